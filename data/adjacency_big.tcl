@@ -0,0 +1,43 @@
+# Adjacency Plot benchmark (3000 nodes, 30 random connections per node)
+
+set nn 3000
+set nc 30
+
+set froms  {}
+set tos    {}
+set values {}
+
+for {set i 0} {$i < $nn} {incr i} {
+  for {set j 0} {$j < $nc} {incr j} {
+    lappend froms  "n$i"
+    lappend tos    "n[expr {int(rand()*$nn)}]"
+    lappend values [expr {1 + int(rand()*100)}]
+  }
+}
+
+set model [load_charts_model -tcl [list $froms $tos $values]]
+
+set_charts_data -model $model -column 0 -header -name value -value From
+set_charts_data -model $model -column 1 -header -name value -value To
+set_charts_data -model $model -column 2 -header -name value -value Value
+
+# auto draw type (image as visible cell count > maxCellObjs)
+set t1 [clock milliseconds]
+
+set plot [create_charts_plot -model $model -type adjacency \
+  -columns {{from From} {to To} {value Value}} -title "adjacency (3000 nodes)"]
+
+print_charts_image -plot $plot -file /tmp/adjacency_big_image.png
+
+set t2 [clock milliseconds]
+
+puts "Image: [expr {$t2 - $t1}]ms"
+
+# cell objects
+set_charts_property -plot $plot -name options.drawType -value CELLS
+
+print_charts_image -plot $plot -file /tmp/adjacency_big_cells.png
+
+set t3 [clock milliseconds]
+
+puts "Cells: [expr {$t3 - $t2}]ms"
@@ -0,0 +1,36 @@
+# Annotation bbox tree benchmark (10000 rectangle annotations)
+#
+# Prints the plot zoomed out and zoomed in and reports the time per print (annotation
+# bboxes are indexed so annotations outside the view are not drawn when zoomed in).
+
+set plot [create_charts_plot -type empty -title "Annotation Tree" \
+  -xmin 0 -ymin 0 -xmax 100 -ymax 100]
+
+set n 10000
+
+for {set i 0} {$i < $n} {incr i} {
+  set x [expr {rand()*100.0}]
+  set y [expr {rand()*100.0}]
+
+  create_charts_rectangle_annotation -plot $plot \
+    -rectangle [list $x $y [expr {$x + 0.5}] [expr {$y + 0.5}]]
+}
+
+get_charts_data -plot $plot -name objects -sync
+
+set dir /tmp/annotation_tree_cull
+
+file mkdir $dir
+
+foreach scale {1 10 10} {
+  set_charts_property -plot $plot -name scaling.data.scale.x -value $scale
+  set_charts_property -plot $plot -name scaling.data.scale.y -value $scale
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file $dir/scale_$scale.png
+
+  set t2 [clock milliseconds]
+
+  puts "scale $scale: [expr {$t2 - $t1}]ms"
+}
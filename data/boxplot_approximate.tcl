@@ -0,0 +1,42 @@
+# Box plot approximate (quantile sketch) benchmark (2000000 values in 4 groups)
+#
+# Creates the box plot with exact and approximate whiskers and reports the time
+# to create the objects for each.
+
+set np 2000000
+
+set gs {}
+set vs {}
+
+proc gauss { } {
+  return [expr {sqrt(-2.0*log(1.0 - rand()))*cos(6.283185307*rand())}]
+}
+
+for {set i 0} {$i < $np} {incr i} {
+  set g [expr {$i % 4}]
+
+  lappend gs "G$g"
+  lappend vs [expr {$g*2.0 + [gauss]*(1.0 + 0.5*$g)}]
+}
+
+set model [load_charts_model -tcl [list $gs $vs]]
+
+set_charts_data -model $model -column 0 -header -name value -value Group
+set_charts_data -model $model -column 1 -header -name value -value Value
+
+foreach approximate {0 1} {
+  set t1 [clock milliseconds]
+
+  set plot [create_charts_plot -model $model -type boxplot \
+    -columns {{group Group} {values Value}} -title "Approximate $approximate" \
+    -properties [list [list approximate.enabled $approximate] \
+                      [list approximate.error 0.005]]]
+
+  set objs [get_charts_data -plot $plot -name objects -sync 1]
+
+  set t2 [clock milliseconds]
+
+  puts "approximate $approximate: [llength $objs] objects [expr {$t2 - $t1}]ms"
+
+  remove_charts_plot -plot $plot
+}
@@ -0,0 +1,40 @@
+# Hierarchical clustering benchmark (20k rows, 8 columns)
+
+set nr 20000
+set nc 8
+
+set columns {}
+
+for {set ic 0} {$ic < $nc} {incr ic} {
+  set values {}
+
+  for {set ir 0} {$ir < $nr} {incr ir} {
+    lappend values [expr {rand()}]
+  }
+
+  lappend columns $values
+}
+
+set model [load_charts_model -tcl $columns]
+
+foreach linkage {ward average complete} {
+  set t1 [clock milliseconds]
+
+  set clusterModel [create_charts_cluster_model -model $model -linkage $linkage]
+
+  set t2 [clock milliseconds]
+
+  puts "$linkage: [expr {$t2 - $t1}]ms"
+}
+
+# memory bounded (centroid) ward
+set t1 [clock milliseconds]
+
+set clusterModel [create_charts_cluster_model -model $model -linkage ward -max_memory 0]
+
+set t2 [clock milliseconds]
+
+puts "ward (memory bounded): [expr {$t2 - $t1}]ms"
+
+set plot [create_charts_plot -model $clusterModel -type dendrogram \
+  -columns {{link Link} {value Size}} -title "ward clusters (20k rows)"]
@@ -0,0 +1,8 @@
+# Hierarchical Clustering Dendrogram (USArrests)
+
+set model [load_charts_model -csv data/USArrests.csv -first_line_header -first_column_header]
+
+set clusterModel [create_charts_cluster_model -model $model -linkage ward -normalize]
+
+set plot [create_charts_plot -model $clusterModel -type dendrogram \
+  -columns {{link Link} {value Size}} -title "ward clusters"]
@@ -0,0 +1,70 @@
+# Contour plot benchmark (400x400 grid)
+#
+# Prints the contour plot as lines and solid bands and reports the time per print.
+# The second print of each type reuses the cached contour geometry.
+
+set n 400
+
+set PI [expr {4.0*atan(1)}]
+
+set rows {}
+
+set row {}
+
+lappend row 0.0
+
+for {set iy 0} {$iy < $n} {incr iy} {
+  lappend row [expr {2.0*$PI*$iy/($n - 1) - $PI}]
+}
+
+lappend rows $row
+
+for {set ix 0} {$ix < $n} {incr ix} {
+  set x [expr {2.0*$PI*$ix/($n - 1) - $PI}]
+
+  set row {}
+
+  lappend row $x
+
+  for {set iy 0} {$iy < $n} {incr iy} {
+    set y [expr {2.0*$PI*$iy/($n - 1) - $PI}]
+
+    lappend row [expr {sin(2.0*$x)*cos(3.0*$y) + 0.2*$x}]
+  }
+
+  lappend rows $row
+}
+
+set file /tmp/contour_tracer.csv
+
+set fp [open $file w]
+
+foreach row $rows {
+  puts $fp [join $row ","]
+}
+
+close $fp
+
+set model [load_charts_model -csv $file]
+
+set plot [create_charts_plot -model $model -type contour -title "Contour Tracer"]
+
+set_charts_property -plot $plot -name contour.numLevels -value 20
+
+get_charts_data -plot $plot -name objects -sync
+
+set dir /tmp/contour_tracer
+
+file mkdir $dir
+
+foreach solid {0 0 1 1} {
+  set_charts_property -plot $plot -name contour.solid -value $solid
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file $dir/solid_$solid.png
+
+  set t2 [clock milliseconds]
+
+  puts "solid $solid: [expr {$t2 - $t1}]ms"
+}
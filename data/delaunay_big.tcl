@@ -0,0 +1,38 @@
+# Delaunay/Voronoi benchmark
+#
+# Compares native (sweep hull and edge flip) triangulation with the 3D convex hull
+# (lifted points) algorithm. The hull algorithm is O(n^2) so it is only timed for
+# the smaller point set.
+
+proc random_points_model { n } {
+  set xvals {}
+  set yvals {}
+
+  for {set i 0} {$i < $n} {incr i} {
+    lappend xvals [expr {1000.0*rand()}]
+    lappend yvals [expr {1000.0*rand()}]
+  }
+
+  return [load_charts_model -tcl [list $xvals $yvals]]
+}
+
+foreach {n algorithms} {5000 {NATIVE HULL3D} 100000 {NATIVE}} {
+  set model [random_points_model $n]
+
+  set plot [create_charts_plot -model $model -type delaunay -columns {{x 0} {y 1}} \
+    -title "delaunay ($n points)"]
+
+  set_charts_property -plot $plot -name voronoi.visible -value 1
+
+  foreach algorithm $algorithms {
+    set t1 [clock milliseconds]
+
+    set_charts_property -plot $plot -name options.algorithm -value $algorithm
+
+    print_charts_image -plot $plot -file /tmp/delaunay_big.png
+
+    set t2 [clock milliseconds]
+
+    puts "$algorithm ($n points): [expr {$t2 - $t1}]ms"
+  }
+}
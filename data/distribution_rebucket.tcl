@@ -0,0 +1,49 @@
+# Distribution plot re-bucket benchmark (1000000 values)
+#
+# Changes the bucket delta and number of auto buckets and reports the time to
+# update the plot (re-buckets cached sorted values without re-reading the model).
+
+set np 1000000
+
+set xs {}
+
+for {set i 0} {$i < $np} {incr i} {
+  lappend xs [expr {rand()*rand()*100.0}]
+}
+
+set model [load_charts_model -tcl [list $xs]]
+
+set_charts_data -model $model -column 0 -header -name value -value X
+
+set plot [create_charts_plot -model $model -type distribution \
+  -columns {{values X}} -title "Distribution Re-bucket"]
+
+get_charts_data -plot $plot -name objects -sync 1
+
+set_charts_property -plot $plot -name bucket.auto -value 0
+
+foreach delta {1 2 5 10 0.5} {
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot -name bucket.delta -value $delta
+
+  set nobjs [llength [get_charts_data -plot $plot -name objects -sync 1]]
+
+  set t2 [clock milliseconds]
+
+  puts "delta $delta: $nobjs objects [expr {$t2 - $t1}]ms"
+}
+
+set_charts_property -plot $plot -name bucket.auto -value 1
+
+foreach n {10 20 50 100} {
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot -name bucket.num -value $n
+
+  set nobjs [llength [get_charts_data -plot $plot -name objects -sync 1]]
+
+  set t2 [clock milliseconds]
+
+  puts "num auto $n: $nobjs objects [expr {$t2 - $t1}]ms"
+}
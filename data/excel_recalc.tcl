@@ -0,0 +1,52 @@
+# Spreadsheet recalculation benchmark (20000 rows)
+#
+# Column B is a chain (each cell adds the cell above) and column C fans out from A1.
+# Reports the time to load the sheet and the time to recalculate after editing a
+# cell at the head of each (only dependent formulas are recalculated in dependency
+# order).
+
+set n 20000
+
+set file /tmp/excel_recalc.csv
+
+set fp [open $file w]
+
+for {set r 1} {$r <= $n} {incr r} {
+  if {$r == 1} {
+    set b {=$A}
+  } else {
+    set b "=\$B[expr {$r - 1}]+\$A"
+  }
+
+  puts $fp "$r,$b,=\$A1*$r"
+}
+
+close $fp
+
+set t1 [clock milliseconds]
+
+set model [load_charts_model -csv $file -spreadsheet]
+
+set t2 [clock milliseconds]
+
+puts "load: [expr {$t2 - $t1}]ms"
+
+# chain: B1 changes all of column B
+set t1 [clock milliseconds]
+
+set_charts_data -model $model -column 0 -row 0 -name value -value 2
+
+set t2 [clock milliseconds]
+
+puts "edit A1 (chain + fan out): [expr {$t2 - $t1}]ms"
+
+# single dependent: A<n> only changes B<n>
+set t1 [clock milliseconds]
+
+set_charts_data -model $model -column 0 -row [expr {$n - 1}] -name value -value 0
+
+set t2 [clock milliseconds]
+
+puts "edit A$n (single): [expr {$t2 - $t1}]ms"
+
+puts "B$n = [get_charts_data -model $model -column 1 -row [expr {$n - 1}] -name value]"
@@ -0,0 +1,43 @@
+# Image plot palette lookup benchmark (300x300 cells)
+#
+# Prints the image plot with several default palettes and reports the time per
+# print (cell fill colors are mapped in one batch from the palette lookup table).
+
+set nr 300
+set nc 300
+
+set columns {}
+
+for {set c 0} {$c < $nc} {incr c} {
+  set values {}
+
+  for {set r 0} {$r < $nr} {incr r} {
+    lappend values [expr {sin($r/20.0)*cos($c/15.0) + rand()*0.2}]
+  }
+
+  lappend columns $values
+}
+
+set model [load_charts_model -tcl $columns]
+
+set plot [create_charts_plot -model $model -type image -title "Image Palette LUT"]
+
+set_charts_property -plot $plot -name cell.drawType -value CELLS
+
+get_charts_data -plot $plot -name objects -sync
+
+set dir /tmp/image_palette_lut
+
+file mkdir $dir
+
+foreach palette {moreland plasma} {
+  set_charts_property -plot $plot -name coloring.defaultPalette -value $palette
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file $dir/$palette.png
+
+  set t2 [clock milliseconds]
+
+  puts "$palette: [expr {$t2 - $t1}]ms"
+}
@@ -0,0 +1,59 @@
+# Image plot raster benchmark (1000x1000 cells)
+#
+# Prints the image plot zoomed out (cells drawn from raster mip levels) and zoomed in
+# (cell objects for visible cells only) and reports the time per print.
+
+set nr 1000
+set nc 1000
+
+set columns {}
+
+for {set c 0} {$c < $nc} {incr c} {
+  set values {}
+
+  for {set r 0} {$r < $nr} {incr r} {
+    lappend values [expr {sin($r/40.0)*cos($c/30.0) + rand()*0.2}]
+  }
+
+  lappend columns $values
+}
+
+set model [load_charts_model -tcl $columns]
+
+set t1 [clock milliseconds]
+
+set plot [create_charts_plot -model $model -type image -title "Image Raster"]
+
+get_charts_data -plot $plot -name objects -sync
+
+set t2 [clock milliseconds]
+
+puts "create: [expr {$t2 - $t1}]ms"
+
+set dir /tmp/image_raster
+
+file mkdir $dir
+
+foreach value {MEAN MAX} {
+  set_charts_property -plot $plot -name cell.rasterValue -value $value
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file $dir/raster_$value.png
+
+  set t2 [clock milliseconds]
+
+  puts "raster $value: [expr {$t2 - $t1}]ms"
+}
+
+# zoom in so visible cell count is small enough for cell objects
+set_charts_property -plot $plot -name scaling.data.scale.x -value 20
+set_charts_property -plot $plot -name scaling.data.scale.y -value 20
+
+set t1 [clock milliseconds]
+
+print_charts_image -plot $plot -file $dir/cells.png
+
+set t2 [clock milliseconds]
+
+puts "cells: [expr {$t2 - $t1}]ms"
@@ -0,0 +1,75 @@
+# Batch print benchmark
+#
+# Prints each plot of a 6x6 plot grid at several sizes using print_charts_image
+# (one file at a time) and print_charts_images (batch) and reports images per second.
+
+set model [load_charts_model -tsv data/scatter.tsv -first_line_header]
+
+set types {scatter barchart boxplot distribution piechart xy}
+
+set plots {}
+
+for {set i 0} {$i < 36} {incr i} {
+  set type [lindex $types [expr {$i % [llength $types]}]]
+
+  switch $type {
+    scatter      { set columns {{x sepalLength} {y sepalWidth} {group species}} }
+    barchart     { set columns {{values sepalLength} {group species}} }
+    boxplot      { set columns {{values {0 1 2 3}}} }
+    distribution { set columns {{values petalLength}} }
+    piechart     { set columns {{values petalWidth} {group species}} }
+    xy           { set columns {{x 0} {y {1 2}}} }
+  }
+
+  lappend plots [create_charts_plot -model $model -type $type -columns $columns \
+    -title "$type $i"]
+}
+
+set view [get_charts_property -plot [lindex $plots 0] -name viewId]
+
+place_charts_plots -view $view -rows 6 -columns 6 $plots
+
+set sizes {{1200 1200} {1800 1800}}
+
+set dir /tmp/print_charts_images
+
+file mkdir $dir
+
+# one file at a time (current view size)
+set t1 [clock milliseconds]
+
+set n 0
+
+foreach size $sizes {
+  foreach plot $plots {
+    print_charts_image -plot $plot -file $dir/single_$n.png
+
+    incr n
+  }
+}
+
+set t2 [clock milliseconds]
+
+puts "print_charts_image : $n images [expr {$t2 - $t1}]ms\
+ ([format %.1f [expr {1000.0*$n/max($t2 - $t1, 1)}]] images/s)"
+
+# batch
+set jobs {}
+
+set n 0
+
+foreach size $sizes {
+  foreach plot $plots {
+    lappend jobs [list plot $plot file $dir/batch_$n.png size $size]
+
+    incr n
+  }
+
+  lappend jobs [list view $view file $dir/batch_view_$n.png size $size]
+
+  incr n
+}
+
+set stats [print_charts_images -jobs $jobs]
+
+puts "print_charts_images: $stats"
@@ -0,0 +1,42 @@
+# Progressive update benchmark (2000000 row scatter plot)
+#
+# Creates the plot with progressive update disabled and enabled and reports the
+# time to the first (sampled) objects and to the final objects.
+
+set np 2000000
+
+set xs {}
+set ys {}
+
+for {set i 0} {$i < $np} {incr i} {
+  lappend xs [expr {rand()*rand()}]
+  lappend ys [expr {rand()}]
+}
+
+set model [load_charts_model -tcl [list $xs $ys]]
+
+set_charts_data -model $model -column 0 -header -name value -value X
+set_charts_data -model $model -column 1 -header -name value -value Y
+
+foreach progressive {0 1} {
+  set t1 [clock milliseconds]
+
+  set plot [create_charts_plot -model $model -type scatter \
+    -columns {{x X} {y Y}} -title "Progressive $progressive" \
+    -properties [list [list progressive.enabled $progressive]]]
+
+  set nobjs1 [llength [get_charts_data -plot $plot -name objects]]
+
+  set t2 [clock milliseconds]
+
+  qt_sync
+
+  set nobjs2 [llength [get_charts_data -plot $plot -name objects -sync 1]]
+
+  set t3 [clock milliseconds]
+
+  puts "progressive $progressive: first $nobjs1 objects [expr {$t2 - $t1}]ms,\
+        final $nobjs2 objects [expr {$t3 - $t1}]ms"
+
+  remove_charts_plot -plot $plot
+}
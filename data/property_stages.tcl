@@ -0,0 +1,68 @@
+# Property update stages trace (1000000 point xy plot)
+#
+# Changes style and data properties with stage trace enabled and reports the
+# declared, requested and applied stages of each change and the number of times
+# each stage ran (objects are not recreated for style changes).
+
+set np 1000000
+
+set xs {}
+set ys {}
+
+for {set i 0} {$i < $np} {incr i} {
+  lappend xs [expr {rand()}]
+  lappend ys [expr {rand()*rand()}]
+}
+
+set model [load_charts_model -tcl [list $xs $ys]]
+
+set_charts_data -model $model -column 0 -header -name value -value X
+set_charts_data -model $model -column 1 -header -name value -value Y
+
+set plot [create_charts_plot -model $model -type xy \
+  -columns {{x X} {y Y}} -title "Property Stages"]
+
+set_charts_property -plot $plot -name points.visible -value 1
+set_charts_property -plot $plot -name lines.visible  -value 0
+
+get_charts_data -plot $plot -name objects -sync 1
+
+set_charts_data -plot $plot -name stage_trace -value 1
+
+proc stageCounts { plot } {
+  set counts {}
+
+  foreach count [get_charts_data -plot $plot -name stage_counts] {
+    lappend counts "[lindex $count 0]=[lindex $count 1]"
+  }
+
+  return [join $counts " "]
+}
+
+foreach {name value} {
+  points.symbol.fill.color   {palette 0.5}
+  points.symbol.stroke.alpha 0.5
+  plotBox.fill.color         {interface 0.1}
+  xaxis.grid.lines.major.visible 1
+  points.symbol.size         8px
+  filter.bad.value           0
+} {
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot -name $name -value $value
+
+  get_charts_data -plot $plot -name objects -sync 1
+
+  qt_sync
+
+  set t2 [clock milliseconds]
+
+  puts "$name: [get_charts_data -plot $plot -name property_stages -data $name]\
+        [expr {$t2 - $t1}]ms"
+  puts "  [stageCounts $plot]"
+}
+
+foreach entry [get_charts_data -plot $plot -name stage_trace] {
+  puts "[lindex $entry 0]: declared [lindex $entry 1]\
+        requested [lindex $entry 2] applied [lindex $entry 3]"
+}
@@ -0,0 +1,30 @@
+# 3D scatter rotate benchmark (500000 points)
+#
+# Rotates the camera and reports the time to print the plot for each angle
+# (points are projected in parallel batches and depth sorted with a radix sort).
+
+set model [load_charts_model -expr -num_rows 500000]
+
+process_charts_model -model $model -add -expr "rnorm(0.0, 0.5)" -header "x"
+process_charts_model -model $model -add -expr "rnorm(1.0, 1.0)" -header "y"
+process_charts_model -model $model -add -expr "rnorm(2.0, 2.0)" -header "z"
+
+set plot [create_charts_plot -model $model -type scatter3d -columns {{x 1} {y 2} { z 3}}]
+
+get_charts_data -plot $plot -name objects -sync
+
+set dir /tmp/scatter_3d_rotate
+
+file mkdir $dir
+
+foreach angle {0 30 60 90 120} {
+  set_charts_property -plot $plot -name camera.rotateZ -value $angle
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file $dir/rotate_$angle.png
+
+  set t2 [clock milliseconds]
+
+  puts "rotate $angle: [expr {$t2 - $t1}]ms"
+}
@@ -0,0 +1,52 @@
+# Scatter plot pixel aggregate benchmark (1000000 points in gaussian clusters)
+#
+# Draws the points as symbols and as a per pixel aggregate image and reports
+# the draw time of each.
+
+set np 1000000
+
+set xs {}
+set ys {}
+set vs {}
+
+proc gauss { } {
+  return [expr {sqrt(-2.0*log(1.0 - rand()))*cos(6.283185307*rand())}]
+}
+
+for {set i 0} {$i < $np} {incr i} {
+  set c [expr {$i % 5}]
+
+  lappend xs [expr {$c*2.0 + [gauss]*(0.2 + 0.1*$c)}]
+  lappend ys [expr {$c*1.0 + [gauss]*(0.5 - 0.05*$c)}]
+  lappend vs [expr {rand()}]
+}
+
+set model [load_charts_model -tcl [list $xs $ys $vs]]
+
+set_charts_data -model $model -column 0 -header -name value -value X
+set_charts_data -model $model -column 1 -header -name value -value Y
+set_charts_data -model $model -column 2 -header -name value -value V
+
+set plot [create_charts_plot -model $model -type scatter \
+  -columns {{x X} {y Y}} -title "Scatter Aggregate"]
+
+foreach type {SYMBOLS AGGREGATE} {
+  set_charts_property -plot $plot -name options.plotType -value $type
+
+  set t1 [clock milliseconds]
+
+  print_charts_image -plot $plot -file /tmp/scatter_[string tolower $type].png
+
+  set t2 [clock milliseconds]
+
+  puts "$type: [expr {$t2 - $t1}]ms"
+}
+
+# log shaded mean of value column
+set_charts_property -plot $plot -name columns.color   -value V
+set_charts_property -plot $plot -name aggregate.value -value MEAN
+set_charts_property -plot $plot -name aggregate.shade -value LOG
+
+qt_sync
+
+print_charts_image -plot $plot -file /tmp/scatter_aggregate_mean.png
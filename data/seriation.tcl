@@ -0,0 +1,31 @@
+# Matrix seriation benchmark (adjacency and correlation plot sort types)
+
+source data/adjacency_big.tcl
+
+foreach sortType {SPECTRAL RCM CLUSTER NAME SPECTRAL} {
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot -name options.sortType -value $sortType
+
+  print_charts_image -plot $plot -file /tmp/adjacency_big_[string tolower $sortType].png
+
+  set t2 [clock milliseconds]
+
+  puts "Adjacency $sortType: [expr {$t2 - $t1}]ms"
+}
+
+set model1 [load_charts_model -csv data/winequality-white.csv -first_line_header -separator {;}]
+
+set plot1 [create_charts_plot -type correlation -model $model1 -title "Wine Correlation"]
+
+foreach sortType {SPECTRAL RCM CLUSTER NONE} {
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot1 -name options.sortType -value $sortType
+
+  print_charts_image -plot $plot1 -file /tmp/correlation_[string tolower $sortType].png
+
+  set t2 [clock milliseconds]
+
+  puts "Correlation $sortType: [expr {$t2 - $t1}]ms"
+}
@@ -0,0 +1,40 @@
+# Virtualized table plot benchmark (100000 rows)
+#
+# Reports the time to create the table objects and the number of objects with and
+# without virtualized rows (only rows in the visible scroll window plus a margin have
+# objects and column widths are estimated from sampled rows).
+
+set n 100000
+
+set file /tmp/table_virtualized.csv
+
+set fp [open $file w]
+
+puts $fp "id,name,value"
+
+for {set r 0} {$r < $n} {incr r} {
+  puts $fp "$r,name_[expr {int(rand()*1000)}],[expr {rand()*1000.0}]"
+}
+
+close $fp
+
+set model [load_charts_model -csv $file -first_line_header]
+
+foreach virtualized {0 1} {
+  set plot [create_charts_plot -type table -model $model -columns {{columns {0 1 2}}}]
+
+  set_charts_property -plot $plot -name options.mode    -value NORMAL
+  set_charts_property -plot $plot -name options.maxRows -value $n
+
+  set t1 [clock milliseconds]
+
+  set_charts_property -plot $plot -name virtualized.enabled -value $virtualized
+
+  set objs [get_charts_data -plot $plot -name objects -sync]
+
+  set t2 [clock milliseconds]
+
+  puts "virtualized $virtualized: [llength $objs] objects, [expr {$t2 - $t1}]ms"
+
+  remove_charts_plot -plot $plot
+}
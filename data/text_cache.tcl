@@ -0,0 +1,33 @@
+# Text cache benchmark (label heavy sankey and adjacency plots)
+#
+# Redraws each plot with the text cache disabled and enabled and reports the
+# cache hit rate and estimated time saved.
+
+set model [load_charts_model -csv data/sankey_energy.csv -comment_header \
+ -column_type {{{0 name_pair}}}]
+
+set plot1 [create_charts_plot -model $model -type sankey    -columns {{link 0} {value 1}}]
+set plot2 [create_charts_plot -model $model -type adjacency -columns {{link 0} {value 1}}]
+
+set view [get_charts_property -plot $plot1 -name viewId]
+
+place_charts_plots -view $view -columns 2 [list $plot1 $plot2]
+
+set n 20
+
+foreach enabled {0 1} {
+  set_charts_data -name text_cache -value $enabled
+  set_charts_data -name reset_text_cache
+
+  set t1 [clock milliseconds]
+
+  for {set i 0} {$i < $n} {incr i} {
+    print_charts_image -view $view -file /tmp/text_cache.png
+  }
+
+  set t2 [clock milliseconds]
+
+  puts "text_cache $enabled: [expr {$t2 - $t1}]ms"
+}
+
+puts "text_cache_stats: [get_charts_data -name text_cache_stats]"
@@ -0,0 +1,46 @@
+# TreeMap Plot layout benchmark (1M leaves, 100 x 100 x 100 hierarchy)
+
+set n1 100
+set n2 100
+set n3 100
+
+set names  {}
+set values {}
+
+for {set i1 0} {$i1 < $n1} {incr i1} {
+  for {set i2 0} {$i2 < $n2} {incr i2} {
+    for {set i3 0} {$i3 < $n3} {incr i3} {
+      lappend names  "a$i1/b$i2/c$i3"
+      lappend values [expr {1 + int(rand()*100)}]
+    }
+  }
+}
+
+set model [load_charts_model -tcl [list $names $values]]
+
+set_charts_data -model $model -column 0 -header -name value -value Name
+set_charts_data -model $model -column 1 -header -name value -value Value
+
+set t1 [clock milliseconds]
+
+set plot [create_charts_plot -model $model -type treemap \
+  -columns {{names Name} {value Value}} -title "tree map (1M leaves)"]
+
+print_charts_image -plot $plot -file /tmp/treemap_big.png
+
+set t2 [clock milliseconds]
+
+puts "Load and Layout: [expr {$t2 - $t1}]ms"
+
+# relayout only (reuses loaded nodes and cached normalized layouts)
+set nl 10
+
+for {set i 0} {$i < $nl} {incr i} {
+  set_charts_property -plot $plot -name margins.box -value "[expr {$i % 3 + 1}]px"
+
+  print_charts_image -plot $plot -file /tmp/treemap_big.png
+}
+
+set t3 [clock milliseconds]
+
+puts "Relayout: [expr {($t3 - $t2)/$nl}]ms"
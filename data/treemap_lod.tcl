@@ -0,0 +1,43 @@
+# Tree Map and Sunburst level of detail benchmark (200000 files in 3 level directory tree)
+#
+# Draws each plot with level of detail disabled and enabled and reports the
+# number of plot objects and draw time.
+
+set nd 20
+set nf 500
+
+set names  {}
+set values {}
+
+for {set i 0} {$i < $nd} {incr i} {
+  for {set j 0} {$j < $nd} {incr j} {
+    for {set k 0} {$k < $nf} {incr k} {
+      lappend names  "d$i/d$j/f$k"
+      lappend values [expr {1 + int(rand()*rand()*1000)}]
+    }
+  }
+}
+
+set model [load_charts_model -tcl [list $names $values]]
+
+set_charts_data -model $model -column 0 -header -name value -value Name
+set_charts_data -model $model -column 1 -header -name value -value Size
+
+foreach type {treemap sunburst} {
+  set plot [create_charts_plot -model $model -type $type \
+    -columns {{names Name} {value Size}} -title "$type (lod)"]
+
+  foreach lod {0 1} {
+    set_charts_property -plot $plot -name lod.enabled -value $lod
+
+    set t1 [clock milliseconds]
+
+    print_charts_image -plot $plot -file /tmp/${type}_lod_$lod.png
+
+    set t2 [clock milliseconds]
+
+    set nobjs [llength [get_charts_data -plot $plot -name objects]]
+
+    puts "$type lod $lod: $nobjs objects [expr {$t2 - $t1}]ms"
+  }
+}
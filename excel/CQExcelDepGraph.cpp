@@ -0,0 +1,404 @@
+#include <CQExcelDepGraph.h>
+#include <CQExcelModel.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace CQExcel {
+
+DepGraph::
+DepGraph(Model *model) :
+ model_(model)
+{
+}
+
+void
+DepGraph::
+setFormula(const Cell &cell, const QString &expr)
+{
+  clearFormula(cell);
+
+  auto refs = parseRefs(expr);
+
+  formulas_[cell] = refs;
+
+  addDeps(cell, *refs);
+}
+
+void
+DepGraph::
+clearFormula(const Cell &cell)
+{
+  auto p = formulas_.find(cell);
+  if (p == formulas_.end()) return;
+
+  removeDeps(cell, *(*p).second);
+
+  formulas_.erase(p);
+}
+
+void
+DepGraph::
+clear()
+{
+  parseCache_.clear();
+  formulas_  .clear();
+  cellDeps_  .clear();
+  colDeps_   .clear();
+  volatile_  .clear();
+}
+
+bool
+DepGraph::
+hasFormula(const Cell &cell) const
+{
+  return (formulas_.find(cell) != formulas_.end());
+}
+
+void
+DepGraph::
+dependents(const Cell &cell, Cells &cells) const
+{
+  auto pc = cellDeps_.find(cell);
+
+  if (pc != cellDeps_.end()) {
+    for (const auto &cell1 : (*pc).second)
+      cells.push_back(cell1);
+  }
+
+  auto pr = colDeps_.find(cell.col);
+
+  if (pr != colDeps_.end()) {
+    for (const auto &pd : (*pr).second) {
+      const auto &rowRange = pd.second;
+
+      if (cell.row >= rowRange.row1 && cell.row <= rowRange.row2)
+        cells.push_back(pd.first);
+    }
+  }
+}
+
+void
+DepGraph::
+recalcLevels(const Cells &changed, CellLevels &levels) const
+{
+  levels.clear();
+
+  // dirty mark formula cells reachable from changed cells (and volatile cells)
+  CellSet dirty;
+  Cells   stack;
+
+  for (const auto &cell : changed)
+    stack.push_back(cell);
+
+  for (const auto &cell : volatile_) {
+    if (dirty.insert(cell).second)
+      stack.push_back(cell);
+  }
+
+  Cells cells;
+
+  while (! stack.empty()) {
+    auto cell = stack.back();
+
+    stack.pop_back();
+
+    cells.clear();
+
+    dependents(cell, cells);
+
+    for (const auto &cell1 : cells) {
+      if (dirty.insert(cell1).second)
+        stack.push_back(cell1);
+    }
+  }
+
+  calcLevels(dirty, levels);
+}
+
+void
+DepGraph::
+allLevels(CellLevels &levels) const
+{
+  levels.clear();
+
+  CellSet dirty;
+
+  for (const auto &pf : formulas_)
+    dirty.insert(pf.first);
+
+  calcLevels(dirty, levels);
+}
+
+void
+DepGraph::
+calcLevels(const CellSet &dirty, CellLevels &levels) const
+{
+  // edges between dirty cells (precedent -> dependent) and dependent in degree
+  std::map<Cell, Cells> edges;
+  std::map<Cell, int>   inDegree;
+
+  for (const auto &cell : dirty)
+    inDegree[cell] = 0;
+
+  Cells cells;
+
+  for (const auto &cell : dirty) {
+    cells.clear();
+
+    dependents(cell, cells);
+
+    for (const auto &cell1 : cells) {
+      auto pd = inDegree.find(cell1);
+      if (pd == inDegree.end()) continue;
+
+      edges[cell].push_back(cell1);
+
+      ++(*pd).second;
+    }
+  }
+
+  //---
+
+  // topological sort (Kahn) by levels
+  Cells level;
+
+  for (const auto &pd : inDegree) {
+    if (pd.second == 0)
+      level.push_back(pd.first);
+  }
+
+  size_t numDone = 0;
+
+  while (! level.empty()) {
+    Cells nextLevel;
+
+    for (const auto &cell : level) {
+      auto pe = edges.find(cell);
+      if (pe == edges.end()) continue;
+
+      for (const auto &cell1 : (*pe).second) {
+        if (--inDegree[cell1] == 0)
+          nextLevel.push_back(cell1);
+      }
+    }
+
+    numDone += level.size();
+
+    levels.push_back(std::move(level));
+
+    std::sort(nextLevel.begin(), nextLevel.end());
+
+    level = std::move(nextLevel);
+  }
+
+  // remaining cells are in (or depend on) a cycle
+  if (numDone < dirty.size()) {
+    Cells cycleCells;
+
+    for (const auto &pd : inDegree) {
+      if (pd.second > 0)
+        cycleCells.push_back(pd.first);
+    }
+
+    levels.push_back(std::move(cycleCells));
+  }
+}
+
+DepGraph::RefsP
+DepGraph::
+parseRefs(const QString &expr)
+{
+  auto pc = parseCache_.find(expr);
+
+  if (pc != parseCache_.end())
+    return (*pc).second;
+
+  //---
+
+  auto refs = std::make_shared<Refs>();
+
+  auto isWordChar = [](const QChar &c) {
+    return (c.isLetterOrNumber() || c == '_');
+  };
+
+  int len = expr.length();
+  int i   = 0;
+
+  while (i < len) {
+    auto c = expr[i];
+
+    // command substitution can reference any cell
+    if      (c == '[') {
+      refs->isVolatile = true;
+
+      ++i;
+    }
+    // variable reference ($A1 or $A)
+    else if (c == '$') {
+      ++i;
+
+      QString name;
+
+      if (i < len && expr[i] == '{') {
+        ++i;
+
+        while (i < len && expr[i] != '}')
+          name += expr[i++];
+
+        ++i;
+      }
+      else {
+        while (i < len && isWordChar(expr[i]))
+          name += expr[i++];
+      }
+
+      int row, col;
+
+      if      (model_->decodeCellName(name, row, col))
+        refs->cells.push_back(Cell(row, col));
+      else if (model_->decodeColumnName(name, col))
+        refs->rowCols.push_back(col);
+      else
+        refs->isVolatile = true;
+    }
+    // skip number (so exponent is not read as cell name)
+    else if (c.isDigit() || c == '.') {
+      while (i < len && (isWordChar(expr[i]) || expr[i] == '.'))
+        ++i;
+    }
+    // cell name, cell range or function name
+    else if (c.isLetter()) {
+      QString word;
+
+      while (i < len && (isWordChar(expr[i]) || expr[i] == ':'))
+        word += expr[i++];
+
+      int row1, col1, row2, col2;
+
+      if      (model_->decodeCellRange(word, row1, col1, row2, col2)) {
+        Refs::Range range;
+
+        range.row1 = std::min(row1, row2); range.col1 = std::min(col1, col2);
+        range.row2 = std::max(row1, row2); range.col2 = std::max(col1, col2);
+
+        refs->ranges.push_back(range);
+      }
+      else if (model_->decodeCellName(word, row1, col1)) {
+        refs->cells.push_back(Cell(row1, col1));
+      }
+      else if (word == "eval") {
+        refs->isVolatile = true;
+      }
+      else if (word == "sumup") {
+        // sumup("<column>") uses column cells up to current row
+        QString name;
+
+        while (i < len && ! isWordChar(expr[i]) && expr[i] != ')')
+          ++i;
+
+        while (i < len && isWordChar(expr[i]))
+          name += expr[i++];
+
+        int col;
+
+        if (model_->decodeColumnName(name, col))
+          refs->upCols.push_back(col);
+        else
+          refs->isVolatile = true;
+      }
+    }
+    else
+      ++i;
+  }
+
+  parseCache_[expr] = refs;
+
+  return refs;
+}
+
+void
+DepGraph::
+addDeps(const Cell &cell, const Refs &refs)
+{
+  auto addColDep = [&](int col, int row1, int row2) {
+    auto &rangeDeps = colDeps_[col];
+
+    auto pr = rangeDeps.find(cell);
+
+    if (pr == rangeDeps.end()) {
+      RowRange rowRange;
+
+      rowRange.row1 = row1;
+      rowRange.row2 = row2;
+
+      rangeDeps[cell] = rowRange;
+    }
+    else {
+      auto &rowRange = (*pr).second;
+
+      rowRange.row1 = std::min(rowRange.row1, row1);
+      rowRange.row2 = std::max(rowRange.row2, row2);
+    }
+  };
+
+  for (const auto &cell1 : refs.cells)
+    cellDeps_[cell1].insert(cell);
+
+  for (const auto &col : refs.rowCols)
+    cellDeps_[Cell(cell.row, col)].insert(cell);
+
+  for (const auto &range : refs.ranges) {
+    for (int col = range.col1; col <= range.col2; ++col)
+      addColDep(col, range.row1, range.row2);
+  }
+
+  for (const auto &col : refs.upCols)
+    addColDep(col, 0, cell.row);
+
+  if (refs.isVolatile)
+    volatile_.insert(cell);
+}
+
+void
+DepGraph::
+removeDeps(const Cell &cell, const Refs &refs)
+{
+  auto removeCellDep = [&](const Cell &cell1) {
+    auto pc = cellDeps_.find(cell1);
+    if (pc == cellDeps_.end()) return;
+
+    (*pc).second.erase(cell);
+
+    if ((*pc).second.empty())
+      cellDeps_.erase(pc);
+  };
+
+  auto removeColDep = [&](int col) {
+    auto pr = colDeps_.find(col);
+    if (pr == colDeps_.end()) return;
+
+    (*pr).second.erase(cell);
+
+    if ((*pr).second.empty())
+      colDeps_.erase(pr);
+  };
+
+  for (const auto &cell1 : refs.cells)
+    removeCellDep(cell1);
+
+  for (const auto &col : refs.rowCols)
+    removeCellDep(Cell(cell.row, col));
+
+  for (const auto &range : refs.ranges) {
+    for (int col = range.col1; col <= range.col2; ++col)
+      removeColDep(col);
+  }
+
+  for (const auto &col : refs.upCols)
+    removeColDep(col);
+
+  volatile_.erase(cell);
+}
+
+}
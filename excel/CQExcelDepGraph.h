@@ -0,0 +1,127 @@
+#ifndef CQExcelDepGraph_H
+#define CQExcelDepGraph_H
+
+#include <QString>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace CQExcel {
+
+class Model;
+
+// formula cell dependency graph
+//
+// Cell references are parsed from formula text (parse cached by text). Precedents of
+// a formula are single cells ($A1, cell("A1")), current row column cells ($A), cell
+// ranges ("A1:B3") and sumup column ranges. Formulas which can reference any cell
+// (eval or command substitution) are volatile and always recalculated.
+//
+// Recalculation returns the dirty formula cells in topological levels. Cells in a
+// level only depend on cells in earlier levels. Cells in a cycle are added as a last
+// level in row/column order.
+class DepGraph {
+ public:
+  struct Cell {
+    int row { 0 };
+    int col { 0 };
+
+    Cell() = default;
+
+    Cell(int row, int col) :
+     row(row), col(col) {
+    }
+
+    bool operator<(const Cell &rhs) const {
+      return (row < rhs.row || (row == rhs.row && col < rhs.col));
+    }
+
+    bool operator==(const Cell &rhs) const {
+      return (row == rhs.row && col == rhs.col);
+    }
+  };
+
+  using Cells      = std::vector<Cell>;
+  using CellLevels = std::vector<Cells>;
+
+ public:
+  DepGraph(Model *model);
+
+  Model *model() const { return model_; }
+
+  //! set/clear formula for cell
+  void setFormula(const Cell &cell, const QString &expr);
+  void clearFormula(const Cell &cell);
+
+  void clear();
+
+  bool hasFormula(const Cell &cell) const;
+
+  //! get formula cells which directly reference cell
+  void dependents(const Cell &cell, Cells &cells) const;
+
+  //! get formula cells to recalculate after changed cells (changed cells not included
+  //! unless in a cycle)
+  void recalcLevels(const Cells &changed, CellLevels &levels) const;
+
+  //! get all formula cells in recalculation order
+  void allLevels(CellLevels &levels) const;
+
+  int numFormulas() const { return int(formulas_.size()); }
+  int numParsed  () const { return int(parseCache_.size()); }
+
+ private:
+  // parsed references (column refs relative to formula row)
+  struct Refs {
+    struct Range {
+      int row1 { 0 };
+      int col1 { 0 };
+      int row2 { 0 };
+      int col2 { 0 };
+    };
+
+    using Ranges = std::vector<Range>;
+    using Cols   = std::vector<int>;
+
+    Cells  cells;                 // absolute cells
+    Cols   rowCols;               // current row cells
+    Ranges ranges;                // absolute ranges
+    Cols   upCols;                // column cells up to current row
+    bool   isVolatile { false };  // can reference any cell
+  };
+
+  using RefsP = std::shared_ptr<Refs>;
+
+  struct RowRange {
+    int row1 { 0 };
+    int row2 { 0 };
+  };
+
+  using ParseCache = std::map<QString, RefsP>;
+  using Formulas   = std::map<Cell, RefsP>;
+  using CellSet    = std::set<Cell>;
+  using CellDeps   = std::map<Cell, CellSet>;
+  using RangeDeps  = std::map<Cell, RowRange>;
+  using ColDeps    = std::map<int, RangeDeps>;
+
+ private:
+  RefsP parseRefs(const QString &expr);
+
+  void addDeps   (const Cell &cell, const Refs &refs);
+  void removeDeps(const Cell &cell, const Refs &refs);
+
+  void calcLevels(const CellSet &dirty, CellLevels &levels) const;
+
+ private:
+  Model*     model_ { nullptr };
+  ParseCache parseCache_; // parsed refs by formula text
+  Formulas   formulas_;   // parsed refs by formula cell
+  CellDeps   cellDeps_;   // formula cells by referenced cell
+  ColDeps    colDeps_;    // formula cells and row range by referenced column
+  CellSet    volatile_;   // volatile formula cells
+};
+
+}
+
+#endif
@@ -19,6 +19,12 @@ Model(int nc, int nr) :
   init(nc, nr);
 }
 
+Model::
+~Model()
+{
+  delete depGraph_;
+}
+
 void
 Model::
 init(int nc, int nr)
@@ -27,6 +33,8 @@ init(int nc, int nr)
 
   tcl_ = new Tcl(this);
 
+  depGraph_ = new DepGraph(this);
+
   //---
 
   for (int c = 0; c < nc; ++c) {
@@ -149,23 +157,9 @@ setData(const QModelIndex &index, const QVariant &value, int role)
 
   //---
 
-  // update associated calculated cells
-  // TODO: only those affected by this cell
-  if (role == Qt::DisplayRole || role == Qt::EditRole) {
-    for (const auto &pr : expr_) {
-      int r = pr.first;
-
-      for (const auto &pc : pr.second) {
-        int c = pc.first;
-
-        if (pc.second.length()) {
-          auto ind = this->index(r, c, QModelIndex());
-
-          updateCellExpression(ind, pc.second);
-        }
-      }
-    }
-  }
+  // update calculated cells affected by this cell
+  if (role == Qt::DisplayRole || role == Qt::EditRole)
+    updateDependentCells(index);
 
   return rc;
 }
@@ -210,6 +204,8 @@ setCellExpression(const QModelIndex &ind, const QString &expr)
 
   expr_[ind.row()][ind.column()] = expr;
 
+  depGraph_->setFormula(DepGraph::Cell(ind.row(), ind.column()), expr);
+
   //---
 
   updateCellExpression(ind, expr);
@@ -222,6 +218,8 @@ clearCellExpression(const QModelIndex &ind)
   assert(ind.model() == this);
 
   expr_[ind.row()][ind.column()] = "";
+
+  depGraph_->clearFormula(DepGraph::Cell(ind.row(), ind.column()));
 }
 
 void
@@ -239,7 +237,7 @@ updateCellExpression(const QModelIndex &ind, const QString &text)
 
   QVariant res;
 
-  if (! tcl->evalExpr(expr, res, /*showError*/true))
+  if (! tcl->evalCachedExpr(expr, res, /*showError*/true))
     return;
 
   auto ind1 = index(ind.row(), ind.column(), QModelIndex());
@@ -247,6 +245,52 @@ updateCellExpression(const QModelIndex &ind, const QString &text)
   CQDataModel::setData(ind1, res, Qt::DisplayRole);
 }
 
+void
+Model::
+updateDependentCells(const QModelIndex &ind)
+{
+  assert(ind.model() == this);
+
+  DepGraph::Cells changed;
+
+  changed.push_back(DepGraph::Cell(ind.row(), ind.column()));
+
+  DepGraph::CellLevels levels;
+
+  depGraph_->recalcLevels(changed, levels);
+
+  updateCellLevels(levels);
+}
+
+void
+Model::
+recalcAll()
+{
+  DepGraph::CellLevels levels;
+
+  depGraph_->allLevels(levels);
+
+  updateCellLevels(levels);
+}
+
+void
+Model::
+updateCellLevels(const DepGraph::CellLevels &levels)
+{
+  // cells in a level are independent but share the model's interpreter so are
+  // evaluated in turn (levels in dependency order)
+  for (const auto &level : levels) {
+    for (const auto &cell : level) {
+      auto ind = index(cell.row, cell.col, QModelIndex());
+
+      auto expr = cellExpression(ind);
+
+      if (expr.length())
+        updateCellExpression(ind, expr);
+    }
+  }
+}
+
 void
 Model::
 getCellExpressions(CellExpr &cellExpr) const
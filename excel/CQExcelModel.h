@@ -2,6 +2,7 @@
 #define CQExcelModel_H
 
 #include <CQDataModel.h>
+#include <CQExcelDepGraph.h>
 
 #include <QPen>
 #include <QBrush>
@@ -69,9 +70,12 @@ class Model : public CQDataModel {
  public:
   Model(QObject *parent, int nc=100, int nr=100);
   Model(int nc=100, int nr=100);
+ ~Model();
 
   Tcl *tcl() const { return tcl_; }
 
+  DepGraph *depGraph() const { return depGraph_; }
+
   void addRow   (int n=1) override;
   void addColumn(int n=1) override;
 
@@ -86,6 +90,9 @@ class Model : public CQDataModel {
 
   void getCellExpressions(CellExpr &cellExpr) const;
 
+  // recalculate all cell expressions in dependency order
+  void recalcAll();
+
   //---
 
   bool hasCellStyle(const QModelIndex &ind) const;
@@ -136,6 +143,10 @@ class Model : public CQDataModel {
 
   void updateCellExpression(const QModelIndex &index, const QString &expr);
 
+  void updateDependentCells(const QModelIndex &index);
+
+  void updateCellLevels(const DepGraph::CellLevels &levels);
+
  private:
   using ColExpr     = std::map<int, QString>;
   using RowColExpr  = std::map<int, ColExpr>;
@@ -143,7 +154,8 @@ class Model : public CQDataModel {
   using ColumnNames = std::map<int, QString>;
   using TraceNames  = std::set<QString>;
 
-  Tcl*        tcl_  { nullptr };
+  Tcl*        tcl_      { nullptr };
+  DepGraph*   depGraph_ { nullptr };
   RowColExpr  expr_;
   RowNames    rowNames_;
   ColumnNames columnNames_;
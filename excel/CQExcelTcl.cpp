@@ -21,6 +21,55 @@ Tcl(Model *model) :
   createExprCommand("sumup"  , (CQTcl::ObjCmdProc) &Tcl::sumUpCmd  , this);
 }
 
+Tcl::
+~Tcl()
+{
+  clearExprCache();
+}
+
+bool
+Tcl::
+evalCachedExpr(const QString &expr, QVariant &res, bool showError)
+{
+  // expression object keeps compiled byte code so shared formulas are only compiled once
+  auto p = exprObjs_.find(expr);
+
+  if (p == exprObjs_.end()) {
+    auto *obj = Tcl_NewStringObj(expr.toLatin1().constData(), -1);
+
+    Tcl_IncrRefCount(obj);
+
+    p = exprObjs_.insert(p, ExprObjs::value_type(expr, obj));
+  }
+
+  Tcl_Obj *resObj = nullptr;
+
+  int rc = Tcl_ExprObj(interp(), (*p).second, &resObj);
+
+  if (rc != TCL_OK) {
+    if (showError)
+      std::cerr << errorInfo(rc).toStdString() << std::endl;
+
+    return false;
+  }
+
+  res = variantFromObj(resObj);
+
+  Tcl_DecrRefCount(resObj);
+
+  return true;
+}
+
+void
+Tcl::
+clearExprCache()
+{
+  for (auto &pe : exprObjs_)
+    Tcl_DecrRefCount(pe.second);
+
+  exprObjs_.clear();
+}
+
 int
 Tcl::
 sumCmd(ClientData clientData, Tcl_Interp *, int objc, const Tcl_Obj **objv)
@@ -2,6 +2,7 @@
 #define CQExcelTcl_H
 
 #include <CQTclUtil.h>
+#include <map>
 
 namespace CQExcel {
 
@@ -10,6 +11,7 @@ class Model;
 class Tcl : public CQTcl {
  public:
   Tcl(Model *model);
+ ~Tcl();
 
   Model *model() const { return model_; }
 
@@ -19,6 +21,11 @@ class Tcl : public CQTcl {
   int column() const { return column_; }
   void setColumn(int i) { column_ = i; }
 
+  // evaluate expression (compiled expression cached by expression text)
+  bool evalCachedExpr(const QString &expr, QVariant &res, bool showError=false);
+
+  void clearExprCache();
+
  private:
   void handleTrace(const char *name, int flags) override;
 
@@ -39,9 +46,12 @@ class Tcl : public CQTcl {
   void argValues(int objc, const Tcl_Obj **objv, QVariantList &values) const;
 
  private:
-  Model* model_  { nullptr };
-  int    row_    { 0 };
-  int    column_ { 0 };
+  using ExprObjs = std::map<QString, Tcl_Obj *>;
+
+  Model*   model_  { nullptr };
+  int      row_    { 0 };
+  int      column_ { 0 };
+  ExprObjs exprObjs_;
 };
 
 //---
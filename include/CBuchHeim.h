@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <iostream>
+#include <cstddef>
 
 namespace CBuchHeim {
 
@@ -216,6 +217,162 @@ class DrawTree {
   double    y2_            { 0.0 };
 };
 
+//---
+
+/*!
+ * Iterative Buchheim (improved Walker) tree layout using flat per-node arrays
+ * (no recursion or per node allocation) for large trees.
+ *
+ * Nodes are added with addNode (root first) and identified by index. Children of
+ * closed nodes are ignored by the layout. After open state changes, replace(i)
+ * re-lays out only the changed subtree and the path to the root (changes made at
+ * each ancestor level are recorded so they can be undone and redone).
+ */
+class FlatTree {
+ public:
+  using Inds  = std::vector<int>;
+  using Reals = std::vector<double>;
+
+ public:
+  FlatTree() { }
+
+  //! remove all nodes
+  void clear();
+
+  //! add node (parent -1 for root) and return node index
+  int addNode(int parent=-1);
+
+  int numNodes() const { return int(parent_.size()); }
+
+  int parent(int i) const { return parent_[size_t(i)]; }
+
+  int numChildren(int i) const { return numChildren_[size_t(i)]; }
+
+  //! get/set node open (children visible)
+  bool isOpen(int i) const { return open_[size_t(i)]; }
+  void setOpen(int i, bool b) { open_[size_t(i)] = b; }
+
+  //! get/set distance between siblings
+  double distance() const { return distance_; }
+  void setDistance(double d) { distance_ = d; }
+
+  //---
+
+  //! full layout
+  void place();
+
+  //! incremental layout after change to open state (or children) of node i
+  void replace(int i);
+
+  //! is layout valid
+  bool isPlaced() const { return placed_; }
+
+  //---
+
+  //! visible nodes (pre-order) of last layout
+  const Inds &visibleNodes() const { return visible_; }
+
+  //! layout position (x) and depth (y)
+  double x(int i) const { return x_[size_t(i)]; }
+  int depth(int i) const { return depth_[size_t(i)]; }
+
+  //---
+
+  //! calc normalized (0-1) box for visible nodes
+  void normalize(bool equalScale=false);
+
+  double x1(int i) const { return x1_[size_t(i)]; }
+  double y1(int i) const { return y1_[size_t(i)]; }
+  double x2(int i) const { return x2_[size_t(i)]; }
+  double y2(int i) const { return y2_[size_t(i)]; }
+
+ private:
+  bool hasChildren(int i) const {
+    return (open_[size_t(i)] && numChildren_[size_t(i)] > 0); }
+
+  int firstChild(int i) const { return (hasChildren(i) ? firstChild_[size_t(i)] : -1); }
+  int lastChild (int i) const { return (hasChildren(i) ? lastChild_ [size_t(i)] : -1); }
+
+  int leftBrother(int i) const { return prevSibling_[size_t(i)]; }
+
+  // contour (thread or child)
+  int left (int i) const { return (thread_[size_t(i)] >= 0 ? thread_[size_t(i)] : firstChild(i)); }
+  int right(int i) const { return (thread_[size_t(i)] >= 0 ? thread_[size_t(i)] : lastChild (i)); }
+
+  void preOrder(int root, Inds &inds) const;
+
+  void resetNode(int i);
+
+  void layoutLevel(int v);
+
+  int apportion(int v, int defaultAncestor, int parent);
+
+  void moveSubtree(int wl, int wr, double shift);
+
+  void executeShifts(int v);
+
+  void placeRoot();
+
+  void secondWalk();
+
+  // logged (undoable) changes
+  void setThread  (int i, int t);
+  void setMod     (int i, double m);
+  void setAncestor(int i, int a);
+
+  void undoLevel(int v);
+
+ private:
+  //! undo data for change made at a level
+  struct Undo {
+    int    node     { -1 };
+    int    thread   { -1 };
+    double mod      { 0.0 };
+    int    ancestor { -1 };
+
+    Undo(int node, int thread, double mod, int ancestor) :
+     node(node), thread(thread), mod(mod), ancestor(ancestor) {
+    }
+  };
+
+  using Undos = std::vector<Undo>;
+
+  // structure
+  Inds               parent_;
+  Inds               firstChild_;
+  Inds               lastChild_;
+  Inds               prevSibling_;
+  Inds               nextSibling_;
+  Inds               numChildren_;
+  Inds               number_;
+  std::vector<bool>  open_;
+
+  // layout
+  Reals prelim_;
+  Reals mod_;
+  Reals shift_;
+  Reals change_;
+  Reals midpoint_;
+  Inds  thread_;
+  Inds  ancestor_;
+  Reals x_;
+  Inds  depth_;
+
+  // level undo log (entries [logStart_, logEnd_) for each level)
+  Undos undos_;
+  Inds  logStart_;
+  Inds  logEnd_;
+
+  // normalized boxes
+  Reals x1_, y1_, x2_, y2_;
+
+  Inds   visible_;
+  Inds   work_;
+  double distance_ { 1.0 };
+  int    root_     { -1 };
+  bool   placed_   { false };
+};
+
 }
 
 #endif
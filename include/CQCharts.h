@@ -24,6 +24,8 @@ class CQChartsSymbolSet;
 class CQChartsInterfaceTheme;
 class CQChartsExprTcl;
 class CQColorsPalette;
+class CQChartsPaletteLUT;
+class CQChartsPaletteLUTMgr;
 class CQChartsColor;
 
 class CQChartsLoadModelDlg;
@@ -123,6 +125,8 @@ class CQCharts : public QObject {
   using Color    = CQChartsColor;
   using ColorInd = CQChartsUtil::ColorInd;
 
+  using PaletteLUT = CQChartsPaletteLUT;
+
  public:
   static QString description();
 
@@ -225,6 +229,15 @@ class CQCharts : public QObject {
 
   //---
 
+  //! get palette color lookup table (built on first use, discarded on palette change)
+  const PaletteLUT *paletteLUT(CQColorsPalette *palette, bool scale=false,
+                               bool invert=false) const;
+
+  //! interp palette color for array of normalized values (false if not interpolated palette)
+  bool interpColorValues(const CQChartsColor &c, const double *values, int n, QRgb *rgbs) const;
+
+  //---
+
   QColor interpThemeColor(const ColorInd &ind) const;
 
   QColor interpInterfaceColor(double r) const;
@@ -444,6 +457,7 @@ class CQCharts : public QObject {
   using SymbolSetMgrP   = std::unique_ptr<CQChartsSymbolSetMgr>;
   using PropertyModel   = CQPropertyViewModel;
   using PropertyModelP  = std::unique_ptr<PropertyModel>;
+  using PaletteLUTMgrP  = std::unique_ptr<CQChartsPaletteLUTMgr>;
 
   QTimer* exitTimer_ { nullptr }; //!< auto exit timer
 
@@ -463,6 +477,7 @@ class CQCharts : public QObject {
   InterfaceThemeP   interfaceTheme_; //!< interface theme
   CQChartsThemeName plotTheme_;      //!< plot theme name
   QColor            contrastColor_;  //!< color for contrast color calc
+  PaletteLUTMgrP    paletteLUTMgr_;  //!< palette color lookup tables
 
   SymbolSetMgrP symbolSetMgr_; //!< symbol set manager
 
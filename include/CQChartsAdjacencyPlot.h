@@ -5,6 +5,11 @@
 #include <CQChartsPlotObj.h>
 #include <CQChartsObjData.h>
 #include <CQChartsConnectionList.h>
+#include <CQChartsSeriation.h>
+
+#include <QImage>
+#include <mutex>
+#include <set>
 
 //------
 
@@ -285,6 +290,8 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
   Q_PROPERTY(SortType       sortType      READ sortType        WRITE setSortType     )
   Q_PROPERTY(bool           forceDiagonal READ isForceDiagonal WRITE setForceDiagonal)
   Q_PROPERTY(CQChartsLength bgMargin      READ bgMargin        WRITE setBgMargin     )
+  Q_PROPERTY(DrawType       drawType      READ drawType        WRITE setDrawType     )
+  Q_PROPERTY(int            maxCellObjs   READ maxCellObjs     WRITE setMaxCellObjs  )
 
   // background
   CQCHARTS_NAMED_FILL_DATA_PROPERTIES(Background, background)
@@ -298,16 +305,27 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
   CQCHARTS_TEXT_DATA_PROPERTIES
 
   Q_ENUMS(SortType)
+  Q_ENUMS(DrawType)
 
  public:
   enum class SortType {
-    GROUP /*! sort by group */,
-    NAME  /*! sort by name  */,
-    COUNT /*! sort by value */
+    GROUP    /*! sort by group */,
+    NAME     /*! sort by name  */,
+    COUNT    /*! sort by value */,
+    SPECTRAL /*! sort by spectral (fiedler vector) order */,
+    RCM      /*! sort by reverse Cuthill-McKee order */,
+    CLUSTER  /*! sort by hierarchical cluster leaf order */
+  };
+
+  enum class DrawType {
+    AUTO  /*! cell objects if visible cell count <= maxCellObjs, otherwise image */,
+    CELLS /*! cell objects */,
+    IMAGE /*! cell image */
   };
 
   using AdjacencyNode  = CQChartsAdjacencyNode;
   using AdjacencyNodeP = std::shared_ptr<AdjacencyNode>;
+  using NodeArray      = std::vector<AdjacencyNodeP>;
   using CellObj        = CQChartsAdjacencyCellObj;
   using Length         = CQChartsLength;
   using Angle          = CQChartsAngle;
@@ -343,6 +361,15 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
   const Length &bgMargin() const { return bgMargin_; }
   void setBgMargin(const Length &r);
 
+  const DrawType &drawType() const { return drawType_; }
+  void setDrawType(const DrawType &t);
+
+  int maxCellObjs() const { return maxCellObjs_; }
+  void setMaxCellObjs(int n);
+
+  //! is matrix drawn as image (no cell objects)
+  bool isDrawImage() const { return drawImage_; }
+
   //---
 
   CellObj *insideObj() const { return insideObj_; }
@@ -384,6 +411,14 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
 
   //---
 
+  QColor calcCellFillColor(const AdjacencyNodeP &node1, const AdjacencyNodeP &node2,
+                           double value, const ColorInd &colorInd) const;
+
+  QString calcCellTipId(const AdjacencyNodeP &node1, const AdjacencyNodeP &node2,
+                        double value) const;
+
+  //---
+
   QColor interpGroupColor(int) const;
 
   ColorInd groupColorInd(int group) const;
@@ -398,6 +433,14 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
 
   void postResize() override;
 
+  void applyDataRangeAndDraw() override;
+
+  //---
+
+  bool plotTipText(const Point &p, QString &tip, bool single) const override;
+
+  bool handleSelectPress(const Point &p, SelMod selMod) override;
+
   //---
 
   bool hasBackground() const override;
@@ -501,6 +544,70 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
 
   void createNameNodeObjs(PlotObjs &objs) const;
 
+  void createCellObjs(PlotObjs &objs, double x, double y) const;
+
+  //---
+
+  //! sparse (CSR) matrix of connected cells (row and column are sorted node indices)
+  struct CellMatrix {
+    using Inds   = std::vector<int>;
+    using Values = std::vector<float>;
+
+    int    n { 0 }; //!< number of rows/columns
+    Inds   rowStart; //!< start of row entries (n + 1 values)
+    Inds   cols;     //!< entry column (sorted per row)
+    Values values;   //!< entry value
+
+    int numCells() const { return int(cols.size()); }
+
+    //! get entry for row/column (-1 if not connected)
+    int find(int r, int c) const {
+      if (r < 0 || r >= n) return -1;
+
+      auto p1 = cols.begin() + rowStart[size_t(r    )];
+      auto p2 = cols.begin() + rowStart[size_t(r + 1)];
+
+      auto p = std::lower_bound(p1, p2, c);
+      if (p == p2 || *p != c) return -1;
+
+      return int(p - cols.begin());
+    }
+  };
+
+  //! range of rows/columns (inclusive)
+  struct CellRange {
+    bool set { false };
+    int  r1  { 0 }, r2 { -1 };
+    int  c1  { 0 }, c2 { -1 };
+
+    int numCells() const { return (set ? (r2 - r1 + 1)*(c2 - c1 + 1) : 0); }
+
+    bool contains(const CellRange &r) const {
+      return (set && r.set && r.r1 >= r1 && r.r2 <= r2 && r.c1 >= c1 && r.c2 <= c2);
+    }
+  };
+
+  void initCellMatrix(const NodeArray &nodes, CellMatrix &matrix) const;
+
+  Point cellOrigin() const;
+
+  void calcVisibleCellRange(CellRange &range) const;
+
+  bool isCellObjs(const CellRange &visibleRange) const;
+
+  bool cellAtPoint(const Point &p, int &row, int &col) const;
+
+  QColor calcNodeFillColor(const AdjacencyNodeP &srcNode, const AdjacencyNodeP &destNode,
+                           const ColorInd &colorInd, bool &scaled) const;
+
+  //---
+
+  void drawCellImage(PaintDevice *device, const BBox &pbbox) const;
+
+  void updateCellImage() const;
+
+  void drawSelectedCells(PaintDevice *device) const;
+
   //---
 
  protected:
@@ -508,7 +615,6 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
 
  private:
   using NodeMap     = std::map<int, AdjacencyNodeP>;
-  using NodeArray   = std::vector<AdjacencyNodeP>;
   using NameNodeMap = std::map<QString, AdjacencyNodeP>;
 
   struct NodeData {
@@ -523,6 +629,20 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
  private:
   void sortNodes(const NodeMap &nodes, NodeArray &sortedNodes, NodeData &nodeData) const;
 
+  void sortNodesByName(NodeArray &sortedNodes) const;
+
+  bool isSeriationSort() const;
+
+  CQChartsSeriation::Type seriationType() const;
+
+  void initSeriationMatrix(const NodeArray &sortedNodes, CQChartsSeriation::Matrix &matrix) const;
+
+  bool isSeriationCached() const;
+
+  void seriateNodes(NodeArray &sortedNodes) const;
+
+  void reorderNodes();
+
  private:
   // options
   SortType    sortType_      { SortType::GROUP };  //!< sort type
@@ -531,6 +651,8 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
   NodeMap     nodes_;                              //!< all nodes
   NameNodeMap nameNodeMap_;                        //!< name node map
   double      fontFactor_    { -1.0 };             //!< font factor
+  DrawType    drawType_      { DrawType::AUTO };   //!< draw type
+  int         maxCellObjs_   { 10000 };            //!< max cell objects for auto draw type
 
   // inside obj
   CellObj* insideObj_ { nullptr }; //!< last inside object
@@ -540,6 +662,34 @@ class CQChartsAdjacencyPlot : public CQChartsConnectionPlot,
   NodeData  nodeData_;            //!< node data
   int       maxNodeDepth_ { -1 }; //!< max node depth
 
+  // cells
+  CellMatrix cellMatrix_;             //!< connected cells of sorted nodes
+  bool       drawImage_    { false }; //!< draw cells as image
+  CellRange  cellObjRange_;           //!< range of created cell objects
+  Point      cellObjOrigin_;          //!< origin of created cell objects
+
+  using CellInd  = std::pair<int, int>;
+  using CellInds = std::set<CellInd>;
+
+  CellInds selectedCells_; //!< selected cells (image draw)
+
+  using CellImages = std::vector<QImage>;
+  using RGBs       = std::vector<QRgb>;
+
+  //! cell image mip levels (level n pixel is max value cell of 2^n x 2^n cells)
+  struct CellImageData {
+    bool       valid      { false }; //!< is valid
+    CellImages levels;               //!< mip levels
+    RGBs       colors;               //!< colors used for levels (empty + node colors)
+    double     fillAlpha  { 1.0 };   //!< cell fill alpha used for levels
+    double     emptyAlpha { 1.0 };   //!< empty cell fill alpha used for levels
+  };
+
+  mutable CellImageData cellImageData_;  //!< cell image data
+  mutable std::mutex    cellImageMutex_; //!< cell image mutex
+
+  mutable CQChartsSeriation seriation_; //!< seriation (cached orderings)
+
   mutable double pxs_   { 0.0 };
   mutable double pys_   { 0.0 };
   mutable double xts_   { 0.0 };
@@ -25,6 +25,7 @@
 #include <CQChartsOptReal.h>
 
 class CQChartsAnnotationGroup;
+class CQChartsAnnotationTree;
 class CQChartsSmooth;
 class CQChartsDensity;
 class CQChartsKey;
@@ -246,6 +247,10 @@ class CQChartsAnnotation : public CQChartsTextBoxObj {
   // get padding values
   void getPaddingValues(double &xlp, double &xrp, double &ytp, double &ybp) const;
 
+  //! are units/length parent (plot or view) coords (independent of pixel mapping)
+  bool isParentUnits (const Units &units) const;
+  bool isParentLength(const CQChartsLength &length) const;
+
   //---
 
   //! get property path
@@ -308,6 +313,9 @@ class CQChartsAnnotation : public CQChartsTextBoxObj {
 
   virtual BBox calcBBox() const { return annotationBBox(); }
 
+  //! is bbox dependent on pixel mapping (positioned or sized in pixels)
+  virtual bool isPixelMapped() const { return true; }
+
   //---
 
   //! interp color
@@ -406,6 +414,9 @@ class CQChartsAnnotation : public CQChartsTextBoxObj {
 
   CQChartsResizeHandle *createExtraHandle() const;
 
+  //! get parent plot/view annotation bbox tree
+  CQChartsAnnotationTree *annotationTree() const;
+
   Units parentUnits() const {
     if      (plot()) return Units::PLOT;
     else if (view()) return Units::VIEW;
@@ -696,6 +707,10 @@ class CQChartsPolyShapeAnnotationBase : public CQChartsShapeAnnotationBase {
 
   //---
 
+  bool isPixelMapped() const override;
+
+  //---
+
   //! add properties
   void addProperties(PropertyModel *model, const QString &path,
                      const QString &desc=QString()) override;
@@ -782,6 +797,10 @@ class CQChartsRectangleAnnotation : public CQChartsShapeAnnotationBase {
 
   //---
 
+  bool isPixelMapped() const override;
+
+  //---
+
   //! add properties
   void addProperties(PropertyModel *model, const QString &path,
                      const QString &desc=QString()) override;
@@ -984,6 +1003,10 @@ class CQChartsEllipseAnnotation : public CQChartsShapeAnnotationBase {
 
   //---
 
+  bool isPixelMapped() const override;
+
+  //---
+
   //! add properties
   void addProperties(PropertyModel *model, const QString &path,
                      const QString &desc=QString()) override;
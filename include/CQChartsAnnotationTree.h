@@ -0,0 +1,103 @@
+#ifndef CQChartsAnnotationTree_H
+#define CQChartsAnnotationTree_H
+
+#include <CQChartsQuadTree.h>
+#include <CQChartsGeom.h>
+#include <map>
+#include <set>
+#include <mutex>
+#include <vector>
+
+class CQChartsAnnotation;
+
+/*!
+ * \brief Charts annotation bounding box quad tree
+ * \ingroup Charts
+ *
+ * Annotation bounding boxes (plot or view coords) are indexed incrementally as they
+ * are updated (annotation bbox is set when the annotation is drawn). Annotations
+ * without a known bbox (not yet drawn or geometry invalidated since last draw) are
+ * kept in an unindexed set and are always returned by queries so the results are
+ * always a superset of the matching annotations.
+ *
+ * Bboxes of annotations sized or positioned in pixels are invalidated when the pixel
+ * mapping changes as they move relative to the parent coords (annotations with only
+ * parent coords stay indexed).
+ */
+class CQChartsAnnotationTree {
+ public:
+  using Annotation  = CQChartsAnnotation;
+  using Annotations = std::vector<Annotation *>;
+  using Point       = CQChartsGeom::Point;
+  using BBox        = CQChartsGeom::BBox;
+
+ public:
+  CQChartsAnnotationTree();
+
+ ~CQChartsAnnotationTree();
+
+  //! add/remove annotation
+  void addAnnotation   (Annotation *annotation);
+  void removeAnnotation(Annotation *annotation);
+
+  //! remove all annotations
+  void clear();
+
+  //! update draw order from annotation list (after raise/lower)
+  void setOrder(const Annotations &annotations);
+
+  //! annotation bbox changed
+  void updateAnnotation(Annotation *annotation);
+
+  //! annotation geometry changed (bbox unknown until next draw)
+  void invalidateAnnotation(Annotation *annotation);
+
+  //! invalidate all annotation bboxes
+  void invalidate();
+
+  //! check mapping (parent rect of fixed pixel rect) and invalidate pixel mapped
+  //! annotations if changed
+  void checkMapping(const BBox &mapping);
+
+  //! get annotations (in draw order) touching rect or with no known bbox
+  void annotationsTouchingRect(const BBox &rect, Annotations &annotations) const;
+
+  //! get annotations (in draw order) which may contain point (within tolerance)
+  void annotationsAtPoint(const Point &p, double dx, double dy, Annotations &annotations) const;
+
+  //! number of indexed/unindexed annotations
+  int numIndexed  () const;
+  int numUnindexed() const;
+
+ private:
+  struct Entry {
+    Annotation* annotation  { nullptr }; //!< annotation
+    int         pos         { 0 };       //!< draw order
+    BBox        bbox;                    //!< indexed bbox
+    bool        indexed     { false };   //!< is in tree
+    bool        pixelMapped { true };    //!< bbox depends on pixel mapping
+
+    const BBox &rect() const { return bbox; }
+  };
+
+  using Tree      = CQChartsQuadTree<Entry, BBox>;
+  using Entries   = std::map<Annotation *, Entry *>;
+  using Unindexed = std::set<Entry *>;
+  using EntryList = std::vector<Entry *>;
+
+ private:
+  void unindexEntry(Entry *entry);
+  void unindexEntries();
+
+  void entryAnnotations(EntryList &entries, Annotations &annotations) const;
+
+ private:
+  Tree               tree_;            //!< bbox tree
+  Entries            entries_;         //!< entry per annotation
+  Unindexed          unindexed_;       //!< entries without known bbox
+  int                pos_     { 0 };   //!< next draw order
+  BBox               mapping_;         //!< last pixel mapping
+  mutable std::mutex mutex_;           //!< lock (annotations can draw in thread)
+};
+
+#endif
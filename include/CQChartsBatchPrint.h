@@ -0,0 +1,75 @@
+#ifndef CQChartsBatchPrint_H
+#define CQChartsBatchPrint_H
+
+#include <QString>
+#include <QSize>
+#include <vector>
+
+class CQChartsView;
+class CQChartsPlot;
+
+/*!
+ * \brief Batch print of views/plots to image files
+ * \ingroup Charts
+ *
+ * Jobs are grouped by view and size so each view is resized (and its plots laid out
+ * and drawn) once per size. Plot layers are drawn on the plot draw threads and the
+ * existing models and plot objects are reused by all jobs. Rendered images are encoded
+ * and written on worker threads.
+ *
+ * Vector formats (svg, js) are written sequentially using the view print code.
+ */
+class CQChartsBatchPrint {
+ public:
+  using View = CQChartsView;
+  using Plot = CQChartsPlot;
+
+  //! print job
+  struct Job {
+    View*   view { nullptr }; //!< view (plot's view if plot set)
+    Plot*   plot { nullptr }; //!< plot (whole view if not set)
+    QString filename;         //!< output filename
+    QSize   size;             //!< image size (current view size if not valid)
+    QString format;           //!< image format (filename suffix if empty)
+  };
+
+  using Jobs = std::vector<Job>;
+
+  //! batch statistics (times in ms)
+  struct Stats {
+    int    numImages  { 0 };   //!< number of images written
+    int    numFailed  { 0 };   //!< number of failed jobs
+    double layoutTime { 0.0 }; //!< time to resize and draw plots
+    double renderTime { 0.0 }; //!< time to composite images
+    double writeTime  { 0.0 }; //!< time to encode and write images
+    double totalTime  { 0.0 }; //!< total time
+
+    double imagesPerSecond() const {
+      return (totalTime > 0.0 ? 1000.0*numImages/totalTime : 0.0);
+    }
+  };
+
+ public:
+  CQChartsBatchPrint();
+
+  //! add job
+  void addJob(const Job &job);
+
+  const Jobs &jobs() const { return jobs_; }
+
+  //! run all jobs (returns false if any job failed)
+  bool exec();
+
+  const Stats &stats() const { return stats_; }
+
+ private:
+  static QString jobFormat(const Job &job);
+
+  static bool isVectorFormat(const QString &format);
+
+ private:
+  Jobs  jobs_;  //!< jobs
+  Stats stats_; //!< stats of last exec
+};
+
+#endif
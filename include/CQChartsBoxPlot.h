@@ -576,6 +576,11 @@ class CQChartsBoxPlot : public CQChartsGroupPlot,
   Q_PROPERTY(double whiskerRange  READ whiskerRange  WRITE setWhiskerRange )
   Q_PROPERTY(double whiskerExtent READ whiskerExtent WRITE setWhiskerExtent)
 
+  // approximate (quantile sketch)
+  Q_PROPERTY(bool   approximate         READ isApproximate       WRITE setApproximate        )
+  Q_PROPERTY(double approximateError    READ approximateError    WRITE setApproximateError   )
+  Q_PROPERTY(int    approximateTailSize READ approximateTailSize WRITE setApproximateTailSize)
+
   // labels
   Q_PROPERTY(double textMargin READ textMargin WRITE setTextMargin)
 
@@ -764,6 +769,18 @@ class CQChartsBoxPlot : public CQChartsGroupPlot,
 
   //---
 
+  // approximate (quantile sketch with outliers from retained tail values)
+  bool isApproximate() const { return approximateData_.enabled; }
+  void setApproximate(bool b);
+
+  double approximateError() const { return approximateData_.error; }
+  void setApproximateError(double r);
+
+  int approximateTailSize() const { return approximateData_.tailSize; }
+  void setApproximateTailSize(int n);
+
+  //---
+
   // label
   double textMargin() const { return textMargin_; }
   void setTextMargin(double r);
@@ -974,6 +991,15 @@ class CQChartsBoxPlot : public CQChartsGroupPlot,
   double whiskerRange_  { 1.5 }; //!< whisker range
   double whiskerExtent_ { 0.2 }; //!< whisker extent
 
+  //! approximate data
+  struct ApproximateData {
+    bool   enabled  { false }; //!< use quantile sketch
+    double error    { 0.01 };  //!< sketch normalized rank error
+    int    tailSize { 1000 };  //!< number of retained values in each tail
+  };
+
+  ApproximateData approximateData_; //!< approximate data
+
   double             textMargin_        { 2 };                //!< text margin
   double             ymargin_           { 0.05 };             //!< y margin
   ColumnType         setType_           { ColumnType::NONE }; //!< set column data type
@@ -2,6 +2,7 @@
 #define CQChartsBoxWhisker_H
 
 #include <CQChartsDensity.h>
+#include <CQChartsQuantileSketch.h>
 #include <CQChartsUtil.h>
 #include <CQStatData.h>
 #include <CSafeIndex.h>
@@ -18,6 +19,12 @@ struct CQChartsPenBrush;
 /*!
  * \brief box whisker
  * \ingroup Charts
+ *
+ * In approximate mode values are added to a mergeable quantile sketch and only the
+ * smallest and largest tail values (up to tail size each) are kept so memory is fixed
+ * for any number of values. Quartiles are read from the sketch and outliers from the
+ * retained tails. Values (and outliers) are exact until more than twice the tail size
+ * values have been added.
  */
 template<typename VALUE>
 class CQChartsBoxWhiskerT {
@@ -25,6 +32,7 @@ class CQChartsBoxWhiskerT {
   using Values   = std::vector<VALUE>;
   using Outliers = std::vector<int>;
   using Density  = CQChartsDensity;
+  using Sketch   = CQChartsQuantileSketch;
 
  public:
   CQChartsBoxWhiskerT() { }
@@ -37,27 +45,80 @@ class CQChartsBoxWhiskerT {
   const QString &name() const { return name_; }
   void setName(const QString &s) { name_ = s; }
 
-  int numValues() const { return int(values_.size()); }
+  //! get/set approximate mode (quantile sketch and tails), resets values
+  bool isApproximate() const { return approximate_; }
+  void setApproximate(bool b, double error=0.01, int tailSize=1000) {
+    approximate_ = b;
 
-  const Values &values() const { return values_; }
+    sketch_.setError(error);
 
-  const VALUE &value(int i) const { return CUtil::safeIndex(values_, i); }
+    tailSize_ = std::max(tailSize, 1);
+
+    clearValues();
+  }
+
+  //! number of (retained) values
+  int numValues() const { initValues(); return int(values_.size()); }
+
+  //! number of added values (more than retained values if approximate)
+  long count() const { return (approximate_ ? sketch_.count() : long(values_.size())); }
+
+  //! (retained) values
+  const Values &values() const { initValues(); return values_; }
+
+  const VALUE &value(int i) const { initValues(); return CUtil::safeIndex(values_, i); }
+
+  const Sketch &sketch() const { return sketch_; }
 
   void addValue(const VALUE &value) {
-    values_.push_back(value);
+    if (approximate_)
+      addSketchValue(value);
+    else
+      values_.push_back(value);
 
     invalidate();
   }
 
   void setValues(const Values &values) {
-    values_ = values;
+    if (! approximate_) {
+      values_ = values;
+
+      invalidate();
+
+      return;
+    }
+
+    clearValues();
+
+    for (const auto &value : values)
+      addSketchValue(value);
 
     invalidate();
   }
 
   void addValues(std::initializer_list<VALUE> values) {
     for (auto value : values)
-      values_.push_back(value);
+      addValue(value);
+  }
+
+  //! merge values from other box whisker (e.g. partition calculated in another thread)
+  void merge(const CQChartsBoxWhiskerT &whisker) {
+    if      (! approximate_) {
+      const auto &values = whisker.values();
+
+      values_.insert(values_.end(), values.begin(), values.end());
+    }
+    else if (whisker.approximate_) {
+      // merge sketches and re-add other's tails (other's middle values only in sketch)
+      sketch_.merge(whisker.sketch_);
+
+      for (const auto &value : whisker.lowTail_ ) addTailValue(value);
+      for (const auto &value : whisker.highTail_) addTailValue(value);
+    }
+    else {
+      for (const auto &value : whisker.values_)
+        addSketchValue(value);
+    }
 
     invalidate();
   }
@@ -83,8 +144,14 @@ class CQChartsBoxWhiskerT {
   double lowerMedian() const { return statData().lowerMedian; }
   double upperMedian() const { return statData().upperMedian; }
 
-  double vmin() const { return (! values_.empty() ? double(values_.front()) : 0.0); }
-  double vmax() const { return (! values_.empty() ? double(values_.back ()) : 0.0); }
+  double vmin() const {
+    if (approximate_) return sketch_.min();
+    return (! values_.empty() ? double(values_.front()) : 0.0);
+  }
+  double vmax() const {
+    if (approximate_) return sketch_.max();
+    return (! values_.empty() ? double(values_.back ()) : 0.0);
+  }
 
   const CQStatData &statData() const { initCalc(); return statData_; }
 
@@ -120,6 +187,70 @@ class CQChartsBoxWhiskerT {
     densityValid_.store(false);
   }
 
+  void clearValues() {
+    values_  .clear();
+    lowTail_ .clear();
+    highTail_.clear();
+
+    sketch_.clear();
+
+    invalidate();
+  }
+
+  // retained values are built from tails on calc when approximate
+  void initValues() const {
+    if (approximate_)
+      initCalc();
+  }
+
+  void addSketchValue(const VALUE &value) {
+    sketch_.add(double(value));
+
+    addTailValue(value);
+  }
+
+  // keep smallest tail size values in low tail (max heap) and largest tail size of the
+  // remaining values in high tail (min heap) so tails never share a value
+  void addTailValue(const VALUE &value) {
+    auto lowCmp  = [](const VALUE &lhs, const VALUE &rhs) { return double(lhs) < double(rhs); };
+    auto highCmp = [](const VALUE &lhs, const VALUE &rhs) { return double(lhs) > double(rhs); };
+
+    auto addHigh = [&](const VALUE &value) {
+      if      (int(highTail_.size()) < tailSize_) {
+        highTail_.push_back(value);
+
+        std::push_heap(highTail_.begin(), highTail_.end(), highCmp);
+      }
+      else if (double(value) > double(highTail_.front())) {
+        std::pop_heap(highTail_.begin(), highTail_.end(), highCmp);
+
+        highTail_.back() = value;
+
+        std::push_heap(highTail_.begin(), highTail_.end(), highCmp);
+      }
+    };
+
+    if      (int(lowTail_.size()) < tailSize_) {
+      lowTail_.push_back(value);
+
+      std::push_heap(lowTail_.begin(), lowTail_.end(), lowCmp);
+    }
+    else if (double(value) < double(lowTail_.front())) {
+      // evicted largest low tail value moves to high tail
+      std::pop_heap(lowTail_.begin(), lowTail_.end(), lowCmp);
+
+      auto evicted = lowTail_.back();
+
+      lowTail_.back() = value;
+
+      std::push_heap(lowTail_.begin(), lowTail_.end(), lowCmp);
+
+      addHigh(evicted);
+    }
+    else
+      addHigh(value);
+  }
+
   void initCalc() const {
     if (! calcValid_.load()) {
       std::unique_lock<std::mutex> lock(calcMutex_);
@@ -135,6 +266,11 @@ class CQChartsBoxWhiskerT {
   }
 
   void calc() {
+    if (approximate_) {
+      calcApproximate();
+      return;
+    }
+
     if (values_.empty())
       return;
 
@@ -158,6 +294,96 @@ class CQChartsBoxWhiskerT {
     }
   }
 
+  void calcApproximate() {
+    values_.clear();
+
+    values_.insert(values_.end(), lowTail_ .begin(), lowTail_ .end());
+    values_.insert(values_.end(), highTail_.begin(), highTail_.end());
+
+    std::sort(values_.begin(), values_.end());
+
+    //---
+
+    // all values retained so use exact stats
+    if (sketch_.count() <= long(values_.size())) {
+      statData_.reset();
+
+      outliers_.clear();
+
+      if (values_.empty())
+        return;
+
+      statData_.calcStatValues(values_);
+
+      int n = 0;
+
+      for (auto v : values_) {
+        if (statData_.isOutlier(v))
+          outliers_.push_back(n);
+
+        ++n;
+      }
+
+      return;
+    }
+
+    //---
+
+    // quartiles from sketch
+    std::vector<double> qvalues;
+
+    sketch_.quantiles({0.25, 0.5, 0.75}, qvalues);
+
+    statData_.reset();
+
+    statData_.sum    = sketch_.sum   ();
+    statData_.mean   = sketch_.mean  ();
+    statData_.stddev = sketch_.stddev();
+
+    statData_.lowerMedian = qvalues[0];
+    statData_.median      = qvalues[1];
+    statData_.upperMedian = qvalues[2];
+
+    double iqr = statData_.upperMedian - statData_.lowerMedian;
+
+    statData_.loutlier = statData_.lowerMedian - range_*iqr;
+    statData_.uoutlier = statData_.upperMedian + range_*iqr;
+
+    statData_.notch  = 1.58*iqr/std::sqrt(double(sketch_.count()));
+    statData_.lnotch = statData_.median - statData_.notch;
+    statData_.unotch = statData_.median + statData_.notch;
+
+    //---
+
+    // outliers and whisker ends (nearest non-outlier) from sorted tails (low tail values
+    // are first). If a tail has no non-outlier value the outliers of that tail are
+    // truncated and its whisker end is the outlier fence.
+    outliers_.clear();
+
+    statData_.min = statData_.loutlier;
+    statData_.max = statData_.uoutlier;
+
+    int nl = int(lowTail_.size());
+    int nv = int(values_.size());
+
+    bool minSet = false;
+
+    for (int i = 0; i < nv; ++i) {
+      double r = double(values_[size_t(i)]);
+
+      if (r < statData_.loutlier || r > statData_.uoutlier)
+        outliers_.push_back(i);
+      else if (i < nl) {
+        if (! minSet) {
+          statData_.min = r;
+          minSet        = true;
+        }
+      }
+      else
+        statData_.max = r;
+    }
+  }
+
   void initDensity() const {
     if (! densityValid_.load()) {
       std::unique_lock<std::mutex> lock(densityMutex_);
@@ -173,10 +399,21 @@ class CQChartsBoxWhiskerT {
   }
 
   void calcDensity() {
-    int nv = numValues();
-
     std::vector<double> vals;
 
+    // density of evenly spaced sketch quantiles if approximate
+    if (approximate_ && sketch_.count() > numValues()) {
+      sketch_.sample(int(std::min(sketch_.count(), long(4*sketch_.k()))), vals);
+
+      density_.setXVals(vals);
+
+      return;
+    }
+
+    initValues();
+
+    int nv = numValues();
+
     for (int iv = 0; iv < nv; ++iv) {
       double v = rvalue(iv);
 
@@ -192,6 +429,13 @@ class CQChartsBoxWhiskerT {
   double                    range_        { 1.5 };  //!< outlier range scale
   double                    fraction_     { 0.95 }; //!< fraction ? TODO
 
+  // approximate data
+  bool                      approximate_  { false }; //!< is approximate
+  int                       tailSize_     { 1000 };  //!< max values in each tail
+  Sketch                    sketch_;                 //!< quantile sketch
+  Values                    lowTail_;                //!< smallest values (max heap)
+  Values                    highTail_;               //!< largest values (min heap)
+
   // calculated data
   mutable std::atomic<bool> calcValid_    { false }; //!< calc valid
   mutable std::mutex        calcMutex_;              //!< calc mutex
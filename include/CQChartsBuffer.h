@@ -3,6 +3,8 @@
 
 #include <QObject>
 #include <QRectF>
+#include <atomic>
+#include <mutex>
 
 class QImage;
 class QPainter;
@@ -17,6 +19,10 @@ class QWindow;
 /*!
  * \brief Draw image/pixmap buffer
  * \ingroup Charts
+ *
+ * The buffer is painted into a back image/pixmap (by the draw thread) which is swapped
+ * with the front (last completed) image/pixmap when painting ends. Drawing the buffer
+ * (view paint) uses the front image/pixmap so it only waits for the swap.
  */
 class CQChartsBuffer : public QObject {
   Q_OBJECT
@@ -65,8 +71,9 @@ class CQChartsBuffer : public QObject {
 
   const BufferType &bufferType() const { return bufferType_; }
 
-  QImage  *image () const { return image_ ; }
-  QPixmap *pixmap() const { return pixmap_; }
+  //! get last completed image/pixmap
+  QImage  *image () const { return frontImage_ ; }
+  QPixmap *pixmap() const { return frontPixmap_; }
 
 #ifdef CQCHARTS_OPENGL
   GLBuffer  *glBuffer () const { return glBuffer_; }
@@ -80,21 +87,29 @@ class CQChartsBuffer : public QObject {
 
   void endPaint(bool draw=true);
 
+  //! clear back and front buffers
   void clear();
 
+  //! draw last completed buffer
   void draw(QPainter *painter);
   void draw(QPainter *painter, int x, int y);
 
  private:
   QPainter *ipainter();
 
+  void clearBack();
+
+  void swapBuffers();
+
+  void drawFront(QPainter *painter, int x, int y);
+
   void updateSize();
 
  private:
-  QWidget* widget_ { nullptr };
-  Type     type_   { Type::NONE };
-  bool     active_ { true };
-  bool     valid_  { false };
+  QWidget*          widget_ { nullptr };
+  Type              type_   { Type::NONE };
+  bool              active_ { true };
+  std::atomic<bool> valid_  { false }; //!< is valid (set by draw thread)
 
   // buffer type and object
   BufferType bufferType_ { BufferType::IMAGE };
@@ -111,6 +126,12 @@ class CQChartsBuffer : public QObject {
   QSize      size_;
   QPainter*  ipainter_ { nullptr };
   QPainter*  painter_  { nullptr };
+
+  // last completed (front) buffer
+  QPixmap*   frontPixmap_ { nullptr };
+  QImage*    frontImage_  { nullptr };
+  QRectF     frontRect_;
+  std::mutex frontMutex_; //!< front buffer lock (held for swap or draw)
 };
 
 #endif
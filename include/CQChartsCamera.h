@@ -149,6 +149,13 @@ class CQChartsCamera {
   Point3D transform  (const Point3D &p) const;
   Point3D untransform(const Point3D &p) const;
 
+  //! get transform as affine matrix (3 rows of 4 values, last column is translation)
+  void transformMatrix(double m[12]) const;
+
+  //! transform points (separate x, y, z arrays) in parallel batches
+  void transformPoints(const double *xs, const double *ys, const double *zs, int n,
+                       double *txs, double *tys, double *tzs) const;
+
   void showView(std::ostream &os) const;
 
   void unsetView();
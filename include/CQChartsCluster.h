@@ -0,0 +1,124 @@
+#ifndef CQChartsCluster_H
+#define CQChartsCluster_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/*!
+ * \brief Agglomerative (hierarchical) clustering of rows of numeric values
+ * \ingroup Charts
+ *
+ * Pairwise euclidean distances are stored in a condensed (upper triangle) matrix
+ * calculated in parallel and clusters are merged using the nearest neighbor chain
+ * algorithm with Lance-Williams distance updates.
+ *
+ * If the distance matrix does not fit in the max memory size then Ward linkage is
+ * calculated from cluster centroids without a matrix (O(n*d) memory).
+ *
+ * Merges are returned in increasing height order. Cluster ids less than the number
+ * of rows are the input rows, merge i creates cluster id numRows + i.
+ */
+class CQChartsCluster {
+ public:
+  enum class Linkage {
+    WARD,
+    AVERAGE,
+    COMPLETE,
+    SINGLE
+  };
+
+  //! merge of two clusters
+  struct Merge {
+    int    id1    { -1 };  //!< first cluster id
+    int    id2    { -1 };  //!< second cluster id
+    double height { 0.0 }; //!< merge distance
+    int    size   { 0 };   //!< number of rows in merged cluster
+
+    Merge() { }
+
+    Merge(int id1, int id2, double height, int size) :
+     id1(id1), id2(id2), height(height), size(size) {
+    }
+  };
+
+  using Merges = std::vector<Merge>;
+  using Reals  = std::vector<double>;
+
+ public:
+  CQChartsCluster();
+
+  //! get/set linkage
+  const Linkage &linkage() const { return linkage_; }
+  void setLinkage(const Linkage &l) { linkage_ = l; }
+
+  //! get/set normalize (scale values of each column to zero mean and unit stddev)
+  bool isNormalize() const { return normalize_; }
+  void setNormalize(bool b) { normalize_ = b; }
+
+  //! get/set max memory (bytes) for distance matrix
+  size_t maxMemory() const { return maxMemory_; }
+  void setMaxMemory(size_t n) { maxMemory_ = n; }
+
+  //---
+
+  //! set row major values (numRows x numCols)
+  void setValues(int numRows, int numCols, const Reals &values);
+
+  int numRows() const { return nr_; }
+  int numCols() const { return nc_; }
+
+  //---
+
+  //! calculate clusters
+  bool calc();
+
+  //! is memory bounded (no distance matrix) mode used
+  bool isMemoryBounded() const { return memoryBounded_; }
+
+  const Merges &merges() const { return merges_; }
+
+  const std::string &errorMsg() const { return errorMsg_; }
+
+  //---
+
+  static bool stringToLinkage(const std::string &str, Linkage &linkage);
+
+ private:
+  using Dists = std::vector<float>;
+  using Inds  = std::vector<int>;
+
+  size_t condensedInd(int i, int j) const {
+    if (i > j) std::swap(i, j);
+
+    auto n = size_t(nr_);
+
+    return n*size_t(i) - (size_t(i)*(size_t(i) + 1))/2 + size_t(j) - size_t(i) - 1;
+  }
+
+  void normalizeValues();
+
+  void calcDistances();
+
+  void nnChainMatrix(Merges &merges);
+  void nnChainWard  (Merges &merges);
+
+  void labelMerges(Merges &merges);
+
+  double updateDist(double dxi, double dyi, double dxy, int nx, int ny, int ni) const;
+
+ private:
+  Linkage linkage_       { Linkage::WARD };
+  bool    normalize_     { false };
+  size_t  maxMemory_     { size_t(1) << 30 };
+  int     nr_            { 0 };
+  int     nc_            { 0 };
+  Reals   values_;
+  Dists   dists_;
+  bool    memoryBounded_ { false };
+  Merges  merges_;
+  std::string errorMsg_;
+};
+
+#endif
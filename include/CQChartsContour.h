@@ -1,8 +1,10 @@
 #ifndef CContour_H
 #define CContour_H
 
+#include <CQChartsContourTracer.h>
 #include <QObject>
 #include <QColor>
+#include <QPainterPath>
 #include <vector>
 
 class CQChartsPlot;
@@ -11,6 +13,9 @@ class CQChartsPaintDevice;
 /*!
  * \brief Contour Data Object
  * \ingroup Charts
+ *
+ * Contour lines and solid bands are extracted by CQChartsContourTracer and the paths
+ * (window coords) are cached until the data or contour levels change.
  */
 class CQChartsContour : public QObject {
   Q_OBJECT
@@ -70,23 +75,27 @@ class CQChartsContour : public QObject {
 
   void initLevels(ContourLevels &levels) const;
 
-  void fillContourBox(PaintDevice *, double, double, double, double,
-                      double, double, double, double, const ContourLevels &);
+  void updateLevels();
 
-  void drawPoint(PaintDevice *, double, double);
-  void drawLine(PaintDevice *, double, double, double, double);
+  void updateLinePaths();
+  void updateBandPaths();
 
-  void fillPolygon(PaintDevice *, const double *, const double *, int);
+  void drawPoint(PaintDevice *, double, double);
 
  private:
-  using RealArray  = std::vector<double>;
+  using RealArray = std::vector<double>;
+  using Tracer    = CQChartsContourTracer;
+  using Paths     = std::vector<QPainterPath>;
+
   Plot*      plot_            { nullptr };
   bool       solid_           { false };
-  RealArray  x_;
-  RealArray  y_;
-  RealArray  z_;
   RealArray  levels_;
   int        numLevels_       { 10 };
+  Tracer     tracer_;
+  Paths      linePaths_;
+  Paths      bandPaths_;
+  bool       linePathsValid_  { false };
+  bool       bandPathsValid_  { false };
 #if 0
   ColorArray colors_;
 #endif
@@ -98,8 +107,6 @@ class CQChartsContour : public QObject {
   double     xmax_            { 1.0 };
   double     ymax_            { 1.0 };
   double     zmax_            { 1.0 };
-  double     minX_            { 0.0 };
-  double     minY_            { 0.0 };
 };
 
 #endif
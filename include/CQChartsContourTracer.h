@@ -0,0 +1,130 @@
+#ifndef CQChartsContourTracer_H
+#define CQChartsContourTracer_H
+
+#include <CQChartsGeom.h>
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Contour geometry of a grid of values (iso lines and filled iso bands)
+ * \ingroup Charts
+ *
+ * Each grid cell is split into four triangles at the cell center (center value is
+ * the average of the corners) which resolves saddle cells. Triangles are processed
+ * in parallel column tiles. Every line and band vertex has an integer key (grid
+ * point, cell center or level crossing of a grid/diagonal edge) so the per triangle
+ * pieces are stitched exactly:
+ *  . iso line segments are chained into open (grid boundary or missing values) or
+ *    closed polylines per level
+ *  . band polygon edges shared by two triangles are dropped (they always cancel) and
+ *    the remaining edges are chained into closed rings per band (holes have the
+ *    opposite orientation so the rings must be filled with the non zero winding rule)
+ *
+ * Band b contains values in [level(b - 1), level(b)) so there is one more band than
+ * levels. Cells with a missing (NaN) corner value are skipped.
+ *
+ * Lines and bands are calculated on demand and kept until the data or levels change.
+ */
+class CQChartsContourTracer {
+ public:
+  using Point  = CQChartsGeom::Point;
+  using Points = std::vector<Point>;
+  using Reals  = std::vector<double>;
+
+  //! iso line
+  struct Line {
+    Points points;             //!< line points
+    bool   closed { false };   //!< is closed (last point connects to first)
+  };
+
+  using Lines = std::vector<Line>;
+  using Rings = std::vector<Points>;
+
+ public:
+  CQChartsContourTracer();
+
+  //! set grid data (z value of x[ix], y[iy] is z[ix*ny + iy])
+  void setData(const Reals &x, const Reals &y, const Reals &z);
+
+  int numX() const { return int(x_.size()); }
+  int numY() const { return int(y_.size()); }
+
+  const Reals &x() const { return x_; }
+  const Reals &y() const { return y_; }
+  const Reals &z() const { return z_; }
+
+  //! get/set levels (ascending). Returns true if changed
+  const Reals &levels() const { return levels_; }
+  bool setLevels(const Reals &levels);
+
+  int numLevels() const { return int(levels_.size()); }
+  int numBands () const { return numLevels() + 1; }
+
+  //---
+
+  //! get iso lines for level (calculated if needed)
+  const Lines &levelLines(int l) const;
+
+  //! get closed rings of band (calculated if needed)
+  const Rings &bandRings(int b) const;
+
+  bool isLinesValid() const { return linesValid_; }
+  bool isBandsValid() const { return bandsValid_; }
+
+  void invalidate();
+
+ private:
+  using Key = uint64_t;
+
+  // triangle vertex
+  struct Vertex {
+    Key    key { 0 };
+    Point  p;
+    double z   { 0.0 };
+  };
+
+  // triangle (vertices and edge ids)
+  struct Triangle {
+    Vertex v[3];
+    Key    e[3]     { 0, 0, 0 };             // edge id of v[i] -> v[i + 1]
+    bool   shared[3] { false, false, false }; // is edge shared with another triangle
+  };
+
+  // directed stitch edge (line segment or band polygon edge)
+  struct Edge {
+    Key   k1 { 0 };
+    Key   k2 { 0 };
+    Point p1;
+    Point p2;
+  };
+
+  using Edges     = std::vector<Edge>;
+  using EdgesList = std::vector<Edges>;
+
+  template<typename FUNC>
+  void visitTriangles(int i1, int i2, FUNC f) const;
+
+  Vertex crossVertex(const Vertex &v1, const Vertex &v2, Key e, int l) const;
+
+  int levelClass(double z) const;
+
+  void calcLines() const;
+  void calcBands() const;
+
+  bool isCellValid(int i, int j) const;
+
+  static void chainLines(const Edges &edges, Lines &lines);
+  static void chainRings(const Edges &edges, Rings &rings);
+
+ private:
+  Reals         x_;                    //!< x values
+  Reals         y_;                    //!< y values
+  Reals         z_;                    //!< z values
+  Reals         levels_;               //!< levels
+  mutable bool  linesValid_ { false }; //!< are lines valid
+  mutable bool  bandsValid_ { false }; //!< are bands valid
+  mutable std::vector<Lines> lines_;   //!< lines per level
+  mutable std::vector<Rings> rings_;   //!< rings per band
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include <CQChartsPlot.h>
 #include <CQChartsPlotType.h>
 #include <CQChartsPlotObj.h>
+#include <CQChartsSeriation.h>
 
 class CQChartsFilterModel;
 class CQChartsCorrelationModel;
@@ -69,6 +70,9 @@ class CQChartsCorrelationCellObj : public CQChartsPlotObj {
 
   //---
 
+  int row() const { return row_; }
+  int col() const { return col_; }
+
   double value() const { return value_; }
 
   //---
@@ -134,8 +138,12 @@ class CQChartsCorrelationPlot : public CQChartsPlot,
   Q_PROPERTY(OffDiagonalType upperDiagonalType READ upperDiagonalType WRITE setUpperDiagonalType)
   Q_PROPERTY(OffDiagonalType lowerDiagonalType READ lowerDiagonalType WRITE setLowerDiagonalType)
 
+  // options
+  Q_PROPERTY(SortType sortType READ sortType WRITE setSortType)
+
   Q_ENUMS(DiagonalType)
   Q_ENUMS(OffDiagonalType)
+  Q_ENUMS(SortType)
 
  public:
   enum class DiagonalType {
@@ -154,6 +162,13 @@ class CQChartsCorrelationPlot : public CQChartsPlot,
     CONFIDENCE
   };
 
+  enum class SortType {
+    NONE     /*! model column order */,
+    SPECTRAL /*! spectral (fiedler vector) order */,
+    RCM      /*! reverse Cuthill-McKee order */,
+    CLUSTER  /*! hierarchical cluster leaf order */
+  };
+
   using Angle    = CQChartsAngle;
   using Color    = CQChartsColor;
   using PenData  = CQChartsPenData;
@@ -207,6 +222,16 @@ class CQChartsCorrelationPlot : public CQChartsPlot,
 
   //---
 
+  // options
+  const SortType &sortType() const { return sortType_; }
+  void setSortType(const SortType &t);
+
+  //! get grid position of column (row/column order from sort type)
+  int columnPos(int c) const {
+    return (c >= 0 && c < int(columnPos_.size()) ? columnPos_[size_t(c)] : c); }
+
+  //---
+
   void addProperties() override;
 
   Range calcRange() const override;
@@ -258,6 +283,8 @@ class CQChartsCorrelationPlot : public CQChartsPlot,
   void drawXLabels(PaintDevice *device) const;
   void drawYLabels(PaintDevice *device) const;
 
+  void updateColumnPos() const;
+
  protected:
   CQChartsPlotCustomControls *createCustomControls() override;
 
@@ -276,6 +303,12 @@ class CQChartsCorrelationPlot : public CQChartsPlot,
   DiagonalType      diagonalType_      { DiagonalType::NAME };     //!< diagonal type
   OffDiagonalType   upperDiagonalType_ { OffDiagonalType::PIE };   //!< upper diagonal type
   OffDiagonalType   lowerDiagonalType_ { OffDiagonalType::SHADE }; //!< lower diagonal type
+  SortType          sortType_          { SortType::NONE };         //!< sort type
+
+  using ColumnPos = std::vector<int>;
+
+  mutable ColumnPos         columnPos_; //!< grid position of each column
+  mutable CQChartsSeriation seriation_; //!< seriation (cached orderings)
 };
 
 //---
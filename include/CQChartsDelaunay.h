@@ -1,32 +1,160 @@
 #ifndef CQChartsDelaunay_H
 #define CQChartsDelaunay_H
 
-#include <CQChartsHull3D.h>
+#include <CQChartsGeom.h>
+#include <vector>
 
 /*!
- * \brief Delaunay plot data
+ * \brief Delaunay triangulation and Voronoi diagram of 2D points
  * \ingroup Charts
+ *
+ * Triangles are stored as compact half-edge arrays: half-edge e belongs to triangle e/3,
+ * starts at vertex triangleVertex(e) and oppositeEdge(e) is the matching half-edge of
+ * the adjacent triangle (-1 on the hull).
+ *
+ * The native algorithm inserts points in radial (distance from seed circle) order
+ * keeping an angular hashed convex hull and restores the Delaunay condition with edge
+ * flips. Orientation and in circle tests use floating point error bounds with an exact
+ * (expansion arithmetic) fallback so degenerate input does not corrupt the mesh.
+ *
+ * The Voronoi diagram is derived from the same structure (triangle circumcenters and
+ * adjacent triangle pairs).
  */
-class CQChartsDelaunay : public CQChartsHull3D {
+class CQChartsDelaunay {
+ public:
+  enum class Algorithm {
+    NATIVE, //!< native 2D algorithm
+    HULL3D  //!< lower faces of 3D convex hull of lifted points
+  };
+
+  using Point  = CQChartsGeom::Point;
+  using Points = std::vector<Point>;
+  using BBox   = CQChartsGeom::BBox;
+
+  //! voronoi edge (between centers of adjacent triangles or ray from hull triangle)
+  struct VoronoiEdge {
+    Point p1;            //!< start point (circumcenter)
+    Point p2;            //!< end point
+    int   triangle { -1 }; //!< triangle of start point
+
+    VoronoiEdge() { }
+
+    VoronoiEdge(const Point &p1, const Point &p2, int triangle) :
+     p1(p1), p2(p2), triangle(triangle) {
+    }
+  };
+
+  using VoronoiEdges = std::vector<VoronoiEdge>;
+
  public:
   CQChartsDelaunay();
 
+  //! get/set algorithm
+  const Algorithm &algorithm() const { return algorithm_; }
+  void setAlgorithm(const Algorithm &a) { algorithm_ = a; }
+
   void clear();
 
+  //! add vertex (returns index)
+  int addVertex(double x, double y, double value=0.0);
+
+  int numVertices() const { return int(points_.size()); }
+
+  const Point &vertex(int i) const { return points_[size_t(i)]; }
+
+  double vertexValue(int i) const { return values_[size_t(i)]; }
+  void setVertexValue(int i, double v) { values_[size_t(i)] = v; }
+
+  //! calculate triangulation and voronoi
   bool calc();
 
+  //---
+
+  // triangles
+  int numTriangles() const { return int(triangles_.size()/3); }
+
+  void triangle(int t, int &i1, int &i2, int &i3) const {
+    auto e = size_t(3*t);
+
+    i1 = triangles_[e]; i2 = triangles_[e + 1]; i3 = triangles_[e + 2];
+  }
+
+  int triangleVertex(int e) const { return triangles_[size_t(e)]; }
+
+  int oppositeEdge(int e) const { return halfedges_[size_t(e)]; }
+
+  static int nextEdge(int e) { return (e % 3 == 2 ? e - 2 : e + 1); }
+  static int prevEdge(int e) { return (e % 3 == 0 ? e + 2 : e - 1); }
+
+  //! convex hull vertices
+  const std::vector<int> &hull() const { return hull_; }
+
+  //---
+
+  // voronoi
+
+  //! voronoi vertex (circumcenter) and circle radius of triangle
+  const Point &voronoiPoint(int t) const { return centers_[size_t(t)]; }
+  double voronoiRadius(int t) const { return radii_[size_t(t)]; }
+
+  const VoronoiEdges &voronoiEdges() const { return voronoiEdges_; }
+
+  //! voronoi cell points (circumcenters of triangles around vertex in order)
+  //! Note: cell of hull vertex is unbounded so these points are not a closed polygon
+  void voronoiCell(int i, Points &points) const;
+
+  //! voronoi cell polygon clipped to bbox (hull vertex cells are closed by bbox)
+  void voronoiCell(int i, const BBox &bbox, Points &points) const;
+
+  //---
+
+  // exact predicates
+  static double orient2d(const Point &a, const Point &b, const Point &c);
+  static double incircle(const Point &a, const Point &b, const Point &c, const Point &d);
+
  private:
-  void lowerFaces();
+  bool calcNative();
+  bool calcHull3D();
+
+  int addTriangle(int i0, int i1, int i2, int a, int b, int c);
+
+  void link(int a, int b);
+
+  int legalize(int a);
+
+  int hashKey(const Point &p) const;
 
   void calcVoronoi();
 
-  bool faceCenter(PFace f, double *xc, double *yc, double *r);
+ private:
+  using Reals = std::vector<double>;
+  using Inds  = std::vector<int>;
+
+  Algorithm algorithm_ { Algorithm::NATIVE };
+
+  // input
+  Points points_;
+  Reals  values_;
 
-  PVertex calcEdgePoint(PFace f, PVertex v, PEdge e);
+  // half-edge data
+  Inds triangles_;
+  Inds halfedges_;
+  Inds hull_;
 
-  bool isLeft(double x, double y, PEdge e);
+  // native build state
+  Inds  hullPrev_;
+  Inds  hullNext_;
+  Inds  hullTri_;
+  Inds  hullHash_;
+  Inds  edgeStack_;
+  int   hullStart_ { -1 };
+  Point center_;
 
-  double normz(PFace f);
+  // voronoi
+  Points       centers_;
+  Reals        radii_;
+  Inds         inedges_;
+  VoronoiEdges voronoiEdges_;
 };
 
 #endif
@@ -122,6 +122,9 @@ class CQChartsDelaunayPlot : public CQChartsPlot,
   Q_PROPERTY(bool voronoiCircles READ isVoronoiCircles WRITE setVoronoiCircles)
   Q_PROPERTY(bool voronoiPolygon READ isVoronoiPolygon WRITE setVoronoiPolygon)
 
+  // options
+  Q_PROPERTY(Algorithm algorithm READ algorithm WRITE setAlgorithm)
+
   // delaunay lines
   CQCHARTS_NAMED_LINE_DATA_PROPERTIES (Delaunay, delaunay)
 
@@ -133,7 +136,14 @@ class CQChartsDelaunayPlot : public CQChartsPlot,
   // points (display, symbol)
   CQCHARTS_POINT_DATA_PROPERTIES
 
+  Q_ENUMS(Algorithm)
+
  public:
+  enum class Algorithm {
+    NATIVE, //!< native 2D (sweep hull and edge flip)
+    HULL3D  //!< lower faces of 3D convex hull
+  };
+
   using Color     = CQChartsColor;
   using PenBrush  = CQChartsPenBrush;
   using PenData   = CQChartsPenData;
@@ -185,6 +195,12 @@ class CQChartsDelaunayPlot : public CQChartsPlot,
 
   //---
 
+  // options
+  const Algorithm &algorithm() const { return algorithm_; }
+  void setAlgorithm(const Algorithm &a);
+
+  //---
+
   const QString &yname() const { return yname_; }
 
   //---
@@ -195,6 +211,8 @@ class CQChartsDelaunayPlot : public CQChartsPlot,
 
   void postCalcRange() override;
 
+  bool canProgressiveSample() const override { return true; }
+
   bool createObjs(PlotObjs &objs) const override;
 
   void addPointObj(const Point &p, double value, const QModelIndex &xind,
@@ -241,6 +259,7 @@ class CQChartsDelaunayPlot : public CQChartsPlot,
   bool      voronoi_        { true };    //!< is voronoi
   bool      voronoiCircles_ { false };   //!< voronoi circle
   bool      voronoiPolygon_ { false };   //!< voronoi polygon
+  Algorithm algorithm_      { Algorithm::NATIVE }; //!< triangulation algorithm
   RMinMax   valueRange_;                 //!< value range
   Delaunay* delaunayData_   { nullptr }; //!< delaunay data
   QString   yname_;                      //!< y name
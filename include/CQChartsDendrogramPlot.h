@@ -10,8 +10,7 @@ class CQChartsDendrogramPlot;
 class CQChartsNamePair;
 
 namespace CBuchHeim {
-class Tree;
-class DrawTree;
+class FlatTree;
 }
 
 //---
@@ -429,8 +428,8 @@ class CQChartsDendrogramPlot : public CQChartsPlot,
   void place() const;
 
   void placeBuchheim() const;
-  void addBuchheimHierNode(CBuchHeim::Tree *tree, Node *hierNode) const;
-  void moveBuchheimHierNode(CBuchHeim::DrawTree *tree) const;
+  void initBuchheimTree(Node *root) const;
+  void moveBuchheimNodes() const;
 
   void placeCircular() const;
   void initCircularDepth(Node *hierNode, CircularDepth &circularDepth,
@@ -497,8 +496,9 @@ class CQChartsDendrogramPlot : public CQChartsPlot,
     bool needsReload { true }; //!< needs reload
     bool needsPlace  { true }; //!< needs place
 
-    CBuchHeim::Tree*     buchheimTree     { nullptr }; //!< buchheim tree
-    CBuchHeim::DrawTree* buchheimDrawTree { nullptr }; //!< buchheim draw tree
+    CBuchHeim::FlatTree* buchheimTree  { nullptr }; //!< buchheim tree (all nodes)
+    std::vector<Node *>  buchheimNodes;              //!< buchheim tree index to node
+    bool                 buchheimValid { false };    //!< buchheim tree matches nodes
 
     NodeObj *rootNodeObj { nullptr }; //!< root node obj
 
@@ -0,0 +1,239 @@
+#ifndef CQChartsDisplayList_H
+#define CQChartsDisplayList_H
+
+#include <CQChartsPaintDevice.h>
+#include <CQChartsImage.h>
+
+#include <QPainterPath>
+#include <QTransform>
+#include <vector>
+#include <cstdint>
+
+/*!
+ * \brief Recorded list of paint device calls
+ * \ingroup Charts
+ *
+ * Commands are stored as a compact array of (op, index) pairs. Coordinates and other
+ * numeric arguments are packed into a single real arena and Qt value types (pens,
+ * brushes, fonts, paths, ...) into per type pools (consecutive duplicate pens, brushes
+ * and fonts share the same entry).
+ *
+ * Commands can be grouped into object segments with a bounding box so replay can skip
+ * the draw commands of objects outside the visible area (state commands are always
+ * replayed so later objects see the same state).
+ *
+ * Lists built separately (e.g. for chunks of objects in parallel) can be appended
+ * in order to build a single list.
+ */
+class CQChartsDisplayList {
+ public:
+  using PaintDevice = CQChartsPaintDevice;
+  using GroupData   = CQChartsPaintDevice::GroupData;
+  using Angle       = CQChartsAngle;
+  using Image       = CQChartsImage;
+  using Point       = CQChartsGeom::Point;
+  using BBox        = CQChartsGeom::BBox;
+  using Polygon     = CQChartsGeom::Polygon;
+
+  enum class Op : uint8_t {
+    SAVE,
+    RESTORE,
+    SET_CLIP_PATH,
+    SET_CLIP_RECT,
+    SET_PEN,
+    SET_BRUSH,
+    SET_ALT_COLOR,
+    SET_ALT_ALPHA,
+    SET_FILL_ANGLE,
+    SET_FILL_TYPE,
+    SET_FILL_RADIUS,
+    SET_FILL_DELTA,
+    SET_FILL_WIDTH,
+    SET_FONT,
+    SET_TRANSFORM_ROTATE,
+    SET_TRANSFORM,
+    SET_RENDER_HINTS,
+    SET_COLOR_NAMES,
+    SET_DEFAULT_COLOR_NAMES,
+    RESET_COLOR_NAMES,
+    SET_ZOOM_FONT,
+    START_GROUP,
+    END_GROUP,
+    // draw commands (after this are skipped for culled segments)
+    FILL_PATH,
+    STROKE_PATH,
+    DRAW_PATH,
+    FILL_RECT,
+    DRAW_RECT,
+    DRAW_ELLIPSE,
+    DRAW_POLYGON,
+    DRAW_POLYLINE,
+    DRAW_LINE,
+    DRAW_POINT,
+    DRAW_TEXT,
+    DRAW_TRANSFORMED_TEXT,
+    DRAW_IMAGE,
+    DRAW_IMAGE_IN_RECT
+  };
+
+ public:
+  CQChartsDisplayList();
+
+  void clear();
+
+  bool isEmpty() const { return cmds_.empty(); }
+
+  int numCmds() const { return int(cmds_.size()); }
+
+  int numSegments() const { return int(segments_.size()); }
+
+  //! approximate memory used (bytes)
+  size_t memUsage() const;
+
+  //---
+
+  // object segments
+  void beginSegment(const BBox &bbox);
+  void endSegment();
+
+  //---
+
+  // state
+  void addSave   () { addCmd(Op::SAVE   , -1); }
+  void addRestore() { addCmd(Op::RESTORE, -1); }
+
+  void addClipPath(const QPainterPath &path, Qt::ClipOperation op);
+  void addClipRect(const BBox &bbox, Qt::ClipOperation op);
+
+  void addPen  (const QPen &pen);
+  void addBrush(const QBrush &brush);
+
+  void addAltColor(const QColor &c);
+  void addReal(const Op &op, double r);
+  void addInt (const Op &op, int i);
+
+  void addFont(const QFont &font, bool scale);
+
+  void addTransformRotate(const Point &p, double angle);
+  void addTransform(const QTransform &t, bool combine);
+
+  void addRenderHints(QPainter::RenderHints hints, bool on);
+
+  void addColorNames(const QString &strokeName, const QString &fillName);
+  void addDefaultColorNames() { addCmd(Op::SET_DEFAULT_COLOR_NAMES, -1); }
+  void addResetColorNames() { addCmd(Op::RESET_COLOR_NAMES, -1); }
+
+  void addZoomFont(bool b) { addCmd(Op::SET_ZOOM_FONT, b ? 1 : 0); }
+
+  void addStartGroup(const QString &id, const GroupData &groupData);
+  void addEndGroup() { addCmd(Op::END_GROUP, -1); }
+
+  //---
+
+  // draw
+  void addPath(const Op &op, const QPainterPath &path);
+
+  void addFillPath  (const QPainterPath &path, const QBrush &brush);
+  void addStrokePath(const QPainterPath &path, const QPen &pen);
+
+  void addRect(const Op &op, const BBox &bbox);
+
+  void addEllipse(const BBox &bbox, const Angle &angle);
+
+  void addPolygon(const Op &op, const Polygon &poly);
+
+  void addLine(const Point &p1, const Point &p2);
+
+  void addPoint(const Point &p);
+
+  void addText(const Op &op, const Point &p, const QString &text);
+
+  void addImage(const Point &p, const QImage &image);
+
+  void addImageInRect(const BBox &bbox, const Image &image, bool stretch, const Angle &angle);
+
+  //---
+
+  //! append list (commands from list are added after current commands)
+  void append(const CQChartsDisplayList &list);
+
+  //! replay commands on device (skip draw of segments outside cull rect if valid)
+  void replay(PaintDevice *device, const BBox &cullRect=BBox()) const;
+
+ private:
+  enum class Pool {
+    NONE,
+    REAL,
+    PEN,
+    BRUSH,
+    FONT,
+    PATH,
+    STRING,
+    TRANSFORM,
+    QIMAGE,
+    IMAGE,
+    GROUP
+  };
+
+  //! command (op and index into arena/pool for op)
+  struct Cmd {
+    Op      op  { Op::SAVE };
+    int32_t ind { -1 };
+
+    Cmd() { }
+
+    Cmd(const Op &op, int ind) :
+     op(op), ind(ind) {
+    }
+  };
+
+  //! object segment (range of commands [start, end) with bounding box)
+  struct Segment {
+    BBox bbox;
+    int  start { 0 };
+    int  end   { 0 };
+  };
+
+  using Cmds       = std::vector<Cmd>;
+  using Reals      = std::vector<double>;
+  using Pens       = std::vector<QPen>;
+  using Brushes    = std::vector<QBrush>;
+  using Fonts      = std::vector<QFont>;
+  using Paths      = std::vector<QPainterPath>;
+  using Strings    = std::vector<QString>;
+  using Transforms = std::vector<QTransform>;
+  using QImages    = std::vector<QImage>;
+  using Images     = std::vector<Image>;
+  using Groups     = std::vector<GroupData>;
+  using Segments   = std::vector<Segment>;
+
+  static Pool opPool(const Op &op);
+
+  static bool isDrawOp(const Op &op) { return op >= Op::FILL_PATH; }
+
+  void addCmd(const Op &op, int ind) { cmds_.emplace_back(op, ind); }
+
+  int addReals(std::initializer_list<double> values);
+
+  void replayCmd(PaintDevice *device, const Cmd &cmd) const;
+
+  const double *reals(int ind) const { return &reals_[size_t(ind)]; }
+
+ private:
+  Cmds       cmds_;
+  Reals      reals_;
+  Pens       pens_;
+  Brushes    brushes_;
+  Fonts      fonts_;
+  Paths      paths_;
+  Strings    strings_;
+  Transforms transforms_;
+  QImages    qimages_;
+  Images     images_;
+  Groups     groups_;
+  Segments   segments_;
+  int        segmentStart_ { -1 };
+  BBox       segmentBBox_;
+};
+
+#endif
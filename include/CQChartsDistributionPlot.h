@@ -757,6 +757,9 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
 
   void initBucketer(CQBucketer &bucketer);
 
+  //! update for changed bucket settings (re-bucket cached sorted values)
+  void updateBuckets();
+
   //---
 
   PlotType plotType() const { return plotType_; }
@@ -870,6 +873,9 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
 
   //---
 
+  void updateRange() override;
+  void updateRangeAndObjs() override;
+
   Range calcRange() const override;
 
   bool createObjs(PlotObjs &objs) const override;
@@ -936,16 +942,39 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
 
   using VariantInds = std::vector<VariantInd>;
 
+  //! real value and its variant data (sorted by value for re-bucket)
+  struct SortedValue {
+    double     r { 0.0 };
+    VariantInd vind;
+
+    SortedValue(double r, const VariantInd &vind) :
+     r(r), vind(vind) {
+    }
+  };
+
+  using SortedValues = std::vector<SortedValue>;
+
   /*!
    * \brief Model Index Variant Set Data
    * \ingroup Charts
    */
   struct VariantIndsData {
-    VariantInds inds;         //!< model indices
-    double      min  { 0.0 }; //!< min value
-    double      max  { 0.0 }; //!< max value
-    CQStatData  statData;     //!< stats data
-    RMinMax     valueRange;   //!< value range
+    VariantInds         inds;                     //!< model indices (if not sorted)
+    const SortedValues* sortedValues { nullptr }; //!< group sorted values (if sorted)
+    int                 i1           { 0 };       //!< start of sorted values range
+    int                 i2           { 0 };       //!< end of sorted values range
+    double              min          { 0.0 };     //!< min value
+    double              max          { 0.0 };     //!< max value
+    CQStatData          statData;                 //!< stats data
+    RMinMax             valueRange;               //!< value range
+
+    //! number of model indices
+    int numInds() const { return (sortedValues ? i2 - i1 : int(inds.size())); }
+
+    //! get i'th model index
+    const VariantInd &ind(int i) const {
+      return (sortedValues ? (*sortedValues)[size_t(i1 + i)].vind : inds[size_t(i)]);
+    }
   };
 
   using BarValue = CQChartsDistributionBarValue;
@@ -995,6 +1024,7 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
     Inds              inds;                      //!< value indices
     CQChartsValueSet* valueSet      { nullptr }; //!< value set
     BucketValues      bucketValues;              //!< values in each bucket
+    SortedValues      sortedValues;              //!< sorted real values (ranges per bucket)
     DensityP          densityData;               //!< density data
     CQStatData        statData;                  //!< stat data
     RMinMax           xValueRange;               //!< x value range
@@ -1016,7 +1046,9 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
   using GroupBucketRange = std::map<int, IMinMax>;
 
  private:
-  void bucketGroupValues() const;
+  void bucketGroupValues(bool rebucket) const;
+
+  void bucketSortedValues(int groupInd, Values *values) const;
 
   Range calcBucketRanges() const;
 
@@ -1145,6 +1177,21 @@ class CQChartsDistributionPlot : public CQChartsBarPlot,
     GroupBucketRange groupBucketRange; //!< bucketer per group
   };
 
+  /*!
+   * \brief Sorted values cache data
+   * \ingroup Charts
+   *
+   * Bucketed numeric values of each group are kept sorted so a change of bucket
+   * settings only needs a binary search for each bucket's value range (no model visit).
+   * Invalidated by any other range update.
+   */
+  struct BucketCacheData {
+    bool valid    { false }; //!< sorted values valid for all groups
+    bool rebucket { false }; //!< next range calc only needs re-bucket
+  };
+
+  BucketCacheData bucketCacheData_; //!< sorted values cache data
+
   Column      nameColumn_;                          //!< name column
   Column      dataColumn_;                          //!< data column
   PlotType    plotType_       { PlotType::NORMAL }; //!< plot type
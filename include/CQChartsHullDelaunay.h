@@ -0,0 +1,32 @@
+#ifndef CQChartsHullDelaunay_H
+#define CQChartsHullDelaunay_H
+
+#include <CQChartsHull3D.h>
+
+/*!
+ * \brief Delaunay triangulation using lower faces of 3D convex hull of lifted points
+ * \ingroup Charts
+ */
+class CQChartsHullDelaunay : public CQChartsHull3D {
+ public:
+  CQChartsHullDelaunay();
+
+  void clear();
+
+  bool calc();
+
+ private:
+  void lowerFaces();
+
+  void calcVoronoi();
+
+  bool faceCenter(PFace f, double *xc, double *yc, double *r);
+
+  PVertex calcEdgePoint(PFace f, PVertex v, PEdge e);
+
+  bool isLeft(double x, double y, PEdge e);
+
+  double normz(PFace f);
+};
+
+#endif
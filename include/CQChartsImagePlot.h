@@ -5,6 +5,9 @@
 #include <CQChartsPlotType.h>
 #include <CQChartsPlotObj.h>
 
+#include <QImage>
+#include <mutex>
+
 //---
 
 /*!
@@ -69,6 +72,8 @@ class CQChartsImageObj : public CQChartsPlotObj {
 
   double value() const { return value_; }
 
+  bool isImage() const { return columnType_ == CQBaseModelType::IMAGE; }
+
   //---
 
   const CQChartsColor &bgColor() const { return bgColor_; }
@@ -77,6 +82,10 @@ class CQChartsImageObj : public CQChartsPlotObj {
   const CQChartsColor &fgColor() const { return fgColor_; }
   void setFgColor(const CQChartsColor &c) { fgColor_ = c; }
 
+  //! get/set precalculated cell fill color (batched palette lookup)
+  const QColor &lutFillColor() const { return lutFillColor_; }
+  void setLutFillColor(const QColor &c) { lutFillColor_ = c; }
+
   //---
 
   void getObjSelectIndices(Indices &inds) const override;
@@ -101,6 +110,7 @@ class CQChartsImageObj : public CQChartsPlotObj {
   CQBaseModelType columnType_ { CQBaseModelType::REAL }; //!< data type
   CQChartsColor   bgColor_;                              //!< optional background color
   CQChartsColor   fgColor_;                              //!< optional foreground color
+  QColor          lutFillColor_;                         //!< precalculated cell fill color
 };
 
 //---
@@ -125,6 +135,11 @@ class CQChartsImagePlot : public CQChartsPlot,
 
   Q_PROPERTY(bool cellLabels READ isCellLabels WRITE setCellLabels)
 
+  // draw type (cell objects or raster)
+  Q_PROPERTY(DrawType    drawType    READ drawType    WRITE setDrawType   )
+  Q_PROPERTY(int         maxCellObjs READ maxCellObjs WRITE setMaxCellObjs)
+  Q_PROPERTY(RasterValue rasterValue READ rasterValue WRITE setRasterValue)
+
 //Q_PROPERTY(bool scaleCellLabels READ isScaleCellLabels WRITE setScaleCellLabels)
 
   CQCHARTS_NAMED_SHAPE_DATA_PROPERTIES(Cell, cell)
@@ -141,6 +156,8 @@ class CQChartsImagePlot : public CQChartsPlot,
   CQCHARTS_NAMED_TEXT_DATA_PROPERTIES(YLabel, yLabel)
 
   Q_ENUMS(CellStyle)
+  Q_ENUMS(DrawType)
+  Q_ENUMS(RasterValue)
 
  public:
   enum class CellStyle {
@@ -148,6 +165,18 @@ class CQChartsImagePlot : public CQChartsPlot,
     BALLOON
   };
 
+  enum class DrawType {
+    AUTO   /*! cell objects if visible cell count <= maxCellObjs, otherwise raster */,
+    CELLS  /*! cell objects */,
+    RASTER /*! raster of cell values */
+  };
+
+  enum class RasterValue {
+    MIN  /*! min value of cells in raster pixel */,
+    MEAN /*! mean value of cells in raster pixel */,
+    MAX  /*! max value of cells in raster pixel */
+  };
+
   using Image    = CQChartsImage;
   using ImageObj = CQChartsImageObj;
   using Color    = CQChartsColor;
@@ -208,6 +237,21 @@ class CQChartsImagePlot : public CQChartsPlot,
 
   //---
 
+  // draw type
+  const DrawType &drawType() const { return drawType_; }
+  void setDrawType(const DrawType &t);
+
+  int maxCellObjs() const { return maxCellObjs_; }
+  void setMaxCellObjs(int n);
+
+  const RasterValue &rasterValue() const { return rasterValue_; }
+  void setRasterValue(const RasterValue &v);
+
+  //! are cells drawn as raster (no cell objects)
+  bool isDrawRaster() const { return drawRaster_; }
+
+  //---
+
   void addProperties() override;
 
   Range calcRange() const override;
@@ -220,10 +264,22 @@ class CQChartsImagePlot : public CQChartsPlot,
 
   //---
 
+  void applyDataRangeAndDraw() override;
+
+  bool plotTipText(const Point &p, QString &tip, bool single) const override;
+
+  //---
+
   bool addMenuItems(QMenu *menu) override;
 
   //---
 
+  void preDrawObjs(PaintDevice *device) const override;
+
+  bool hasBackground() const override;
+
+  void execDrawBackground(PaintDevice *device) const override;
+
   bool hasForeground() const override;
 
   void execDrawForeground(PaintDevice *device) const override;
@@ -259,6 +315,40 @@ class CQChartsImagePlot : public CQChartsPlot,
   virtual ImageObj *createImageObj(const BBox &rect, int row, int col,
                                    const Image &image, const QModelIndex &ind) const;
 
+  //---
+
+  //! range of rows/columns (inclusive)
+  struct CellRange {
+    bool set { false };
+    int  r1  { 0 }, r2 { -1 };
+    int  c1  { 0 }, c2 { -1 };
+
+    int numCells() const { return (set ? (r2 - r1 + 1)*(c2 - c1 + 1) : 0); }
+
+    bool contains(const CellRange &r) const {
+      return (set && r.set && r.r1 >= r1 && r.r2 <= r2 && r.c1 >= c1 && r.c2 <= c2);
+    }
+  };
+
+  void calcVisibleCellRange(CellRange &range) const;
+
+  bool isCellObjs(const CellRange &visibleRange) const;
+
+  bool cellAtPoint(const Point &p, int &row, int &col) const;
+
+  //---
+
+  void drawRaster(PaintDevice *device) const;
+
+  void updateRasterLevels() const;
+
+  //! raster tile size (texels)
+  static int rasterTileSize() { return 256; }
+
+  const QImage &rasterTile(int level, int tr, int tc) const;
+
+  float rasterTexelValue(int level, int r, int c) const;
+
  protected:
   CQChartsPlotCustomControls *createCustomControls() override;
 
@@ -274,6 +364,58 @@ class CQChartsImagePlot : public CQChartsPlot,
   double    maxValue_        { 0.0 };             //!< max value
   double    minBalloonSize_  { 0.1 };             //!< min balloon size (cell fraction)
   double    maxBalloonSize_  { 1.0 };             //!< max balloon size (cell fraction)
+
+  // draw type
+  DrawType    drawType_    { DrawType::AUTO };    //!< draw type
+  int         maxCellObjs_ { 10000 };             //!< max cell objects for auto draw type
+  RasterValue rasterValue_ { RasterValue::MEAN }; //!< raster pixel value
+  bool        drawRaster_  { false };             //!< draw cells as raster
+  CellRange   cellObjRange_;                      //!< range of created cell objects
+
+  using Values = std::vector<float>;
+  using Counts = std::vector<int>;
+
+  //! cell values (row major, NaN for missing or image values)
+  struct GridData {
+    int    nr        { 0 };     //!< number of rows
+    int    nc        { 0 };     //!< number of columns
+    Values values;              //!< values
+    bool   hasImages { false }; //!< has image cells
+  };
+
+  GridData gridData_; //!< cell values
+
+  using TileImages = std::vector<QImage>;
+
+  //! raster mip level (texel is min/mean/max of 2^n x 2^n cells, level 0 is grid)
+  struct RasterLevel {
+    int        nr  { 0 }; //!< number of texel rows
+    int        nc  { 0 }; //!< number of texel columns
+    Values     minValues;  //!< min cell value
+    Values     meanValues; //!< mean cell value
+    Values     maxValues;  //!< max cell value
+    Counts     counts;     //!< number of non-missing cells
+    int        ntr { 0 }; //!< number of tile rows
+    int        ntc { 0 }; //!< number of tile columns
+    TileImages tiles;     //!< colored tiles (created on demand)
+  };
+
+  using RasterLevels = std::vector<RasterLevel>;
+  using RGBs         = std::vector<QRgb>;
+
+  //! raster data
+  struct RasterData {
+    bool         valid     { false };             //!< are levels valid
+    RasterLevels levels;                          //!< mip levels
+    RGBs         colors;                          //!< palette samples used for tiles
+    RasterValue  value     { RasterValue::MEAN }; //!< texel value used for tiles
+    double       minValue  { 0.0 };               //!< min value used for tiles
+    double       maxValue  { 0.0 };               //!< max value used for tiles
+    double       fillAlpha { 1.0 };               //!< fill alpha used for tiles
+  };
+
+  mutable RasterData rasterData_;  //!< raster data
+  mutable std::mutex rasterMutex_; //!< raster data mutex
 };
 
 //---
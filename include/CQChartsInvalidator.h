@@ -21,6 +21,9 @@ class CQChartsInvalidator {
 
   virtual void invalidate(bool reload);
 
+  //! invalidate for change of named property (plot property stages replace invalidate)
+  void invalidateProperty(const char *name, bool reload);
+
  protected:
   QObject* obj_ { nullptr };
 };
@@ -61,6 +61,21 @@ class CQChartsLoader {
   FilterModel *createCorrelationModel(QAbstractItemModel *model,
                                       const CorrelationData &correlationData=CorrelationData());
 
+  //---
+
+  struct ClusterData {
+    ClusterData() { }
+
+    Columns        columns;             //!< value columns (default all numeric)
+    CQChartsColumn nameColumn;          //!< row name column (default vertical header)
+    QString        linkage   { "ward" }; //!< linkage (ward, average, complete, single)
+    bool           normalize { false };  //!< normalize column values
+    int            maxMemory { 1024 };   //!< max distance matrix memory (MB)
+  };
+
+  FilterModel *createClusterModel(QAbstractItemModel *model,
+                                  const ClusterData &clusterData=ClusterData());
+
  private:
   void setFilter(ModelFilter *model, const InputData &inputData);
 
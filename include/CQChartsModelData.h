@@ -351,7 +351,7 @@ class CQChartsModelData : public QObject {
   void modelColumnsInsertedSlot();
   void modelColumnsRemovedSlot();
 
-  void selectionSlot();
+  void selectionSlot(const QItemSelection &selected, const QItemSelection &deselected);
 
   void fileChangedSlot(const QString &);
 
@@ -368,8 +368,9 @@ class CQChartsModelData : public QObject {
   // current model column changed
   void currentColumnChanged(int);
 
-  // selection changed
-  void selectionChanged(QItemSelectionModel *sm);
+  // selection changed (selected and deselected are changed items)
+  void selectionChanged(QItemSelectionModel *sm, const QItemSelection &selected,
+                        const QItemSelection &deselected);
 
   // model data deleted
   void deleted();
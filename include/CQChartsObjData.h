@@ -63,13 +63,13 @@ class CQChartsObjLineData {
   bool isLines() const { return lineData_.isVisible(); }
   void setLines(bool b) {
     if (b != lineData_.isVisible()) {
-      lineData_.setVisible(b); lineDataInvalidate(/*reload*/isReloadObj()); }
+      lineData_.setVisible(b); lineDataInvalidate(/*reload*/isReloadObj(), "lines"); }
   }
 
   const Color &linesColor() const { return lineData_.color(); }
   void setLinesColor(const Color &c) {
     if (c != lineData_.color()) {
-      lineData_.setColor(c); lineDataInvalidate(); }
+      lineData_.setColor(c); lineDataInvalidate(false, "linesColor"); }
   }
 
   QColor interpLinesColor(const ColorInd &ind) const {
@@ -79,31 +79,31 @@ class CQChartsObjLineData {
   const Alpha &linesAlpha() const { return lineData_.alpha(); }
   void setLinesAlpha(const Alpha &a) {
     if (a != lineData_.alpha()) {
-      lineData_.setAlpha(a); lineDataInvalidate(); }
+      lineData_.setAlpha(a); lineDataInvalidate(false, "linesAlpha"); }
   }
 
   const Length &linesWidth() const { return lineData_.width(); }
   void setLinesWidth(const Length &l) {
     if (l != lineData_.width()) {
-      lineData_.setWidth(l); lineDataInvalidate(/*reload*/isReloadObj()); }
+      lineData_.setWidth(l); lineDataInvalidate(/*reload*/isReloadObj(), "linesWidth"); }
    }
 
   const LineDash &linesDash() const { return lineData_.dash(); }
   void setLinesDash(const LineDash &d) {
     if (d != lineData_.dash()) {
-      lineData_.setDash(d); lineDataInvalidate(); }
+      lineData_.setDash(d); lineDataInvalidate(false, "linesDash"); }
   }
 
   const LineCap &linesCap() const { return lineData_.lineCap(); }
   void setLinesCap(const LineCap &c) {
     if (c != lineData_.lineCap()) {
-      lineData_.setLineCap(c); lineDataInvalidate(); }
+      lineData_.setLineCap(c); lineDataInvalidate(false, "linesCap"); }
   }
 
   const LineJoin &linesJoin() const { return lineData_.lineJoin(); }
   void setLinesJoin(const LineJoin &j) {
     if (j != lineData_.lineJoin()) {
-      lineData_.setLineJoin(j); lineDataInvalidate(); }
+      lineData_.setLineJoin(j); lineDataInvalidate(false, "linesJoin"); }
   }
 
   void setLineDataPen(QPen &pen, const ColorInd &ind) const {
@@ -130,12 +130,13 @@ class CQChartsObjLineData {
   const LineData &lineData() const { return lineData_; }
 
   void setLineData(const LineData &data) {
-    lineData_ = data; lineDataInvalidate(/*reload*/isReloadObj());
+    lineData_ = data; lineDataInvalidate(/*reload*/isReloadObj(), "lineData");
   };
 
  private:
-  virtual void lineDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void lineDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -201,13 +202,14 @@ class CQChartsObj##UNAME##LineData { \
   bool is##UNAME##Lines() const { return LNAME##LineData_.isVisible(); } \
   void set##UNAME##Lines(bool b) { \
     if (b != LNAME##LineData_.isVisible()) { \
-      LNAME##LineData_.setVisible(b); LNAME##LineDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##LineData_.setVisible(b); \
+      LNAME##LineDataInvalidate(is##UNAME##ReloadObj(), #LNAME "Lines"); } \
   } \
 \
   const Color &LNAME##LinesColor() const { return LNAME##LineData_.color(); } \
   void set##UNAME##LinesColor(const Color &c) { \
     if (c != LNAME##LineData_.color()) { \
-      LNAME##LineData_.setColor(c); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setColor(c); LNAME##LineDataInvalidate(false, #LNAME "LinesColor"); } \
   } \
 \
   QColor interp##UNAME##LinesColor(const ColorInd &ind) const { \
@@ -217,31 +219,31 @@ class CQChartsObj##UNAME##LineData { \
   const Alpha &LNAME##LinesAlpha() const { return LNAME##LineData_.alpha(); } \
   void set##UNAME##LinesAlpha(const Alpha &a) { \
     if (a != LNAME##LineData_.alpha()) { \
-      LNAME##LineData_.setAlpha(a); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setAlpha(a); LNAME##LineDataInvalidate(false, #LNAME "LinesAlpha"); } \
   } \
 \
   const Length &LNAME##LinesWidth() const { return LNAME##LineData_.width(); } \
   void set##UNAME##LinesWidth(const Length &l) { \
     if (l != LNAME##LineData_.width()) { \
-      LNAME##LineData_.setWidth(l); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setWidth(l); LNAME##LineDataInvalidate(false, #LNAME "LinesWidth"); } \
    } \
 \
   const LineDash &LNAME##LinesDash() const { return LNAME##LineData_.dash(); } \
   void set##UNAME##LinesDash(const LineDash &d) { \
     if (d != LNAME##LineData_.dash()) { \
-      LNAME##LineData_.setDash(d); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setDash(d); LNAME##LineDataInvalidate(false, #LNAME "LinesDash"); } \
   } \
 \
   const LineCap &LNAME##LinesCap() const { return LNAME##LineData_.lineCap(); } \
   void set##UNAME##LinesCap(const LineCap &c) { \
     if (c != LNAME##LineData_.lineCap()) { \
-      LNAME##LineData_.setLineCap(c); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setLineCap(c); LNAME##LineDataInvalidate(false, #LNAME "LinesCap"); } \
   } \
 \
   const LineJoin &LNAME##LinesJoin() const { return LNAME##LineData_.lineJoin(); } \
   void set##UNAME##LinesJoin(const LineJoin &j) { \
     if (j != LNAME##LineData_.lineJoin()) { \
-      LNAME##LineData_.setLineJoin(j); LNAME##LineDataInvalidate(); } \
+      LNAME##LineData_.setLineJoin(j); LNAME##LineDataInvalidate(false, #LNAME "LinesJoin"); } \
   } \
 \
   void set##UNAME##LineDataPen(QPen &pen, const ColorInd &ind) const { \
@@ -266,13 +268,13 @@ class CQChartsObj##UNAME##LineData { \
   const LineData &LNAME##LineData() const { return LNAME##LineData_; } \
 \
   void set##UNAME##LineData(const LineData &data) { \
-    LNAME##LineData_ = data; LNAME##LineDataInvalidate(); \
+    LNAME##LineData_ = data; LNAME##LineDataInvalidate(false, #LNAME "LineData"); \
   } \
 \
  private: \
-  virtual void LNAME##LineDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##LineDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
@@ -362,31 +364,31 @@ class CQChartsObjPointData {
   bool isPoints() const { return pointData_.isVisible(); }
   void setPoints(bool b) {
     if (b != pointData_.isVisible()) {
-      pointData_.setVisible(b); pointDataInvalidate(isReloadObj()); }
+      pointData_.setVisible(b); pointDataInvalidate(isReloadObj(), "points"); }
   }
 
   const Symbol &symbol() const { return pointData_.symbol(); }
   void setSymbol(const Symbol &s) {
     if (s != pointData_.symbol()) {
-      pointData_.setSymbol(s); pointDataInvalidate(); }
+      pointData_.setSymbol(s); pointDataInvalidate(false, "symbol"); }
   }
 
   const Length &symbolSize() const { return pointData_.size(); }
   void setSymbolSize(const Length &l) {
     if (l != pointData_.size()) {
-      pointData_.setSize(l); pointDataInvalidate(isReloadObj()); }
+      pointData_.setSize(l); pointDataInvalidate(isReloadObj(), "symbolSize"); }
   }
 
   bool isSymbolStroked() const { return pointData_.stroke().isVisible(); }
   void setSymbolStroked(bool b) {
     if (b != pointData_.stroke().isVisible()) {
-      pointData_.stroke().setVisible(b); pointDataInvalidate(); }
+      pointData_.stroke().setVisible(b); pointDataInvalidate(false, "symbolStroked"); }
   }
 
   const Color &symbolStrokeColor() const { return pointData_.stroke().color(); }
   void setSymbolStrokeColor(const Color &c) {
     if (c != pointData_.stroke().color()) {
-      pointData_.stroke().setColor(c); pointDataInvalidate(); }
+      pointData_.stroke().setColor(c); pointDataInvalidate(false, "symbolStrokeColor"); }
   }
 
   QColor interpSymbolStrokeColor(const ColorInd &ind) const {
@@ -396,43 +398,43 @@ class CQChartsObjPointData {
   const Alpha &symbolStrokeAlpha() const { return pointData_.stroke().alpha(); }
   void setSymbolStrokeAlpha(const Alpha &a) {
     if (a != pointData_.stroke().alpha()) {
-      pointData_.stroke().setAlpha(a); pointDataInvalidate(); }
+      pointData_.stroke().setAlpha(a); pointDataInvalidate(false, "symbolStrokeAlpha"); }
   }
 
   const Length &symbolStrokeWidth() const { return pointData_.stroke().width(); }
   void setSymbolStrokeWidth(const Length &l) {
     if (l != pointData_.stroke().width()) {
-      pointData_.stroke().setWidth(l); pointDataInvalidate(); }
+      pointData_.stroke().setWidth(l); pointDataInvalidate(false, "symbolStrokeWidth"); }
   }
 
   const LineDash &symbolStrokeDash() const { return pointData_.stroke().dash(); }
   void setSymbolStrokeDash(const LineDash &d) {
     if (d != pointData_.stroke().dash()) {
-      pointData_.stroke().setDash(d); pointDataInvalidate(); }
+      pointData_.stroke().setDash(d); pointDataInvalidate(false, "symbolStrokeDash"); }
   }
 
   const LineCap &symbolStrokeCap() const { return pointData_.stroke().lineCap(); }
   void setSymbolStrokeCap(const LineCap &c) {
     if (c != pointData_.stroke().lineCap()) {
-      pointData_.stroke().setLineCap(c); pointDataInvalidate(); }
+      pointData_.stroke().setLineCap(c); pointDataInvalidate(false, "symbolStrokeCap"); }
   }
 
   const LineJoin &symbolStrokeJoin() const { return pointData_.stroke().lineJoin(); }
   void setSymbolStrokeJoin(const LineJoin &j) {
     if (j != pointData_.stroke().lineJoin()) {
-      pointData_.stroke().setLineJoin(j); pointDataInvalidate(); }
+      pointData_.stroke().setLineJoin(j); pointDataInvalidate(false, "symbolStrokeJoin"); }
   }
 
   bool isSymbolFilled() const { return pointData_.fill().isVisible(); }
   void setSymbolFilled(bool b) {
     if (b != pointData_.fill().isVisible()) {
-      pointData_.fill().setVisible(b); pointDataInvalidate(); }
+      pointData_.fill().setVisible(b); pointDataInvalidate(false, "symbolFilled"); }
   }
 
   const Color &symbolFillColor() const { return pointData_.fill().color(); }
   void setSymbolFillColor(const Color &c) {
     if (c != pointData_.fill().color()) {
-      pointData_.fill().setColor(c); pointDataInvalidate(); }
+      pointData_.fill().setColor(c); pointDataInvalidate(false, "symbolFillColor"); }
   }
 
   QColor interpSymbolFillColor(const ColorInd &ind) const {
@@ -442,13 +444,13 @@ class CQChartsObjPointData {
   const Alpha &symbolFillAlpha() const { return pointData_.fill().alpha(); }
   void setSymbolFillAlpha(const Alpha &a) {
     if (a != pointData_.fill().alpha()) {
-      pointData_.fill().setAlpha(a); pointDataInvalidate(); }
+      pointData_.fill().setAlpha(a); pointDataInvalidate(false, "symbolFillAlpha"); }
   }
 
   const FillPattern &symbolFillPattern() const { return pointData_.fill().pattern(); }
   void setSymbolFillPattern(const FillPattern &p) {
     if (p != pointData_.fill().pattern()) {
-      pointData_.fill().setPattern(p); pointDataInvalidate(); }
+      pointData_.fill().setPattern(p); pointDataInvalidate(false, "symbolFillPattern"); }
   }
 
   //---
@@ -475,12 +477,13 @@ class CQChartsObjPointData {
   const SymbolData &symbolData() const { return pointData_; }
 
   void setSymbolData(const SymbolData &data) {
-    pointData_ = data; pointDataInvalidate();
+    pointData_ = data; pointDataInvalidate(false, "symbolData");
   };
 
  private:
-  virtual void pointDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void pointDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -570,31 +573,35 @@ class CQChartsObj##UNAME##PointData { \
   bool is##UNAME##Points() const { return LNAME##PointData_.isVisible(); } \
   void set##UNAME##Points(bool b) { \
     if (b != LNAME##PointData_.isVisible()) { \
-      LNAME##PointData_.setVisible(b); LNAME##PointDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##PointData_.setVisible(b); \
+      LNAME##PointDataInvalidate(is##UNAME##ReloadObj(), #LNAME "Points"); } \
   } \
 \
   const Symbol &LNAME##Symbol() const { return LNAME##PointData_.symbol(); } \
   void set##UNAME##Symbol(const Symbol &s) { \
     if (s != LNAME##PointData_.symbol()) { \
-      LNAME##PointData_.setSymbol(s); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.setSymbol(s); LNAME##PointDataInvalidate(false, #LNAME "Symbol"); } \
   } \
 \
   const Length &LNAME##SymbolSize() const { return LNAME##PointData_.size(); } \
   void set##UNAME##SymbolSize(const Length &s) { \
     if (s != LNAME##PointData_.size()) { \
-      LNAME##PointData_.setSize(s); LNAME##PointDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##PointData_.setSize(s); \
+      LNAME##PointDataInvalidate(is##UNAME##ReloadObj(), #LNAME "SymbolSize"); } \
   } \
 \
   bool is##UNAME##SymbolStroked() const { return LNAME##PointData_.stroke().isVisible(); } \
   void set##UNAME##SymbolStroked(bool b) { \
     if (b != LNAME##PointData_.stroke().isVisible()) { \
-      LNAME##PointData_.stroke().setVisible(b); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setVisible(b); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStroked"); } \
   } \
 \
   const Color &LNAME##SymbolStrokeColor() const { return LNAME##PointData_.stroke().color(); } \
   void set##UNAME##SymbolStrokeColor(const Color &c) { \
     if (c != LNAME##PointData_.stroke().color()) { \
-      LNAME##PointData_.stroke().setColor(c); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setColor(c); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeColor"); } \
   } \
 \
   QColor interp##UNAME##SymbolStrokeColor(const ColorInd &ind) const { \
@@ -605,45 +612,51 @@ class CQChartsObj##UNAME##PointData { \
   const Alpha &LNAME##SymbolStrokeAlpha() const { return LNAME##PointData_.stroke().alpha(); } \
   void set##UNAME##SymbolStrokeAlpha(const Alpha &a) { \
     if (a != LNAME##PointData_.stroke().alpha()) { \
-      LNAME##PointData_.stroke().setAlpha(a); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setAlpha(a); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeAlpha"); } \
   } \
 \
   const Length &LNAME##SymbolStrokeWidth() const { return LNAME##PointData_.stroke().width(); } \
   void set##UNAME##SymbolStrokeWidth(const Length &l) { \
     if (l != LNAME##PointData_.stroke().width()) { \
-      LNAME##PointData_.stroke().setWidth(l); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setWidth(l); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeWidth"); } \
   } \
 \
   const LineDash &LNAME##SymbolStrokeDash() const { return LNAME##PointData_.stroke().dash(); } \
   void set##UNAME##SymbolStrokeDash(const LineDash &d) { \
     if (d != LNAME##PointData_.stroke().dash()) { \
-      LNAME##PointData_.stroke().setDash(d); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setDash(d); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeDash"); } \
   } \
 \
   const LineCap &LNAME##SymbolStrokeCap() const { return LNAME##PointData_.stroke().lineCap(); } \
   void set##UNAME##SymbolStrokeCap(const LineCap &c) { \
     if (c != LNAME##PointData_.stroke().lineCap()) { \
-      LNAME##PointData_.stroke().setLineCap(c); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setLineCap(c); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeCap"); } \
   } \
 \
   const LineJoin &LNAME##SymbolStrokeJoin() const { \
     return LNAME##PointData_.stroke().lineJoin(); } \
   void set##UNAME##SymbolStrokeJoin(const LineJoin &j) { \
     if (j != LNAME##PointData_.stroke().lineJoin()) { \
-      LNAME##PointData_.stroke().setLineJoin(j); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.stroke().setLineJoin(j); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolStrokeJoin"); } \
   } \
 \
   bool is##UNAME##SymbolFilled() const { return LNAME##PointData_.fill().isVisible(); } \
   void set##UNAME##SymbolFilled(bool b) { \
     if (b != LNAME##PointData_.fill().isVisible()) { \
       LNAME##PointData_.fill().setVisible(b); \
-      LNAME##PointDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##PointDataInvalidate(is##UNAME##ReloadObj(), #LNAME "SymbolFilled"); } \
   } \
 \
   const Color &LNAME##SymbolFillColor() const { return LNAME##PointData_.fill().color(); } \
   void set##UNAME##SymbolFillColor(const Color &c) { \
     if (c != LNAME##PointData_.fill().color()) { \
-      LNAME##PointData_.fill().setColor(c); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.fill().setColor(c); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolFillColor"); } \
   } \
 \
   QColor interp##UNAME##SymbolFillColor(const ColorInd &ind) const { \
@@ -653,14 +666,16 @@ class CQChartsObj##UNAME##PointData { \
   const Alpha &LNAME##SymbolFillAlpha() const { return LNAME##PointData_.fill().alpha(); } \
   void set##UNAME##SymbolFillAlpha(const Alpha &a) { \
     if (a != LNAME##PointData_.fill().alpha()) { \
-      LNAME##PointData_.fill().setAlpha(a); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.fill().setAlpha(a); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolFillAlpha"); } \
   } \
 \
   const FillPattern &LNAME##SymbolFillPattern() const { \
     return LNAME##PointData_.fill().pattern(); } \
   void set##UNAME##SymbolFillPattern(const FillPattern &p) { \
     if (p != LNAME##PointData_.fill().pattern()) { \
-      LNAME##PointData_.fill().setPattern(p); LNAME##PointDataInvalidate(); } \
+      LNAME##PointData_.fill().setPattern(p); \
+      LNAME##PointDataInvalidate(false, #LNAME "SymbolFillPattern"); } \
   } \
 \
   void set##UNAME##SymbolPenBrush(PenBrush &penBrush, const ColorInd &ind) const { \
@@ -675,13 +690,14 @@ class CQChartsObj##UNAME##PointData { \
   const SymbolData &LNAME##SymbolData() const { return LNAME##PointData_; } \
 \
   void set##UNAME##SymbolData(const SymbolData &data) { \
-    LNAME##PointData_ = data; LNAME##PointDataInvalidate(is##UNAME##ReloadObj()); \
+    LNAME##PointData_ = data; \
+    LNAME##PointDataInvalidate(is##UNAME##ReloadObj(), #LNAME "SymbolData"); \
   } \
 \
  private: \
-  virtual void LNAME##PointDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##PointDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
@@ -754,13 +770,14 @@ class CQChartsObj##UNAME##FillData { \
   bool is##UNAME##Filled() const { return LNAME##FillData_.isVisible(); } \
   void set##UNAME##Filled(bool b) { \
     if (b != LNAME##FillData_.isVisible()) { \
-      LNAME##FillData_.setVisible(b); LNAME##FillDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##FillData_.setVisible(b); \
+      LNAME##FillDataInvalidate(is##UNAME##ReloadObj(), #LNAME "Filled"); } \
   } \
 \
   const Color &LNAME##FillColor() const { return LNAME##FillData_.color(); } \
   void set##UNAME##FillColor(const Color &c) { \
     if (c != LNAME##FillData_.color()) { \
-      LNAME##FillData_.setColor(c); LNAME##FillDataInvalidate(); } \
+      LNAME##FillData_.setColor(c); LNAME##FillDataInvalidate(false, #LNAME "FillColor"); } \
   } \
 \
   QColor interp##UNAME##FillColor(const ColorInd &ind) const { \
@@ -770,25 +787,25 @@ class CQChartsObj##UNAME##FillData { \
   const Alpha &LNAME##FillAlpha() const { return LNAME##FillData_.alpha(); } \
   void set##UNAME##FillAlpha(const Alpha &a) { \
     if (a != LNAME##FillData_.alpha()) { \
-      LNAME##FillData_.setAlpha(a); LNAME##FillDataInvalidate(); } \
+      LNAME##FillData_.setAlpha(a); LNAME##FillDataInvalidate(false, #LNAME "FillAlpha"); } \
   } \
 \
   const FillPattern &LNAME##FillPattern() const { return LNAME##FillData_.pattern(); } \
   void set##UNAME##FillPattern(const FillPattern &p) { \
     if (p != LNAME##FillData_.pattern()) { \
-      LNAME##FillData_.setPattern(p); LNAME##FillDataInvalidate(); } \
+      LNAME##FillData_.setPattern(p); LNAME##FillDataInvalidate(false, #LNAME "FillPattern"); } \
   } \
 \
   const FillData &LNAME##FillData() const { return LNAME##FillData_; } \
 \
   void set##UNAME##FillData(const FillData &data) { \
-    LNAME##FillData_ = data; LNAME##FillDataInvalidate(is##UNAME##ReloadObj()); \
+    LNAME##FillData_ = data; LNAME##FillDataInvalidate(is##UNAME##ReloadObj(), #LNAME "FillData"); \
   } \
 \
  private: \
-  virtual void LNAME##FillDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##FillDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
@@ -857,19 +874,19 @@ class CQChartsObjTextData {
   bool isTextVisible() const { return textData_.isVisible(); }
   void setTextVisible(bool b) {
     if (b != textData_.isVisible()) {
-      textData_.setVisible(b); textDataInvalidate(isReloadObj()); }
+      textData_.setVisible(b); textDataInvalidate(isReloadObj(), "textVisible"); }
   }
 
   const Color &textColor() const { return textData_.color(); }
   void setTextColor(const Color &c) {
     if (c != textData_.color()) {
-      textData_.setColor(c); textDataInvalidate(); }
+      textData_.setColor(c); textDataInvalidate(false, "textColor"); }
   }
 
   const Alpha& textAlpha() const { return textData_.alpha(); }
   void setTextAlpha(const Alpha &a) {
     if (a != textData_.alpha()) {
-      textData_.setAlpha(a); textDataInvalidate(); }
+      textData_.setAlpha(a); textDataInvalidate(false, "textAlpha"); }
   }
 
   QColor interpTextColor(const ColorInd &ind) const {
@@ -879,61 +896,61 @@ class CQChartsObjTextData {
   const Font &textFont() const { return textData_.font(); }
   void setTextFont(const Font &f) {
     if (f != textData_.font()) {
-      textData_.setFont(f); textDataInvalidate(); }
+      textData_.setFont(f); textDataInvalidate(false, "textFont"); }
   }
 
   const Angle &textAngle() const { return textData_.angle(); }
   void setTextAngle(const Angle &a) {
     if (a != textData_.angle()) {
-      textData_.setAngle(a); textDataInvalidate(); }
+      textData_.setAngle(a); textDataInvalidate(false, "textAngle"); }
   }
 
   bool isTextContrast() const { return textData_.isContrast(); }
   void setTextContrast(bool b) {
     if (b != textData_.isContrast()) {
-      textData_.setContrast(b); textDataInvalidate(); }
+      textData_.setContrast(b); textDataInvalidate(false, "textContrast"); }
   }
 
   const Alpha& textContrastAlpha() const { return textData_.contrastAlpha(); }
   void setTextContrastAlpha(const Alpha &a) {
     if (a != textData_.contrastAlpha()) {
-      textData_.setContrastAlpha(a); textDataInvalidate(); }
+      textData_.setContrastAlpha(a); textDataInvalidate(false, "textContrastAlpha"); }
   }
 
   const Qt::Alignment &textAlign() const { return textData_.align(); }
   void setTextAlign(const Qt::Alignment &a) {
     if (a != textData_.align()) {
-      textData_.setAlign(a); textDataInvalidate(); }
+      textData_.setAlign(a); textDataInvalidate(false, "textAlign"); }
   }
 
   bool isTextFormatted() const { return textData_.isFormatted(); }
   void setTextFormatted(bool b) {
     if (b != textData_.isFormatted()) {
-      textData_.setFormatted(b); textDataInvalidate(); }
+      textData_.setFormatted(b); textDataInvalidate(false, "textFormatted"); }
   }
 
   bool isTextScaled() const { return textData_.isScaled(); }
   void setTextScaled(bool b) {
     if (b != textData_.isScaled()) {
-      textData_.setScaled(b); textDataInvalidate(); }
+      textData_.setScaled(b); textDataInvalidate(false, "textScaled"); }
   }
 
   bool isTextHtml() const { return textData_.isHtml(); }
   void setTextHtml(bool b) {
     if (b != textData_.isHtml()) {
-      textData_.setHtml(b); textDataInvalidate(); }
+      textData_.setHtml(b); textDataInvalidate(false, "textHtml"); }
   }
 
   const Length &textClipLength() const { return textData_.clipLength(); }
   void setTextClipLength(const Length &l) {
     if (l != textData_.clipLength()) {
-      textData_.setClipLength(l); textDataInvalidate(); }
+      textData_.setClipLength(l); textDataInvalidate(false, "textClipLength"); }
   }
 
   const Qt::TextElideMode &textClipElide() const { return textData_.clipElide(); }
   void setTextClipElide(const Qt::TextElideMode &l) {
     if (l != textData_.clipElide()) {
-      textData_.setClipElide(l); textDataInvalidate(); }
+      textData_.setClipElide(l); textDataInvalidate(false, "textClipElide"); }
   }
 
   //---
@@ -941,7 +958,7 @@ class CQChartsObjTextData {
   const TextData &textData() const { return textData_; }
 
   void setTextData(const TextData &data) {
-    textData_ = data; textDataInvalidate();
+    textData_ = data; textDataInvalidate(false, "textData");
   };
 
   CQChartsTextOptions textOptions(CQChartsPaintDevice *device=nullptr) const {
@@ -963,8 +980,9 @@ class CQChartsObjTextData {
   }
 
  protected:
-  virtual void textDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void textDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -1045,19 +1063,20 @@ class CQChartsObj##UNAME##TextData { \
   bool is##UNAME##TextVisible() const { return LNAME##TextData_.isVisible(); } \
   void set##UNAME##TextVisible(bool b) { \
     if (b != LNAME##TextData_.isVisible()) { \
-      LNAME##TextData_.setVisible(b); LNAME##TextDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##TextData_.setVisible(b); \
+      LNAME##TextDataInvalidate(is##UNAME##ReloadObj(), #LNAME "TextVisible"); } \
   } \
 \
   const Color &LNAME##TextColor() const { return LNAME##TextData_.color(); } \
   void set##UNAME##TextColor(const Color &c) { \
     if (c != LNAME##TextData_.color()) { \
-      LNAME##TextData_.setColor(c); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setColor(c); LNAME##TextDataInvalidate(false, #LNAME "TextColor"); } \
   } \
 \
   const Alpha &LNAME##TextAlpha() const { return LNAME##TextData_.alpha(); } \
   void set##UNAME##TextAlpha(const Alpha &a) { \
     if (a != LNAME##TextData_.alpha()) { \
-      LNAME##TextData_.setAlpha(a); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setAlpha(a); LNAME##TextDataInvalidate(false, #LNAME "TextAlpha"); } \
   } \
 \
   QColor interp##UNAME##TextColor(const ColorInd &ind) const { \
@@ -1067,68 +1086,72 @@ class CQChartsObj##UNAME##TextData { \
   const Font &LNAME##TextFont() const { return LNAME##TextData_.font(); } \
   void set##UNAME##TextFont(const Font &f) { \
     if (f != LNAME##TextData_.font()) { \
-      LNAME##TextData_.setFont(f); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setFont(f); LNAME##TextDataInvalidate(false, #LNAME "TextFont"); } \
   } \
 \
   const Angle &LNAME##TextAngle() const { return LNAME##TextData_.angle(); } \
   void set##UNAME##TextAngle(const Angle &a) { \
     if (a != LNAME##TextData_.angle()) { \
-      LNAME##TextData_.setAngle(a); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setAngle(a); LNAME##TextDataInvalidate(false, #LNAME "TextAngle"); } \
   } \
 \
   bool is##UNAME##TextContrast() const { return LNAME##TextData_.isContrast(); } \
   void set##UNAME##TextContrast(bool b) { \
     if (b != LNAME##TextData_.isContrast()) { \
-      LNAME##TextData_.setContrast(b); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setContrast(b); LNAME##TextDataInvalidate(false, #LNAME "TextContrast"); } \
   } \
 \
   const Alpha &LNAME##TextContrastAlpha() const { \
     return LNAME##TextData_.contrastAlpha(); } \
   void set##UNAME##TextContrastAlpha(const Alpha &a) { \
     if (a != LNAME##TextData_.contrastAlpha()) { \
-      LNAME##TextData_.setContrastAlpha(a); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setContrastAlpha(a); \
+      LNAME##TextDataInvalidate(false, #LNAME "TextContrastAlpha"); } \
   } \
 \
   const Qt::Alignment &LNAME##TextAlign() const { return LNAME##TextData_.align(); } \
   void set##UNAME##TextAlign(const Qt::Alignment &a) { \
     if (a != LNAME##TextData_.align()) { \
-      LNAME##TextData_.setAlign(a); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setAlign(a); LNAME##TextDataInvalidate(false, #LNAME "TextAlign"); } \
   } \
 \
   bool is##UNAME##TextFormatted() const { return LNAME##TextData_.isFormatted(); } \
   void set##UNAME##TextFormatted(bool b) { \
     if (b != LNAME##TextData_.isFormatted()) { \
-      LNAME##TextData_.setFormatted(b); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setFormatted(b); \
+      LNAME##TextDataInvalidate(false, #LNAME "TextFormatted"); } \
   } \
 \
   bool is##UNAME##TextScaled() const { return LNAME##TextData_.isScaled(); } \
   void set##UNAME##TextScaled(bool b) { \
     if (b != LNAME##TextData_.isScaled()) { \
-      LNAME##TextData_.setScaled(b); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setScaled(b); LNAME##TextDataInvalidate(false, #LNAME "TextScaled"); } \
   } \
 \
   bool is##UNAME##TextHtml() const { return LNAME##TextData_.isHtml(); } \
   void set##UNAME##TextHtml(bool b) { \
     if (b != LNAME##TextData_.isHtml()) { \
-      LNAME##TextData_.setHtml(b); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setHtml(b); LNAME##TextDataInvalidate(false, #LNAME "TextHtml"); } \
   } \
 \
   const Length &LNAME##TextClipLength() const { return LNAME##TextData_.clipLength(); } \
   void set##UNAME##TextClipLength(const Length &l) { \
     if (l != LNAME##TextData_.clipLength()) { \
-      LNAME##TextData_.setClipLength(l); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setClipLength(l); \
+      LNAME##TextDataInvalidate(false, #LNAME "TextClipLength"); } \
   } \
 \
   const Qt::TextElideMode &LNAME##TextClipElide() const { return LNAME##TextData_.clipElide(); } \
   void set##UNAME##TextClipElide(const Qt::TextElideMode &l) { \
     if (l != LNAME##TextData_.clipElide()) { \
-      LNAME##TextData_.setClipElide(l); LNAME##TextDataInvalidate(); } \
+      LNAME##TextData_.setClipElide(l); \
+      LNAME##TextDataInvalidate(false, #LNAME "TextClipElide"); } \
   } \
 \
   const TextData &LNAME##TextData() const { return LNAME##TextData_; } \
 \
   void set##UNAME##TextData(const TextData &data) { \
-    LNAME##TextData_ = data; LNAME##TextDataInvalidate(); \
+    LNAME##TextData_ = data; LNAME##TextDataInvalidate(false, #LNAME "TextData"); \
   } \
 \
   CQChartsTextOptions LNAME##TextOptions(CQChartsPaintDevice *device=nullptr) const { \
@@ -1151,9 +1174,9 @@ class CQChartsObj##UNAME##TextData { \
   } \
 \
  private: \
-  virtual void LNAME##TextDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##TextDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
@@ -1230,49 +1253,49 @@ class CQChartsObjStrokeData {
   bool isStroked() const { return strokeData_.isVisible(); }
   void setStroked(bool b) {
     if (b != strokeData_.isVisible()) {
-      strokeData_.setVisible(b); strokeDataInvalidate(); }
+      strokeData_.setVisible(b); strokeDataInvalidate(false, "stroked"); }
   }
 
   const Color &strokeColor() const { return strokeData_.color(); }
   void setStrokeColor(const Color &c) {
     if (c != strokeData_.color()) {
-      strokeData_.setColor(c); strokeDataInvalidate(); }
+      strokeData_.setColor(c); strokeDataInvalidate(false, "strokeColor"); }
   }
 
   const Alpha &strokeAlpha() const { return strokeData_.alpha(); }
   void setStrokeAlpha(const Alpha &a) {
     if (a != strokeData_.alpha()) {
-      strokeData_.setAlpha(a); strokeDataInvalidate(); }
+      strokeData_.setAlpha(a); strokeDataInvalidate(false, "strokeAlpha"); }
   }
 
   const Length &strokeWidth() const { return strokeData_.width(); }
   void setStrokeWidth(const Length &l) {
     if (l != strokeData_.width()) {
-      strokeData_.setWidth(l); strokeDataInvalidate(); }
+      strokeData_.setWidth(l); strokeDataInvalidate(false, "strokeWidth"); }
   }
 
   const LineDash &strokeDash() const { return strokeData_.dash(); }
   void setStrokeDash(const LineDash &d) {
     if (d != strokeData_.dash()) {
-      strokeData_.setDash(d); strokeDataInvalidate(); }
+      strokeData_.setDash(d); strokeDataInvalidate(false, "strokeDash"); }
   }
 
   const LineCap &strokeCap() const { return strokeData_.lineCap(); }
   void setStrokeCap(const LineCap &c) {
     if (c != strokeData_.lineCap()) {
-      strokeData_.setLineCap(c); strokeDataInvalidate(); }
+      strokeData_.setLineCap(c); strokeDataInvalidate(false, "strokeCap"); }
   }
 
   const LineJoin &strokeJoin() const { return strokeData_.lineJoin(); }
   void setStrokeJoin(const LineJoin &j) {
     if (j != strokeData_.lineJoin()) {
-      strokeData_.setLineJoin(j); strokeDataInvalidate(); }
+      strokeData_.setLineJoin(j); strokeDataInvalidate(false, "strokeJoin"); }
   }
 
   const Length &cornerSize() const { return strokeData_.cornerSize(); }
   void setCornerSize(const Length &l) {
     if (l != strokeData_.cornerSize()) {
-      strokeData_.setCornerSize(l); strokeDataInvalidate(); }
+      strokeData_.setCornerSize(l); strokeDataInvalidate(false, "cornerSize"); }
   }
 
   QColor interpStrokeColor(const ColorInd &ind) const {
@@ -1287,14 +1310,15 @@ class CQChartsObjStrokeData {
   const StrokeData &strokeData() const { return strokeData_; }
 
   void setStrokeData(const StrokeData &data) {
-    strokeData_ = data; strokeDataInvalidate();
+    strokeData_ = data; strokeDataInvalidate(false, "strokeData");
   };
 
   //---
 
  private:
-  virtual void strokeDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void strokeDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -1363,49 +1387,49 @@ class CQChartsObjShapeData {
   bool isStroked() const { return shapeData_.stroke().isVisible(); }
   void setStroked(bool b) {
     if (b != shapeData_.stroke().isVisible()) {
-      shapeData_.stroke().setVisible(b); shapeDataInvalidate(); }
+      shapeData_.stroke().setVisible(b); shapeDataInvalidate(false, "stroked"); }
   }
 
   const Color &strokeColor() const { return shapeData_.stroke().color(); }
   void setStrokeColor(const Color &c) {
     if (c != shapeData_.stroke().color()) {
-      shapeData_.stroke().setColor(c); shapeDataInvalidate(); }
+      shapeData_.stroke().setColor(c); shapeDataInvalidate(false, "strokeColor"); }
   }
 
   const Alpha &strokeAlpha() const { return shapeData_.stroke().alpha(); }
   void setStrokeAlpha(const Alpha &a) {
     if (a != shapeData_.stroke().alpha()) {
-      shapeData_.stroke().setAlpha(a); shapeDataInvalidate(); }
+      shapeData_.stroke().setAlpha(a); shapeDataInvalidate(false, "strokeAlpha"); }
   }
 
   const Length &strokeWidth() const { return shapeData_.stroke().width(); }
   void setStrokeWidth(const Length &l) {
     if (l != shapeData_.stroke().width()) {
-      shapeData_.stroke().setWidth(l); shapeDataInvalidate(); }
+      shapeData_.stroke().setWidth(l); shapeDataInvalidate(false, "strokeWidth"); }
   }
 
   const LineDash &strokeDash() const { return shapeData_.stroke().dash(); }
   void setStrokeDash(const LineDash &d) {
     if (d != shapeData_.stroke().dash()) {
-      shapeData_.stroke().setDash(d); shapeDataInvalidate(); }
+      shapeData_.stroke().setDash(d); shapeDataInvalidate(false, "strokeDash"); }
   }
 
   const LineCap &strokeCap() const { return shapeData_.stroke().lineCap(); }
   void setStrokeCap(const LineCap &c) {
     if (c != shapeData_.stroke().lineCap()) {
-      shapeData_.stroke().setLineCap(c); shapeDataInvalidate(); }
+      shapeData_.stroke().setLineCap(c); shapeDataInvalidate(false, "strokeCap"); }
   }
 
   const LineJoin &strokeJoin() const { return shapeData_.stroke().lineJoin(); }
   void setStrokeJoin(const LineJoin &j) {
     if (j != shapeData_.stroke().lineJoin()) {
-      shapeData_.stroke().setLineJoin(j); shapeDataInvalidate(); }
+      shapeData_.stroke().setLineJoin(j); shapeDataInvalidate(false, "strokeJoin"); }
   }
 
   const Length &cornerSize() const { return shapeData_.stroke().cornerSize(); }
   void setCornerSize(const Length &l) {
     if (l != shapeData_.stroke().cornerSize()) {
-      shapeData_.stroke().setCornerSize(l); shapeDataInvalidate(); }
+      shapeData_.stroke().setCornerSize(l); shapeDataInvalidate(false, "cornerSize"); }
   }
 
   QColor interpStrokeColor(const ColorInd &ind) const {
@@ -1420,25 +1444,25 @@ class CQChartsObjShapeData {
   bool isFilled() const { return shapeData_.fill().isVisible(); }
   void setFilled(bool b) {
     if (b != shapeData_.fill().isVisible()) {
-      shapeData_.fill().setVisible(b); shapeDataInvalidate(); }
+      shapeData_.fill().setVisible(b); shapeDataInvalidate(false, "filled"); }
   }
 
   const Color &fillColor() const { return shapeData_.fill().color(); }
   void setFillColor(const Color &c) {
     if (c != shapeData_.fill().color()) {
-      shapeData_.fill().setColor(c); shapeDataInvalidate(); }
+      shapeData_.fill().setColor(c); shapeDataInvalidate(false, "fillColor"); }
   }
 
   const Alpha &fillAlpha() const { return shapeData_.fill().alpha(); }
   void setFillAlpha(const Alpha &a) {
     if (a != shapeData_.fill().alpha()) {
-      shapeData_.fill().setAlpha(a); shapeDataInvalidate(); }
+      shapeData_.fill().setAlpha(a); shapeDataInvalidate(false, "fillAlpha"); }
   }
 
   const FillPattern &fillPattern() const { return shapeData_.fill().pattern(); }
   void setFillPattern(const FillPattern &p) {
     if (p != shapeData_.fill().pattern()) {
-      shapeData_.fill().setPattern(p); shapeDataInvalidate(); }
+      shapeData_.fill().setPattern(p); shapeDataInvalidate(false, "fillPattern"); }
   }
 
   QColor interpFillColor(const ColorInd &ind) const {
@@ -1466,12 +1490,13 @@ class CQChartsObjShapeData {
   const ShapeData &shapeData() const { return shapeData_; }
 
   void setShapeData(const ShapeData &data) {
-    shapeData_ = data; shapeDataInvalidate();
+    shapeData_ = data; shapeDataInvalidate(false, "shapeData");
   };
 
  private:
-  virtual void shapeDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void shapeDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -1556,49 +1581,57 @@ class CQChartsObj##UNAME##ShapeData { \
   bool is##UNAME##Stroked() const { return LNAME##ShapeData_.stroke().isVisible(); } \
   void set##UNAME##Stroked(bool b) { \
     if (b != LNAME##ShapeData_.stroke().isVisible()) { \
-      LNAME##ShapeData_.stroke().setVisible(b); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setVisible(b); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "Stroked"); } \
   } \
 \
   const Color &LNAME##StrokeColor() const { return LNAME##ShapeData_.stroke().color(); } \
   void set##UNAME##StrokeColor(const Color &c) { \
     if (c != LNAME##ShapeData_.stroke().color()) { \
-      LNAME##ShapeData_.stroke().setColor(c); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setColor(c); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeColor"); } \
   } \
 \
   const Alpha &LNAME##StrokeAlpha() const { return LNAME##ShapeData_.stroke().alpha(); } \
   void set##UNAME##StrokeAlpha(const Alpha &a) { \
     if (a != LNAME##ShapeData_.stroke().alpha()) { \
-      LNAME##ShapeData_.stroke().setAlpha(a); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setAlpha(a); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeAlpha"); } \
   } \
 \
   const Length &LNAME##StrokeWidth() const { return LNAME##ShapeData_.stroke().width(); } \
   void set##UNAME##StrokeWidth(const Length &l) { \
     if (l != LNAME##ShapeData_.stroke().width()) { \
-      LNAME##ShapeData_.stroke().setWidth(l); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setWidth(l); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeWidth"); } \
   } \
 \
   const LineDash &LNAME##StrokeDash() const { return LNAME##ShapeData_.stroke().dash(); } \
   void set##UNAME##StrokeDash(const LineDash &d) { \
     if (d != LNAME##ShapeData_.stroke().dash()) { \
-      LNAME##ShapeData_.stroke().setDash(d); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setDash(d); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeDash"); } \
   } \
 \
   const LineCap &LNAME##StrokeCap() const { return LNAME##ShapeData_.stroke().lineCap(); } \
   void set##UNAME##StrokeCap(const LineCap &c) { \
     if (c != LNAME##ShapeData_.stroke().lineCap()) { \
-      LNAME##ShapeData_.stroke().setLineCap(c); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setLineCap(c); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeCap"); } \
   } \
 \
   const LineJoin &LNAME##StrokeJoin() const { return LNAME##ShapeData_.stroke().lineJoin(); } \
   void set##UNAME##StrokeJoin(const LineJoin &j) { \
     if (j != LNAME##ShapeData_.stroke().lineJoin()) { \
-      LNAME##ShapeData_.stroke().setLineJoin(j); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setLineJoin(j); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "StrokeJoin"); } \
   } \
 \
   const Length &LNAME##CornerSize() const { return LNAME##ShapeData_.stroke().cornerSize(); } \
   void set##UNAME##CornerSize(const Length &l) { \
     if (l != LNAME##ShapeData_.stroke().cornerSize()) { \
-      LNAME##ShapeData_.stroke().setCornerSize(l); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.stroke().setCornerSize(l); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "CornerSize"); } \
   } \
 \
   QColor interp##UNAME##StrokeColor(const ColorInd &ind) const { \
@@ -1609,26 +1642,29 @@ class CQChartsObj##UNAME##ShapeData { \
   void set##UNAME##Filled(bool b) { \
     if (b != LNAME##ShapeData_.fill().isVisible()) { \
       LNAME##ShapeData_.fill().setVisible(b); \
-      LNAME##ShapeDataInvalidate(is##UNAME##ReloadObj()); } \
+      LNAME##ShapeDataInvalidate(is##UNAME##ReloadObj(), #LNAME "Filled"); } \
   } \
 \
   const Color &LNAME##FillColor() const { return LNAME##ShapeData_.fill().color(); } \
   void set##UNAME##FillColor(const Color &c) { \
     if (c != LNAME##ShapeData_.fill().color()) { \
-      LNAME##ShapeData_.fill().setColor(c); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.fill().setColor(c); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "FillColor"); } \
   } \
 \
   const Alpha &LNAME##FillAlpha() const { return LNAME##ShapeData_.fill().alpha(); } \
   void set##UNAME##FillAlpha(const Alpha &a) { \
     if (a != LNAME##ShapeData_.fill().alpha()) { \
-      LNAME##ShapeData_.fill().setAlpha(a); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.fill().setAlpha(a); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "FillAlpha"); } \
   } \
 \
   const FillPattern &LNAME##FillPattern() const { \
     return LNAME##ShapeData_.fill().pattern(); } \
   void set##UNAME##FillPattern(const FillPattern &p) { \
     if (p != LNAME##ShapeData_.fill().pattern()) { \
-      LNAME##ShapeData_.fill().setPattern(p); LNAME##ShapeDataInvalidate(); } \
+      LNAME##ShapeData_.fill().setPattern(p); \
+      LNAME##ShapeDataInvalidate(false, #LNAME "FillPattern"); } \
   } \
 \
   QColor interp##UNAME##FillColor(const ColorInd &ind) const { \
@@ -1638,7 +1674,7 @@ class CQChartsObj##UNAME##ShapeData { \
   const ShapeData &LNAME##ShapeData() const { return LNAME##ShapeData_; } \
 \
   void set##UNAME##ShapeData(const ShapeData &data) { \
-    LNAME##ShapeData_ = data; LNAME##ShapeDataInvalidate(); \
+    LNAME##ShapeData_ = data; LNAME##ShapeDataInvalidate(false, #LNAME "ShapeData"); \
   } \
 \
   PenData LNAME##PenData(const ColorInd &colorInd) const { \
@@ -1685,9 +1721,9 @@ class CQChartsObj##UNAME##ShapeData { \
   } \
 \
  private: \
-  virtual void LNAME##ShapeDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##ShapeDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
@@ -1760,64 +1796,65 @@ class CQChartsObjBoxData {
   //---
 
   const Margin &margin() const { return boxData_.margin(); }
-  void setMargin(const Margin &m) { boxData_.setMargin(m); boxDataInvalidate(); }
+  void setMargin(const Margin &m) { boxData_.setMargin(m); boxDataInvalidate(false, "margin"); }
 
   const Margin &padding() const { return boxData_.padding(); }
-  void setPadding(const Margin &m) { boxData_.setPadding(m); boxDataInvalidate(); }
+  void setPadding(const Margin &m) { boxData_.setPadding(m); boxDataInvalidate(false, "padding"); }
 
   //---
 
   const Sides &borderSides() const { return boxData_.borderSides(); }
-  void setBorderSides(const Sides &s) { boxData_.setBorderSides(s); boxDataInvalidate(); }
+  void setBorderSides(const Sides &s) { boxData_.setBorderSides(s);
+  boxDataInvalidate(false, "borderSides"); }
 
   //---
 
   bool isStroked() const { return boxData_.shape().stroke().isVisible(); }
   void setStroked(bool b) {
     if (b != boxData_.shape().stroke().isVisible()) {
-      boxData_.shape().stroke().setVisible(b); boxDataInvalidate(); }
+      boxData_.shape().stroke().setVisible(b); boxDataInvalidate(false, "stroked"); }
   }
 
   const Color &strokeColor() const { return boxData_.shape().stroke().color(); }
   void setStrokeColor(const Color &c) {
     if (c != boxData_.shape().stroke().color()) {
-      boxData_.shape().stroke().setColor(c); boxDataInvalidate(); }
+      boxData_.shape().stroke().setColor(c); boxDataInvalidate(false, "strokeColor"); }
   }
 
   const Alpha &strokeAlpha() const { return boxData_.shape().stroke().alpha(); }
   void setStrokeAlpha(const Alpha &a) {
     if (a != boxData_.shape().stroke().alpha()) {
-      boxData_.shape().stroke().setAlpha(a); boxDataInvalidate(); }
+      boxData_.shape().stroke().setAlpha(a); boxDataInvalidate(false, "strokeAlpha"); }
   }
 
   const Length &strokeWidth() const { return boxData_.shape().stroke().width(); }
   void setStrokeWidth(const Length &l) {
     if (l != boxData_.shape().stroke().width()) {
-      boxData_.shape().stroke().setWidth(l); boxDataInvalidate(); }
+      boxData_.shape().stroke().setWidth(l); boxDataInvalidate(false, "strokeWidth"); }
   }
 
   const LineDash &strokeDash() const { return boxData_.shape().stroke().dash(); }
   void setStrokeDash(const LineDash &d) {
     if (d != boxData_.shape().stroke().dash()) {
-      boxData_.shape().stroke().setDash(d); boxDataInvalidate(); }
+      boxData_.shape().stroke().setDash(d); boxDataInvalidate(false, "strokeDash"); }
   }
 
   const LineCap &strokeCap() const { return boxData_.shape().stroke().lineCap(); }
   void setStrokeCap(const LineCap &c) {
     if (c != boxData_.shape().stroke().lineCap()) {
-      boxData_.shape().stroke().setLineCap(c); boxDataInvalidate(); }
+      boxData_.shape().stroke().setLineCap(c); boxDataInvalidate(false, "strokeCap"); }
   }
 
   const LineJoin &strokeJoin() const { return boxData_.shape().stroke().lineJoin(); }
   void setStrokeJoin(const LineJoin &j) {
     if (j != boxData_.shape().stroke().lineJoin()) {
-      boxData_.shape().stroke().setLineJoin(j); boxDataInvalidate(); }
+      boxData_.shape().stroke().setLineJoin(j); boxDataInvalidate(false, "strokeJoin"); }
   }
 
   const Length &cornerSize() const { return boxData_.shape().stroke().cornerSize(); }
   void setCornerSize(const Length &l) {
     if (l != boxData_.shape().stroke().cornerSize()) {
-      boxData_.shape().stroke().setCornerSize(l); boxDataInvalidate(); }
+      boxData_.shape().stroke().setCornerSize(l); boxDataInvalidate(false, "cornerSize"); }
   }
 
   QColor interpStrokeColor(const ColorInd &ind) const {
@@ -1832,25 +1869,25 @@ class CQChartsObjBoxData {
   bool isFilled() const { return boxData_.shape().fill().isVisible(); }
   void setFilled(bool b) {
     if (b != boxData_.shape().fill().isVisible()) {
-      boxData_.shape().fill().setVisible(b); boxDataInvalidate(); }
+      boxData_.shape().fill().setVisible(b); boxDataInvalidate(false, "filled"); }
   }
 
   const Color &fillColor() const { return boxData_.shape().fill().color(); }
   void setFillColor(const Color &c) {
     if (c != boxData_.shape().fill().color()) {
-      boxData_.shape().fill().setColor(c); boxDataInvalidate(); }
+      boxData_.shape().fill().setColor(c); boxDataInvalidate(false, "fillColor"); }
   }
 
   const Alpha &fillAlpha() const { return boxData_.shape().fill().alpha(); }
   void setFillAlpha(const Alpha &a) {
     if (a != boxData_.shape().fill().alpha()) {
-      boxData_.shape().fill().setAlpha(a); boxDataInvalidate(); }
+      boxData_.shape().fill().setAlpha(a); boxDataInvalidate(false, "fillAlpha"); }
   }
 
   const FillPattern &fillPattern() const { return boxData_.shape().fill().pattern(); }
   void setFillPattern(const FillPattern &p) {
     if (p != boxData_.shape().fill().pattern()) {
-      boxData_.shape().fill().setPattern(p); boxDataInvalidate(); }
+      boxData_.shape().fill().setPattern(p); boxDataInvalidate(false, "fillPattern"); }
   }
 
   QColor interpFillColor(const ColorInd &ind) const {
@@ -1865,12 +1902,13 @@ class CQChartsObjBoxData {
   const BoxData &boxData() const { return boxData_; }
 
   void setBoxData(const BoxData &data) {
-    boxData_ = data; boxDataInvalidate();
+    boxData_ = data; boxDataInvalidate(false, "boxData");
   };
 
  private:
-  virtual void boxDataInvalidate(bool reload=false) {
-    pinvalidator_ ? pinvalidator_->invalidate(reload) : invalidator_.invalidate(reload);
+  virtual void boxDataInvalidate(bool reload=false, const char *name=nullptr) {
+    pinvalidator_ ? pinvalidator_->invalidateProperty(name, reload) :
+                    invalidator_.invalidateProperty(name, reload);
   }
 
  private:
@@ -1958,64 +1996,72 @@ class CQChartsObj##UNAME##BoxData { \
 \
   const Margin &LNAME##Margin() const { return LNAME##BoxData_.margin(); } \
   void set##UNAME##Margin(const Margin &m) { \
-    LNAME##BoxData_.setMargin(m); LNAME##BoxDataInvalidate(); } \
+    LNAME##BoxData_.setMargin(m); LNAME##BoxDataInvalidate(false, #LNAME "Margin"); } \
 \
   const Margin &LNAME##Padding() const { return LNAME##BoxData_.padding(); } \
   void set##UNAME##Padding(const Margin &m) { \
-    LNAME##BoxData_.setPadding(m); LNAME##BoxDataInvalidate(); } \
+    LNAME##BoxData_.setPadding(m); LNAME##BoxDataInvalidate(false, #LNAME "Padding"); } \
 \
   const Sides &LNAME##BorderSides() const { return LNAME##BoxData_.borderSides(); } \
   void set##UNAME##BorderSides(const Sides &s) { \
-    LNAME##BoxData_.setBorderSides(s); LNAME##BoxDataInvalidate(); } \
+    LNAME##BoxData_.setBorderSides(s); LNAME##BoxDataInvalidate(false, #LNAME "BorderSides"); } \
 \
   bool is##UNAME##Stroked() const { return LNAME##BoxData_.shape().stroke().isVisible(); } \
   void set##UNAME##Stroked(bool b) { \
     if (b != LNAME##BoxData_.shape().stroke().isVisible()) { \
-      LNAME##BoxData_.shape().stroke().setVisible(b); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setVisible(b); \
+      LNAME##BoxDataInvalidate(false, #LNAME "Stroked"); } \
   } \
 \
   const Color &LNAME##StrokeColor() const { return LNAME##BoxData_.shape().stroke().color(); } \
   void set##UNAME##StrokeColor(const Color &c) { \
     if (c != LNAME##BoxData_.shape().stroke().color()) { \
-      LNAME##BoxData_.shape().stroke().setColor(c); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setColor(c); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeColor"); } \
   } \
 \
   const Alpha &LNAME##StrokeAlpha() const { return LNAME##BoxData_.shape().stroke().alpha(); } \
   void set##UNAME##StrokeAlpha(const Alpha &a) { \
     if (a != LNAME##BoxData_.shape().stroke().alpha()) { \
-      LNAME##BoxData_.shape().stroke().setAlpha(a); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setAlpha(a); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeAlpha"); } \
   } \
 \
   const Length &LNAME##StrokeWidth() const { return LNAME##BoxData_.shape().stroke().width(); } \
   void set##UNAME##StrokeWidth(const Length &l) { \
     if (l != LNAME##BoxData_.shape().stroke().width()) { \
-      LNAME##BoxData_.shape().stroke().setWidth(l); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setWidth(l); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeWidth"); } \
   } \
 \
   const LineDash &LNAME##StrokeDash() const { return LNAME##BoxData_.shape().stroke().dash(); } \
   void set##UNAME##StrokeDash(const LineDash &d) { \
     if (d != LNAME##BoxData_.shape().stroke().dash()) { \
-      LNAME##BoxData_.shape().stroke().setDash(d); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setDash(d); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeDash"); } \
   } \
 \
   const LineCap &LNAME##StrokeCap() const { return LNAME##BoxData_.shape().stroke().lineCap(); } \
   void set##UNAME##StrokeCap(const LineCap &c) { \
     if (c != LNAME##BoxData_.shape().stroke().lineCap()) { \
-      LNAME##BoxData_.shape().stroke().setLineCap(c); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setLineCap(c); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeCap"); } \
   } \
 \
   const LineJoin &LNAME##StrokeJoin() const { \
     return LNAME##BoxData_.shape().stroke().lineJoin(); } \
   void set##UNAME##StrokeJoin(const LineJoin &j) { \
     if (j != LNAME##BoxData_.shape().stroke().lineJoin()) { \
-      LNAME##BoxData_.shape().stroke().setLineJoin(j); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setLineJoin(j); \
+      LNAME##BoxDataInvalidate(false, #LNAME "StrokeJoin"); } \
   } \
 \
   const Length &LNAME##CornerSize() const { \
     return LNAME##BoxData_.shape().stroke().cornerSize(); } \
   void set##UNAME##CornerSize(const Length &l) { \
     if (l != LNAME##BoxData_.shape().stroke().cornerSize()) { \
-      LNAME##BoxData_.shape().stroke().setCornerSize(l); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().stroke().setCornerSize(l); \
+      LNAME##BoxDataInvalidate(false, #LNAME "CornerSize"); } \
   } \
 \
   QColor interp##UNAME##StrokeColor(const ColorInd &ind) const { \
@@ -2028,26 +2074,30 @@ class CQChartsObj##UNAME##BoxData { \
   bool is##UNAME##Filled() const { return LNAME##BoxData_.shape().fill().isVisible(); } \
   void set##UNAME##Filled(bool b) { \
     if (b != LNAME##BoxData_.shape().fill().isVisible()) { \
-      LNAME##BoxData_.shape().fill().setVisible(b); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().fill().setVisible(b); \
+      LNAME##BoxDataInvalidate(false, #LNAME "Filled"); } \
   } \
 \
   const Color &LNAME##FillColor() const { return LNAME##BoxData_.shape().fill().color(); } \
   void set##UNAME##FillColor(const Color &c) { \
     if (c != LNAME##BoxData_.shape().fill().color()) { \
-      LNAME##BoxData_.shape().fill().setColor(c); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().fill().setColor(c); \
+      LNAME##BoxDataInvalidate(false, #LNAME "FillColor"); } \
   } \
 \
   const Alpha &LNAME##FillAlpha() const { return LNAME##BoxData_.shape().fill().alpha(); } \
   void set##UNAME##FillAlpha(const Alpha &a) { \
     if (a != LNAME##BoxData_.shape().fill().alpha()) { \
-      LNAME##BoxData_.shape().fill().setAlpha(a); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().fill().setAlpha(a); \
+      LNAME##BoxDataInvalidate(false, #LNAME "FillAlpha"); } \
   } \
 \
   const FillPattern &LNAME##FillPattern() const { \
     return LNAME##BoxData_.shape().fill().pattern(); } \
   void set##UNAME##FillPattern(const FillPattern &p) { \
     if (p != LNAME##BoxData_.shape().fill().pattern()) { \
-      LNAME##BoxData_.shape().fill().setPattern(p); LNAME##BoxDataInvalidate(); } \
+      LNAME##BoxData_.shape().fill().setPattern(p); \
+      LNAME##BoxDataInvalidate(false, #LNAME "FillPattern"); } \
   } \
 \
   QColor interp##UNAME##FillColor(const ColorInd &ind) const { \
@@ -2060,7 +2110,7 @@ class CQChartsObj##UNAME##BoxData { \
   const BoxData &LNAME##BoxData() const { return LNAME##BoxData_; } \
 \
   void set##UNAME##BoxData(const BoxData &data) { \
-    LNAME##BoxData_ = data; LNAME##BoxDataInvalidate(); \
+    LNAME##BoxData_ = data; LNAME##BoxDataInvalidate(false, #LNAME "BoxData"); \
   }; \
 \
   void set##UNAME##PenBrush(PenBrush &penBrush, const ColorInd &ind) const { \
@@ -2073,9 +2123,9 @@ class CQChartsObj##UNAME##BoxData { \
   } \
 \
  private: \
-  virtual void LNAME##BoxDataInvalidate(bool reload=false) { \
-    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidate(reload) : \
-                           LNAME##Invalidator_.invalidate(reload); \
+  virtual void LNAME##BoxDataInvalidate(bool reload=false, const char *name=nullptr) { \
+    LNAME##PInvalidator_ ? LNAME##PInvalidator_->invalidateProperty(name, reload) : \
+                           LNAME##Invalidator_.invalidateProperty(name, reload); \
   } \
 \
  private: \
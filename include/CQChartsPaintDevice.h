@@ -25,7 +25,8 @@ class CQChartsPaintDevice {
     VIEW,
     SCRIPT,
     SVG,
-    STATS
+    STATS,
+    RECORD
   };
 
  public:
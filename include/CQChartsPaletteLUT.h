@@ -0,0 +1,105 @@
+#ifndef CQChartsPaletteLUT_H
+#define CQChartsPaletteLUT_H
+
+#include <QObject>
+#include <QColor>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+class CQColorsPalette;
+
+/*!
+ * \brief Fixed resolution palette color lookup table
+ * \ingroup Charts
+ *
+ * Palette colors are sampled at evenly spaced normalized values (0-1) when the table
+ * is built so a color lookup is an index calculation and a table read instead of a
+ * palette interpolation. Values outside 0-1 (or NaN) are interpolated by the palette.
+ *
+ * Colors for arrays of values are mapped in fixed size blocks: a branch free index
+ * loop (vectorized by the compiler) followed by a table gather.
+ */
+class CQChartsPaletteLUT {
+ public:
+  using Rgbs  = std::vector<QRgb>;
+  using Reals = std::vector<double>;
+
+  static const int NUM_COLORS = 1024;
+
+ public:
+  CQChartsPaletteLUT(CQColorsPalette *palette, bool scale=false, bool invert=false);
+
+  CQColorsPalette *palette() const { return palette_; }
+
+  bool isScale () const { return scale_ ; }
+  bool isInvert() const { return invert_; }
+
+  //! get color for normalized value
+  QRgb rgb(double r) const;
+
+  QColor color(double r) const { return QColor::fromRgba(rgb(r)); }
+
+  //! get colors for array of normalized values
+  void map(const double *values, int n, QRgb *rgbs) const;
+
+  void map(const Reals &values, Rgbs &rgbs) const;
+
+ private:
+  QRgb interpRgb(double r) const;
+
+ private:
+  CQColorsPalette* palette_ { nullptr }; //!< palette
+  bool             scale_   { false };   //!< palette scale
+  bool             invert_  { false };   //!< palette invert
+  Rgbs             rgbs_;                //!< sampled colors
+};
+
+//---
+
+/*!
+ * \brief Palette color lookup table cache
+ * \ingroup Charts
+ *
+ * Tables are built on first use per palette, scale and invert and are shared between
+ * threads. Tables are immutable so lookups only take a shared (read) lock and tables
+ * are built outside the lock.
+ *
+ * All tables are discarded when a theme or palette is changed. Discarded tables are
+ * kept (not deleted) until the manager is destroyed as draw threads may still be
+ * using them (palette changes are rare and tables are small).
+ */
+class CQChartsPaletteLUTMgr : public QObject {
+  Q_OBJECT
+
+ public:
+  using LUT  = CQChartsPaletteLUT;
+  using LUTP = std::unique_ptr<LUT>;
+
+ public:
+  CQChartsPaletteLUTMgr();
+
+  //! get lookup table for palette (built if needed)
+  const LUT *lut(CQColorsPalette *palette, bool scale=false, bool invert=false);
+
+  //! number of built tables
+  int numLUTs() const;
+
+ public slots:
+  //! discard all tables
+  void clear();
+
+ private:
+  using Key         = std::tuple<CQColorsPalette *, bool, bool>;
+  using LUTs        = std::map<Key, LUTP>;
+  using RetiredLUTs = std::vector<LUTP>;
+  using Mutex       = std::shared_timed_mutex;
+
+  LUTs          luts_;    //!< tables by palette, scale and invert
+  RetiredLUTs   retired_; //!< discarded tables
+  mutable Mutex mutex_;   //!< table lock
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef CQChartsParallel_H
+#define CQChartsParallel_H
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief Simple std::async based parallel loop helpers
+ * \ingroup Charts
+ *
+ * Work is split into contiguous chunks (at least minChunk items each) and the last
+ * chunk is run on the calling thread. Small loops run sequentially.
+ */
+namespace CQChartsParallel {
+
+//! get/set max number of worker threads (0 = hardware concurrency)
+inline int &maxThreadsRef() { static int maxThreads = 0; return maxThreads; }
+
+inline int maxThreads() { return maxThreadsRef(); }
+inline void setMaxThreads(int n) { maxThreadsRef() = std::max(n, 0); }
+
+//! number of threads to use for parallel loops
+inline int numThreads() {
+  int n = maxThreads();
+
+  if (n <= 0)
+    n = int(std::thread::hardware_concurrency());
+
+  return std::max(n, 1);
+}
+
+//! call f(i1, i2) for contiguous sub ranges [i1, i2) of [0, n)
+template<typename FUNC>
+void forChunks(int n, FUNC f, int minChunk=1) {
+  if (n <= 0) return;
+
+  int nt = std::min(numThreads(), std::max(n/std::max(minChunk, 1), 1));
+
+  if (nt <= 1) {
+    f(0, n);
+    return;
+  }
+
+  int chunk = (n + nt - 1)/nt;
+
+  std::vector<std::future<void>> futures;
+
+  int i1 = 0;
+
+  while (i1 + chunk < n) {
+    int i2 = i1 + chunk;
+
+    futures.push_back(std::async(std::launch::async, [&f, i1, i2]() { f(i1, i2); }));
+
+    i1 = i2;
+  }
+
+  f(i1, n);
+
+  for (auto &future : futures)
+    future.get();
+}
+
+//! call f(i) for each i in [0, n)
+template<typename FUNC>
+void forEach(int n, FUNC f, int minChunk=1) {
+  forChunks(n, [&f](int i1, int i2) { for (int i = i1; i < i2; ++i) f(i); }, minChunk);
+}
+
+//! number of chunks used by forChunkInds for n items
+inline int numChunks(int n, int minChunk=1) {
+  if (n <= 0) return 0;
+
+  int nt = std::min(numThreads(), std::max(n/std::max(minChunk, 1), 1));
+
+  int chunk = (n + nt - 1)/nt;
+
+  return (n + chunk - 1)/chunk;
+}
+
+//! call f(ic, i1, i2) for each of the numChunks() chunks (for per chunk results)
+template<typename FUNC>
+void forChunkInds(int n, FUNC f, int minChunk=1) {
+  int nc = numChunks(n, minChunk);
+  if (nc <= 0) return;
+
+  int chunk = (n + nc - 1)/nc;
+
+  forEach(nc, [&](int ic) {
+    int i1 = ic*chunk;
+    int i2 = std::min(i1 + chunk, n);
+
+    if (i1 < i2)
+      f(ic, i1, i2);
+  });
+}
+
+}
+
+#endif
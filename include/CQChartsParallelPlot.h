@@ -273,6 +273,8 @@ class CQChartsParallelPlot : public CQChartsPlot,
 
   void updateAxes();
 
+  bool canProgressiveSample() const override { return true; }
+
   bool createObjs(PlotObjs &objs) const override;
 
   //---
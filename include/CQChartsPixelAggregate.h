@@ -0,0 +1,107 @@
+#ifndef CQChartsPixelAggregate_H
+#define CQChartsPixelAggregate_H
+
+#include <CQChartsGeom.h>
+#include <QImage>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*!
+ * \brief Per pixel aggregate (count/sum) canvas of points
+ * \ingroup Charts
+ *
+ * Points are binned into a canvas with one bin per pixel of a window rect. Chunks of
+ * points are accumulated into separate canvases on multiple threads which are then
+ * summed (in row chunks).
+ *
+ * The canvas is shaded by mapping each pixel value (count, sum or mean) to 0-1 using
+ * linear, log or equalized histogram (value rank) scaling and then to a color table.
+ *
+ * A canvas can be calculated from a sample (every n'th point) for a quick preview,
+ * counts and sums are scaled by the sample stride.
+ */
+class CQChartsPixelAggregate {
+ public:
+  using Point = CQChartsGeom::Point;
+  using BBox  = CQChartsGeom::BBox;
+
+  enum class ValueType {
+    COUNT,
+    SUM,
+    MEAN
+  };
+
+  enum class ShadeType {
+    LINEAR,
+    LOG,
+    EQ_HIST
+  };
+
+  //! points (optional value per point for sum/mean)
+  struct Points {
+    using Reals = std::vector<double>;
+
+    Reals x;
+    Reals y;
+    Reals v;
+
+    int size() const { return int(x.size()); }
+
+    bool hasValues() const { return ! v.empty(); }
+
+    void add(const Point &p) { x.push_back(p.x); y.push_back(p.y); }
+
+    void add(const Point &p, double value) { add(p); v.push_back(value); }
+
+    void clear() { x.clear(); y.clear(); v.clear(); }
+  };
+
+  //! pixel canvas (row 0 is top of rect)
+  struct Canvas {
+    using Counts = std::vector<uint32_t>;
+    using Sums   = std::vector<double>;
+
+    BBox   rect;            //!< window rect
+    int    width     { 0 }; //!< pixel width
+    int    height    { 0 }; //!< pixel height
+    int    stride    { 1 }; //!< point sample stride
+    long   numPoints { 0 }; //!< number of (sampled) points in rect
+    Counts counts;          //!< pixel counts
+    Sums   sums;            //!< pixel value sums (if points have values)
+
+    bool isValid() const { return (width > 0 && height > 0 && rect.isValid()); }
+
+    void init(const BBox &rect, int width, int height, bool hasSums);
+
+    //! get pixel for window point
+    bool pixelAt(const Point &p, int &i, int &j) const;
+
+    //! get pixel count (scaled by stride)
+    double count(int i, int j) const;
+
+    //! get pixel value (scaled by stride for count and sum)
+    double value(int i, int j, const ValueType &valueType) const;
+
+    double value(size_t ind, const ValueType &valueType) const;
+  };
+
+  using Values    = std::vector<float>;
+  using Colors    = std::vector<QRgb>;
+  using Interrupt = std::function<bool()>;
+
+ public:
+  //! accumulate every stride'th point into canvas for window rect and pixel size
+  //! (returns false if interrupted)
+  static bool calc(const Points &points, const BBox &rect, int width, int height,
+                   int stride, Canvas &canvas, const Interrupt &interrupt=Interrupt());
+
+  //! calc normalized (0-1) pixel values (-1 if empty)
+  static void shade(const Canvas &canvas, const ValueType &valueType,
+                    const ShadeType &shadeType, Values &tvalues);
+
+  //! create image from normalized pixel values and color table (empty pixels transparent)
+  static QImage image(const Canvas &canvas, const Values &tvalues, const Colors &colors);
+};
+
+#endif
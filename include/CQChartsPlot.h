@@ -20,6 +20,7 @@
 #include <CQChartsModelTypes.h>
 #include <CQChartsModelIndex.h>
 #include <CQChartsPlotModelVisitor.h>
+#include <CQChartsPlotStage.h>
 #include <CQChartsColorColumnData.h>
 #include <CQChartsAlphaColumnData.h>
 #include <CQChartsSymbolTypeData.h>
@@ -51,11 +52,13 @@ class CQChartsColorMapKey;
 class CQChartsTitle;
 class CQChartsPlotObj;
 class CQChartsPlotObjTree;
+class CQChartsDisplayList;
 class CQChartsPlotCustomControls;
 class CQChartsSymbolSet;
 
 class CQChartsAnnotation;
 class CQChartsAnnotationGroup;
+class CQChartsAnnotationTree;
 class CQChartsArcAnnotation;
 class CQChartsArcConnectorAnnotation;
 class CQChartsArrowAnnotation;
@@ -105,6 +108,7 @@ class CQThreadObject;
 
 class QAbstractProxyModel;
 class QItemSelectionModel;
+class QItemSelection;
 class QTextBrowser;
 class QRubberBand;
 class QMenu;
@@ -341,6 +345,12 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   Q_PROPERTY(bool showBoxes         READ showBoxes         WRITE setShowBoxes        )
   Q_PROPERTY(bool showSelectedBoxes READ showSelectedBoxes WRITE setShowSelectedBoxes)
 
+  Q_PROPERTY(bool drawRecord         READ isDrawRecord         WRITE setDrawRecord        )
+  Q_PROPERTY(bool drawRecordParallel READ isDrawRecordParallel WRITE setDrawRecordParallel)
+
+  Q_PROPERTY(bool progressive           READ isProgressive         WRITE setProgressive          )
+  Q_PROPERTY(int  progressiveSampleSize READ progressiveSampleSize WRITE setProgressiveSampleSize)
+
   Q_ENUMS(ColorType)
 
  public:
@@ -438,8 +448,9 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   using ModelP          = QSharedPointer<QAbstractItemModel>;
   using SelectionModelP = QPointer<QItemSelectionModel>;
 
-  using PlotObj  = CQChartsPlotObj;
-  using PlotObjs = std::vector<PlotObj *>;
+  using PlotObj    = CQChartsPlotObj;
+  using PlotObjs   = std::vector<PlotObj *>;
+  using PlotObjSet = std::set<PlotObj *>;
 
   using Obj  = CQChartsObj;
   using Objs = std::vector<Obj *>;
@@ -598,6 +609,71 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   void drawObjs();
 
+  //! redraw objects (middle) layer only
+  void drawMiddle();
+
+  //---
+
+  // property update stages
+  using Stage      = CQChartsPlotStage::Stage;
+  using Stages     = CQChartsPlotStage::Stages;
+  using StageGraph = CQChartsPlotStageGraph;
+
+  //! \brief property change stage trace entry
+  struct StageTraceEntry {
+    QString name;              //!< property name
+    Stages  declared  { 0 };   //!< declared stages (0 if undeclared)
+    Stages  requested { 0 };   //!< stages requested by property setter
+    Stages  applied   { 0 };   //!< stages invalidated
+  };
+
+  using StageTraceEntries = std::vector<StageTraceEntry>;
+
+  //! get property to update stage graph
+  const StageGraph &stageGraph() const { return stageGraph_; }
+
+  //! get invalidated stages of property path or name (0 if undeclared)
+  Stages propertyStages(const QString &name) const;
+
+  //! declare stages invalidated by property
+  void declarePropertyStages(const QString &name, Stages stages);
+
+  //! \brief RAII class to record stages requested by property setter (or invalidator)
+  //! and invalidate declared stages of property instead when scope ends
+  struct PropertyStagesScope {
+    PropertyStagesScope(Plot *plot, const QString &name) :
+     plot(plot) {
+      active = plot->beginPropertyStages(name, plot->propertyStages(name));
+    }
+
+   ~PropertyStagesScope() { if (active) plot->endPropertyStages(); }
+
+    Plot* plot   { nullptr };
+    bool  active { false };
+  };
+
+  //! set property member value and notify (declared stages of property replace stages
+  //! requested by notifier)
+  template<typename T, typename NOTIFIER>
+  void testAndSetProperty(const char *name, T &t, const T &v, NOTIFIER &&notifier) {
+    CQChartsUtil::testAndSet(t, v, [&]() {
+      PropertyStagesScope scope(this, name); notifier(); } );
+  }
+
+  //! invalidate stages (and dependents)
+  void invalidateStages(Stages stages);
+
+  //! get/set property change stage trace enabled
+  bool isStageTrace() const { return stageData_.trace; }
+  void setStageTrace(bool b);
+
+  //! get/clear property change stage trace
+  const StageTraceEntries &stageTrace() const { return stageData_.entries; }
+  void clearStageTrace() { stageData_.entries.clear(); }
+
+  //! number of times stage has been run
+  int stageCount(const Stage &stage) const;
+
   virtual void init3D() { }
   virtual void draw3D() { }
 
@@ -904,6 +980,40 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   bool isQueueUpdate() const { return queueUpdate_; }
   void setQueueUpdate(bool b) { queueUpdate_ = b; }
 
+  //! get/set record object draws into cached display lists (replayed on redraw)
+  bool isDrawRecord() const { return drawRecordData_.enabled; }
+  void setDrawRecord(bool b);
+
+  //! get/set record display lists for chunks of objects in parallel
+  //! Note: off by default as object draw code (execDrawObj) of most plot types reads
+  //! mutable plot and object caches (interpolated colors, text sizes, label positions)
+  //! without locks so is only safe for plot types whose draw code is thread safe
+  bool isDrawRecordParallel() const { return drawRecordData_.parallel; }
+  void setDrawRecordParallel(bool b);
+
+  //! clear recorded display lists
+  void clearDrawRecord();
+
+  //! get/set progressive update (objects created and drawn from a random sample of
+  //! rows first then refined using all rows). Only used by plots with per row objects
+  //! (see canProgressiveSample) and applies to all overlay plots when set on first plot
+  bool isProgressive() const { return progressiveData_.enabled; }
+  void setProgressive(bool b);
+
+  //! get/set number of sampled rows for first progressive update
+  int progressiveSampleSize() const { return progressiveData_.sampleSize; }
+  void setProgressiveSampleSize(int n);
+
+  //! get row stride of model visit (> 1 when creating objects from sample)
+  int progressiveStride() const { return progressiveData_.visitStride.load(); }
+
+  //! are current objects created from a progressive sample
+  bool isProgressiveSample() const { return (progressiveData_.sampleStride > 1); }
+
+  //! can objects be created from a sample of rows (one object per row so no counts or
+  //! sums of row values)
+  virtual bool canProgressiveSample() const { return false; }
+
   //---
 
   bool isOverview() const { return overview_; }
@@ -1708,6 +1818,28 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   void startUpdateDrawBackground();
   void startUpdateDrawForeground();
   void startUpdateDrawObjs();
+  void startUpdateDrawMiddle();
+
+  //! start/end property change (returns false if property stages not recorded)
+  bool beginPropertyStages(const QString &name, Stages declared);
+  void endPropertyStages();
+
+  //! record stages requested during declared property change (returns true if deferred)
+  bool traceStages(Stages stages);
+
+  //! increment run count of stage
+  void incStageCount(const Stage &stage);
+
+  void declareStyleStages(const QString &prefix, const QStringList &names, Stages stages);
+
+  //! declare fill, stroke or symbol (same prefix as add...Properties) style properties
+  //! only drawn by plot objects (middle layer) and key
+  void declareObjFillStages  (const QString &prefix);
+  void declareObjStrokeStages(const QString &prefix);
+  void declareObjSymbolStages(const QString &prefix);
+
+  void invalidateMiddleLayers();
+
   void startCalcRange(bool updateObjs);
   void startCalcObjs();
   void startDrawObjs();
@@ -1759,6 +1891,12 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   void updatePlotObjs();
 
+  void initProgressive();
+
+  int calcProgressiveStride(const Plot *plot) const;
+
+  void refineProgressive();
+
   virtual void resetInsideObjs();
   void resetInsideObjs1();
 
@@ -1879,6 +2017,8 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   virtual bool isApplyDataRange() const;
   virtual void applyDataRangeAndDraw();
 
+  void applyPanDataRangeAndDraw();
+
   virtual void applyDataRange(bool propagate=true);
 
   Range adjustDataRange(const Range &range) const;
@@ -2399,6 +2539,9 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   BBox calcPlotPixelRect() const;
   BBox calcPlotViewRect() const;
 
+  //! pixel rect covered by plot buffers (for partial view update)
+  BBox calcBufferPixelRect() const;
+
   BBox calcFitPixelRect() const;
 
   Size calcPixelSize() const;
@@ -2458,6 +2601,9 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   // get annotations
   const Annotations &annotations() const { return annotations_; }
 
+  // get annotation bbox tree
+  CQChartsAnnotationTree *annotationTree() const { return annotationTree_.get(); }
+
   // --- add annotation ---
 
   using Point3DArray = std::vector<CQChartsGeom::Point3D>;
@@ -2729,6 +2875,12 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   virtual void execDrawObjs(PaintDevice *device, const Layer::Type &type) const;
 
+  void execDrawObj(PaintDevice *device, PlotObj *plotObj, const Layer::Type &layerType) const;
+
+  bool canDrawRecord(PaintDevice *device, const Layer::Type &layerType) const;
+
+  void drawRecordObjs(PaintDevice *device, const Layer::Type &layerType) const;
+
   virtual void postDrawFgObjs(PaintDevice *) const { }
   virtual void postDrawBgObjs(PaintDevice *) const { }
   virtual void postDrawObjs  (PaintDevice *) const { }
@@ -2858,6 +3010,9 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   bool isValueVisible(int row, const QModelIndex &parent) const;
 
+  //! are all model rows visited (no row filters) so visit row is model row
+  bool isModelRowsUnfiltered() const;
+
   void setColumnValueVisible(const Column &column, const QVariant &value, bool visible);
   bool isColumnValueVisible(const Column &column, const QVariant &value) const;
 
@@ -2960,6 +3115,11 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
  public:
   virtual QColor interpColor(const Color &c, const ColorInd &ind) const;
 
+  // interp palette color for array of normalized values using palette lookup table
+  // (false if not interpolated palette color)
+  virtual bool interpColorValues(const Color &c, const std::vector<double> &values,
+                                 std::vector<QRgb> &rgbs) const;
+
   //---
 
  public:
@@ -3118,7 +3278,8 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   //---
 
-  void selectionSlot(QItemSelectionModel *sm);
+  void selectionSlot(QItemSelectionModel *sm, const QItemSelection &selected,
+                     const QItemSelection &deselected);
 
   void updateAnnotationSlot();
 
@@ -3279,6 +3440,9 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   void annotationsIntersectRect1(const BBox &r, Annotations &annotations, bool inside,
                                  const Constraints &constraints) const;
 
+  // invalidate annotation bbox tree if pixel mapping changed
+  void checkAnnotationTree() const;
+
   //---
 
  public:
@@ -3286,6 +3450,15 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   //---
 
+  // row to object index for cross select
+  void buildSelectRowIndex();
+  void clearSelectRowIndex();
+
+  void getSelectRowObjs(const QAbstractItemModel *model, const QItemSelection &selection,
+                        PlotObjSet &objs) const;
+
+  //---
+
 #if 0
  public:
   void clearSkipColors() { skipColors_.clear(); }
@@ -3317,6 +3490,7 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
     UPDATE_RANGE,           //!< needs range update
     UPDATE_OBJS,            //!< needs objs update
     UPDATE_DRAW_OBJS,       //!< needs draw objects
+    UPDATE_DRAW_MIDDLE,     //!< needs draw objects layer only
     UPDATE_DRAW_BACKGROUND, //!< needs draw background
     UPDATE_DRAW_FOREGROUND, //!< needs draw foreground
     UPDATE_VIEW,            //!< update view
@@ -3766,6 +3940,74 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   //---
 
+  using DisplayListP = std::unique_ptr<CQChartsDisplayList>;
+
+  //! \brief recorded object draw display list for layer
+  struct LayerDisplayList {
+    DisplayListP list;                   //!< display list
+    int          generation  { -1 };    //!< draw generation when recorded
+    double       pixelWidth  { 0.0 };   //!< pixel width of unit window width
+    double       pixelHeight { 0.0 };   //!< pixel height of unit window height
+    bool         interactive { false }; //!< recorded for interactive device
+  };
+
+  using LayerDisplayLists = std::map<Layer::Type, LayerDisplayList>;
+
+  //! \brief draw record data
+  struct DrawRecordData {
+    bool              enabled    { false }; //!< is enabled
+    bool              parallel   { false }; //!< record in parallel
+    int               generation { 0 };     //!< draw generation (changes on non-pan redraw)
+    bool              panning    { false }; //!< is pan only redraw
+    LayerDisplayLists layerLists;           //!< per layer display lists
+  };
+
+  mutable DrawRecordData drawRecordData_; //!< draw record data
+
+  //---
+
+  //! \brief progressive update data
+  struct ProgressiveData {
+    bool             enabled      { false }; //!< is enabled
+    int              sampleSize   { 10000 }; //!< number of sampled rows for first update
+    int              sampleStride { 1 };     //!< row stride of current objects
+    std::atomic<int> visitStride  { 1 };     //!< row stride applied to model visit
+    bool             refine       { false }; //!< next update refines sample
+  };
+
+  ProgressiveData progressiveData_; //!< progressive update data
+
+  //---
+
+  //! \brief property change update stage data
+  struct StageData {
+    int               depth     { 0 };     //!< property change depth
+    QString           name;                //!< current property name
+    Stages            declared  { 0 };     //!< current property declared stages
+    Stages            requested { 0 };     //!< stages requested by current property setter
+    bool              trace     { false }; //!< record trace entries
+    StageTraceEntries entries;             //!< trace entries
+    std::atomic<bool> modelRead { false }; //!< model (columns, filters) needs reread
+    std::atomic<int>  counts[CQChartsPlotStage::NUM_STAGES] {}; //!< stage run counts
+  };
+
+  StageGraph stageGraph_; //!< declared property update stages
+  StageData  stageData_;  //!< property change update stage data
+
+  //---
+
+  //! \brief inverted index from normalized model rows to plot objects (cross select)
+  struct SelectRowData {
+    using RowObjs       = std::vector<PlotObjs>;
+    using ParentRowObjs = std::map<QModelIndex, RowObjs>;
+
+    ParentRowObjs parentRowObjs; //!< objects per row of each (normalized) parent
+  };
+
+  SelectRowData selectRowData_; //!< select row data
+
+  //---
+
   UpdateData  updateData_;  //!< update data
   MouseData   mouseData_;   //!< mouse event data
   AnimateData animateData_; //!< animation data
@@ -3785,8 +4027,11 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
   bool         editing_     { false }; //!< is editing
 
   // annotations
-  Annotations annotations_;      //!< extra annotations
-  Annotations pressAnnotations_; //!< press annotations
+  using AnnotationTreeP = std::unique_ptr<CQChartsAnnotationTree>;
+
+  Annotations     annotations_;      //!< extra annotations
+  Annotations     pressAnnotations_; //!< press annotations
+  AnnotationTreeP annotationTree_;   //!< annotation bbox tree
 
   //---
 
@@ -3857,6 +4102,7 @@ class CQChartsPlot : public CQChartsObj, public CQChartsEditableIFace,
 
   mutable std::mutex resizeMutex_;  //!< resize mutex
   mutable std::mutex updatesMutex_; //!< updates enabled mutex
+  mutable std::mutex bufferMutex_;  //!< draw buffers mutex
 };
 
 //------
@@ -21,6 +21,63 @@ class CQChartsPlot3DType : public CQChartsGroupPlotType {
 
 //---
 
+/*!
+ * \brief 3D Plot objects at reference points
+ * \ingroup Charts
+ *
+ * Reference points are stored in separate x, y, z arrays so all points are projected
+ * by the camera in one batch and depth sorted (radix sort of projected z) on each draw.
+ * Objects which support it are culled against the (2D) draw box after projection.
+ */
+class CQChartsPlot3DPointObjs {
+ public:
+  using Point3D = CQChartsGeom::Point3D;
+  using BBox    = CQChartsGeom::BBox;
+  using Obj     = CQChartsPlot3DObj;
+  using Objs    = std::vector<Obj *>;
+  using Reals   = std::vector<double>;
+  using Inds    = std::vector<int>;
+
+ public:
+  CQChartsPlot3DPointObjs() { }
+
+  //! add object at reference point
+  void add(const Point3D &p, Obj *obj);
+
+  //! remove objects
+  void clear();
+
+  //! delete and remove objects
+  void deleteObjs();
+
+  bool empty() const { return objs_.empty(); }
+
+  int size() const { return int(objs_.size()); }
+
+  const Objs &objs() const { return objs_; }
+
+  //! project reference points and get back to front draw order of objects not outside
+  //! box (if valid)
+  void drawOrder(const CQChartsCamera *camera, const BBox &bbox, Inds &inds) const;
+
+  //! projected reference point (set by drawOrder)
+  Point3D projPoint(int i) const {
+    return Point3D(txs_[size_t(i)], tys_[size_t(i)], tzs_[size_t(i)]);
+  }
+
+ private:
+  Reals xs_;  //!< reference point x
+  Reals ys_;  //!< reference point y
+  Reals zs_;  //!< reference point z
+  Objs  objs_; //!< objects
+
+  mutable Reals txs_; //!< projected reference point x
+  mutable Reals tys_; //!< projected reference point y
+  mutable Reals tzs_; //!< projected reference point z
+};
+
+//---
+
 class CQChartsLine3DObj;
 class CQChartsText3DObj;
 class CQChartsPolyline3DObj;
@@ -158,6 +215,9 @@ class CQChartsPlot3D : public CQChartsGroupPlot {
 
   void drawPointObjs(PaintDevice *device) const;
 
+  void drawPointObjs(PaintDevice *device, const CQChartsPlot3DPointObjs &pointObjs,
+                     const BBox &bbox) const;
+
   //---
 
   bool selectMousePress(const Point &p, SelMod selMod) override;
@@ -209,7 +269,7 @@ class CQChartsPlot3D : public CQChartsGroupPlot {
 
   using Obj       = CQChartsPlot3DObj;
   using Objs      = std::vector<Obj *>;
-  using PointObjs = std::map<Point3D, Objs>;
+  using PointObjs = CQChartsPlot3DPointObjs;
 
   mutable PointObjs bgPointObjs_;
   mutable PointObjs pointObjs_;
@@ -242,6 +302,13 @@ class CQChartsPlot3DObj : public CQChartsPlotObj {
   const BBox &drawBBox() const { return drawBBox_; }
   void setDrawBBox(const BBox &b) { drawBBox_ = b; }
 
+  //! get/set projected reference point (set before draw)
+  const Point3D &drawRefPoint() const { return drawRefPoint_; }
+  void setDrawRefPoint(const Point3D &p) { drawRefPoint_ = p; }
+
+  //! is object drawn inside box when projected reference point is outside box
+  virtual bool isDrawInside(const Point3D &, const BBox &) const { return true; }
+
   void calcPenBrush(PenBrush &, bool) const override;
 
  private:
@@ -249,6 +316,7 @@ class CQChartsPlot3DObj : public CQChartsPlotObj {
   Point3D               refPoint_;           //!< reference point
   CQChartsPenBrush      penBrush_;           //!< pen/brush
   mutable BBox          drawBBox_;           //!< draw bounding box
+  Point3D               drawRefPoint_;       //!< projected reference point
 };
 
 //---
@@ -0,0 +1,86 @@
+#ifndef CQChartsPlotStage_H
+#define CQChartsPlotStage_H
+
+#include <QString>
+#include <QStringList>
+#include <map>
+
+/*!
+ * \brief Plot update pipeline stages
+ * \ingroup Charts
+ *
+ * Stages form a dependency graph (model read -> range -> objects -> tree/draw) so
+ * invalidating a stage invalidates all stages downstream of it. Outputs of stages
+ * upstream of an invalidated stage (range, objects, object tree, layer buffers) are
+ * kept and reused.
+ */
+class CQChartsPlotStage {
+ public:
+  enum class Stage : unsigned int {
+    NONE            = 0,
+    MODEL           = (1<<0), //!< model read (columns, filters)
+    RANGE           = (1<<1), //!< data range calc
+    OBJS            = (1<<2), //!< plot object creation
+    TREE            = (1<<3), //!< plot object tree build
+    DRAW_BACKGROUND = (1<<4), //!< background layer draw
+    DRAW_OBJS       = (1<<5), //!< objects (middle) layer draw
+    DRAW_FOREGROUND = (1<<6), //!< foreground layer draw
+    DRAW_KEY        = (1<<7)  //!< key layer draw (background or foreground)
+  };
+
+  using Stages = unsigned int;
+
+  static constexpr int NUM_STAGES = 8;
+
+  //! stages and all stages downstream of them
+  static Stages dependents(Stages stages);
+
+  //! stages to/from string (names separated by '|')
+  static QString toString(Stages stages);
+  static Stages fromString(const QString &str, bool &ok);
+
+  //! stage names
+  static QStringList stageNames();
+
+  //! stage name for index (bit position)
+  static QString stageName(int i);
+};
+
+//---
+
+/*!
+ * \brief Declared plot property to update stage map
+ * \ingroup Charts
+ *
+ * Properties (by property name) are mapped to the stages changing the property value
+ * invalidates. Undeclared properties invalidate whatever their setter requests.
+ */
+class CQChartsPlotStageGraph {
+ public:
+  using Stages = CQChartsPlotStage::Stages;
+
+ public:
+  CQChartsPlotStageGraph() { }
+
+  //! declare stages invalidated by property (NONE removes declaration)
+  void declare(const QString &name, Stages stages);
+
+  //! is property declared
+  bool isDeclared(const QString &name) const;
+
+  //! declared stages of property
+  Stages declaredStages(const QString &name) const;
+
+  //! invalidated stages of property (declared stages and dependents)
+  Stages stages(const QString &name) const;
+
+  //! declared property names
+  QStringList names() const;
+
+ private:
+  using PropertyStages = std::map<QString, Stages>;
+
+  PropertyStages propertyStages_; //!< declared stages per property
+};
+
+#endif
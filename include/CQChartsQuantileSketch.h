@@ -0,0 +1,107 @@
+#ifndef CQChartsQuantileSketch_H
+#define CQChartsQuantileSketch_H
+
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Mergeable approximate quantile sketch (KLL)
+ * \ingroup Charts
+ *
+ * Values are added to a stack of compactors. When a compactor is full it is sorted and
+ * every other value (random odd or even offset) is promoted to the next compactor
+ * with twice the weight. Compactor capacities decrease geometrically with depth so
+ * the number of retained values is fixed (about 3*k) for any number of added values.
+ *
+ * The rank error of a quantile query is approximately the configured error and k is
+ * derived from it. Sketches with the same error can be merged (e.g. from parallel
+ * partitions) and values can be appended at any time.
+ *
+ * Count, min, max, sum, mean and standard deviation are exact.
+ */
+class CQChartsQuantileSketch {
+ public:
+  using Reals = std::vector<double>;
+
+ public:
+  explicit CQChartsQuantileSketch(double error=0.01);
+
+  //! get/set error (normalized rank error, resets sketch)
+  double error() const { return error_; }
+  void setError(double e);
+
+  //! get compactor size (derived from error)
+  int k() const { return k_; }
+
+  //! reset to empty
+  void clear();
+
+  //! add value
+  void add(double v);
+
+  //! merge values of other sketch
+  void merge(const CQChartsQuantileSketch &sketch);
+
+  //---
+
+  bool isEmpty() const { return (n_ == 0); }
+
+  //! exact count/min/max/sum/mean/stddev
+  long count() const { return n_; }
+
+  double min() const { return min_; }
+  double max() const { return max_; }
+
+  double sum   () const { return mean_*double(n_); }
+  double mean  () const { return mean_; }
+  double stddev() const;
+
+  //---
+
+  //! get approximate value at quantile (0-1)
+  double quantile(double q) const;
+
+  //! get approximate values at multiple quantiles (0-1)
+  void quantiles(const Reals &qs, Reals &values) const;
+
+  //! get n approximate values at evenly spaced quantiles (for density)
+  void sample(int n, Reals &values) const;
+
+  //! get approximate normalized rank (0-1) of value
+  double rank(double v) const;
+
+  //! number of retained values
+  int numRetained() const;
+
+ private:
+  struct Item {
+    double   value;
+    uint64_t weight;
+  };
+
+  using Items  = std::vector<Item>;
+  using Levels = std::vector<Reals>;
+
+  int capacity(int level) const;
+
+  void compress();
+
+  void compactLevel(int level);
+
+  void sortedItems(Items &items) const;
+
+  bool randomBit();
+
+ private:
+  double   error_ { 0.01 };   //!< normalized rank error
+  int      k_     { 200 };    //!< compactor size
+  Levels   levels_;           //!< compactors (level i values have weight 2^i)
+  long     n_     { 0 };      //!< number of values
+  double   min_   { 0.0 };    //!< min value
+  double   max_   { 0.0 };    //!< max value
+  double   mean_  { 0.0 };    //!< running mean
+  double   m2_    { 0.0 };    //!< running sum of squared differences from mean
+  uint64_t seed_  { 0x9e3779b97f4a7c15ULL }; //!< random bit state
+};
+
+#endif
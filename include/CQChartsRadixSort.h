@@ -0,0 +1,124 @@
+#ifndef CQChartsRadixSort_H
+#define CQChartsRadixSort_H
+
+#include <CQChartsParallel.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*!
+ * \brief Parallel LSD radix sort of 32 bit keys
+ * \ingroup Charts
+ *
+ * Sorts indices by key in three passes of 11 bit digits. Each pass builds per chunk
+ * digit counts in parallel, converts them to per chunk output offsets and scatters
+ * each chunk in parallel so the sort is stable. Passes where all keys have the same
+ * digit are skipped.
+ */
+namespace CQChartsRadixSort {
+
+//! map float to unsigned key with same order (negative values reversed)
+inline uint32_t floatKey(float f) {
+  uint32_t u;
+
+  std::memcpy(&u, &f, sizeof(u));
+
+  return ((u & 0x80000000U) ? ~u : (u | 0x80000000U));
+}
+
+//! get indices [0, n) of keys in stable ascending key order
+inline void sortInds(const std::vector<uint32_t> &keys, std::vector<int> &inds) {
+  const int      numBits    = 11;
+  const int      numBuckets = (1<<numBits);
+  const uint32_t mask       = uint32_t(numBuckets - 1);
+  const int      numPasses  = 3;
+  const int      minChunk   = 65536;
+
+  int n = int(keys.size());
+
+  inds.resize(size_t(n));
+
+  for (int i = 0; i < n; ++i)
+    inds[size_t(i)] = i;
+
+  if (n <= 1)
+    return;
+
+  //---
+
+  // keys are moved with indices so digit reads are sequential
+  auto sn = size_t(n);
+
+  std::vector<uint32_t> keys1(keys), keys2(sn);
+  std::vector<int>      inds2(sn);
+
+  int nc = CQChartsParallel::numChunks(n, minChunk);
+
+  std::vector<int> offsets(size_t(nc*numBuckets));
+
+  for (int pass = 0; pass < numPasses; ++pass) {
+    int shift = pass*numBits;
+
+    // per chunk digit counts
+    std::fill(offsets.begin(), offsets.end(), 0);
+
+    CQChartsParallel::forChunkInds(n, [&](int ic, int i1, int i2) {
+      int *counts = &offsets[size_t(ic*numBuckets)];
+
+      for (int i = i1; i < i2; ++i)
+        ++counts[(keys1[size_t(i)] >> shift) & mask];
+    }, minChunk);
+
+    // skip pass if all keys have same digit
+    bool skip = false;
+
+    for (int b = 0; b < numBuckets; ++b) {
+      int count = 0;
+
+      for (int ic = 0; ic < nc; ++ic)
+        count += offsets[size_t(ic*numBuckets + b)];
+
+      if (count == n) { skip = true; break; }
+      if (count >  0) break;
+    }
+
+    if (skip)
+      continue;
+
+    // counts to output offsets (digit major, chunk minor)
+    int sum = 0;
+
+    for (int b = 0; b < numBuckets; ++b) {
+      for (int ic = 0; ic < nc; ++ic) {
+        int &offset = offsets[size_t(ic*numBuckets + b)];
+
+        int count = offset;
+
+        offset = sum;
+
+        sum += count;
+      }
+    }
+
+    // scatter
+    CQChartsParallel::forChunkInds(n, [&](int ic, int i1, int i2) {
+      int *chunkOffsets = &offsets[size_t(ic*numBuckets)];
+
+      for (int i = i1; i < i2; ++i) {
+        auto key = keys1[size_t(i)];
+
+        auto j = size_t(chunkOffsets[(key >> shift) & mask]++);
+
+        keys2[j] = key;
+        inds2[j] = inds[size_t(i)];
+      }
+    }, minChunk);
+
+    std::swap(keys1, keys2);
+    std::swap(inds , inds2);
+  }
+}
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef CQChartsRecordPaintDevice_H
+#define CQChartsRecordPaintDevice_H
+
+#include <CQChartsPaintDevice.h>
+
+class CQChartsDisplayList;
+
+/*!
+ * \brief Paint Device to record draw calls into a display list
+ * \ingroup Charts
+ *
+ * Draw calls are stored (in window coordinates) for later replay onto another device.
+ * Current pen, brush, font, transform and clip are tracked (with save/restore) so code
+ * querying device state sees the same values as when drawing directly.
+ */
+class CQChartsRecordPaintDevice : public CQChartsPaintDevice {
+ public:
+  using View        = CQChartsView;
+  using Plot        = CQChartsPlot;
+  using DisplayList = CQChartsDisplayList;
+
+ public:
+  CQChartsRecordPaintDevice(View *view, DisplayList *displayList);
+  CQChartsRecordPaintDevice(Plot *plot, DisplayList *displayList);
+
+  DisplayList *displayList() const { return displayList_; }
+
+  Type type() const override { return Type::RECORD; }
+
+  //! get/set interactive (mirrors device list is replayed on)
+  bool isInteractive() const override { return interactive_; }
+  void setInteractive(bool b) { interactive_ = b; }
+
+  //---
+
+  // object segments (for culling on replay)
+  void beginObject(const BBox &bbox);
+  void endObject();
+
+  //! set zoom font (recorded)
+  void setRecordZoomFont(bool b);
+
+  //---
+
+  void save   () override;
+  void restore() override;
+
+  void setClipPath(const QPainterPath &path, Qt::ClipOperation operation=Qt::ReplaceClip) override;
+  void setClipRect(const BBox &bbox, Qt::ClipOperation operation=Qt::ReplaceClip) override;
+
+  BBox clipRect() const override { return state_.clipRect; }
+
+  QPen pen() const override { return state_.pen; }
+  void setPen(const QPen &pen) override;
+
+  QBrush brush() const override { return state_.brush; }
+  void setBrush(const QBrush &brush) override;
+
+  void setAltColor(const QColor &c) override;
+  void setAltAlpha(double alpha) override;
+
+  void setFillAngle(double a) override;
+  void setFillType(CQChartsFillPattern::Type t) override;
+  void setFillRadius(double r) override;
+  void setFillDelta(double d) override;
+  void setFillWidth(double w) override;
+
+  void fillPath  (const QPainterPath &path, const QBrush &brush) override;
+  void strokePath(const QPainterPath &path, const QPen &pen) override;
+  void drawPath  (const QPainterPath &path) override;
+
+  void fillRect(const BBox &bbox) override;
+  void drawRect(const BBox &bbox) override;
+
+  void drawEllipse(const BBox &bbox, const Angle &a=Angle()) override;
+
+  void drawPolygon (const Polygon &poly) override;
+  void drawPolyline(const Polygon &poly) override;
+
+  void drawLine(const Point &p1, const Point &p2) override;
+
+  void drawPoint(const Point &p) override;
+
+  void drawText(const Point &p, const QString &text) override;
+  void drawTransformedText(const Point &p, const QString &text) override;
+
+  void drawImage(const Point &, const QImage &) override;
+  void drawImageInRect(const BBox &bbox, const Image &image, bool stretch=true,
+                       const Angle &angle=Angle()) override;
+
+  const QFont &font() const override { return state_.font; }
+  void setFont(const QFont &f, bool scale=true) override;
+
+  void setTransformRotate(const Point &p, double angle) override;
+
+  const QTransform &transform() const override { return state_.transform; }
+  void setTransform(const QTransform &t, bool combine=false) override;
+
+  void setRenderHints(QPainter::RenderHints hints, bool on) override;
+
+  void setColorNames() override;
+  void setColorNames(const QString &strokeName, const QString &fillName) override;
+
+  void resetColorNames() override;
+
+  void startGroup(const QString &id, const GroupData &groupData=GroupData()) override;
+  void endGroup() override;
+
+  void setPainterFont(const Font &font) override;
+
+ private:
+  //! tracked state
+  struct State {
+    QPen       pen;
+    QBrush     brush;
+    QFont      font;
+    QTransform transform;
+    BBox       clipRect;
+  };
+
+  using States = std::vector<State>;
+
+  DisplayList* displayList_ { nullptr };
+  bool         interactive_ { false };
+  State        state_;
+  States       states_;
+};
+
+#endif
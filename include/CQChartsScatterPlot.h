@@ -7,9 +7,13 @@
 #include <CQChartsGridCell.h>
 #include <CQChartsImage.h>
 #include <CQChartsKey.h>
+#include <CQChartsPixelAggregate.h>
 #include <CInterval.h>
 #include <CHexMap.h>
 
+#include <atomic>
+#include <mutex>
+
 class CQChartsScatterPlot;
 class CQChartsBivariateDensity;
 
@@ -411,6 +415,44 @@ class CQChartsScatterDensityObj : public CQChartsPlotObj {
 
 //---
 
+/*!
+ * \brief Scatter Plot Aggregate object
+ * \ingroup Charts
+ *
+ * Draws image of per pixel aggregate canvas of all points (calculated in background
+ * for current view)
+ */
+class CQChartsScatterAggregateObj : public CQChartsPlotObj {
+  Q_OBJECT
+
+ public:
+  using Plot = CQChartsScatterPlot;
+
+ public:
+  CQChartsScatterAggregateObj(const Plot *plot, const BBox &rect);
+
+  //---
+
+  QString typeName() const override { return "aggregate"; }
+
+  QString calcId() const override;
+
+  QString calcTipId() const override;
+
+  //---
+
+  void draw(PaintDevice *device) const override;
+
+  void calcPenBrush(PenBrush &, bool) const override { }
+
+  bool drawMouseOver() const override { return false; }
+
+ private:
+  const Plot* plot_ { nullptr }; //!< scatter plot
+};
+
+//---
+
 /*!
  * \brief Scatter Plot Key Color Box
  * \ingroup Charts
@@ -519,6 +561,11 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   Q_PROPERTY(double    densityMapDelta    READ densityMapDelta    WRITE setDensityMapDelta   )
   Q_PROPERTY(DrawLayer densityMapLayer    READ densityMapLayer    WRITE setDensityMapLayer   )
 
+  // aggregate
+  Q_PROPERTY(AggregateValue aggregateValue      READ aggregateValue      WRITE setAggregateValue     )
+  Q_PROPERTY(AggregateShade aggregateShade      READ aggregateShade      WRITE setAggregateShade     )
+  Q_PROPERTY(int            aggregateSampleSize READ aggregateSampleSize WRITE setAggregateSampleSize)
+
   // symbol data
   CQCHARTS_POINT_DATA_PROPERTIES
 
@@ -532,6 +579,8 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   CQCHARTS_NAMED_SHAPE_DATA_PROPERTIES(GridCell, gridCell)
 
   Q_ENUMS(PlotType)
+  Q_ENUMS(AggregateValue)
+  Q_ENUMS(AggregateShade)
 
   Q_ENUMS(XSide)
   Q_ENUMS(YSide)
@@ -541,7 +590,20 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
     NONE,
     SYMBOLS,
     GRID_CELLS,
-    HEX_CELLS
+    HEX_CELLS,
+    AGGREGATE
+  };
+
+  enum class AggregateValue {
+    COUNT = static_cast<int>(CQChartsPixelAggregate::ValueType::COUNT),
+    SUM   = static_cast<int>(CQChartsPixelAggregate::ValueType::SUM),
+    MEAN  = static_cast<int>(CQChartsPixelAggregate::ValueType::MEAN)
+  };
+
+  enum class AggregateShade {
+    LINEAR  = static_cast<int>(CQChartsPixelAggregate::ShadeType::LINEAR),
+    LOG     = static_cast<int>(CQChartsPixelAggregate::ShadeType::LOG),
+    EQ_HIST = static_cast<int>(CQChartsPixelAggregate::ShadeType::EQ_HIST)
   };
 
   //--
@@ -651,6 +713,7 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   bool isSymbols  () const { return (plotType() == PlotType::SYMBOLS   ); }
   bool isGridCells() const { return (plotType() == PlotType::GRID_CELLS); }
   bool isHexCells () const { return (plotType() == PlotType::HEX_CELLS ); }
+  bool isAggregate() const { return (plotType() == PlotType::AGGREGATE ); }
 
   //---
 
@@ -680,6 +743,19 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
 
   //---
 
+  // aggregate (value from color column for sum/mean)
+  const AggregateValue &aggregateValue() const { return aggregateData_.value; }
+  void setAggregateValue(const AggregateValue &v);
+
+  const AggregateShade &aggregateShade() const { return aggregateData_.shade; }
+  void setAggregateShade(const AggregateShade &s);
+
+  //! number of points in first (preview) pass (<= 0 for no preview)
+  int aggregateSampleSize() const { return aggregateData_.sampleSize; }
+  void setAggregateSampleSize(int n);
+
+  //---
+
   // grid cells
   int gridNumX() const { return gridData_.nx(); }
   void setGridNumX(int n);
@@ -708,11 +784,25 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   void addNameValue(int groupInd, const QString &name, const Point &p, int row,
                     const QModelIndex &xind, const Color &color=Color());
 
+  void addAggregatePoint(int groupInd, const Point &p, int row, const QModelIndex &parent);
+
+  //---
+
+  // get image of calculated aggregate canvas for color table (and canvas window rect)
+  QImage aggregateImage(const CQChartsPixelAggregate::Colors &colors, BBox &rect,
+                        bool &sampled) const;
+
+  // get aggregate canvas summary tip
+  QString aggregateTipText() const;
+
   //---
 
   // custom color interp (for overlay)
   QColor interpColor(const Color &c, const ColorInd &ind) const override;
 
+  bool interpColorValues(const Color &c, const std::vector<double> &values,
+                         std::vector<QRgb> &rgbs) const override;
+
   //---
 
   // add properties
@@ -728,12 +818,17 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
 
   void clearPlotObjects() override;
 
+  // only symbols have one object per row (grid/hex cells and aggregates count rows)
+  bool canProgressiveSample() const override { return isSymbols(); }
+
   bool createObjs(PlotObjs &obj) const override;
 
   void addPointObjects(PlotObjs &objs) const;
   void addGridObjects (PlotObjs &objs) const;
   void addHexObjects  (PlotObjs &objs) const;
 
+  void addAggregateObjects(PlotObjs &objs) const;
+
   void addConnectedObjects(PlotObjs &objs) const;
   void addBestFitObjects  (PlotObjs &objs) const;
   void addHullObjects     (PlotObjs &objs) const;
@@ -786,6 +881,7 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   using CellObj      = CQChartsScatterCellObj;
   using HexObj       = CQChartsScatterHexObj;
   using DensityObj   = CQChartsScatterDensityObj;
+  using AggregateObj = CQChartsScatterAggregateObj;
 
   virtual PointObj *createPointObj(int groupInd, const BBox &rect, const Point &p,
                                    const ColorInd &is, const ColorInd &ig,
@@ -804,6 +900,16 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
 
   virtual DensityObj *createDensityObj(int groupInd, const QString &name, const BBox &rect) const;
 
+  virtual AggregateObj *createAggregateObj(const BBox &rect) const;
+
+  //---
+
+  void postResize() override;
+
+  void applyDataRangeAndDraw() override;
+
+  bool plotTipText(const Point &p, QString &tip, bool single) const override;
+
   //---
 
   void addKeyItems(PlotKey *key) override;
@@ -937,6 +1043,12 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
 
   void calcDensityMapImpl(int groupInd);
 
+  void calcAggregate() const;
+
+  static void calcAggregateThread(CQChartsScatterPlot *plot);
+
+  void calcAggregateImpl();
+
  public slots:
   // set plot type
   void setPlotType(PlotType plotType);
@@ -946,6 +1058,7 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   void setSymbols  (bool b);
   void setGridCells(bool b);
   void setHexCells (bool b);
+  void setAggregate(bool b);
 
   // overlays
   void setDensityMap(bool b);
@@ -1017,7 +1130,38 @@ class CQChartsScatterPlot : public CQChartsPointPlot,
   AxisBoxWhisker* yAxisWhisker_ { nullptr }; //!< y axis whisker master object
 
   // plot overlay data
+  // aggregate data
+  //
+  // Points are collected on create objs and are binned into a canvas for the current
+  // view in a background thread (sample pass then full pass). A new view request
+  // increments the generation which interrupts the current calculation.
+  struct AggregateData {
+    using Points  = CQChartsPixelAggregate::Points;
+    using PointsP = std::shared_ptr<Points>;
+    using Canvas  = CQChartsPixelAggregate::Canvas;
+    using Values  = CQChartsPixelAggregate::Values;
+    using Colors  = CQChartsPixelAggregate::Colors;
+
+    AggregateValue     value        { AggregateValue::COUNT };   //!< pixel value
+    AggregateShade     shade        { AggregateShade::EQ_HIST }; //!< pixel shade
+    int                sampleSize   { 100000 };                  //!< preview sample size
+    Points             addPoints;                                //!< points being added
+    PointsP            points;                                   //!< calc points
+    BBox               rect;                                     //!< requested window rect
+    Size               psize;                                    //!< requested pixel size
+    std::atomic<int>   generation   { 0 };                       //!< request generation
+    Canvas             canvas;                                   //!< calculated canvas
+    Values             tvalues;                                  //!< calculated shade values
+    int                resultId     { 0 };                       //!< calculated result id
+    CQThreadObject*    thread       { nullptr };                 //!< calc thread
+    mutable QImage     image;                                    //!< cached image
+    mutable Colors     imageColors;                              //!< cached image colors
+    mutable int        imageId      { -1 };                      //!< cached image result id
+    mutable std::mutex mutex;                                    //!< lock
+  };
+
   DensityMapData densityMapData_;   //!< density map data
+  AggregateData  aggregateData_;    //!< aggregate data
   GridCell       gridData_;         //!< grid data
   HexMap         hexMap_;           //!< hex map
   int            hexMapMaxN_ { 0 }; //!< hex map max N
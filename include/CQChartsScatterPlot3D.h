@@ -111,6 +111,8 @@ class CQChartsScatterPoint3DObj : public CQChartsPlot3DObj {
 
   //---
 
+  bool isDrawInside(const Point3D &pt, const BBox &bbox) const override;
+
   void postDraw(PaintDevice *device) override;
 
   //---
@@ -0,0 +1,101 @@
+#ifndef CQChartsSeriation_H
+#define CQChartsSeriation_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+/*!
+ * \brief Matrix seriation (row/column reordering)
+ * \ingroup Charts
+ *
+ * Calculates a symmetric ordering of the rows/columns of a square sparse matrix so
+ * that strongly connected rows are placed close together. The matrix is treated as
+ * an undirected weighted graph (weight of i-j is |a(i,j)| + |a(j,i)|, diagonal ignored).
+ *
+ * Orderings:
+ *  + SPECTRAL : sort by Fiedler vector (second smallest Laplacian eigenvector) per
+ *               connected component, calculated by inverse iteration (conjugate
+ *               gradient solves) from breadth first distances of a peripheral node
+ *  + RCM      : reverse Cuthill-McKee (bandwidth reduction) from pseudo-peripheral nodes
+ *  + CLUSTER  : leaf order of average linkage clustering of row cosine distances, with
+ *               each merge flipped so the adjacent end leaves are closest
+ *
+ * Matrix products and distances are calculated on multiple threads. Results are cached
+ * per ordering type and matrix contents so a plot can reapply an ordering cheaply.
+ */
+class CQChartsSeriation {
+ public:
+  enum class Type {
+    NONE,
+    SPECTRAL,
+    RCM,
+    CLUSTER
+  };
+
+  //! square sparse matrix (compressed rows, columns sorted per row)
+  struct Matrix {
+    using Inds   = std::vector<int>;
+    using Values = std::vector<double>;
+
+    int    n { 0 };  //!< number of rows/columns
+    Inds   rowStart; //!< start of row entries (n + 1 values)
+    Inds   cols;     //!< entry column
+    Values values;   //!< entry value
+
+    int numValues() const { return int(cols.size()); }
+
+    //! create from dense row major values (zero values skipped)
+    static Matrix fromDense(int n, const Values &values);
+  };
+
+  //! permutation (position -> original index)
+  using Permutation = std::vector<int>;
+
+ public:
+  CQChartsSeriation();
+
+  //! get/set max rows for cluster ordering (uses dense n x n distances, spectral if larger)
+  int maxClusterRows() const { return maxClusterRows_; }
+  void setMaxClusterRows(int n) { maxClusterRows_ = n; }
+
+  //! get/set max Laplacian products (iterations) for spectral ordering
+  int maxIterations() const { return maxIterations_; }
+  void setMaxIterations(int n) { maxIterations_ = n; }
+
+  //! calc ordering (cached)
+  Permutation calc(const Type &type, const Matrix &matrix);
+
+  //! is ordering of matrix cached
+  bool isCached(const Type &type, const Matrix &matrix);
+
+  void clearCache();
+
+  //---
+
+  static Permutation calcSpectral(const Matrix &matrix, int maxIterations=20000);
+  static Permutation calcRCM     (const Matrix &matrix);
+  static Permutation calcCluster (const Matrix &matrix);
+
+ private:
+  //! undirected weighted graph (symmetric matrix without diagonal)
+  static Matrix symmetricGraph(const Matrix &matrix);
+
+  static size_t matrixHash(const Matrix &matrix);
+
+ private:
+  struct CacheData {
+    size_t      hash { 0 }; //!< matrix hash
+    int         n    { 0 }; //!< matrix size
+    Permutation perm;       //!< permutation
+  };
+
+  using TypeCache = std::map<Type, CacheData>;
+
+  int        maxClusterRows_ { 5000 };  //!< max rows for cluster ordering
+  int        maxIterations_  { 20000 }; //!< max spectral Laplacian products
+  TypeCache  cache_;                    //!< cached permutations per type
+  std::mutex mutex_;                    //!< cache mutex
+};
+
+#endif
@@ -154,6 +154,8 @@ class CQChartsStripPlot : public CQChartsGroupPlot,
 
   //---
 
+  bool canProgressiveSample() const override { return true; }
+
   bool createObjs(PlotObjs &objs) const override;
 
   //---
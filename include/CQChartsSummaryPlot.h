@@ -96,6 +96,10 @@ class CQChartsSummaryPlot : public CQChartsPlot,
   // density
   Q_PROPERTY(bool density READ isDensity WRITE setDensity)
 
+  // level of detail
+  Q_PROPERTY(int lodPoints READ lodPoints WRITE setLodPoints)
+  Q_PROPERTY(int lodBins   READ lodBins   WRITE setLodBins  )
+
   // TODO: hull
 
   Q_ENUMS(PlotType)
@@ -129,6 +133,16 @@ class CQChartsSummaryPlot : public CQChartsPlot,
   using CellObj          = CQChartsSummaryCellObj;
   using Length           = CQChartsLength;
   using ColorInd         = CQChartsUtil::ColorInd;
+  using Reals            = std::vector<double>;
+  using Inds             = std::vector<int>;
+
+  //! typed values of visible column (extracted once and shared by all cells)
+  struct ColumnValues {
+    bool   numeric { false }; //!< is numeric
+    double min     { 0.0 };   //!< min value
+    double max     { 1.0 };   //!< max value
+    Reals  values;            //!< value per row (unique id if not numeric, NaN if invalid)
+  };
 
  public:
   CQChartsSummaryPlot(View *view, const ModelP &model);
@@ -209,6 +223,31 @@ class CQChartsSummaryPlot : public CQChartsPlot,
 
   //---
 
+  //! get/set number of cell points above which points are drawn as binned density
+  int lodPoints() const { return lodPoints_; }
+  void setLodPoints(int n);
+
+  //! get/set number of bins (in each direction) for binned density
+  int lodBins() const { return lodBins_; }
+  void setLodBins(int n);
+
+  //---
+
+  //! get shared column values for visible column
+  const ColumnValues &columnValues(int ic) const;
+
+  //! get number of rows in shared column values
+  int numValueRows() const { return numValueRows_; }
+
+  //! get number of groups and rows for group
+  int numGroups() const { return int(groupRows_.size()); }
+  const Inds &groupRows(int ig) const { return groupRows_[size_t(ig)]; }
+
+  //! get group for row (-1 if no group)
+  int rowGroup(int r) const { return (! rowGroups_.empty() ? rowGroups_[size_t(r)] : -1); }
+
+  //---
+
   Column getNamedColumn(const QString &name) const override;
   void setNamedColumn(const QString &name, const Column &c) override;
 
@@ -293,6 +332,9 @@ class CQChartsSummaryPlot : public CQChartsPlot,
  protected:
   void updateVisibleColumns();
 
+  void initColumnValues();
+  void resetColumnValues();
+
   void notifyCollapse() override;
 
   CQChartsPlotCustomControls *createCustomControls() override;
@@ -328,6 +370,19 @@ class CQChartsSummaryPlot : public CQChartsPlot,
   bool bestFit_ { false };
   bool density_ { false };
 
+  int lodPoints_ { 10000 }; //!< number of points above which points are binned
+  int lodBins_   { 64 };    //!< number of bins for binned points
+
+  // shared column data
+  using ColumnValuesArray = std::vector<ColumnValues>;
+  using GroupRows         = std::vector<Inds>;
+
+  bool              columnValuesValid_ { false }; //!< is column values cache valid
+  ColumnValuesArray columnValues_;                //!< cached values per visible column
+  int               numValueRows_      { 0 };     //!< number of value rows
+  GroupRows         groupRows_;                   //!< rows per group
+  Inds              rowGroups_;                   //!< group per row
+
   Length symbolSize_ { Length::plot(0.03) }; //!< scatter symbol size
 
   CQChartsPlotObj* menuObj_ { nullptr }; //!< menu plot object
@@ -364,8 +419,12 @@ class CQChartsSummaryCellObj : public CQChartsPlotObj {
 
   void calcPenBrush(PenBrush &penBrush, bool updateState) const override;
 
+  //! calc cached cell data from plot shared column values (thread safe)
+  void initData();
+
  private:
   void drawScatter     (PaintDevice *device) const;
+  void drawBinnedPoints(PaintDevice *device) const;
   void drawBestFit     (PaintDevice *device) const;
   void drawCorrelation (PaintDevice *device) const;
   void drawBoxPlot     (PaintDevice *device) const;
@@ -373,32 +432,28 @@ class CQChartsSummaryCellObj : public CQChartsPlotObj {
   void drawDensity     (PaintDevice *device) const;
   void drawPie         (PaintDevice *device) const;
 
-  void initGroupedValues();
+  Polygon calcPoints(int ig=-1) const;
 
  private:
-  using Values = std::vector<QVariant>;
-  using Reals  = std::vector<double>;
-
-  struct IndData {
-    Values  xvals;
-    Values  yvals;
-    Reals   x;
-    Reals   y;
-    Polygon poly;
-  };
-
-  using GroupIndData = std::map<int, IndData>;
-
-  struct GroupValues {
-    bool         set { false };
-    GroupIndData groupIndData;
+  using Counts = std::vector<int>;
+
+  using GroupCorrelation = std::map<int, double>;
+
+  //! cell data calculated from shared column values
+  struct CellData {
+    int              numPoints   { 0 };     //!< number of valid points
+    double           correlation { 0.0 };   //!< correlation (no group)
+    GroupCorrelation groupCorrelation;      //!< correlation per group
+    bool             binned      { false }; //!< is binned (too many points)
+    int              numBins     { 0 };     //!< number of bins in each direction
+    Counts           bins;                  //!< bin counts
+    int              maxBin      { 0 };     //!< max bin count
   };
 
   const Plot*     plot_ { nullptr }; //!< parent plot
   int             row_  { -1 };      //!< row
   int             col_  { -1 };      //!< column
-  mutable Polygon poly_;
-  GroupValues     groupValues_;
+  CellData        cellData_;         //!< cached cell data
   mutable double  pxmin_ { 0.0 };
   mutable double  pymin_ { 0.0 };
   mutable double  pxmax_ { 1.0 };
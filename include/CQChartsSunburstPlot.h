@@ -84,6 +84,64 @@ class CQChartsSunburstNodeObj : public CQChartsPlotObj {
 
 //---
 
+/*!
+ * \brief Sunburst Plot Level of Detail object
+ * \ingroup Charts
+ *
+ * Single object for the small (below the plot's lod pixel size) nodes and sub-trees
+ * of a hier node. Each is drawn as a filled arc segment (sub-tree to its outer ring).
+ */
+class CQChartsSunburstLodObj : public CQChartsPlotObj {
+  Q_OBJECT
+
+  Q_PROPERTY(int    numNodes READ numNodes)
+  Q_PROPERTY(double size     READ hierSize)
+
+ public:
+  using Plot     = CQChartsSunburstPlot;
+  using Node     = CQChartsSunburstNode;
+  using Nodes    = std::vector<Node *>;
+  using HierNode = CQChartsSunburstHierNode;
+  using Angle    = CQChartsAngle;
+
+ public:
+  CQChartsSunburstLodObj(const Plot *plot, const BBox &rect, HierNode *hier, const Nodes &nodes);
+
+  QString typeName() const override { return "lod"; }
+
+  HierNode *hierNode() const { return hier_; }
+
+  const Nodes &nodes() const { return nodes_; }
+
+  //! number of nodes
+  int numNodes() const;
+
+  double hierSize() const;
+
+  QString calcId() const override;
+
+  QString calcTipId() const override;
+
+  bool inside(const Point &p) const override;
+
+  void getObjSelectIndices(Indices &inds) const override;
+
+  void draw(PaintDevice *device) const override;
+
+ private:
+  QColor nodeColor(Node *node, const ColorInd &colorInd) const;
+
+ private:
+  using Reals = std::vector<double>;
+
+  const Plot* plot_ { nullptr }; //!< parent plot
+  HierNode*   hier_ { nullptr }; //!< parent hier node
+  Nodes       nodes_;            //!< aggregated nodes
+  Reals       radii_;            //!< outer radius of aggregated nodes (sub-tree)
+};
+
+//---
+
 /*!
  * \brief Sunburst Plot Node
  * \ingroup Charts
@@ -110,6 +168,7 @@ class CQChartsSunburstNode {
   using Angle    = CQChartsAngle;
   using Color    = CQChartsColor;
   using ColorInd = CQChartsUtil::ColorInd;
+  using Point    = CQChartsGeom::Point;
 
  public:
   CQChartsSunburstNode(const Plot *plot, HierNode *parent, const QString &name="");
@@ -163,7 +222,8 @@ class CQChartsSunburstNode {
 
   //---
 
-  //bool pointInside(double x, double y);
+  //! is point inside node arc (for radius range)
+  bool pointInside(const Point &p, double r1, double r2) const;
 
   virtual QColor interpColor(const Plot *plot, const Color &c,
                              const ColorInd &colorInd, int n) const;
@@ -315,6 +375,10 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
   Q_PROPERTY(bool          multiRoot   READ isMultiRoot WRITE setMultiRoot  )
   Q_PROPERTY(SortType      sortType    READ sortType    WRITE setSortType   )
 
+  // level of detail
+  Q_PROPERTY(bool   lod     READ isLod   WRITE setLod    )
+  Q_PROPERTY(double lodSize READ lodSize WRITE setLodSize)
+
   // color
   Q_PROPERTY(bool colorById READ isColorById WRITE setColorById)
 
@@ -341,6 +405,8 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
   using HierNode  = CQChartsSunburstHierNode;
   using Node      = CQChartsSunburstNode;
   using NodeObj   = CQChartsSunburstNodeObj;
+  using LodObj    = CQChartsSunburstLodObj;
+  using Nodes     = std::vector<Node *>;
 
   using Angle     = CQChartsAngle;
   using Length    = CQChartsLength;
@@ -386,6 +452,19 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
 
   //---
 
+  //! get/set level of detail (aggregate small nodes)
+  bool isLod() const { return lodData_.enabled; }
+  void setLod(bool b);
+
+  //! get/set level of detail pixel size (nodes with smaller arc length or width are aggregated)
+  double lodSize() const { return lodData_.size; }
+  void setLodSize(double s);
+
+  //! number of nodes aggregated into level of detail objects
+  int numLodNodes() const { return numLodNodes_; }
+
+  //---
+
   const RootNodes &roots() const { return roots_; }
 
   bool isRoot(const HierNode *node) const;
@@ -438,8 +517,17 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
 
   //---
 
+  void updateObjs() override;
+
+  //! update objects for level of detail change only (reuses loaded nodes)
+  void updateLodObjs();
+
+  //---
+
   void postResize() override;
 
+  void applyDataRangeAndDraw() override;
+
   //---
 
   bool hasForeground() const override;
@@ -458,6 +546,7 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
   //---
 
   virtual NodeObj *createNodeObj(const BBox &rect, Node *node) const;
+  virtual LodObj  *createLodObj (const BBox &rect, HierNode *hier, const Nodes &nodes) const;
 
  private:
   void resetRoots();
@@ -502,6 +591,16 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
 
   void addPlotObj(Node *node, PlotObjs &objs, const ColorInd &ir) const;
 
+  void addLodObj(HierNode *hier, const Nodes &nodes, PlotObjs &objs, const ColorInd &ir) const;
+
+  //---
+
+  void initLod() const;
+
+  bool isLodNode(Node *node) const;
+
+  bool isLodUpdate() const;
+
   //---
 
 //void drawNodes(PaintDevice *device, HierNode *hier) const;
@@ -529,6 +628,11 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
   CQChartsPlotCustomControls *createCustomControls() override;
 
  private:
+  struct LodData {
+    bool   enabled { true }; //!< is enabled
+    double size    { 1.0 };  //!< min pixel arc length/width of node object
+  };
+
   double    innerRadius_      { 0.5 };            //!< inner radius
   double    outerRadius_      { 1.0 };            //!< outer radius
   Angle     startAngle_       { -90 };            //!< start angle
@@ -540,6 +644,12 @@ class CQChartsSunburstPlot : public CQChartsHierPlot,
   int       colorId_          { -1 };             //!< current color id
   int       numColorIds_      { 0 };              //!< num used color ids
   bool      colorById_        { true };           //!< color by id
+  LodData   lodData_;                             //!< level of detail config data
+  bool      rootsValid_       { false };          //!< are loaded roots valid for current data
+
+  // level of detail data (set on create objects)
+  mutable double lodScale_    { 0.0 }; //!< pixels per window unit
+  mutable int    numLodNodes_ { 0 };   //!< number of aggregated nodes
 };
 
 //---
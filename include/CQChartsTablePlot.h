@@ -103,6 +103,11 @@ class CQChartsTablePlot : public CQChartsPlot {
   Q_PROPERTY(int    cellMargin  READ cellMargin   WRITE setCellMargin)
   Q_PROPERTY(bool   followView  READ isFollowView WRITE setFollowView)
 
+  // virtualized
+  Q_PROPERTY(bool virtualized   READ isVirtualized WRITE setVirtualized  )
+  Q_PROPERTY(int  virtualMargin READ virtualMargin WRITE setVirtualMargin)
+  Q_PROPERTY(int  widthSamples  READ widthSamples  WRITE setWidthSamples )
+
   Q_ENUMS(Mode)
 
  public:
@@ -290,6 +295,20 @@ class CQChartsTablePlot : public CQChartsPlot {
 
   //---
 
+  //! get/set virtualized (only create row and cell objects for visible rows plus margin)
+  bool isVirtualized() const { return virtualData_.enabled; }
+  void setVirtualized(bool b);
+
+  //! get/set number of rows above and below visible rows to create objects for
+  int virtualMargin() const { return virtualData_.margin; }
+  void setVirtualMargin(int i);
+
+  //! get/set number of sampled rows for virtualized column widths
+  int widthSamples() const { return virtualData_.samples; }
+  void setWidthSamples(int i);
+
+  //---
+
   void addProperties() override;
 
   Range calcRange() const override;
@@ -360,6 +379,13 @@ class CQChartsTablePlot : public CQChartsPlot {
 
   void createTableObjData() const;
 
+  void calcVirtualRows(int margin, int &row1, int &row2) const;
+
+  bool isDirectRowVisit() const;
+
+  void recycleObjs();
+  bool recycleObjData();
+
   std::vector<Mode> modes() const { return
     {{ Mode::NORMAL, Mode::RANDOM, Mode::SORTED, Mode::PAGED, Mode::ROWS }};
   }
@@ -447,6 +473,20 @@ class CQChartsTablePlot : public CQChartsPlot {
     Font  font;             //!< header font
   };
 
+  //! virtualized data
+  struct VirtualData {
+    using SelectedRows  = std::set<int>;
+    using SelectedCells = std::set<QModelIndex>;
+
+    bool          enabled { false }; //!< is enabled
+    int           margin  { 32 };    //!< rows above and below visible rows
+    int           samples { 1000 };  //!< number of rows sampled for column widths
+    int           row1    { -1 };    //!< first row with objects
+    int           row2    { -1 };    //!< last row with objects
+    SelectedRows  selectedRows;      //!< selected rows (kept when objects recycled)
+    SelectedCells selectedCells;     //!< selected cells (kept when objects recycled)
+  };
+
   //! fit data
   struct FitData {
     bool fitHorizontal { true };
@@ -471,6 +511,7 @@ class CQChartsTablePlot : public CQChartsPlot {
   bool            rowColumn_    { false };        //!< draw row numbers column
   HeaderData      headerData_;                    //!< header data
   FitData         fitData_;                       //!< fit data
+  VirtualData     virtualData_;                   //!< virtualized data
   Font            headerFont_;                    //!< header font
   Color           gridColor_;                     //!< grid line color
   Color           cellColor_;                     //!< cell bg color
@@ -543,6 +584,11 @@ class CQChartsTableRowObj : public CQChartsPlotObj {
  public:
   CQChartsTableRowObj(const Plot *plot, const Plot::RowObjData &rowObjData);
 
+  const Plot::RowObjData &rowObjData() const { return rowObjData_; }
+
+  //! reuse object for new row data (virtualized scroll)
+  void setRowObjData(const Plot::RowObjData &rowObjData, bool visible, bool selected);
+
   QString typeName() const override { return "row"; }
 
   QString calcId() const override;
@@ -575,6 +621,11 @@ class CQChartsTableCellObj : public CQChartsPlotObj {
  public:
   CQChartsTableCellObj(const Plot *plot, const Plot::CellObjData &cellObjData);
 
+  const Plot::CellObjData &cellObjData() const { return cellObjData_; }
+
+  //! reuse object for new cell data (virtualized scroll)
+  void setCellObjData(const Plot::CellObjData &cellObjData, bool visible, bool selected);
+
   QString typeName() const override { return "cell"; }
 
   QString calcId() const override;
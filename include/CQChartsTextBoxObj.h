@@ -92,7 +92,7 @@ class CQChartsTextBoxObj : public CQChartsBoxObj,
  protected:
   void init();
 
-  void textDataInvalidate(bool) override {
+  void textDataInvalidate(bool, const char *) override {
     textBoxObjInvalidate();
   }
 
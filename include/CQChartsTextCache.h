@@ -0,0 +1,163 @@
+#ifndef CQChartsTextCache_H
+#define CQChartsTextCache_H
+
+#include <CQChartsGeom.h>
+#include <QFont>
+#include <QStringList>
+#include <QHash>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+
+class QFontMetricsF;
+
+#define CQChartsTextCacheInst CQChartsTextCache::instance()
+
+/*!
+ * \brief Cache of text measurements (font metrics, string widths, wrapped lines, html sizes)
+ * \ingroup Charts
+ *
+ * Measurements are keyed by font and string (and layout options for wrapped and html
+ * text) so labels redrawn on pan/zoom are not re-measured.
+ *
+ * The cache is shared by all threads and kept across draws. Fonts are looked up by
+ * QFont hash/compare (no font key string) behind a read mostly (shared) lock and each
+ * font's values are a separate shard with its own read mostly lock, so parallel draws
+ * only take exclusive locks to add new values. Text is measured outside the locks.
+ *
+ * Hit/miss counts and the time spent measuring are recorded so the time saved by
+ * cache hits can be estimated (hits * average miss time).
+ */
+class CQChartsTextCache {
+ public:
+  using Size = CQChartsGeom::Size;
+  using BBox = CQChartsGeom::BBox;
+
+  //! font metrics
+  struct FontData {
+    double height  { 0.0 };
+    double ascent  { 0.0 };
+    double descent { 0.0 };
+  };
+
+  //! cache statistics (times in ms)
+  struct Stats {
+    long   hits      { 0 };   //!< number of cache hits
+    long   misses    { 0 };   //!< number of cache misses
+    double missTime  { 0.0 }; //!< time spent measuring on misses
+    double savedTime { 0.0 }; //!< estimated time saved by hits
+    int    numFonts  { 0 };   //!< number of cached fonts
+    long   numValues { 0 };   //!< number of cached values
+
+    double hitRate() const {
+      return (hits + misses > 0 ? double(hits)/double(hits + misses) : 0.0);
+    }
+  };
+
+  struct FontCache;
+
+  using FontCacheP = std::shared_ptr<FontCache>;
+
+ public:
+  static CQChartsTextCache *instance();
+
+ ~CQChartsTextCache();
+
+  //! get/set enabled
+  bool isEnabled() const { return enabled_; }
+  void setEnabled(bool b);
+
+  //! get/set max cached values per font (font values cleared when exceeded)
+  int maxValues() const { return maxValues_; }
+  void setMaxValues(int n) { maxValues_ = n; }
+
+  //! get/set max cached fonts (all fonts cleared when exceeded)
+  int maxFonts() const { return maxFonts_; }
+  void setMaxFonts(int n) { maxFonts_ = n; }
+
+  //---
+
+  //! get font cache (shared so it remains valid if cache is cleared)
+  FontCacheP fontCache(const QFont &font);
+
+  //! get font metrics
+  static const FontData &fontData(const FontCacheP &fontCache);
+
+  //! get width of single line text
+  double textWidth(const FontCacheP &fontCache, const QString &text);
+
+  //! get size of html text
+  Size htmlTextSize(const QString &text, const QFont &font, int margin);
+
+  //! split text into lines which fit in (pixel) rect
+  QStringList formatStringInRect(const QString &text, const QFont &font, const BBox &rect,
+                                 const QString &seps);
+
+  //---
+
+  Stats stats() const;
+
+  void resetStats();
+
+  void clear();
+
+ private:
+  CQChartsTextCache();
+
+  enum class StatType {
+    FONT,
+    WIDTH,
+    HTML,
+    FORMAT,
+    NUM_TYPES
+  };
+
+  //! add stats of font cache (being removed) to removed stats
+  void addRemovedStats(const FontCache &fontCache);
+
+ private:
+  using FontCaches = QHash<QFont, FontCacheP>;
+
+  struct StatData {
+    long   hits     { 0 };
+    long   misses   { 0 };
+    double missTime { 0.0 };
+  };
+
+  using Mutex = std::shared_timed_mutex;
+
+  std::atomic<bool> enabled_   { true };   //!< is enabled
+  int               maxValues_ { 100000 }; //!< max cached values per font
+  int               maxFonts_  { 256 };    //!< max cached fonts
+  FontCaches        fontCaches_;           //!< per font caches (shards)
+  StatData          removedStats_[int(StatType::NUM_TYPES)]; //!< stats of removed fonts
+  mutable Mutex     mutex_;                //!< font caches lock
+};
+
+//---
+
+/*!
+ * \brief Font metrics using text cache (drop in replacement for QFontMetricsF)
+ * \ingroup Charts
+ */
+class CQChartsFontMetrics {
+ public:
+  explicit CQChartsFontMetrics(const QFont &font);
+ ~CQChartsFontMetrics();
+
+  double height () const { return fontData_.height ; }
+  double ascent () const { return fontData_.ascent ; }
+  double descent() const { return fontData_.descent; }
+
+  double horizontalAdvance(const QString &text) const;
+
+ private:
+  using TextCache = CQChartsTextCache;
+
+  QFont                                  font_;      //!< font
+  TextCache::FontCacheP                  fontCache_; //!< font cache (null if disabled)
+  TextCache::FontData                    fontData_;  //!< font metrics
+  std::shared_ptr<QFontMetricsF>         fm_;        //!< uncached font metrics (if disabled)
+};
+
+#endif
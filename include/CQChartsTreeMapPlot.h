@@ -84,7 +84,7 @@ class CQChartsTreeMapNode {
   virtual const QString &name() const { return name_; }
 
   virtual double size() const { return size_; }
-  virtual void setSize(double s) { size_ = s; }
+  virtual void setSize(double s);
 
   virtual double x() const { return x_; }
   virtual void setX(double x) { x_ = x; }
@@ -184,6 +184,7 @@ class CQChartsTreeMapHierNode : public CQChartsTreeMapNode {
   using Nodes    = std::vector<Node*>;
   using HierNode = CQChartsTreeMapHierNode;
   using Children = std::vector<HierNode*>;
+  using BBox     = CQChartsGeom::BBox;
 
  public:
   CQChartsTreeMapHierNode(const Plot *plot, HierNode *parent=nullptr, const QString &name="",
@@ -214,8 +215,16 @@ class CQChartsTreeMapHierNode : public CQChartsTreeMapNode {
 
   //---
 
+  void setSize(double s) override;
+
   double hierSize() const override;
 
+  //! number of leaf nodes in hierarchy
+  int numLeaves() const;
+
+  //! invalidate cached size, sort and layout of this node and its parents
+  void invalidateLayout();
+
   //---
 
   bool hasNodes() const { return ! nodes_.empty(); }
@@ -240,8 +249,6 @@ class CQChartsTreeMapHierNode : public CQChartsTreeMapNode {
 
   void packNodes(double x, double y, double w, double h);
 
-  void packSubNodes(double x, double y, double w, double h, const Nodes &nodes);
-
   void setPosition(double x, double y, double w, double h) override;
 
   void addNode(Node *node);
@@ -252,11 +259,34 @@ class CQChartsTreeMapHierNode : public CQChartsTreeMapNode {
                      const ColorInd &colorInd, int n) const override;
 
  private:
-  Nodes    nodes_;               //!< child nodes
-  Children children_;            //!< child hier nodes
-  int      hierInd_   { -1 };    //!< hier index
-  bool     showTitle_ { false }; //!< show title
-  bool     expanded_  { true };  //!< is expanded
+  using Reals  = std::vector<double>;
+  using BBoxes = std::vector<BBox>;
+
+  void initSortedNodes() const;
+
+  void packSubNodes(double x, double y, double w, double h, int i1, int i2,
+                    BBoxes &rects) const;
+
+ private:
+  //! cached layout data (normalized child rects are reused while content aspect is unchanged)
+  struct LayoutData {
+    bool   sizeValid  { false }; //!< is cached hier size valid
+    double hierSize   { 0.0 };   //!< cached hier size
+    int    numLeaves  { 0 };     //!< cached number of leaves
+    bool   sortValid  { false }; //!< are sorted nodes valid
+    Nodes  nodes;                //!< child and hier nodes sorted by size (largest first)
+    Reals  sums;                 //!< prefix sums of sorted node sizes
+    bool   placeValid { false }; //!< are normalized rects valid
+    double aspect     { 1.0 };   //!< content aspect of normalized rects
+    BBoxes rects;                //!< normalized (0-1) rects of sorted nodes
+  };
+
+  Nodes              nodes_;               //!< child nodes
+  Children           children_;            //!< child hier nodes
+  int                hierInd_   { -1 };    //!< hier index
+  bool               showTitle_ { false }; //!< show title
+  bool               expanded_  { true };  //!< is expanded
+  mutable LayoutData layoutData_;          //!< cached layout data
 };
 
 //---
@@ -395,6 +425,71 @@ class CQChartsTreeMapHierObj : public CQChartsTreeMapNodeObj {
 
 //---
 
+/*!
+ * \brief Tree Map Level of Detail Object
+ * \ingroup Charts
+ *
+ * Single object for the small (below the plot's lod pixel size) or out of view
+ * nodes and sub-trees of a hier node. Each is drawn as a filled box (or point).
+ */
+class CQChartsTreeMapLodObj : public CQChartsPlotObj {
+  Q_OBJECT
+
+  Q_PROPERTY(int    numNodes READ numNodes)
+  Q_PROPERTY(double size     READ hierSize)
+
+ public:
+  using Plot     = CQChartsTreeMapPlot;
+  using Node     = CQChartsTreeMapNode;
+  using Nodes    = std::vector<Node*>;
+  using HierNode = CQChartsTreeMapHierNode;
+  using HierObj  = CQChartsTreeMapHierObj;
+
+ public:
+  CQChartsTreeMapLodObj(const Plot *plot, HierNode *hier, HierObj *hierObj,
+                        const Nodes &nodes, const BBox &rect, const ColorInd &is);
+
+  HierNode *hierNode() const { return hier_; }
+
+  HierObj *parent() const { return hierObj_; }
+
+  const Nodes &nodes() const { return nodes_; }
+
+  //! number of leaf nodes
+  int numNodes() const;
+
+  double hierSize() const;
+
+  //---
+
+  QString typeName() const override { return "lod"; }
+
+  QString calcId() const override;
+
+  QString calcTipId() const override;
+
+  //---
+
+  bool inside(const Point &p) const override;
+
+  void getObjSelectIndices(Indices &inds) const override;
+
+  //---
+
+  void draw(PaintDevice *device) const override;
+
+ private:
+  QColor nodeColor(Node *node, const ColorInd &colorInd) const;
+
+ private:
+  const Plot* plot_    { nullptr }; //!< parent plot
+  HierNode*   hier_    { nullptr }; //!< parent hier node
+  HierObj*    hierObj_ { nullptr }; //!< parent hier object
+  Nodes       nodes_;               //!< aggregated nodes
+};
+
+//---
+
 CQCHARTS_NAMED_SHAPE_DATA(Header, header)
 
 /*!
@@ -445,12 +540,17 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
   Q_PROPERTY(bool         textClipped READ isTextClipped WRITE setTextClipped)
   Q_PROPERTY(CQChartsArea minArea     READ minArea       WRITE setMinArea    )
 
+  // level of detail
+  Q_PROPERTY(bool   lod     READ isLod   WRITE setLod    )
+  Q_PROPERTY(double lodSize READ lodSize WRITE setLodSize)
+
  public:
   using Node     = CQChartsTreeMapNode;
   using Nodes    = std::vector<Node*>;
   using HierNode = CQChartsTreeMapHierNode;
   using HierObj  = CQChartsTreeMapHierObj;
   using NodeObj  = CQChartsTreeMapNodeObj;
+  using LodObj   = CQChartsTreeMapLodObj;
 
   using OptLength = CQChartsOptLength;
   using OptReal   = CQChartsOptReal;
@@ -532,6 +632,19 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
 
   //---
 
+  //! get/set level of detail (aggregate small and out of view nodes)
+  bool isLod() const { return lodData_.enabled; }
+  void setLod(bool b);
+
+  //! get/set level of detail pixel size (nodes smaller than this are aggregated)
+  double lodSize() const { return lodData_.size; }
+  void setLodSize(double s);
+
+  //! number of nodes aggregated into level of detail objects
+  int numLodNodes() const { return numLodNodes_; }
+
+  //---
+
   void setHeaderTextFontSize(double s);
 
   void setTextFontSize(double s);
@@ -593,8 +706,17 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
 
   //---
 
+  void updateObjs() override;
+
+  //! update objects for layout change only (reuses loaded nodes and cached layouts)
+  void updateLayout();
+
+  //---
+
   void postResize() override;
 
+  void applyDataRangeAndDraw() override;
+
   //---
 
   bool hasForeground() const override;
@@ -615,6 +737,12 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
  protected:
   void initNodeObjs(HierNode *hier, HierObj *parentObj, int depth, PlotObjs &objs) const;
 
+  void initLod() const;
+
+  bool isLodNode(Node *node) const;
+
+  bool isLodUpdate() const;
+
   void resetNodes();
 
   void initNodes() const;
@@ -680,6 +808,8 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
                                  const BBox &rect, const ColorInd &is) const;
   virtual NodeObj *createNodeObj(Node *node, HierObj *hierObj,
                                  const BBox &rect, const ColorInd &is) const;
+  virtual LodObj  *createLodObj (HierNode *hier, HierObj *hierObj, const Nodes &nodes,
+                                 const BBox &rect, const ColorInd &is) const;
 
  public slots:
   void pushSlot();
@@ -713,6 +843,11 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
     Area minArea; //!< min area
   };
 
+  struct LodData {
+    bool   enabled { true }; //!< is enabled
+    double size    { 1.0 };  //!< min pixel width/height of node object
+  };
+
   struct NodeData {
     bool   hierName    { false };            //!< show hierarchical name
     bool   textClipped { true };             //!< is text clipped
@@ -728,6 +863,7 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
 
   TitleData titleData_;          //!< title config data
   TreeData  treeData_;           //!< tree config data
+  LodData   lodData_;            //!< level of detail config data
   NodeData  nodeData_;           //!< node config data
   bool      colorById_ { true }; //!< color by id
 
@@ -735,6 +871,7 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
   HierNode* root_             { nullptr }; //!< root node
   HierNode* firstHier_        { nullptr }; //!< first hier node
   QString   currentRootName_;              //!< current root name (push in)
+  bool      nodesValid_       { false };   //!< are loaded nodes valid for current data
 
   // work data
   ColorData   colorData_;      //!< color index data
@@ -743,6 +880,11 @@ class CQChartsTreeMapPlot : public CQChartsHierPlot,
   mutable int ig_       { 0 }; //!< current group index
   mutable int in_       { 0 }; //!< current node index
 
+  // level of detail data (set on create objects)
+  mutable double lodScale_    { 0.0 }; //!< pixels per window unit
+  mutable BBox   lodViewRect_;         //!< window rect of non aggregated sub-trees
+  mutable int    numLodNodes_ { 0 };   //!< number of aggregated nodes
+
   double windowHeaderHeight_ { 0.01 }; //!< calculated window pixel header height
   double windowMarginWidth_  { 0.01 }; //!< calculated window pixel margin width
 
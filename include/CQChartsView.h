@@ -32,6 +32,7 @@ class CQChartsViewFloatTip;
 
 class CQChartsAnnotation;
 class CQChartsAnnotationGroup;
+class CQChartsAnnotationTree;
 class CQChartsArcAnnotation;
 class CQChartsArrowAnnotation;
 class CQChartsButtonAnnotation;
@@ -680,6 +681,9 @@ class CQChartsView : public QFrame,
   // get annotations
   const Annotations &annotations() const { return annotations_; }
 
+  // get annotation bbox tree
+  CQChartsAnnotationTree *annotationTree() const { return annotationTree_.get(); }
+
   // --- add annotation ---
 
   Annotation *addAnnotation(CQChartsAnnotationType type);
@@ -778,6 +782,10 @@ class CQChartsView : public QFrame,
 
   QColor interpColor(const Color &c, const ColorInd &ind) const;
 
+  // interp palette color for normalized values (false if not interpolated palette)
+  bool interpColorValues(const Color &c, const std::vector<double> &values,
+                         std::vector<QRgb> &rgbs) const;
+
   //---
 
  public:
@@ -811,11 +819,11 @@ class CQChartsView : public QFrame,
   // handle paint
   void paintEvent(QPaintEvent *) override;
 
-  void paint(QPainter *painter, Plot *plot=nullptr);
+  void paint(QPainter *painter, Plot *plot=nullptr, const QRegion &region=QRegion());
 
   void drawBackground(PaintDevice *device) const;
 
-  void drawPlots(QPainter *painter);
+  void drawPlots(QPainter *painter, const QRegion &region=QRegion());
 
   void drawOverlay(QPainter *painter);
 
@@ -844,12 +852,15 @@ class CQChartsView : public QFrame,
 
   Buffer *overlayBuffer() const { return overlayBuffer_.get(); }
 
-  // get/set draw layer type
-  const Layer::Type &drawLayerType() const { return drawLayerType_; }
-  void setDrawLayerType(const Layer::Type &t) { drawLayerType_ = t; }
+  // get/set draw layer type (per thread as plots draw layers on separate threads)
+  const Layer::Type &drawLayerType() const;
+  void setDrawLayerType(const Layer::Type &t);
 
   //---
 
+  //! render view (or plot area of view) at size to image
+  QImage renderImage(const QSize &size, Plot *plot=nullptr);
+
   // print to PNG/SVG
   bool printPNG(const QString &filename, Plot *plot=nullptr);
   bool printSVG(const QString &filename, Plot *plot=nullptr);
@@ -1085,6 +1096,9 @@ class CQChartsView : public QFrame,
 
   void doUpdate();
 
+  //! update (recomposite) only the pixel area of the plot
+  void doUpdatePlot(Plot *plot);
+
   //---
 
   // write all details to output (model, view, plots and annotations)
@@ -1455,6 +1469,8 @@ class CQChartsView : public QFrame,
 
   void annotationsAtPoint(const Point &w, Annotations &annotations) const;
 
+  void checkAnnotationTree() const;
+
   void windowToPixelI(double wx, double wy, double &px, double &py) const;
   void pixelToWindowI(double px, double py, double &wx, double &wy) const;
 
@@ -1617,6 +1633,8 @@ class CQChartsView : public QFrame,
   using ViewKey        = CQChartsViewKey;
   using ViewKeyP       = std::unique_ptr<ViewKey>;
   using RegionMgrP     = std::unique_ptr<RegionMgr>;
+  using AnnotationTree  = CQChartsAnnotationTree;
+  using AnnotationTreeP = std::unique_ptr<AnnotationTree>;
 
   using EditAnnotationDlg = CQChartsEditAnnotationDlg;
   using EditAxisDlg       = CQChartsEditAxisDlg;
@@ -1656,6 +1674,9 @@ class CQChartsView : public QFrame,
   int         currentPlotInd_ { -1 }; //!< current plot index
   Annotations annotations_;           //!< annotations
 
+  AnnotationTreeP annotationTree_;    //!< annotation bbox tree
+  Annotations     insideAnnotations_; //!< annotations under mouse
+
   Mode        mode_        { Mode::SELECT };            //!< mouse mode
   KeyBehavior keyBehavior_ { KeyBehavior::Type::SHOW }; //!< default key press behavior
 
@@ -1747,7 +1768,6 @@ class CQChartsView : public QFrame,
   BufferP   bgBuffer_;                          //!< buffer for view bg
   BufferP   fgBuffer_;                          //!< buffer for view fg
   BufferP   overlayBuffer_ ;                    //!< buffer for view overlays
-  LayerType drawLayerType_ { LayerType::NONE }; //!< current draw layer type
 
   mutable std::atomic<bool> painterLocked_ { false}; //!< is painter locked
   mutable std::mutex        painterMutex_;           //!< painter mutex
@@ -960,6 +960,9 @@ class CQChartsXYPlot : public CQChartsPointPlot,
 
   void postCalcRange() override;
 
+  // cumulative values need all rows
+  bool canProgressiveSample() const override { return ! isCumulative(); }
+
   bool createObjs(PlotObjs &objs) const override;
 
   //---
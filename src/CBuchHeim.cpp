@@ -715,4 +715,487 @@ commonParent(DrawTree *tree1, DrawTree *tree2) const
   return commonParent;
 }
 
+//------
+
+void
+FlatTree::
+clear()
+{
+  parent_     .clear();
+  firstChild_ .clear();
+  lastChild_  .clear();
+  prevSibling_.clear();
+  nextSibling_.clear();
+  numChildren_.clear();
+  number_     .clear();
+  open_       .clear();
+
+  prelim_  .clear();
+  mod_     .clear();
+  shift_   .clear();
+  change_  .clear();
+  midpoint_.clear();
+  thread_  .clear();
+  ancestor_.clear();
+  x_       .clear();
+  depth_   .clear();
+
+  undos_   .clear();
+  logStart_.clear();
+  logEnd_  .clear();
+
+  x1_.clear(); y1_.clear(); x2_.clear(); y2_.clear();
+
+  visible_.clear();
+
+  root_   = -1;
+  placed_ = false;
+}
+
+int
+FlatTree::
+addNode(int parent)
+{
+  int i = numNodes();
+
+  parent_     .push_back(parent);
+  firstChild_ .push_back(-1);
+  lastChild_  .push_back(-1);
+  prevSibling_.push_back(-1);
+  nextSibling_.push_back(-1);
+  numChildren_.push_back(0);
+  number_     .push_back(1);
+  open_       .push_back(true);
+
+  prelim_  .push_back(0.0);
+  mod_     .push_back(0.0);
+  shift_   .push_back(0.0);
+  change_  .push_back(0.0);
+  midpoint_.push_back(0.0);
+  thread_  .push_back(-1);
+  ancestor_.push_back(i);
+  x_       .push_back(0.0);
+  depth_   .push_back(0);
+
+  logStart_.push_back(0);
+  logEnd_  .push_back(0);
+
+  x1_.push_back(0.0); y1_.push_back(0.0); x2_.push_back(0.0); y2_.push_back(0.0);
+
+  if (parent >= 0) {
+    auto pi = size_t(parent);
+    auto ii = size_t(i);
+
+    int last = lastChild_[pi];
+
+    if (last >= 0) {
+      nextSibling_[size_t(last)] = i;
+      prevSibling_[ii]           = last;
+    }
+    else
+      firstChild_[pi] = i;
+
+    lastChild_[pi] = i;
+
+    ++numChildren_[pi];
+
+    number_[ii] = numChildren_[pi];
+    depth_ [ii] = depth_[pi] + 1;
+  }
+  else {
+    if (root_ < 0)
+      root_ = i;
+  }
+
+  placed_ = false;
+
+  return i;
+}
+
+void
+FlatTree::
+place()
+{
+  undos_.clear();
+
+  visible_.clear();
+
+  if (root_ < 0) return;
+
+  preOrder(root_, visible_);
+
+  for (auto i : visible_)
+    resetNode(i);
+
+  // layout children of each node (children before parents)
+  for (auto p = visible_.rbegin(); p != visible_.rend(); ++p) {
+    if (hasChildren(*p))
+      layoutLevel(*p);
+  }
+
+  placeRoot();
+
+  secondWalk();
+
+  placed_ = true;
+}
+
+void
+FlatTree::
+replace(int c)
+{
+  if (! placed_ || c == root_ || undos_.size() > size_t(4*numNodes() + 1024))
+    return place();
+
+  // path from parent to root (skip if not visible)
+  Inds path;
+
+  for (int p = parent(c); p >= 0; p = parent(p)) {
+    if (! isOpen(p))
+      return;
+
+    path.push_back(p);
+  }
+
+  // undo changes made by path levels (top down)
+  for (auto p = path.rbegin(); p != path.rend(); ++p)
+    undoLevel(*p);
+
+  // re-layout changed subtree
+  work_.clear();
+
+  preOrder(c, work_);
+
+  for (auto i : work_)
+    resetNode(i);
+
+  for (auto p = work_.rbegin(); p != work_.rend(); ++p) {
+    if (hasChildren(*p))
+      layoutLevel(*p);
+  }
+
+  // redo path levels (bottom up)
+  for (auto p : path)
+    layoutLevel(p);
+
+  placeRoot();
+
+  visible_.clear();
+
+  preOrder(root_, visible_);
+
+  secondWalk();
+}
+
+void
+FlatTree::
+preOrder(int root, Inds &inds) const
+{
+  Inds stack;
+
+  stack.push_back(root);
+
+  while (! stack.empty()) {
+    int i = stack.back(); stack.pop_back();
+
+    inds.push_back(i);
+
+    // push children in reverse so first child is processed first
+    for (int c = lastChild(i); c >= 0; c = prevSibling_[size_t(c)])
+      stack.push_back(c);
+  }
+}
+
+void
+FlatTree::
+resetNode(int i)
+{
+  auto ii = size_t(i);
+
+  prelim_  [ii] = 0.0;
+  mod_     [ii] = 0.0;
+  shift_   [ii] = 0.0;
+  change_  [ii] = 0.0;
+  midpoint_[ii] = 0.0;
+  thread_  [ii] = -1;
+  ancestor_[ii] = i;
+  logStart_[ii] = 0;
+  logEnd_  [ii] = 0;
+}
+
+void
+FlatTree::
+layoutLevel(int v)
+{
+  auto vi = size_t(v);
+
+  logStart_[vi] = int(undos_.size());
+
+  int defaultAncestor = firstChild(v);
+
+  for (int w = firstChild(v); w >= 0; w = nextSibling_[size_t(w)]) {
+    auto wi = size_t(w);
+
+    shift_   [wi] = 0.0;
+    change_  [wi] = 0.0;
+    ancestor_[wi] = w;
+
+    int lb = leftBrother(w);
+
+    if (lb >= 0) {
+      prelim_[wi] = prelim_[size_t(lb)] + distance_;
+      mod_   [wi] = (hasChildren(w) ? prelim_[wi] - midpoint_[wi] : 0.0);
+    }
+    else {
+      prelim_[wi] = (hasChildren(w) ? midpoint_[wi] : 0.0);
+      mod_   [wi] = 0.0;
+    }
+
+    defaultAncestor = apportion(w, defaultAncestor, v);
+  }
+
+  executeShifts(v);
+
+  midpoint_[vi] = (prelim_[size_t(firstChild(v))] + prelim_[size_t(lastChild(v))])/2.0;
+
+  logEnd_[vi] = int(undos_.size());
+}
+
+int
+FlatTree::
+apportion(int v, int defaultAncestor, int parent)
+{
+  int w = leftBrother(v);
+  if (w < 0) return defaultAncestor;
+
+  // in buchheim notation:
+  //   i == inner; o == outer; r == right; l == left
+  int vir = v;
+  int vor = v;
+  int vil = w;
+  int vol = firstChild(parent);
+
+  double sir = mod_[size_t(vir)];
+  double sor = mod_[size_t(vor)];
+  double sil = mod_[size_t(vil)];
+  double sol = mod_[size_t(vol)];
+
+  while (right(vil) >= 0 && left(vir) >= 0) {
+    vil = right(vil);
+    vir = left (vir);
+    vol = left (vol);
+    vor = right(vor);
+
+    setAncestor(vor, v);
+
+    double shift = (prelim_[size_t(vil)] + sil) - (prelim_[size_t(vir)] + sir) + distance_;
+
+    if (shift > 0) {
+      int a = ancestor_[size_t(vil)];
+
+      if (parent_[size_t(a)] != parent)
+        a = defaultAncestor;
+
+      moveSubtree(a, v, shift);
+
+      sir += shift;
+      sor += shift;
+    }
+
+    sil += mod_[size_t(vil)];
+    sir += mod_[size_t(vir)];
+    sol += mod_[size_t(vol)];
+    sor += mod_[size_t(vor)];
+  }
+
+  if (right(vil) >= 0 && right(vor) < 0) {
+    setThread(vor, right(vil));
+    setMod   (vor, mod_[size_t(vor)] + sil - sor);
+  }
+  else {
+    if (left(vir) >= 0 && left(vol) < 0) {
+      setThread(vol, left(vir));
+      setMod   (vol, mod_[size_t(vol)] + sir - sol);
+    }
+
+    defaultAncestor = v;
+  }
+
+  return defaultAncestor;
+}
+
+void
+FlatTree::
+moveSubtree(int wl, int wr, double shift)
+{
+  auto li = size_t(wl);
+  auto ri = size_t(wr);
+
+  double subtrees = number_[ri] - number_[li];
+
+  change_[ri] -= shift/subtrees;
+  shift_ [ri] += shift;
+  change_[li] += shift/subtrees;
+  prelim_[ri] += shift;
+  mod_   [ri] += shift;
+}
+
+void
+FlatTree::
+executeShifts(int v)
+{
+  double shift  = 0.0;
+  double change = 0.0;
+
+  for (int w = lastChild(v); w >= 0; w = prevSibling_[size_t(w)]) {
+    auto wi = size_t(w);
+
+    prelim_[wi] += shift;
+    mod_   [wi] += shift;
+
+    change += change_[wi];
+    shift  += shift_[wi] + change;
+  }
+}
+
+void
+FlatTree::
+placeRoot()
+{
+  auto ri = size_t(root_);
+
+  prelim_[ri] = (hasChildren(root_) ? midpoint_[ri] : 0.0);
+  mod_   [ri] = 0.0;
+}
+
+void
+FlatTree::
+secondWalk()
+{
+  // x = prelim + sum of ancestor mods (visible nodes are in pre-order so parents
+  // are always processed before their children)
+  Reals modSum(parent_.size(), 0.0);
+
+  for (auto i : visible_) {
+    auto ii = size_t(i);
+
+    double m = (i != root_ ? modSum[size_t(parent_[ii])] : 0.0);
+
+    x_[ii] = prelim_[ii] + m;
+
+    modSum[ii] = m + mod_[ii];
+  }
+}
+
+void
+FlatTree::
+setThread(int i, int t)
+{
+  auto ii = size_t(i);
+
+  undos_.emplace_back(i, thread_[ii], mod_[ii], ancestor_[ii]);
+
+  thread_[ii] = t;
+}
+
+void
+FlatTree::
+setMod(int i, double m)
+{
+  auto ii = size_t(i);
+
+  undos_.emplace_back(i, thread_[ii], mod_[ii], ancestor_[ii]);
+
+  mod_[ii] = m;
+}
+
+void
+FlatTree::
+setAncestor(int i, int a)
+{
+  auto ii = size_t(i);
+
+  undos_.emplace_back(i, thread_[ii], mod_[ii], ancestor_[ii]);
+
+  ancestor_[ii] = a;
+}
+
+void
+FlatTree::
+undoLevel(int v)
+{
+  auto vi = size_t(v);
+
+  for (int k = logEnd_[vi] - 1; k >= logStart_[vi]; --k) {
+    const auto &undo = undos_[size_t(k)];
+
+    auto ii = size_t(undo.node);
+
+    thread_  [ii] = undo.thread;
+    mod_     [ii] = undo.mod;
+    ancestor_[ii] = undo.ancestor;
+  }
+
+  logStart_[vi] = 0;
+  logEnd_  [vi] = 0;
+}
+
+void
+FlatTree::
+normalize(bool equalScale)
+{
+  // node radius (in layout units)
+  double r = 0.5;
+
+  double xmin = 9999.0, ymin = 9999.0, xmax = -9999.0, ymax = -9999.0;
+
+  for (auto i : visible_) {
+    double x = x_[size_t(i)];
+    double y = depth_[size_t(i)] - depth_[size_t(root_)];
+
+    xmin = std::min(xmin, x - r*1.5);
+    ymin = std::min(ymin, y - r*1.5);
+    xmax = std::max(xmax, x + r*1.5);
+    ymax = std::max(ymax, y + r*1.5);
+  }
+
+  if (equalScale) {
+    auto xmid = (xmin + xmax)/2.0;
+    auto ymid = (ymin + ymax)/2.0;
+
+    auto s = std::max(xmax - xmin, ymax - ymin);
+
+    xmin = xmid - s/2.0;
+    xmax = xmid + s/2.0;
+    ymin = ymid - s/2.0;
+    ymax = ymid + s/2.0;
+  }
+
+  auto map = [](double v, double low, double high) {
+    return (high != low ? (v - low)/(high - low) : low);
+  };
+
+  for (auto i : visible_) {
+    auto ii = size_t(i);
+
+    double x = x_[ii];
+    double y = depth_[ii] - depth_[size_t(root_)];
+
+    double x1 = map(x - r, xmin, xmax);
+    double y1 = map(y - r, ymin, ymax);
+    double x2 = map(x + r, xmin, xmax);
+    double y2 = map(y + r, ymin, ymax);
+
+    double s = std::min(x2 - x1, y2 - y1);
+
+    double xc = (x1 + x2)/2.0;
+    double yc = (y1 + y2)/2.0;
+
+    x1_[ii] = xc - s/2.0;
+    y1_[ii] = yc - s/2.0;
+    x2_[ii] = xc + s/2.0;
+    y2_[ii] = yc + s/2.0;
+  }
+}
+
 }
@@ -156,6 +156,7 @@
 #include <CQChartsPaletteCanvas.h>
 #include <CQChartsPaletteControl.h>
 #include <CQChartsInterfaceControl.h>
+#include <CQChartsPaletteLUT.h>
 #include <CQColorsEditList.h>
 #include <CQColorsEditControl.h>
 #include <CQColorsPalette.h>
@@ -560,6 +561,10 @@ CQCharts()
 
   //---
 
+  paletteLUTMgr_ = std::make_unique<CQChartsPaletteLUTMgr>();
+
+  //---
+
   addProc(ProcType::SVG, "logMessage", "s",
     "document.getElementById(\"log_message\").innerHTML = s;");
 
@@ -1268,7 +1273,7 @@ interpIndPaletteColorValue(int ind, int /*ig*/, int /*ng*/, double r,
   }
 #endif
 
-  return palette->getColor(r, scale, invert);
+  return paletteLUT(palette, scale, invert)->color(r);
 }
 
 QColor
@@ -1279,7 +1284,7 @@ interpNamePaletteColorValue(const QString &name, int /*ig*/, int /*ng*/, double
   auto *palette = CQColorsMgrInst->getNamedPalette(name);
   if (! palette) return QColor(); // assert ?
 
-  return palette->getColor(r, scale, invert);
+  return paletteLUT(palette, scale, invert)->color(r);
 }
 
 QColor
@@ -1312,6 +1317,40 @@ indexNamePaletteColor(const QString &name, int i, int n) const
   return palette->getColor(i, n, CQColorsPalette::WrapMode::REPEAT);
 }
 
+const CQCharts::PaletteLUT *
+CQCharts::
+paletteLUT(CQColorsPalette *palette, bool scale, bool invert) const
+{
+  return paletteLUTMgr_->lut(palette, scale, invert);
+}
+
+bool
+CQCharts::
+interpColorValues(const Color &c, const double *values, int n, QRgb *rgbs) const
+{
+  // only palette colors interpolated from value
+  if (! c.isValid() || c.type() != Color::Type::PALETTE)
+    return false;
+
+  CQColorsPalette *palette = nullptr;
+
+  QString name;
+
+  if      (c.hasPaletteIndex())
+    palette = this->themePalette(std::max(c.getPaletteIndex(), 0));
+  else if (c.hasPaletteName() && c.getPaletteName(name))
+    palette = CQColorsMgrInst->getNamedPalette(name);
+  else
+    palette = this->themePalette(0);
+
+  if (! palette)
+    return false;
+
+  paletteLUT(palette, c.isScale(), c.isInvert())->map(values, n, rgbs);
+
+  return true;
+}
+
 QColor
 CQCharts::
 interpThemeColor(const ColorInd &ind) const
@@ -28,6 +28,7 @@ CQChartsVarsModel.cpp \
 CQChartsTclModel.cpp \
 CQChartsExprDataModel.cpp \
 CQChartsSelectionModel.cpp \
+CQChartsCluster.cpp \
 CQChartsCorrelationModel.cpp \
 \
 CQChartsColumn.cpp \
@@ -43,6 +44,7 @@ CQChartsTableDelegate.cpp \
 \
 CQChartsWindow.cpp \
 CQChartsView.cpp \
+CQChartsBatchPrint.cpp \
 CQChartsViewError.cpp \
 CQChartsViewQuery.cpp \
 CQChartsViewExpander.cpp \
@@ -129,6 +131,7 @@ CQChartsKey.cpp \
 CQChartsMapKey.cpp \
 CQChartsTitle.cpp \
 CQChartsAnnotation.cpp \
+CQChartsAnnotationTree.cpp \
 CQChartsArrow.cpp \
 CQChartsEditHandles.cpp \
 CQChartsResizeHandle.cpp \
@@ -209,6 +212,7 @@ CQChartsModelExprMatch.cpp \
 CQChartsModelFilter.cpp \
 \
 CQChartsPlotModelVisitor.cpp \
+CQChartsPlotStage.cpp \
 CQChartsModelVisitor.cpp \
 \
 CQChartsData.cpp \
@@ -249,6 +253,7 @@ CQChartsPlotMargin.cpp \
 CQChartsConnectionList.cpp \
 CQChartsSides.cpp \
 CQChartsFillUnder.cpp \
+CQChartsPaletteLUT.cpp \
 CQChartsPaletteName.cpp \
 CQChartsArea.cpp \
 CQChartsUnits.cpp \
@@ -261,6 +266,7 @@ CQChartsSymbol.cpp \
 CQChartsSymbolType.cpp \
 CQChartsSymbolSet.cpp \
 CQChartsSymbolBuffer.cpp \
+CQChartsTextCache.cpp \
 \
 CQChartsImage.cpp \
 CQChartsWidget.cpp \
@@ -268,6 +274,7 @@ CQChartsPath.cpp \
 CQChartsStyle.cpp \
 CQChartsBoxWhisker.cpp \
 CQChartsDensity.cpp \
+CQChartsQuantileSketch.cpp \
 CQChartsGrahamHull.cpp \
 CQChartsBivariateDensity.cpp \
 \
@@ -290,7 +297,9 @@ CQChartsSVGPaintDevice.cpp \
 CQChartsViewPlotPaintDevice.cpp \
 CQChartsStatsPaintDevice.cpp \
 CQChartsPixelPaintDevice.cpp \
+CQChartsRecordPaintDevice.cpp \
 CQChartsPaintDevice.cpp \
+CQChartsDisplayList.cpp \
 \
 CQChartsPlotDrawUtil.cpp \
 CQChartsSVGUtil.cpp \
@@ -307,10 +316,14 @@ CQChartsGeom.cpp \
 CQChartsAnalyzeFile.cpp \
 CQChartsAnalyzeModel.cpp \
 \
+CQChartsSeriation.cpp \
+CQChartsPixelAggregate.cpp \
 CQChartsDelaunay.cpp \
+CQChartsHullDelaunay.cpp \
 CQChartsDendrogram.cpp \
 CQChartsHull3D.cpp \
 CQChartsContour.cpp \
+CQChartsContourTracer.cpp \
 \
 CQChartsTitleEdit.cpp \
 CQChartsKeyEdit.cpp \
@@ -439,6 +452,7 @@ HEADERS += \
 ../include/CQChartsTclModel.h \
 ../include/CQChartsExprDataModel.h \
 ../include/CQChartsSelectionModel.h \
+../include/CQChartsCluster.h \
 ../include/CQChartsCorrelationModel.h \
 \
 ../include/CQChartsColumn.h \
@@ -454,6 +468,7 @@ HEADERS += \
 \
 ../include/CQChartsWindow.h \
 ../include/CQChartsView.h \
+../include/CQChartsBatchPrint.h \
 ../include/CQChartsViewError.h \
 ../include/CQChartsViewQuery.h \
 ../include/CQChartsViewExpander.h \
@@ -540,6 +555,7 @@ HEADERS += \
 ../include/CQChartsMapKey.h \
 ../include/CQChartsTitle.h \
 ../include/CQChartsAnnotation.h \
+../include/CQChartsAnnotationTree.h \
 ../include/CQChartsArrow.h \
 ../include/CQChartsEditHandles.h \
 ../include/CQChartsResizeHandle.h \
@@ -568,6 +584,7 @@ HEADERS += \
 ../include/CQChartsSymbolType.h \
 ../include/CQChartsSymbolSet.h \
 ../include/CQChartsSymbolBuffer.h \
+../include/CQChartsTextCache.h \
 \
 ../include/CQChartsImage.h \
 ../include/CQChartsWidget.h \
@@ -575,6 +592,7 @@ HEADERS += \
 ../include/CQChartsStyle.h \
 ../include/CQChartsBoxWhisker.h \
 ../include/CQChartsDensity.h \
+../include/CQChartsQuantileSketch.h \
 ../include/CQChartsGrahamHull.h \
 ../include/CQChartsBivariateDensity.h \
 \
@@ -591,6 +609,8 @@ HEADERS += \
 ../include/CQChartsNameValues.h \
 ../include/CQChartsQuadTree.h \
 ../include/CQChartsEnv.h \
+../include/CQChartsParallel.h \
+../include/CQChartsRadixSort.h \
 \
 ../include/CQChartsHtmlPaintDevice.h \
 ../include/CQChartsScriptPaintDevice.h \
@@ -598,7 +618,9 @@ HEADERS += \
 ../include/CQChartsViewPlotPaintDevice.h \
 ../include/CQChartsStatsPaintDevice.h \
 ../include/CQChartsPixelPaintDevice.h \
+../include/CQChartsRecordPaintDevice.h \
 ../include/CQChartsPaintDevice.h \
+../include/CQChartsDisplayList.h \
 \
 ../include/CQChartsPlotDrawUtil.h \
 ../include/CQChartsSVGUtil.h \
@@ -670,6 +692,7 @@ HEADERS += \
 ../include/CQChartsModelFilter.h \
 \
 ../include/CQChartsPlotModelVisitor.h \
+../include/CQChartsPlotStage.h \
 ../include/CQChartsModelVisitor.h \
 \
 ../include/CQChartsObjData.h \
@@ -703,6 +726,7 @@ HEADERS += \
 ../include/CQChartsConnectionList.h \
 ../include/CQChartsSides.h \
 ../include/CQChartsFillUnder.h \
+../include/CQChartsPaletteLUT.h \
 ../include/CQChartsPaletteName.h \
 ../include/CQChartsArea.h \
 ../include/CQChartsUnits.h \
@@ -756,10 +780,14 @@ HEADERS += \
 ../include/CQChartsHtml.h \
 ../include/CQChartsJS.h \
 \
+../include/CQChartsSeriation.h \
+../include/CQChartsPixelAggregate.h \
 ../include/CQChartsDelaunay.h \
+../include/CQChartsHullDelaunay.h \
 ../include/CQChartsDendrogram.h \
 ../include/CQChartsHull3D.h \
 ../include/CQChartsContour.h \
+../include/CQChartsContourTracer.h \
 \
 ../include/CQChartsTitleEdit.h \
 ../include/CQChartsKeyEdit.h \
@@ -13,6 +13,9 @@
 #include <CQChartsDrawUtil.h>
 #include <CQChartsViewPlotPaintDevice.h>
 #include <CQChartsHtml.h>
+#include <CQChartsParallel.h>
+#include <CQChartsSeriation.h>
+#include <CQChartsTextCache.h>
 
 #include <CQPropertyViewItem.h>
 #include <CQPropertyViewModel.h>
@@ -62,7 +65,12 @@ description() const
      p("The group is specified using the " + B("Group") + " column.").
     h3("Options").
      p("The nodes can be sorted by group, name or value using the " + B("sortType") + " option").
+     p("The nodes can also be reordered so strongly connected nodes are adjacent (matrix "
+       "seriation) using spectral, reverse Cuthill-McKee or cluster leaf order sort types").
      p("The margin around the plot can be specified using the " + B("margin") + " option").
+     p("Large matrices are drawn as an image (instead of a cell object per connection) when "
+       "the number of visible cells is greater than " + B("maxCellObjs") + ". This can be "
+       "controlled using the " + B("drawType") + " option").
     h3("Styling").
      p("The styling (fill, stroke) of the connection cells, empty (no connection) cell "
        "and background can be set").
@@ -162,6 +170,8 @@ clearNodes()
   nameNodeMap_.clear();
 
   sortedNodes_.clear();
+
+  cellMatrix_ = CellMatrix();
 }
 
 //---
@@ -170,7 +180,7 @@ void
 CQChartsAdjacencyPlot::
 setSortType(const SortType &t)
 {
-  CQChartsUtil::testAndSet(sortType_, t, [&]() { updateRangeAndObjs(); } );
+  CQChartsUtil::testAndSet(sortType_, t, [&]() { reorderNodes(); } );
 }
 
 void
@@ -187,6 +197,20 @@ setBgMargin(const Length &l)
   CQChartsUtil::testAndSet(bgMargin_, l, [&]() { updateObjs(); } );
 }
 
+void
+CQChartsAdjacencyPlot::
+setDrawType(const DrawType &t)
+{
+  CQChartsUtil::testAndSet(drawType_, t, [&]() { updateObjs(); } );
+}
+
+void
+CQChartsAdjacencyPlot::
+setMaxCellObjs(int n)
+{
+  CQChartsUtil::testAndSet(maxCellObjs_, std::max(n, 0), [&]() { updateObjs(); } );
+}
+
 //---
 
 void
@@ -201,6 +225,9 @@ addProperties()
   addProp("options", "sortType"     , "sort"         , "Sort type");
   addProp("options", "forceDiagonal", "forceDiagonal", "Force nodes on diagonal");
   addProp("options", "bgMargin"     , "margin"       , "Background margin");
+  addProp("options", "drawType"     , "drawType"     , "Draw cells as objects or image");
+  addProp("options", "maxCellObjs"  , "maxCellObjs"  ,
+          "Max visible cells drawn as objects for auto draw type");
 
   // background
   addFillProperties("background/fill", "backgroundFill", "Background");
@@ -761,41 +788,7 @@ initConnectionObjs(PlotObjs &objs) const
 
   //---
 
-  double equalValue = 0.0;
-
-  double y = 1.0 - tsize - yb;
-
-  for (auto &node1 : sortedNodes_) {
-    double x = tsize + xb;
-
-    for (auto &node2 : sortedNodes_) {
-      double value = node1->edgeValue(node2, equalValue);
-
-      // skip unconnected
-      bool connected;
-
-      if (node1 == node2)
-        connected = (value > 0.0 || isForceDiagonal());
-      else
-        connected = ! CMathUtil::isZero(value);
-
-      if (connected) {
-        BBox bbox(x, y - scale(), x + scale(), y);
-
-        auto ig = groupColorInd(node1->group());
-
-        auto *obj = th->createCellObj(node1, node2, value, bbox, ig);
-
-        connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
-
-        objs.push_back(obj);
-      }
-
-      x += scale();
-    }
-
-    y -= scale();
-  }
+  createCellObjs(objs, tsize + xb, 1.0 - tsize - yb);
 
   //---
 
@@ -977,6 +970,207 @@ sortNodes(const NodeMap &nodes, NodeArray &sortedNodes, NodeData &nodeData) cons
       return lhs->name() < rhs->name();
     });
   }
+  else if (isSeriationSort()) {
+    // start from name order so ties are stable
+    sortNodesByName(sortedNodes);
+
+    seriateNodes(sortedNodes);
+  }
+}
+
+void
+CQChartsAdjacencyPlot::
+sortNodesByName(NodeArray &sortedNodes) const
+{
+  std::sort(sortedNodes.begin(), sortedNodes.end(), [](const AdjacencyNodeP &lhs,
+                                                       const AdjacencyNodeP &rhs) {
+    return lhs->name() < rhs->name();
+  });
+}
+
+bool
+CQChartsAdjacencyPlot::
+isSeriationSort() const
+{
+  return (sortType() == SortType::SPECTRAL || sortType() == SortType::RCM ||
+          sortType() == SortType::CLUSTER);
+}
+
+CQChartsSeriation::Type
+CQChartsAdjacencyPlot::
+seriationType() const
+{
+  using Seriation = CQChartsSeriation;
+
+  switch (sortType()) {
+    case SortType::SPECTRAL: return Seriation::Type::SPECTRAL;
+    case SortType::RCM     : return Seriation::Type::RCM;
+    case SortType::CLUSTER : return Seriation::Type::CLUSTER;
+    default                : return Seriation::Type::NONE;
+  }
+}
+
+void
+CQChartsAdjacencyPlot::
+initSeriationMatrix(const NodeArray &sortedNodes, CQChartsSeriation::Matrix &matrix) const
+{
+  // connection matrix of nodes
+  CellMatrix cellMatrix;
+
+  initCellMatrix(sortedNodes, cellMatrix);
+
+  matrix.n        = cellMatrix.n;
+  matrix.rowStart = cellMatrix.rowStart;
+  matrix.cols     = cellMatrix.cols;
+
+  matrix.values.assign(cellMatrix.values.begin(), cellMatrix.values.end());
+}
+
+bool
+CQChartsAdjacencyPlot::
+isSeriationCached() const
+{
+  // seriation is calculated from name sorted nodes
+  NodeArray sortedNodes;
+
+  for (auto &pnode : nodes_)
+    sortedNodes.push_back(pnode.second);
+
+  sortNodesByName(sortedNodes);
+
+  CQChartsSeriation::Matrix matrix;
+
+  initSeriationMatrix(sortedNodes, matrix);
+
+  return seriation_.isCached(seriationType(), matrix);
+}
+
+void
+CQChartsAdjacencyPlot::
+seriateNodes(NodeArray &sortedNodes) const
+{
+  CQPerfTrace trace("CQChartsAdjacencyPlot::seriateNodes");
+
+  auto type = seriationType();
+
+  if (type == CQChartsSeriation::Type::NONE)
+    return;
+
+  CQChartsSeriation::Matrix matrix;
+
+  initSeriationMatrix(sortedNodes, matrix);
+
+  // calc (cached) permutation and apply
+  auto perm = seriation_.calc(type, matrix);
+
+  if (perm.size() != sortedNodes.size())
+    return;
+
+  NodeArray nodes;
+
+  nodes.reserve(sortedNodes.size());
+
+  for (const auto &i : perm)
+    nodes.push_back(sortedNodes[size_t(i)]);
+
+  sortedNodes.swap(nodes);
+}
+
+void
+CQChartsAdjacencyPlot::
+reorderNodes()
+{
+  // reorder existing objects if they cover all cells (or image drawn),
+  // otherwise objects for visible cells must be recreated
+  int n = cellMatrix_.n;
+
+  bool allCells = (cellObjRange_.set && cellObjRange_.r1 == 0 && cellObjRange_.r2 == n - 1 &&
+                   cellObjRange_.c1 == 0 && cellObjRange_.c2 == n - 1);
+
+  if (n <= 0 || n != numVisibleNodes() || (! isDrawImage() && ! allCells)) {
+    updateRangeAndObjs();
+    return;
+  }
+
+  // seriation can be slow (cluster distances are O(n^2)) so calculate in update thread
+  // when objects are rebuilt unless ordering already cached
+  if (isSeriationSort() && ! isSeriationCached()) {
+    updateRangeAndObjs();
+    return;
+  }
+
+  CQPerfTrace trace("CQChartsAdjacencyPlot::reorderNodes");
+
+  //---
+
+  // resort nodes (same node set so node data unchanged)
+  NodeArray sortedNodes;
+  NodeData  nodeData;
+
+  sortNodes(nodes_, sortedNodes, nodeData);
+
+  if (int(sortedNodes.size()) != n) {
+    updateRangeAndObjs();
+    return;
+  }
+
+  // map old sorted index to new sorted index
+  std::map<int, int> idRow;
+
+  for (int r = 0; r < n; ++r)
+    idRow[sortedNodes[size_t(r)]->id()] = r;
+
+  std::vector<int> newInd(static_cast<size_t>(n));
+
+  for (int r = 0; r < n; ++r)
+    newInd[size_t(r)] = idRow[sortedNodes_[size_t(r)]->id()];
+
+  sortedNodes_.swap(sortedNodes);
+
+  //---
+
+  initCellMatrix(sortedNodes_, cellMatrix_);
+
+  CellInds selectedCells;
+
+  for (const auto &cellInd : selectedCells_)
+    selectedCells.insert(CellInd(newInd[size_t(cellInd.first)], newInd[size_t(cellInd.second)]));
+
+  selectedCells_.swap(selectedCells);
+
+  {
+  std::unique_lock<std::mutex> lock(cellImageMutex_);
+
+  cellImageData_.valid = false;
+  }
+
+  //---
+
+  // move cell objects to new row/column
+  double x = cellObjOrigin_.x;
+  double y = cellObjOrigin_.y;
+
+  {
+  NoUpdate noUpdate(this);
+
+  for (auto *plotObj : plotObjects()) {
+    auto *cellObj = dynamic_cast<CellObj *>(plotObj);
+    if (! cellObj) continue;
+
+    auto pr = idRow.find(cellObj->node1()->id());
+    auto pc = idRow.find(cellObj->node2()->id());
+    if (pr == idRow.end() || pc == idRow.end()) continue;
+
+    double x1 = x + (*pc).second*scale();
+    double y1 = y - (*pr).second*scale();
+
+    cellObj->setRect(BBox(x1, y1 - scale(), x1 + scale(), y1));
+  }
+  }
+
+  invalidateObjTree();
+
+  drawObjs();
 }
 
 //---
@@ -1033,41 +1227,260 @@ createNameNodeObjs(PlotObjs &objs) const
 
   //---
 
+  createCellObjs(objs, tsize, 1.0 - tsize);
+}
+
+void
+CQChartsAdjacencyPlot::
+createCellObjs(PlotObjs &objs, double x, double y) const
+{
+  CQPerfTrace trace("CQChartsAdjacencyPlot::createCellObjs");
+
+  auto *th = const_cast<CQChartsAdjacencyPlot *>(this);
+
+  //---
+
+  // build sparse matrix of connected cells
+  initCellMatrix(sortedNodes_, th->cellMatrix_);
+
+  th->selectedCells_.clear();
+
+  {
+  std::unique_lock<std::mutex> lock(cellImageMutex_);
+
+  cellImageData_.valid = false;
+  }
+
+  //---
+
+  // create objects for visible cells if few enough (otherwise cells are drawn as an image)
+  CellRange visibleRange;
+
+  calcVisibleCellRange(visibleRange);
+
+  th->drawImage_     = ! isCellObjs(visibleRange);
+  th->cellObjRange_  = CellRange();
+  th->cellObjOrigin_ = Point(x, y);
+
+  int n = cellMatrix_.n;
+
+  if (isDrawImage() || n <= 0)
+    return;
+
+  CellRange range;
+
+  range.set = true;
+  range.r1  = 0; range.r2 = n - 1;
+  range.c1  = 0; range.c2 = n - 1;
+
+  if (drawType() == DrawType::AUTO) {
+    if (! visibleRange.set)
+      return;
+
+    range = visibleRange;
+
+    // add margin so small pans don't need new objects
+    int dr = (range.r2 - range.r1 + 1)/4;
+    int dc = (range.c2 - range.c1 + 1)/4;
+
+    range.r1 = std::max(range.r1 - dr, 0); range.r2 = std::min(range.r2 + dr, n - 1);
+    range.c1 = std::max(range.c1 - dc, 0); range.c2 = std::min(range.c2 + dc, n - 1);
+  }
+
+  th->cellObjRange_ = range;
+
+  //---
+
   double equalValue = 0.0;
 
-  double y = 1.0 - tsize;
+  const auto &cols = cellMatrix_.cols;
 
-  for (auto &node1 : sortedNodes_) {
-    double x = tsize;
+  for (int r = range.r1; r <= range.r2; ++r) {
+    const auto &node1 = sortedNodes_[size_t(r)];
+
+    auto ig = groupColorInd(node1->group());
+
+    double y1 = y - r*scale();
+
+    int i1 = cellMatrix_.rowStart[size_t(r    )];
+    int i2 = cellMatrix_.rowStart[size_t(r + 1)];
+
+    auto pc = std::lower_bound(cols.begin() + i1, cols.begin() + i2, range.c1);
+
+    for (int i = int(pc - cols.begin()); i < i2; ++i) {
+      int c = cols[size_t(i)];
+      if (c > range.c2) break;
+
+      const auto &node2 = sortedNodes_[size_t(c)];
 
-    for (auto &node2 : sortedNodes_) {
       double value = node1->edgeValue(node2, equalValue);
 
+      double x1 = x + c*scale();
+
+      BBox bbox(x1, y1 - scale(), x1 + scale(), y1);
+
+      auto *obj = th->createCellObj(node1, node2, value, bbox, ig);
+
+      connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
+
+      objs.push_back(obj);
+    }
+  }
+}
+
+void
+CQChartsAdjacencyPlot::
+initCellMatrix(const NodeArray &nodes, CellMatrix &matrix) const
+{
+  CQPerfTrace trace("CQChartsAdjacencyPlot::initCellMatrix");
+
+  matrix = CellMatrix();
+
+  int n = int(nodes.size());
+
+  matrix.n = n;
+
+  matrix.rowStart.resize(size_t(n + 1));
+
+  //---
+
+  // map node id to sorted index
+  std::map<int, int> idRow;
+
+  for (int r = 0; r < n; ++r)
+    idRow[nodes[size_t(r)]->id()] = r;
+
+  //---
+
+  // add connected cells of each row (from node edges)
+  using ColValue  = std::pair<int, float>;
+  using ColValues = std::vector<ColValue>;
+
+  ColValues colValues;
+
+  double equalValue = 0.0;
+
+  for (int r = 0; r < n; ++r) {
+    const auto &node1 = nodes[size_t(r)];
+
+    colValues.clear();
+
+    for (const auto &pe : node1->edges()) {
+      auto pr = idRow.find(pe.first);
+      if (pr == idRow.end()) continue;
+
+      int c = (*pr).second;
+      if (c == r) continue;
+
+      const auto &edgeData = pe.second;
+
+      double value = (edgeData.value.isSet() ? edgeData.value.real() : 0.0);
+
       // skip unconnected
-      bool connected;
+      if (CMathUtil::isZero(value))
+        continue;
 
-      if (node1 == node2)
-        connected = (value > 0.0 || isForceDiagonal());
-      else
-        connected = ! CMathUtil::isZero(value);
+      colValues.push_back(ColValue(c, float(value)));
+    }
 
-      if (connected) {
-        BBox bbox(x, y - scale(), x + scale(), y);
+    double value = node1->edgeValue(node1, equalValue);
 
-        auto ig = groupColorInd(node1->group());
+    if (value > 0.0 || isForceDiagonal())
+      colValues.push_back(ColValue(r, float(value)));
 
-        auto *obj = th->createCellObj(node1, node2, value, bbox, ig);
+    std::sort(colValues.begin(), colValues.end());
 
-        connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
+    //---
 
-        objs.push_back(obj);
-      }
+    matrix.rowStart[size_t(r)] = matrix.numCells();
 
-      x += scale();
+    for (const auto &colValue : colValues) {
+      matrix.cols  .push_back(colValue.first );
+      matrix.values.push_back(colValue.second);
     }
+  }
+
+  matrix.rowStart[size_t(n)] = matrix.numCells();
+}
+
+CQChartsGeom::Point
+CQChartsAdjacencyPlot::
+cellOrigin() const
+{
+  double xb = lengthPlotWidth (bgMargin());
+  double yb = lengthPlotHeight(bgMargin());
+
+  double tsize = maxLen()*std::max(fontFactor_, 0.0)*scale();
+
+  return Point(tsize + xb, 1.0 - tsize - yb);
+}
+
+void
+CQChartsAdjacencyPlot::
+calcVisibleCellRange(CellRange &range) const
+{
+  range = CellRange();
+
+  int n = cellMatrix_.n;
+
+  if (n <= 0)
+    return;
+
+  range.set = true;
+  range.r1  = 0; range.r2 = n - 1;
+  range.c1  = 0; range.c2 = n - 1;
+
+  //---
+
+  // restrict to rows/columns inside plot area
+  auto vbbox = calcPlotViewRect();
+
+  if (! vbbox.isValid() || scale() <= 0.0)
+    return;
 
-    y -= scale();
+  auto o = cellOrigin();
+
+  int c1 = int(std::floor((vbbox.getXMin() - o.x)/scale()));
+  int c2 = int(std::floor((vbbox.getXMax() - o.x)/scale()));
+  int r1 = int(std::floor((o.y - vbbox.getYMax())/scale()));
+  int r2 = int(std::floor((o.y - vbbox.getYMin())/scale()));
+
+  if (c2 < 0 || c1 >= n || r2 < 0 || r1 >= n) {
+    range.set = false;
+    return;
   }
+
+  range.r1 = std::max(r1, 0); range.r2 = std::min(r2, n - 1);
+  range.c1 = std::max(c1, 0); range.c2 = std::min(c2, n - 1);
+}
+
+bool
+CQChartsAdjacencyPlot::
+isCellObjs(const CellRange &visibleRange) const
+{
+  if      (drawType() == DrawType::CELLS)
+    return true;
+  else if (drawType() == DrawType::IMAGE)
+    return false;
+
+  return (visibleRange.numCells() <= maxCellObjs());
+}
+
+bool
+CQChartsAdjacencyPlot::
+cellAtPoint(const Point &p, int &row, int &col) const
+{
+  int n = cellMatrix_.n;
+
+  if (n <= 0 || scale() <= 0.0)
+    return false;
+
+  auto o = cellOrigin();
+
+  col = int(std::floor((p.x - o.x)/scale()));
+  row = int(std::floor((o.y - p.y)/scale()));
+
+  return (row >= 0 && row < n && col >= 0 && col < n);
 }
 
 //---
@@ -1127,7 +1540,7 @@ void
 CQChartsAdjacencyPlot::
 initFontFactor()
 {
-  QFontMetricsF fm(view_->QWidget::font());
+  CQChartsFontMetrics fm(view_->QWidget::font());
 
   // get height
   double th = fm.height();
@@ -1174,21 +1587,150 @@ postResize()
   setInsideObj(nullptr);
 }
 
-bool
-CQChartsAdjacencyPlot::
-hasBackground() const
-{
-  return true;
-}
-
 void
 CQChartsAdjacencyPlot::
-execDrawBackground(PaintDevice *device) const
+applyDataRangeAndDraw()
 {
-  rowNodeLabels_.clear();
-  colNodeLabels_.clear();
+  CQChartsConnectionPlot::applyDataRangeAndDraw();
 
-  // calc text size
+  //---
+
+  // recreate objects if zoom/pan changes draw of visible cells (objects or image)
+  if (drawType() != DrawType::AUTO)
+    return;
+
+  CellRange visibleRange;
+
+  calcVisibleCellRange(visibleRange);
+
+  bool cellObjs = isCellObjs(visibleRange);
+
+  if      (cellObjs == isDrawImage())
+    updateObjs();
+  else if (cellObjs && visibleRange.set && ! cellObjRange_.contains(visibleRange))
+    updateObjs();
+}
+
+//---
+
+bool
+CQChartsAdjacencyPlot::
+plotTipText(const Point &p, QString &tip, bool single) const
+{
+  if (! isDrawImage())
+    return CQChartsConnectionPlot::plotTipText(p, tip, single);
+
+  // map point to cell
+  int row, col;
+
+  if (! cellAtPoint(p, row, col) || cellMatrix_.find(row, col) < 0)
+    return false;
+
+  const auto &node1 = sortedNodes_[size_t(row)];
+  const auto &node2 = sortedNodes_[size_t(col)];
+
+  double equalValue = 0.0;
+
+  tip = calcCellTipId(node1, node2, node1->edgeValue(node2, equalValue));
+
+  return true;
+}
+
+bool
+CQChartsAdjacencyPlot::
+handleSelectPress(const Point &p, SelMod selMod)
+{
+  if (! isDrawImage())
+    return CQChartsConnectionPlot::handleSelectPress(p, selMod);
+
+  if (mapKeySelectPress(p, selMod))
+    return true;
+
+  //---
+
+  // map point to cell
+  int row, col;
+
+  if (! cellAtPoint(p, row, col) || cellMatrix_.find(row, col) < 0) {
+    if (selMod == SelMod::REPLACE && ! selectedCells_.empty()) {
+      selectedCells_.clear();
+
+      drawForeground();
+    }
+
+    return CQChartsConnectionPlot::handleSelectPress(p, selMod);
+  }
+
+  //---
+
+  // update selected cells
+  CellInd cellInd(row, col);
+
+  bool selected = (selectedCells_.find(cellInd) != selectedCells_.end());
+
+  if      (selMod == SelMod::REPLACE) {
+    selectedCells_.clear();
+
+    selected = true;
+  }
+  else if (selMod == SelMod::TOGGLE)
+    selected = ! selected;
+  else if (selMod == SelMod::ADD)
+    selected = true;
+  else if (selMod == SelMod::REMOVE)
+    selected = false;
+
+  if (selected)
+    selectedCells_.insert(cellInd);
+  else
+    selectedCells_.erase(cellInd);
+
+  //---
+
+  // select model indices of selected cells
+  startSelection();
+
+  beginSelectIndex();
+
+  for (const auto &cellInd1 : selectedCells_) {
+    const auto &node1 = sortedNodes_[size_t(cellInd1.first )];
+    const auto &node2 = sortedNodes_[size_t(cellInd1.second)];
+
+    auto ind = node1->ind(node2->id());
+
+    if (! ind.isValid())
+      ind = node2->ind(node1->id());
+
+    if (ind.isValid())
+      addSelectIndex(modelIndex(ind));
+  }
+
+  endSelectIndex();
+
+  endSelection();
+
+  //---
+
+  drawForeground();
+
+  return true;
+}
+
+bool
+CQChartsAdjacencyPlot::
+hasBackground() const
+{
+  return true;
+}
+
+void
+CQChartsAdjacencyPlot::
+execDrawBackground(PaintDevice *device) const
+{
+  rowNodeLabels_.clear();
+  colNodeLabels_.clear();
+
+  // calc text size
   auto po = windowToPixel(Point(0.0, 1.0));
 
   pxs_ = windowToPixelWidth (scale());
@@ -1241,7 +1783,7 @@ execDrawBackground(PaintDevice *device) const
 
   //---
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   for (const auto &pr : rowNodeLabels_) {
     for (const auto &pr1 : pr.second) {
@@ -1338,46 +1880,43 @@ execDrawBackground(PaintDevice *device) const
 
   //---
 
-  // draw empty cells
-  PenBrush emptyPenBrush;
-
-  auto pc = interpEmptyCellStrokeColor(ColorInd());
-  auto bc = interpEmptyCellFillColor  (ColorInd());
+  // draw all cells as image
+  if (isDrawImage()) {
+    drawCellImage(device, cellBBox);
+  }
+  // draw visible empty cells (connected cells are objects)
+  else {
+    PenBrush emptyPenBrush;
 
-  setPenBrush(emptyPenBrush,
-    PenData  (true, pc, emptyCellShapeData().stroke()),
-    BrushData(true, bc, emptyCellShapeData().fill  ()));
+    auto pc = interpEmptyCellStrokeColor(ColorInd());
+    auto bc = interpEmptyCellFillColor  (ColorInd());
 
-  auto cornerSize = emptyCellCornerSize();
+    setPenBrush(emptyPenBrush,
+      PenData  (true, pc, emptyCellShapeData().stroke()),
+      BrushData(true, bc, emptyCellShapeData().fill  ()));
 
-  double equalValue = 0.0;
+    auto cornerSize = emptyCellCornerSize();
 
-  py = po.y + lengthPixelHeight(bgMargin()) + yts_;
+    CellRange visibleRange;
 
-  for (auto &node1 : sortedNodes_) {
-    double px1 = po.x + lengthPixelWidth(bgMargin()) + xts_;
+    calcVisibleCellRange(visibleRange);
 
-    for (auto &node2 : sortedNodes_) {
-      double value = node1->edgeValue(node2, equalValue);
+    if (visibleRange.set && cellMatrix_.n == nn) {
+      for (int r = visibleRange.r1; r <= visibleRange.r2; ++r) {
+        double py1 = py + r*pys_;
 
-      // draw unconnected
-      bool connected;
+        for (int c = visibleRange.c1; c <= visibleRange.c2; ++c) {
+          if (cellMatrix_.find(r, c) >= 0)
+            continue;
 
-      if (node1 == node2)
-        connected = (value > 0.0 || isForceDiagonal());
-      else
-        connected = ! CMathUtil::isZero(value);
+          double px1 = px + c*pxs_;
 
-      if (! connected) {
-        auto cellBBox1 = pixelToWindow(BBox(px1, py, px1 + pxs_, py + pys_));
+          auto cellBBox1 = pixelToWindow(BBox(px1, py1, px1 + pxs_, py1 + pys_));
 
-        CQChartsDrawUtil::drawRoundedRect(device, emptyPenBrush, cellBBox1, cornerSize);
+          CQChartsDrawUtil::drawRoundedRect(device, emptyPenBrush, cellBBox1, cornerSize);
+        }
       }
-
-      px1 += pxs_;
     }
-
-    py += pys_;
   }
 
   if (insideObject()) {
@@ -1415,7 +1954,7 @@ void
 CQChartsAdjacencyPlot::
 drawRowNodeLabelStr(PaintDevice *device, const Point &p, const QString &str, int group) const
 {
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double tw = fm.horizontalAdvance(str) + 4;
 
@@ -1494,7 +2033,7 @@ void
 CQChartsAdjacencyPlot::
 drawColNodeLabelStr(PaintDevice *device, const Point &p, const QString &str, int group) const
 {
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   //---
 
@@ -1543,6 +2082,277 @@ addColNodeLabelStr(const Point &p, const QString &str, int depth, int group) con
 
 //---
 
+void
+CQChartsAdjacencyPlot::
+drawCellImage(PaintDevice *device, const BBox &pbbox) const
+{
+  CQPerfTrace trace("CQChartsAdjacencyPlot::drawCellImage");
+
+  std::unique_lock<std::mutex> lock(cellImageMutex_);
+
+  updateCellImage();
+
+  const auto &levels = cellImageData_.levels;
+
+  int nl = int(levels.size());
+  int n  = cellMatrix_.n;
+
+  if (nl == 0 || n <= 0 || pxs_ <= 0.0 || pys_ <= 0.0)
+    return;
+
+  //---
+
+  // get visible part of cells (pixels)
+  BBox vbbox;
+
+  if (! pbbox.intersect(calcPlotPixelRect(), vbbox))
+    return;
+
+  int x1 = int(std::floor(vbbox.getXMin())), x2 = int(std::ceil(vbbox.getXMax()));
+  int y1 = int(std::floor(vbbox.getYMin())), y2 = int(std::ceil(vbbox.getYMax()));
+
+  int w = x2 - x1;
+  int h = y2 - y1;
+
+  if (w <= 0 || h <= 0)
+    return;
+
+  //---
+
+  // use mip level where each texel is no more than a pixel
+  double cellPixels = std::min(pxs_, pys_);
+
+  int level = 0;
+
+  while (level + 1 < nl && cellPixels*(1 << (level + 1)) <= 1.0)
+    ++level;
+
+  const auto &image = levels[size_t(level)];
+
+  int iw = image.width ();
+  int ih = image.height();
+
+  //---
+
+  // sample level texel at each pixel center
+  std::vector<int> texelCols(size_t(w));
+
+  for (int i = 0; i < w; ++i) {
+    int c = int(std::floor((x1 + i + 0.5 - pbbox.getXMin())/pxs_));
+
+    c = std::min(std::max(c, 0), n - 1);
+
+    texelCols[size_t(i)] = std::min(c >> level, iw - 1);
+  }
+
+  QImage pimage(w, h, QImage::Format_ARGB32);
+
+  CQChartsParallel::forChunks(h, [&](int j1, int j2) {
+    for (int j = j1; j < j2; ++j) {
+      int r = int(std::floor((y1 + j + 0.5 - pbbox.getYMin())/pys_));
+
+      r = std::min(std::max(r, 0), n - 1);
+
+      int tr = std::min(r >> level, ih - 1);
+
+      auto *src = reinterpret_cast<const QRgb *>(image.constScanLine(tr));
+      auto *dst = reinterpret_cast<QRgb *>(pimage.scanLine(j));
+
+      for (int i = 0; i < w; ++i)
+        dst[i] = src[texelCols[size_t(i)]];
+    }
+  }, 64);
+
+  device->drawImage(pixelToWindow(Point(x1, y1)), pimage);
+}
+
+void
+CQChartsAdjacencyPlot::
+updateCellImage() const
+{
+  int n = cellMatrix_.n;
+
+  //---
+
+  // get colors used for image (empty cell color and node colors)
+  RGBs colors;
+
+  auto bg = interpEmptyCellFillColor(ColorInd());
+
+  colors.push_back(bg.rgba());
+
+  for (const auto &node : sortedNodes_) {
+    bool scaled = true;
+
+    auto nc = calcNodeFillColor(node, node, groupColorInd(node->group()), scaled);
+
+    colors.push_back(nc.rgba());
+  }
+
+  double fillAlpha  = this->fillAlpha().valueOr(1.0);
+  double emptyAlpha = emptyCellFillAlpha().valueOr(1.0);
+
+  if (cellImageData_.valid && cellImageData_.colors == colors &&
+      cellImageData_.fillAlpha == fillAlpha && cellImageData_.emptyAlpha == emptyAlpha)
+    return;
+
+  //---
+
+  CQPerfTrace trace("CQChartsAdjacencyPlot::updateCellImage");
+
+  cellImageData_.valid      = true;
+  cellImageData_.colors     = colors;
+  cellImageData_.fillAlpha  = fillAlpha;
+  cellImageData_.emptyAlpha = emptyAlpha;
+
+  cellImageData_.levels.clear();
+
+  if (n <= 0)
+    return;
+
+  //---
+
+  // calc cell colors (blend of node colors scaled by value, see calcCellFillColor)
+  int nc = cellMatrix_.numCells();
+
+  RGBs cellColors(size_t(nc));
+
+  bool nodeColors = ! colorColumn().isValid();
+
+  auto cellFillColor = [&](int r, int c, double value) {
+    const auto &node1 = sortedNodes_[size_t(r)];
+    const auto &node2 = sortedNodes_[size_t(c)];
+
+    if (! nodeColors)
+      return calcCellFillColor(node1, node2, value, groupColorInd(node1->group()));
+
+    auto bc = QColor::fromRgba(colors[size_t(r + 1)]);
+
+    if (r != c) {
+      bc = CQChartsUtil::blendColors(bc, QColor::fromRgba(colors[size_t(c + 1)]), 0.5);
+
+      double s = CMathUtil::map(value, 0.0, maxValue(), 0.0, 1.0);
+
+      bc = CQChartsUtil::blendColors(bc, bg, s);
+    }
+
+    return bc;
+  };
+
+  auto setCellColors = [&](int r1, int r2) {
+    for (int r = r1; r < r2; ++r) {
+      int i1 = cellMatrix_.rowStart[size_t(r    )];
+      int i2 = cellMatrix_.rowStart[size_t(r + 1)];
+
+      for (int i = i1; i < i2; ++i) {
+        auto bc = cellFillColor(r, cellMatrix_.cols[size_t(i)], cellMatrix_.values[size_t(i)]);
+
+        bc.setAlphaF(bc.alphaF()*fillAlpha);
+
+        cellColors[size_t(i)] = bc.rgba();
+      }
+    }
+  };
+
+  // color column lookup uses model so calc in this thread
+  if (nodeColors)
+    CQChartsParallel::forChunks(n, setCellColors, 64);
+  else
+    setCellColors(0, n);
+
+  //---
+
+  // build mip levels (level pixel is color of max absolute value cell in 2^level square)
+  int nl = 1;
+
+  while ((1 << (nl - 1)) < n)
+    ++nl;
+
+  cellImageData_.levels.resize(size_t(nl));
+
+  auto bgAlpha = bg;
+
+  bgAlpha.setAlphaF(bg.alphaF()*emptyAlpha);
+
+  CQChartsParallel::forEach(nl, [&](int level) {
+    int w = (n + (1 << level) - 1) >> level;
+
+    QImage image(w, w, QImage::Format_ARGB32);
+
+    image.fill(bgAlpha);
+
+    // level 0 has one cell per pixel
+    std::vector<float> maxValues;
+
+    if (level > 0)
+      maxValues.resize(size_t(w)*size_t(w), -1.0f);
+
+    for (int r = 0; r < n; ++r) {
+      int tr = r >> level;
+
+      auto *dst = reinterpret_cast<QRgb *>(image.scanLine(tr));
+
+      int i1 = cellMatrix_.rowStart[size_t(r    )];
+      int i2 = cellMatrix_.rowStart[size_t(r + 1)];
+
+      for (int i = i1; i < i2; ++i) {
+        int tc = cellMatrix_.cols[size_t(i)] >> level;
+
+        if (level == 0) {
+          dst[tc] = cellColors[size_t(i)];
+          continue;
+        }
+
+        float value = std::abs(cellMatrix_.values[size_t(i)]);
+
+        auto &texelValue = maxValues[size_t(tr)*size_t(w) + size_t(tc)];
+
+        if (value > texelValue) {
+          texelValue = value;
+
+          dst[tc] = cellColors[size_t(i)];
+        }
+      }
+    }
+
+    cellImageData_.levels[size_t(level)] = image;
+  });
+}
+
+void
+CQChartsAdjacencyPlot::
+drawSelectedCells(PaintDevice *device) const
+{
+  auto o = cellOrigin();
+
+  for (const auto &cellInd : selectedCells_) {
+    int r = cellInd.first;
+    int c = cellInd.second;
+
+    int i = cellMatrix_.find(r, c);
+    if (i < 0) continue;
+
+    const auto &node1 = sortedNodes_[size_t(r)];
+    const auto &node2 = sortedNodes_[size_t(c)];
+
+    auto bc = calcCellFillColor(node1, node2, cellMatrix_.values[size_t(i)],
+                                groupColorInd(node1->group()));
+    auto pc = interpStrokeColor(groupColorInd(node1->group()));
+
+    PenBrush penBrush;
+
+    setPenBrush(penBrush,
+      PenData  (true, selectedColor(pc), shapeData().stroke()),
+      BrushData(true, selectedColor(bc), shapeData().fill  ()));
+
+    BBox bbox(o.x + c*scale(), o.y - (r + 1)*scale(), o.x + (c + 1)*scale(), o.y - r*scale());
+
+    CQChartsDrawUtil::drawRoundedRect(device, penBrush, bbox, cornerSize());
+  }
+}
+
+//---
+
 bool
 CQChartsAdjacencyPlot::
 hasForeground() const
@@ -1550,6 +2360,9 @@ hasForeground() const
   if (! insideObj())
     return true;
 
+  if (isDrawImage() && ! selectedCells_.empty())
+    return true;
+
   if (! isLayerActive(CQChartsLayer::Type::FOREGROUND))
     return false;
 
@@ -1563,12 +2376,104 @@ execDrawForeground(PaintDevice *device) const
   if (insideObj())
     insideObj()->draw(device);
 
+  if (isDrawImage())
+    drawSelectedCells(device);
+
   if (isColorMapKey())
     drawColorMapKey(device);
 }
 
 //---
 
+QColor
+CQChartsAdjacencyPlot::
+calcCellFillColor(const AdjacencyNodeP &node1, const AdjacencyNodeP &node2,
+                  double value, const ColorInd &colorInd) const
+{
+  bool scaled = true;
+
+  QColor bc;
+
+  if (node1 == node2)
+    bc = calcNodeFillColor(node1, node2, colorInd, scaled);
+  else
+    bc = CQChartsUtil::blendColors(calcNodeFillColor(node1, node2, colorInd, scaled),
+                                   calcNodeFillColor(node2, node1, colorInd, scaled), 0.5);
+
+  // scale to value
+  if (scaled) {
+    if (node1 != node2) {
+      auto bg = interpEmptyCellFillColor(ColorInd());
+
+      double s = CMathUtil::map(value, 0.0, maxValue(), 0.0, 1.0);
+
+      bc = CQChartsUtil::blendColors(bc, bg, s);
+    }
+  }
+
+  return bc;
+}
+
+QColor
+CQChartsAdjacencyPlot::
+calcNodeFillColor(const AdjacencyNodeP &srcNode, const AdjacencyNodeP &destNode,
+                  const ColorInd &colorInd, bool &scaled) const
+{
+  auto colorType = this->colorType();
+
+  if      (colorType == ColorType::AUTO || colorType == ColorType::GROUP) {
+    if (colorColumn().isValid()) {
+      scaled = false;
+
+      auto ind1 = srcNode->ind(destNode->id());
+
+      Color indColor;
+
+      if (colorColumnColor(ind1.row(), ind1.parent(), indColor))
+        return interpColor(indColor, ColorInd());
+    }
+
+    return interpFillColor(groupColorInd(srcNode->group()));
+  }
+  else if (colorType == ColorType::INDEX)
+    return interpFillColor(ColorInd(srcNode->id(), numNodes()));
+  else
+    return interpFillColor(colorInd);
+}
+
+QString
+CQChartsAdjacencyPlot::
+calcCellTipId(const AdjacencyNodeP &node1, const AdjacencyNodeP &node2, double value) const
+{
+  CQChartsTableTip tableTip;
+
+  if (node1 != node2) {
+    auto groupStr1 = QString("(%1)").arg(node1->group());
+    auto groupStr2 = QString("(%1)").arg(node2->group());
+
+    tableTip.addTableRow("From", node1->name(), groupStr1);
+    tableTip.addTableRow("To"  , node2->name(), groupStr2);
+  }
+  else {
+    tableTip.addTableRow("Name" , node1->name());
+    tableTip.addTableRow("Group", node1->group());
+    tableTip.addTableRow("Total", node1->totalValue());
+  }
+
+  if (value > 0.0)
+    tableTip.addTableRow("Value", value);
+
+  //---
+
+  //addTipColumns(tableTip, node1->ind());
+
+  //---
+
+  return tableTip.str();
+}
+
+//---
+
 QColor
 CQChartsAdjacencyPlot::
 interpGroupColor(int group) const
@@ -1636,31 +2541,7 @@ QString
 CQChartsAdjacencyCellObj::
 calcTipId() const
 {
-  CQChartsTableTip tableTip;
-
-  if (node1() != node2()) {
-    auto groupStr1 = QString("(%1)").arg(node1()->group());
-    auto groupStr2 = QString("(%1)").arg(node2()->group());
-
-    tableTip.addTableRow("From", node1()->name(), groupStr1);
-    tableTip.addTableRow("To"  , node2()->name(), groupStr2);
-  }
-  else {
-    tableTip.addTableRow("Name" , node1()->name());
-    tableTip.addTableRow("Group", node1()->group());
-    tableTip.addTableRow("Total", node1()->totalValue());
-  }
-
-  if (value() > 0.0)
-    tableTip.addTableRow("Value", value());
-
-  //---
-
-  //plot()->addTipColumns(tableTip, node1()->ind());
-
-  //---
-
-  return tableTip.str();
+  return plot_->calcCellTipId(node1(), node2(), value());
 }
 
 void
@@ -1713,44 +2594,6 @@ calcPenBrush(PenBrush &penBrush, bool updateState) const
 
   //---
 
-  // get fill color for node
-  auto nodeFillColor = [&](const AdjacencyNodeP &srcNode,
-                           const AdjacencyNodeP &destNode, bool &scaled) {
-    auto colorType = plot_->colorType();
-
-    if      (colorType == CQChartsPlot::ColorType::AUTO ||
-             colorType == CQChartsPlot::ColorType::GROUP) {
-      if (plot_->colorColumn().isValid()) {
-        scaled = false;
-
-        auto ind1 = srcNode->ind(destNode->id());
-
-        Color indColor;
-
-        if (plot_->colorColumnColor(ind1.row(), ind1.parent(), indColor))
-          return plot_->interpColor(indColor, ColorInd());
-      }
-
-      return plot_->interpFillColor(plot_->groupColorInd(srcNode->group()));
-    }
-    else if (colorType == CQChartsPlot::ColorType::INDEX)
-      return plot_->interpFillColor(ColorInd(srcNode->id(), plot_->numNodes()));
-    else
-      return plot_->interpFillColor(colorInd);
-  };
-
-  auto nodesFillColor = [&](const AdjacencyNodeP &srcNode,
-                            const AdjacencyNodeP &destNode, bool &scaled) {
-    if  (srcNode == destNode)
-      return nodeFillColor(srcNode, destNode, scaled);
-    else {
-      return CQChartsUtil::blendColors(nodeFillColor(srcNode , destNode, scaled),
-                                       nodeFillColor(destNode, srcNode , scaled), 0.5);
-    }
-  };
-
-  //---
-
   // get stroke color for node
   auto nodeStrokeColor = [&](const AdjacencyNodeP &srcNode, const AdjacencyNodeP & /*destNode*/) {
     auto colorType = plot_->colorType();
@@ -1774,23 +2617,8 @@ calcPenBrush(PenBrush &penBrush, bool updateState) const
 
   //---
 
-  // get background color
-  auto bg = plot_->interpEmptyCellFillColor(ColorInd());
-
-  //--
-
   // calc brush color (scaled to value)
-  bool scaled = true;
-
-  auto bc = nodesFillColor(node1(), node2(), scaled);
-
-  if (scaled) {
-    if (node1() != node2()) {
-      double s = CMathUtil::map(value(), 0.0, plot_->maxValue(), 0.0, 1.0);
-
-      bc = CQChartsUtil::blendColors(bc, bg, s);
-    }
-  }
+  auto bc = plot_->calcCellFillColor(node1(), node2(), value(), colorInd);
 
   // calc pen color (not scaled)
   auto pc = nodesStrokeColor(node1(), node2());
@@ -1,4 +1,5 @@
 #include <CQChartsAnnotation.h>
+#include <CQChartsAnnotationTree.h>
 #include <CQChartsPlot.h>
 #include <CQChartsView.h>
 #include <CQChartsArrow.h>
@@ -328,6 +329,23 @@ setAnnotationBBox(const BBox &bbox)
 {
   annotationBBox_ = bbox;
   rect_           = bbox;
+
+  auto *tree = annotationTree();
+
+  if (tree)
+    tree->updateAnnotation(this);
+}
+
+CQChartsAnnotationTree *
+CQChartsAnnotation::
+annotationTree() const
+{
+  if      (plot())
+    return plot()->annotationTree();
+  else if (view())
+    return view()->annotationTree();
+
+  return nullptr;
 }
 
 //---
@@ -345,6 +363,12 @@ void
 CQChartsAnnotation::
 invalidate()
 {
+  // bbox unknown until redrawn
+  auto *tree = annotationTree();
+
+  if (tree)
+    tree->invalidateAnnotation(this);
+
   if      (plot()) {
     plot()->invalidateLayers ();
     plot()->invalidateOverlay();
@@ -361,6 +385,12 @@ void
 CQChartsAnnotation::
 emitDataChanged()
 {
+  // bbox unknown until redrawn (also when signals disabled for layout)
+  auto *tree = annotationTree();
+
+  if (tree)
+    tree->invalidateAnnotation(this);
+
   if (! isDisableSignals())
     emit dataChanged();
 }
@@ -387,6 +417,23 @@ getPaddingValues(double &xlp, double &xrp, double &ytp, double &ybp) const
   ybp = lengthParentHeight(padding().bottom());
 }
 
+bool
+CQChartsAnnotation::
+isParentUnits(const Units &units) const
+{
+  if (plot())
+    return (units == Units::PLOT);
+  else
+    return (units == Units::VIEW);
+}
+
+bool
+CQChartsAnnotation::
+isParentLength(const CQChartsLength &length) const
+{
+  return (! length.isSet() || isParentUnits(length.units()));
+}
+
 //---
 
 void
@@ -1927,6 +1974,13 @@ setSmoothed(bool b)
   CQChartsUtil::testAndSet(smoothed_, b, [&]() { invalidate(); } );
 }
 
+bool
+CQChartsPolyShapeAnnotationBase::
+isPixelMapped() const
+{
+  return (objRef().isValid() || ! isParentUnits(polygon().units()));
+}
+
 //--
 
 void
@@ -2087,6 +2141,19 @@ addProperties(PropertyModel *model, const QString &path, const QString &desc)
 
 //---
 
+bool
+CQChartsRectangleAnnotation::
+isPixelMapped() const
+{
+  if (objRef().isValid() || ! isParentUnits(rectangle().units()))
+    return true;
+
+  return (! isParentLength(margin().left ()) || ! isParentLength(margin().right ()) ||
+          ! isParentLength(margin().top  ()) || ! isParentLength(margin().bottom()));
+}
+
+//---
+
 void
 CQChartsRectangleAnnotation::
 setEditBBox(const BBox &bbox, const ResizeSide &)
@@ -2651,6 +2718,16 @@ calcBBox() const
   return BBox(c.x - xr, c.y - yr, c.x + xr, c.y + yr);
 }
 
+bool
+CQChartsEllipseAnnotation::
+isPixelMapped() const
+{
+  if (objRef().isValid() || ! isParentUnits(center().units()))
+    return true;
+
+  return (! isParentLength(xRadius()) || ! isParentLength(yRadius()));
+}
+
 //---
 
 void
@@ -7214,22 +7291,17 @@ drawDelaunay(PaintDevice *device)
   }
 
   // draw delaunay triangles
-  for (auto pf = delaunay_->facesBegin(); pf != delaunay_->facesEnd(); ++pf) {
-    const auto *f = *pf;
+  int nt = delaunay_->numTriangles();
 
-    if (! f->isLower()) continue;
+  for (int t = 0; t < nt; ++t) {
+    int i1, i2, i3;
 
-    auto *v1 = f->vertex(0);
-    auto *v2 = f->vertex(1);
-    auto *v3 = f->vertex(2);
-
-    Point p1(v1->x(), v1->y());
-    Point p2(v2->x(), v2->y());
-    Point p3(v3->x(), v3->y());
+    delaunay_->triangle(t, i1, i2, i3);
 
     QPainterPath path;
 
-    CQChartsDrawUtil::trianglePath(path, p1, p2, p3);
+    CQChartsDrawUtil::trianglePath(path, delaunay_->vertex(i1),
+                                   delaunay_->vertex(i2), delaunay_->vertex(i3));
 
     device->strokePath(path, device->pen());
   }
@@ -7289,11 +7361,18 @@ void
 CQChartsPoint3DSetAnnotation::
 updateValues()
 {
+  xvals_.clear();
+  yvals_.clear();
+  zvals_.clear();
+
   for (auto &p : points_) {
     xvals_.addValue(p.x);
     yvals_.addValue(p.y);
     zvals_.addValue(p.z);
   }
+
+  // contour geometry is recalculated from new values on next draw
+  contour_.reset();
 }
 
 //---
@@ -7396,14 +7475,15 @@ initContour() const
   for (uint iy = 0; iy < ny; ++iy)
     y[iy] = yvals_.ivalue(int(iy));
 
+  // missing grid values are skipped by contour
   for (uint iz = 0; iz < nz; ++iz)
-    CMathUtil::isNaN(z[iz]);
+    z[iz] = CMathUtil::getNaN();
 
   for (const auto &p : points_) {
     uint ix = uint(xvals_.id(p.x));
     uint iy = uint(yvals_.id(p.y));
 
-    z[iy*nx + ix] = p.z;
+    z[ix*ny + iy] = p.z;
   }
 
   auto *th = const_cast<CQChartsPoint3DSetAnnotation *>(this);
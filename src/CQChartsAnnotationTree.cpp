@@ -0,0 +1,268 @@
+#include <CQChartsAnnotationTree.h>
+#include <CQChartsAnnotation.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+bool isIndexBBox(const CQChartsGeom::BBox &bbox) {
+  if (! bbox.isSet())
+    return false;
+
+  return (std::isfinite(bbox.getXMin()) && std::isfinite(bbox.getYMin()) &&
+          std::isfinite(bbox.getXMax()) && std::isfinite(bbox.getYMax()));
+}
+
+}
+
+//---
+
+CQChartsAnnotationTree::
+CQChartsAnnotationTree()
+{
+}
+
+CQChartsAnnotationTree::
+~CQChartsAnnotationTree()
+{
+  clear();
+}
+
+void
+CQChartsAnnotationTree::
+addAnnotation(Annotation *annotation)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (entries_.find(annotation) != entries_.end())
+    return;
+
+  auto *entry = new Entry;
+
+  entry->annotation = annotation;
+  entry->pos        = pos_++;
+
+  entries_[annotation] = entry;
+
+  unindexed_.insert(entry);
+}
+
+void
+CQChartsAnnotationTree::
+removeAnnotation(Annotation *annotation)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto p = entries_.find(annotation);
+  if (p == entries_.end()) return;
+
+  auto *entry = (*p).second;
+
+  unindexEntry(entry);
+
+  unindexed_.erase(entry);
+
+  entries_.erase(p);
+
+  delete entry;
+}
+
+void
+CQChartsAnnotationTree::
+clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  tree_.reset();
+
+  unindexed_.clear();
+
+  for (auto &pe : entries_)
+    delete pe.second;
+
+  entries_.clear();
+
+  pos_ = 0;
+}
+
+void
+CQChartsAnnotationTree::
+setOrder(const Annotations &annotations)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  pos_ = 0;
+
+  for (auto *annotation : annotations) {
+    auto p = entries_.find(annotation);
+    if (p == entries_.end()) continue;
+
+    (*p).second->pos = pos_++;
+  }
+}
+
+void
+CQChartsAnnotationTree::
+updateAnnotation(Annotation *annotation)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto p = entries_.find(annotation);
+  if (p == entries_.end()) return;
+
+  auto *entry = (*p).second;
+
+  const auto &bbox = annotation->annotationBBox();
+
+  if (entry->indexed && entry->bbox == bbox)
+    return;
+
+  unindexEntry(entry);
+
+  if (isIndexBBox(bbox)) {
+    entry->bbox        = bbox;
+    entry->indexed     = true;
+    entry->pixelMapped = annotation->isPixelMapped();
+
+    tree_.add(entry);
+
+    unindexed_.erase(entry);
+  }
+}
+
+void
+CQChartsAnnotationTree::
+invalidateAnnotation(Annotation *annotation)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto p = entries_.find(annotation);
+  if (p == entries_.end()) return;
+
+  unindexEntry((*p).second);
+}
+
+void
+CQChartsAnnotationTree::
+invalidate()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  unindexEntries();
+}
+
+void
+CQChartsAnnotationTree::
+checkMapping(const BBox &mapping)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (mapping == mapping_)
+    return;
+
+  mapping_ = mapping;
+
+  // only pixel sized or positioned annotations move in parent coords
+  for (auto &pe : entries_) {
+    auto *entry = pe.second;
+
+    if (entry->indexed && entry->pixelMapped)
+      unindexEntry(entry);
+  }
+}
+
+void
+CQChartsAnnotationTree::
+annotationsTouchingRect(const BBox &rect, Annotations &annotations) const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  EntryList entries;
+
+  if (! rect.isSet()) {
+    for (auto &pe : entries_)
+      entries.push_back(pe.second);
+  }
+  else {
+    if (entries_.size() > unindexed_.size() && isIndexBBox(rect)) {
+      Tree::DataList dataList;
+
+      tree_.dataTouchingRect(rect, dataList);
+
+      for (auto *entry : dataList)
+        entries.push_back(entry);
+    }
+
+    for (auto *entry : unindexed_)
+      entries.push_back(entry);
+  }
+
+  entryAnnotations(entries, annotations);
+}
+
+void
+CQChartsAnnotationTree::
+annotationsAtPoint(const Point &p, double dx, double dy, Annotations &annotations) const
+{
+  annotationsTouchingRect(BBox(p.x - dx, p.y - dy, p.x + dx, p.y + dy), annotations);
+}
+
+int
+CQChartsAnnotationTree::
+numIndexed() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  return int(entries_.size() - unindexed_.size());
+}
+
+int
+CQChartsAnnotationTree::
+numUnindexed() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  return int(unindexed_.size());
+}
+
+void
+CQChartsAnnotationTree::
+unindexEntry(Entry *entry)
+{
+  if (entry->indexed) {
+    tree_.remove(entry);
+
+    entry->indexed = false;
+  }
+
+  unindexed_.insert(entry);
+}
+
+void
+CQChartsAnnotationTree::
+unindexEntries()
+{
+  tree_.reset();
+
+  for (auto &pe : entries_) {
+    auto *entry = pe.second;
+
+    entry->indexed = false;
+
+    unindexed_.insert(entry);
+  }
+}
+
+void
+CQChartsAnnotationTree::
+entryAnnotations(EntryList &entries, Annotations &annotations) const
+{
+  // return in draw order (list order)
+  std::sort(entries.begin(), entries.end(), [](const Entry *lhs, const Entry *rhs) {
+    return lhs->pos < rhs->pos;
+  });
+
+  for (auto *entry : entries)
+    annotations.push_back(entry->annotation);
+}
@@ -9,6 +9,7 @@
 #include <CQChartsDrawUtil.h>
 #include <CQChartsRotatedText.h>
 #include <CQChartsViewPlotPaintDevice.h>
+#include <CQChartsTextCache.h>
 
 #include <CQPropertyViewModel.h>
 #include <CQPropertyViewItem.h>
@@ -2054,7 +2055,7 @@ drawTickLabel(const Plot *plot, PaintDevice *device,
   auto clipLength = lengthPixelWidth(plot, device, axesTickLabelTextClipLength());
   auto clipElide  = axesTickLabelTextClipElide();
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   auto text1 = CQChartsDrawUtil::clipTextToLength(text, device->font(), clipLength, clipElide);
 
@@ -2683,7 +2684,7 @@ drawAxisLabel(const Plot *plot, PaintDevice *device, double apos,
   auto clipLength = lengthPixelWidth(plot, device, axesLabelTextClipLength());
   auto clipElide  = axesLabelTextClipElide();
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   auto text1 = CQChartsDrawUtil::clipTextToLength(text, device->font(), clipLength, clipElide);
 
@@ -0,0 +1,240 @@
+#include <CQChartsBatchPrint.h>
+#include <CQChartsView.h>
+#include <CQChartsPlot.h>
+#include <CQChartsParallel.h>
+
+#include <CQPerfMonitor.h>
+
+#include <QImage>
+
+#include <chrono>
+#include <map>
+#include <set>
+
+namespace {
+
+using Clock     = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+double elapsedMs(const TimePoint &t) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+}
+
+}
+
+//---
+
+CQChartsBatchPrint::
+CQChartsBatchPrint()
+{
+}
+
+void
+CQChartsBatchPrint::
+addJob(const Job &job)
+{
+  auto job1 = job;
+
+  if (job1.plot && ! job1.view)
+    job1.view = job1.plot->view();
+
+  jobs_.push_back(job1);
+}
+
+bool
+CQChartsBatchPrint::
+exec()
+{
+  CQPerfTrace trace("CQChartsBatchPrint::exec");
+
+  stats_ = Stats();
+
+  auto startTime = Clock::now();
+
+  //---
+
+  // group jobs by view and size (in order of first use)
+  using GroupKey  = std::pair<View *, std::pair<int, int>>;
+  using JobInds   = std::vector<int>;
+  using GroupInds = std::map<GroupKey, int>;
+  using Groups    = std::vector<JobInds>;
+
+  GroupInds groupInds;
+  Groups    groups;
+
+  int nj = int(jobs_.size());
+
+  for (int i = 0; i < nj; ++i) {
+    const auto &job = jobs_[size_t(i)];
+
+    GroupKey key(job.view, std::make_pair(job.size.width(), job.size.height()));
+
+    auto pg = groupInds.find(key);
+
+    if (pg == groupInds.end()) {
+      pg = groupInds.insert(pg, GroupInds::value_type(key, int(groups.size())));
+
+      groups.push_back(JobInds());
+    }
+
+    groups[size_t((*pg).second)].push_back(i);
+  }
+
+  //---
+
+  for (const auto &jobInds : groups) {
+    int n = int(jobInds.size());
+
+    const auto &job0 = jobs_[size_t(jobInds[0])];
+
+    auto *view = job0.view;
+
+    if (! view) {
+      stats_.numFailed += n;
+      continue;
+    }
+
+    //---
+
+    // resize view to job size
+    auto layoutTime = Clock::now();
+
+    bool autoSize  = view->isAutoSize();
+    auto fixedSize = view->fixedSize();
+    bool resized   = false;
+
+    if (job0.size.isValid()) {
+      auto prect = view->prect();
+
+      if (job0.size.width () != int(prect.getWidth ()) ||
+          job0.size.height() != int(prect.getHeight())) {
+        view->setAutoSize(false);
+        view->setFixedSize(job0.size);
+
+        resized = true;
+      }
+    }
+
+    auto prect = view->prect();
+
+    QSize viewSize(int(prect.getWidth()), int(prect.getHeight()));
+
+    // wait for plots to be laid out and drawn (plots draw in parallel on their draw threads)
+    std::set<Plot *> plots;
+
+    for (const auto &i : jobInds) {
+      const auto &job = jobs_[size_t(i)];
+
+      if (job.plot)
+        plots.insert(job.plot);
+      else {
+        for (const auto &plot : view->plots())
+          plots.insert(plot);
+      }
+    }
+
+    for (auto *plot : plots)
+      plot->syncAll();
+
+    stats_.layoutTime += elapsedMs(layoutTime);
+
+    //---
+
+    // composite images from plot buffers and write vector formats
+    auto renderTime = Clock::now();
+
+    std::vector<QImage>     images (size_t(n));
+    std::vector<QByteArray> formats(size_t(n));
+    std::vector<int>        rcs    (size_t(n), 0);
+
+    for (int j = 0; j < n; ++j) {
+      const auto &job = jobs_[size_t(jobInds[size_t(j)])];
+
+      auto format = jobFormat(job);
+
+      if (isVectorFormat(format)) {
+        bool rc;
+
+        if (format == "svg")
+          rc = view->printSVG(job.filename, job.plot);
+        else
+          rc = view->writeScript(job.filename, job.plot);
+
+        rcs[size_t(j)] = (rc ? 1 : -1);
+
+        continue;
+      }
+
+      images [size_t(j)] = view->renderImage(viewSize, job.plot);
+      formats[size_t(j)] = format.toLatin1();
+
+      if (images[size_t(j)].isNull())
+        rcs[size_t(j)] = -1;
+    }
+
+    stats_.renderTime += elapsedMs(renderTime);
+
+    //---
+
+    // encode and write images in parallel
+    auto writeTime = Clock::now();
+
+    CQChartsParallel::forEach(n, [&](int j) {
+      if (rcs[size_t(j)] != 0)
+        return;
+
+      const auto &job = jobs_[size_t(jobInds[size_t(j)])];
+
+      bool rc = images[size_t(j)].save(job.filename, formats[size_t(j)].constData());
+
+      rcs[size_t(j)] = (rc ? 1 : -1);
+
+      images[size_t(j)] = QImage();
+    });
+
+    stats_.writeTime += elapsedMs(writeTime);
+
+    for (const auto &rc : rcs) {
+      if (rc > 0)
+        ++stats_.numImages;
+      else
+        ++stats_.numFailed;
+    }
+
+    //---
+
+    // restore view size
+    if (resized) {
+      if (autoSize)
+        view->setAutoSize(true);
+      else
+        view->setFixedSize(fixedSize);
+    }
+  }
+
+  stats_.totalTime = elapsedMs(startTime);
+
+  return (stats_.numFailed == 0);
+}
+
+QString
+CQChartsBatchPrint::
+jobFormat(const Job &job)
+{
+  if (job.format.length())
+    return job.format.toLower();
+
+  auto p = job.filename.lastIndexOf(".");
+
+  if (p > 0)
+    return job.filename.mid(p + 1).toLower();
+
+  return "png";
+}
+
+bool
+CQChartsBatchPrint::
+isVectorFormat(const QString &format)
+{
+  return (format == "svg" || format == "js");
+}
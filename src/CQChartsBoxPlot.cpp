@@ -459,6 +459,29 @@ setWhiskerExtent(double r)
   CQChartsUtil::testAndSet(whiskerExtent_, r, [&]() { drawObjs(); } );
 }
 
+//---
+
+void
+CQChartsBoxPlot::
+setApproximate(bool b)
+{
+  CQChartsUtil::testAndSet(approximateData_.enabled, b, [&]() { updateRangeAndObjs(); } );
+}
+
+void
+CQChartsBoxPlot::
+setApproximateError(double r)
+{
+  CQChartsUtil::testAndSet(approximateData_.error, r, [&]() { updateRangeAndObjs(); } );
+}
+
+void
+CQChartsBoxPlot::
+setApproximateTailSize(int n)
+{
+  CQChartsUtil::testAndSet(approximateData_.tailSize, n, [&]() { updateRangeAndObjs(); } );
+}
+
 //------
 
 void
@@ -536,6 +559,14 @@ addProperties()
   addProp("box", "boxWidth"    , "width"  , "Box width");
   addProp("box", "notched"     , "notched", "Box notched at median");
 
+  // approximate
+  addProp("approximate", "approximate"        , "enabled" ,
+          "Calculate whisker from quantile sketch (fixed memory)");
+  addProp("approximate", "approximateError"   , "error"   ,
+          "Quantile sketch normalized rank error")->setMinValue(0.0001).setMaxValue(0.5);
+  addProp("approximate", "approximateTailSize", "tailSize",
+          "Number of smallest/largest values kept for outliers")->setMinValue(1);
+
   // whisker box fill
   addProp("box/fill", "boxFilled", "visible", "Box fill visible");
 
@@ -567,6 +598,13 @@ addProperties()
 
   addSymbolProperties("outlier/symbol", "outlier", "Outlier");
 
+  // box, whisker and point style only drawn by objects
+  declareObjFillStages  ("boxFill");
+  declareObjStrokeStages("boxStroke");
+  declareObjStrokeStages("whiskerLines");
+  declareObjSymbolStages("outlier");
+  declareObjSymbolStages("jitter");
+
   // coloring
   addProp("coloring", "colorBySet", "", "Color by value set");
 
@@ -1467,6 +1505,9 @@ addRawWhiskerRow(const ModelVisitor::VisitData &vdata) const
       if (ps1 == setWhiskerMap1.end()) {
         auto *whisker = new Whisker;
 
+        if (isApproximate())
+          whisker->setApproximate(true, approximateError(), approximateTailSize());
+
         whisker->setRange(whiskerRange());
 
         QString name;
@@ -2439,6 +2480,9 @@ calcTipId() const
   if (name.length())
     tableTip.addTableRow("Name", name);
 
+  if (whisker_ && whisker_->isApproximate())
+    tableTip.addTableRow("Count", QString::number(whisker_->count()));
+
   if (plot_->isErrorBar()) {
     tableTip.addTableRow("Mean"  , mean  ());
     tableTip.addTableRow("StdDev", stddev());
@@ -62,6 +62,9 @@ CQChartsBuffer::
   delete image_;
   delete pixmap_;
 
+  delete frontImage_;
+  delete frontPixmap_;
+
 #ifdef CQCHARTS_OPENGL
   delete glBuffer_;
   delete glDevice_;
@@ -91,7 +94,7 @@ beginPaint(QPainter *painter, const QRectF &rect, bool alias)
 
   //---
 
-  clear();
+  clearBack();
 
   if      (bufferType() == BufferType::PIXMAP) {
     assert(pixmap_);
@@ -144,14 +147,20 @@ endPaint(bool draw)
     if (bufferType() == BufferType::OPENGL) {
       glBuffer_->release();
 
+      if (! image_)
+        image_ = CQChartsUtil::newImage(size_);
+
       *image_ = glBuffer_->toImage();
     }
 #endif
 
+    // make painted buffer the completed buffer
+    swapBuffers();
+
     setValid(true);
   }
 
-  if (draw)
+  if (draw && painter_)
     this->draw(painter_);
 
   painter_ = nullptr;
@@ -160,6 +169,21 @@ endPaint(bool draw)
 void
 CQChartsBuffer::
 clear()
+{
+  clearBack();
+
+  std::unique_lock<std::mutex> lock(frontMutex_);
+
+  if (frontPixmap_)
+    frontPixmap_->fill(Qt::transparent);
+
+  if (frontImage_)
+    frontImage_->fill(Qt::transparent);
+}
+
+void
+CQChartsBuffer::
+clearBack()
 {
   if      (bufferType() == BufferType::PIXMAP) {
     if (pixmap_)
@@ -177,34 +201,49 @@ clear()
   }
 }
 
+void
+CQChartsBuffer::
+swapBuffers()
+{
+  std::unique_lock<std::mutex> lock(frontMutex_);
+
+  std::swap(image_ , frontImage_ );
+  std::swap(pixmap_, frontPixmap_);
+
+  frontRect_ = rect_;
+}
+
 void
 CQChartsBuffer::
 draw(QPainter *painter)
 {
-  draw(painter, int(rect_.x()), int(rect_.y()));
+  std::unique_lock<std::mutex> lock(frontMutex_);
+
+  drawFront(painter, int(frontRect_.x()), int(frontRect_.y()));
 }
 
 void
 CQChartsBuffer::
 draw(QPainter *painter, int x, int y)
 {
-//std::cerr << "draw: " << typeName(type_) << "\n";
-  if      (bufferType() == BufferType::PIXMAP) {
-    assert(pixmap_);
+  std::unique_lock<std::mutex> lock(frontMutex_);
 
-    painter->drawPixmap(x, y, *pixmap_);
-  }
-#ifdef CQCHARTS_OPENGL
-  else if (bufferType() == BufferType::OPENGL) {
-    assert(glBuffer_);
+  drawFront(painter, x, y);
+}
 
-    painter->drawImage(x, y, *image_);
+void
+CQChartsBuffer::
+drawFront(QPainter *painter, int x, int y)
+{
+//std::cerr << "draw: " << typeName(type_) << "\n";
+  // nothing completed yet
+  if      (bufferType() == BufferType::PIXMAP) {
+    if (frontPixmap_)
+      painter->drawPixmap(x, y, *frontPixmap_);
   }
-#endif
-  else if (bufferType() == BufferType::IMAGE) {
-    assert(image_);
-
-    painter->drawImage(x, y, *image_);
+  else {
+    if (frontImage_)
+      painter->drawImage(x, y, *frontImage_);
   }
 }
 
@@ -228,8 +267,9 @@ updateSize()
 
   bool hasDrawable = false;
 
+  // (back buffer may be previous front buffer of different size)
   if      (bufferType() == BufferType::PIXMAP) {
-    hasDrawable = (pixmap_ != nullptr);
+    hasDrawable = (pixmap_ && pixmap_->size() == size);
   }
 #ifdef CQCHARTS_OPENGL
   else if (bufferType() == BufferType::OPENGL) {
@@ -240,7 +280,7 @@ updateSize()
   }
 #endif
   else if (bufferType() == BufferType::IMAGE) {
-    hasDrawable = (image_ != nullptr);
+    hasDrawable = (image_ && image_->size() == size);
   }
 
   if (! hasDrawable || size_ != size) {
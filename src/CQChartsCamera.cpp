@@ -1,5 +1,6 @@
 #include <CQChartsCamera.h>
 #include <CQChartsPlot3D.h>
+#include <CQChartsParallel.h>
 
 CQChartsCamera::
 CQChartsCamera(CQChartsPlot3D *plot) :
@@ -213,6 +214,45 @@ untransform(const Point3D &p) const
   return Point3D(x, y, z);
 }
 
+void
+CQChartsCamera::
+transformMatrix(double m[12]) const
+{
+  // range map, coord frame and ortho projection are all affine so the transform is
+  // defined by the transformed origin and unit axis points
+  auto p0 = transform(Point3D(0.0, 0.0, 0.0));
+  auto px = transform(Point3D(1.0, 0.0, 0.0));
+  auto py = transform(Point3D(0.0, 1.0, 0.0));
+  auto pz = transform(Point3D(0.0, 0.0, 1.0));
+
+  m[ 0] = px.x - p0.x; m[ 1] = py.x - p0.x; m[ 2] = pz.x - p0.x; m[ 3] = p0.x;
+  m[ 4] = px.y - p0.y; m[ 5] = py.y - p0.y; m[ 6] = pz.y - p0.y; m[ 7] = p0.y;
+  m[ 8] = px.z - p0.z; m[ 9] = py.z - p0.z; m[10] = pz.z - p0.z; m[11] = p0.z;
+}
+
+void
+CQChartsCamera::
+transformPoints(const double *xs, const double *ys, const double *zs, int n,
+                double *txs, double *tys, double *tzs) const
+{
+  double m[12];
+
+  transformMatrix(m);
+
+  // straight line loop over arrays (vectorized by the compiler)
+  auto transformChunk = [&](int i1, int i2) {
+    for (int i = i1; i < i2; ++i) {
+      double x = xs[i], y = ys[i], z = zs[i];
+
+      txs[i] = m[0]*x + m[1]*y + m[ 2]*z + m[ 3];
+      tys[i] = m[4]*x + m[5]*y + m[ 6]*z + m[ 7];
+      tzs[i] = m[8]*x + m[9]*y + m[10]*z + m[11];
+    }
+  };
+
+  CQChartsParallel::forChunks(n, transformChunk, /*minChunk*/16384);
+}
+
 void
 CQChartsCamera::
 planeZRange(double &zmin, double &zmax) const
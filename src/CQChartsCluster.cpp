@@ -0,0 +1,488 @@
+#include <CQChartsCluster.h>
+#include <CQChartsParallel.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+CQChartsCluster::
+CQChartsCluster()
+{
+}
+
+void
+CQChartsCluster::
+setValues(int numRows, int numCols, const Reals &values)
+{
+  nr_ = std::max(numRows, 0);
+  nc_ = std::max(numCols, 0);
+
+  values_ = values;
+
+  values_.resize(size_t(nr_)*size_t(nc_));
+
+  merges_.clear();
+}
+
+bool
+CQChartsCluster::
+calc()
+{
+  errorMsg_.clear();
+
+  merges_.clear();
+
+  dists_.clear();
+
+  if (nr_ <= 0 || nc_ <= 0) {
+    errorMsg_ = "No values";
+    return false;
+  }
+
+  normalizeValues();
+
+  //---
+
+  // use matrix if fits in memory, otherwise ward can be calculated from centroids
+  auto n = size_t(nr_);
+
+  size_t matrixSize = (n*(n - 1)/2)*sizeof(float);
+
+  memoryBounded_ = (matrixSize > maxMemory_);
+
+  if (memoryBounded_ && linkage_ != Linkage::WARD) {
+    errorMsg_ = "Distance matrix (" + std::to_string(matrixSize/(1024*1024)) +
+                "MB) exceeds max memory (only ward linkage supported)";
+    return false;
+  }
+
+  //---
+
+  Merges merges;
+
+  if (nr_ > 1) {
+    if (! memoryBounded_) {
+      calcDistances();
+
+      nnChainMatrix(merges);
+
+      Dists().swap(dists_);
+    }
+    else
+      nnChainWard(merges);
+  }
+
+  labelMerges(merges);
+
+  merges_ = std::move(merges);
+
+  return true;
+}
+
+void
+CQChartsCluster::
+normalizeValues()
+{
+  // replace missing (NaN) values with column mean and optionally scale to unit stddev
+  CQChartsParallel::forEach(nc_, [&](int ic) {
+    auto nc = size_t(nc_);
+
+    double sum  = 0.0;
+    double sum2 = 0.0;
+    int    n    = 0;
+
+    for (size_t ir = 0; ir < size_t(nr_); ++ir) {
+      double v = values_[ir*nc + size_t(ic)];
+
+      if (std::isnan(v)) continue;
+
+      sum  += v;
+      sum2 += v*v;
+
+      ++n;
+    }
+
+    double mean   = (n > 0 ? sum/n : 0.0);
+    double stddev = (n > 1 ? std::sqrt(std::max((sum2 - n*mean*mean)/(n - 1), 0.0)) : 0.0);
+
+    for (size_t ir = 0; ir < size_t(nr_); ++ir) {
+      auto &v = values_[ir*nc + size_t(ic)];
+
+      if (std::isnan(v))
+        v = mean;
+
+      if (normalize_)
+        v = (stddev > 0.0 ? (v - mean)/stddev : 0.0);
+    }
+  });
+}
+
+void
+CQChartsCluster::
+calcDistances()
+{
+  auto n  = size_t(nr_);
+  auto nc = size_t(nc_);
+
+  dists_.resize(n*(n - 1)/2);
+
+  // row i has n - i - 1 distances so process rows i and n - i - 1 together to
+  // balance work between threads
+  auto calcRow = [&](size_t i) {
+    const double *vi = &values_[i*nc];
+
+    float *d = &dists_[condensedInd(int(i), int(i + 1))];
+
+    for (size_t j = i + 1; j < n; ++j) {
+      const double *vj = &values_[j*nc];
+
+      // independent partial sums (vectorizable)
+      double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+      size_t k = 0;
+
+      for ( ; k + 4 <= nc; k += 4) {
+        double d0 = vi[k    ] - vj[k    ];
+        double d1 = vi[k + 1] - vj[k + 1];
+        double d2 = vi[k + 2] - vj[k + 2];
+        double d3 = vi[k + 3] - vj[k + 3];
+
+        s0 += d0*d0; s1 += d1*d1; s2 += d2*d2; s3 += d3*d3;
+      }
+
+      for ( ; k < nc; ++k) {
+        double d0 = vi[k] - vj[k];
+
+        s0 += d0*d0;
+      }
+
+      *d++ = float(std::sqrt((s0 + s1) + (s2 + s3)));
+    }
+  };
+
+  int np = int((n + 1)/2);
+
+  CQChartsParallel::forEach(np, [&](int k) {
+    auto i1 = size_t(k);
+    auto i2 = n - size_t(k) - 1;
+
+    if (i1 + 1 < n)
+      calcRow(i1);
+
+    if (i2 != i1 && i2 + 1 < n)
+      calcRow(i2);
+  }, 16);
+}
+
+// distance from new cluster (x + y) to cluster i from distances to x and y
+double
+CQChartsCluster::
+updateDist(double dxi, double dyi, double dxy, int nx, int ny, int ni) const
+{
+  switch (linkage_) {
+    case Linkage::WARD: {
+      double t = 1.0/(nx + ny + ni);
+
+      return std::sqrt(std::max((ni + nx)*t*dxi*dxi + (ni + ny)*t*dyi*dyi - ni*t*dxy*dxy, 0.0));
+    }
+    case Linkage::AVERAGE:
+      return (nx*dxi + ny*dyi)/(nx + ny);
+    case Linkage::COMPLETE:
+      return std::max(dxi, dyi);
+    case Linkage::SINGLE:
+    default:
+      return std::min(dxi, dyi);
+  }
+}
+
+// nearest neighbor chain using condensed distance matrix
+void
+CQChartsCluster::
+nnChainMatrix(Merges &merges)
+{
+  int n = nr_;
+
+  auto nn = size_t(n);
+
+  Inds sizes (nn, 1);
+  Inds active(nn);
+
+  std::iota(active.begin(), active.end(), 0);
+
+  Inds chain;
+
+  chain.reserve(nn);
+
+  for (int k = 0; k < n - 1; ++k) {
+    if (chain.empty())
+      chain.push_back(active[0]);
+
+    int    x = -1, y = -1;
+    double minDist = 0.0;
+
+    while (true) {
+      x = chain.back();
+
+      if (chain.size() > 1) {
+        y       = chain[chain.size() - 2];
+        minDist = dists_[condensedInd(x, y)];
+      }
+      else {
+        y       = -1;
+        minDist = std::numeric_limits<double>::max();
+      }
+
+      for (auto i : active) {
+        if (i == x) continue;
+
+        double d = dists_[condensedInd(x, i)];
+
+        if (d < minDist) {
+          minDist = d;
+          y       = i;
+        }
+      }
+
+      if (chain.size() > 1 && y == chain[chain.size() - 2])
+        break;
+
+      chain.push_back(y);
+    }
+
+    chain.pop_back();
+    chain.pop_back();
+
+    if (x > y) std::swap(x, y);
+
+    int nx = sizes[size_t(x)];
+    int ny = sizes[size_t(y)];
+
+    merges.emplace_back(x, y, minDist, nx + ny);
+
+    // merged cluster stored in y
+    sizes[size_t(x)] = 0;
+    sizes[size_t(y)] = nx + ny;
+
+    active.erase(std::find(active.begin(), active.end(), x));
+
+    for (auto i : active) {
+      if (i == y) continue;
+
+      auto iy = condensedInd(i, y);
+
+      double dxi = dists_[condensedInd(i, x)];
+      double dyi = dists_[iy];
+
+      dists_[iy] = float(updateDist(dxi, dyi, minDist, nx, ny, sizes[size_t(i)]));
+    }
+  }
+}
+
+// nearest neighbor chain for ward linkage using cluster centroids (no matrix)
+void
+CQChartsCluster::
+nnChainWard(Merges &merges)
+{
+  int  n  = nr_;
+  auto nc = size_t(nc_);
+
+  Reals centroids = values_;
+
+  auto nn = size_t(n);
+
+  Inds sizes (nn, 1);
+  Inds active(nn);
+
+  std::iota(active.begin(), active.end(), 0);
+
+  auto wardDist = [&](int x, int i) {
+    const double *cx = &centroids[size_t(x)*nc];
+    const double *ci = &centroids[size_t(i)*nc];
+
+    double s = 0.0;
+
+    for (size_t k = 0; k < nc; ++k) {
+      double d = cx[k] - ci[k];
+
+      s += d*d;
+    }
+
+    double nx = sizes[size_t(x)];
+    double ni = sizes[size_t(i)];
+
+    return std::sqrt(2.0*nx*ni/(nx + ni)*s);
+  };
+
+  // nearest active cluster to x (first in active order if equal)
+  struct Nearest {
+    double dist { std::numeric_limits<double>::max() };
+    int    ind  { -1 };
+  };
+
+  std::vector<Nearest> chunkNearest;
+
+  auto nearest = [&](int x) {
+    int na = int(active.size());
+
+    auto findNearest = [&](int i1, int i2, Nearest &nearest) {
+      for (int i = i1; i < i2; ++i) {
+        int ai = active[size_t(i)];
+        if (ai == x) continue;
+
+        double d = wardDist(x, ai);
+
+        if (d < nearest.dist) {
+          nearest.dist = d;
+          nearest.ind  = ai;
+        }
+      }
+    };
+
+    Nearest nearest;
+
+    // only use threads when enough work per scan
+    int minChunk = std::max(int(65536/std::max(nc, size_t(1))), 1024);
+
+    int nchunks = CQChartsParallel::numChunks(na, minChunk);
+
+    if (nchunks <= 1) {
+      findNearest(0, na, nearest);
+    }
+    else {
+      chunkNearest.assign(size_t(nchunks), Nearest());
+
+      CQChartsParallel::forChunkInds(na, [&](int ic, int i1, int i2) {
+        findNearest(i1, i2, chunkNearest[size_t(ic)]);
+      }, minChunk);
+
+      for (const auto &cn : chunkNearest) {
+        if (cn.dist < nearest.dist)
+          nearest = cn;
+      }
+    }
+
+    return nearest;
+  };
+
+  Inds chain;
+
+  chain.reserve(nn);
+
+  for (int k = 0; k < n - 1; ++k) {
+    if (chain.empty())
+      chain.push_back(active[0]);
+
+    int    x = -1, y = -1;
+    double minDist = 0.0;
+
+    while (true) {
+      x = chain.back();
+
+      auto nx = nearest(x);
+
+      if (chain.size() > 1) {
+        y       = chain[chain.size() - 2];
+        minDist = wardDist(x, y);
+
+        // prefer previous chain element if equal
+        if (nx.dist < minDist) {
+          minDist = nx.dist;
+          y       = nx.ind;
+        }
+      }
+      else {
+        minDist = nx.dist;
+        y       = nx.ind;
+      }
+
+      if (chain.size() > 1 && y == chain[chain.size() - 2])
+        break;
+
+      chain.push_back(y);
+    }
+
+    chain.pop_back();
+    chain.pop_back();
+
+    if (x > y) std::swap(x, y);
+
+    int nx = sizes[size_t(x)];
+    int ny = sizes[size_t(y)];
+
+    merges.emplace_back(x, y, minDist, nx + ny);
+
+    // merged cluster (size weighted centroid) stored in y
+    double *cx = &centroids[size_t(x)*nc];
+    double *cy = &centroids[size_t(y)*nc];
+
+    for (size_t i = 0; i < nc; ++i)
+      cy[i] = (nx*cx[i] + ny*cy[i])/(nx + ny);
+
+    sizes[size_t(x)] = 0;
+    sizes[size_t(y)] = nx + ny;
+
+    active.erase(std::find(active.begin(), active.end(), x));
+  }
+}
+
+// sort merges by height and convert row slots to cluster ids
+void
+CQChartsCluster::
+labelMerges(Merges &merges)
+{
+  std::stable_sort(merges.begin(), merges.end(), [](const Merge &lhs, const Merge &rhs) {
+    return lhs.height < rhs.height;
+  });
+
+  int n = nr_;
+
+  Inds parent(size_t(2*n - 1 > 0 ? 2*n - 1 : 0));
+
+  std::iota(parent.begin(), parent.end(), 0);
+
+  auto findRoot = [&](int i) {
+    int r = i;
+
+    while (parent[size_t(r)] != r)
+      r = parent[size_t(r)];
+
+    // path compression
+    while (parent[size_t(i)] != r) {
+      int p = parent[size_t(i)];
+
+      parent[size_t(i)] = r;
+
+      i = p;
+    }
+
+    return r;
+  };
+
+  int id = n;
+
+  for (auto &merge : merges) {
+    int r1 = findRoot(merge.id1);
+    int r2 = findRoot(merge.id2);
+
+    parent[size_t(r1)] = id;
+    parent[size_t(r2)] = id;
+
+    merge.id1 = std::min(r1, r2);
+    merge.id2 = std::max(r1, r2);
+
+    ++id;
+  }
+}
+
+bool
+CQChartsCluster::
+stringToLinkage(const std::string &str, Linkage &linkage)
+{
+  if      (str == "ward"    ) linkage = Linkage::WARD;
+  else if (str == "average" ) linkage = Linkage::AVERAGE;
+  else if (str == "complete") linkage = Linkage::COMPLETE;
+  else if (str == "single"  ) linkage = Linkage::SINGLE;
+  else return false;
+
+  return true;
+}
@@ -3,21 +3,7 @@
 #include <CQChartsPlot.h>
 #include <QPainter>
 
-static int contourFlags[] = {
-  0, 4, // bottom edge to diagonals
-  0, 5,
-  1, 6, // top edge to diagonals
-  1, 7,
-  2, 4, // left edge to diagonals
-  2, 6,
-  3, 5, // right edge to diagonals
-  3, 7,
-
-  4, 5, // diagonal to diagonal
-  4, 6,
-  5, 7,
-  6, 7,
-};
+#include <algorithm>
 
 #if 0
 // TODO: move to palette
@@ -52,9 +38,6 @@ CQChartsContour::
 CQChartsContour(CQChartsPlot *plot) :
  plot_(plot)
 {
-  minX_ = 1E-6;
-  minY_ = 1E-6;
-
 #if 0
   colors_ = ColorArray(&contourColors[0], &contourColors[20]);
 #endif
@@ -64,43 +47,57 @@ void
 CQChartsContour::
 setData(double *x, double *y, double *z, int numX, int numY)
 {
-  // populate x and calc min/max
-  x_.resize(size_t(numX));
+  RealArray xa(size_t(numX)), ya(size_t(numY)), za(size_t(numX*numY));
 
+  // populate x and calc min/max
   xmin_ = x[0]; xmax_ = xmin_;
 
   for (uint i = 0; i < uint(numX); i++) {
-    x_[i] = x[i];
+    xa[i] = x[i];
 
     xmin_ = std::min(xmin_, x[i]);
     xmax_ = std::max(xmax_, x[i]);
   }
 
   // populate y and calc min/max
-  y_.resize(size_t(numY));
-
   ymin_ = y[0]; ymax_ = ymin_;
 
   for (uint i = 0; i < uint(numY); i++) {
-    y_[i] = y[i];
+    ya[i] = y[i];
 
     ymin_ = std::min(ymin_, y[i]);
     ymax_ = std::max(ymax_, y[i]);
   }
 
-  // populate z and calc min/max
+  // populate z and calc min/max (skip missing values)
   int numZ = numX*numY;
 
-  z_.resize(size_t(numZ));
+  bool zset = false;
 
-  zmin_ = z[0]; zmax_ = zmin_;
+  zmin_ = 0.0; zmax_ = 1.0;
 
   for (uint i = 0; i < uint(numZ); i++) {
-    z_[i] = z[i];
+    za[i] = z[i];
 
-    zmin_ = std::min(zmin_, z[i]);
-    zmax_ = std::max(zmax_, z[i]);
+    if (CMathUtil::isNaN(z[i]))
+      continue;
+
+    if (! zset) {
+      zmin_ = z[i]; zmax_ = zmin_;
+      zset  = true;
+    }
+    else {
+      zmin_ = std::min(zmin_, z[i]);
+      zmax_ = std::max(zmax_, z[i]);
+    }
   }
+
+  //---
+
+  tracer_.setData(xa, ya, za);
+
+  linePathsValid_ = false;
+  bandPathsValid_ = false;
 }
 
 void
@@ -160,192 +157,29 @@ drawContourLines(PaintDevice *device)
   // draw contour points (optional ?)
   device->setPen(gridPointColor());
 
-  for (auto y : y_)
-    for (auto x : x_)
+  for (auto y : tracer_.y())
+    for (auto x : tracer_.x())
       drawPoint(device, x, y);
 
   //---
 
-  ContourLevels levels;
-
-  initLevels(levels);
+  updateLinePaths();
 
   //---
 
-  device->setPen(QColor(Qt::black)); // TODO: use interface color
-
-  double xc[8];
-  double yc[8];
-  int    flag[8];
+  device->setPen  (QColor(Qt::black)); // TODO: use interface color
+  device->setBrush(QBrush());
 
-  for (uint l = 0; l < levels.size(); l++) {
-    double level = levels[l];
+  for (uint l = 0; l < linePaths_.size(); l++) {
+    if (linePaths_[l].isEmpty())
+      continue;
 
     auto c = getLevelColor(int(l));
 
-    if (c.isValid()) {
-      device->setPen  (c);
-      device->setBrush(c);
-    }
+    if (c.isValid())
+      device->setPen(c);
 
-    for (uint i = 0; i < x_.size() - 1; i++) {
-      double xi1 = x_[i + 0];
-      double xi2 = x_[i + 1];
-
-      double xm = (xi1 + xi2)/2.0;
-
-      uint i1 =  i     *uint(y_.size());
-      uint i2 = (i + 1)*uint(y_.size());
-
-      for (uint j = 0; j < y_.size() - 1; j++) {
-        double yj1 = y_[j + 0];
-        double yj2 = y_[j + 1];
-
-        double ym = (yj1 + yj2)/2.0;
-
-        double z1 = z_[i1 + j    ];
-        double z2 = z_[i2 + j    ];
-        double z3 = z_[i1 + j + 1];
-        double z4 = z_[i2 + j + 1];
-
-        double zm = (z1 + z2 + z3 + z4)/4.0;
-
-        //---
-
-        // get point on lower side for specified value (if in range)
-        if ((level >= z1 && level <= z2) || (level <= z1 && level >= z2)) {
-          flag[0] = true;
-
-          if (z1 != z2)
-            xc[0] = xi1 + (level - z1)*(xi2 - xi1)/(z2 - z1);
-          else
-            xc[0] = xi1;
-
-          yc[0] = yj1;
-        }
-        else
-          flag[0] = false;
-
-        // get point on upper side for specified value (if in range)
-        if ((level >= z3 && level <= z4) || (level <= z3 && level >= z4)) {
-          flag[1] = true;
-
-          if (z3 != z4)
-            xc[1] = xi1 + (level - z3)*(xi2 - xi1)/(z4 - z3);
-          else
-            xc[1] = xi1;
-
-          yc[1] = yj2;
-        }
-        else
-          flag[1] = false;
-
-        // get point on left side for specified value (if in range)
-        if ((level >= z1 && level <= z3) || (level <= z1 && level >= z3)) {
-          flag[2] = true;
-
-          xc[2] = xi1;
-
-          if (z1 != z3)
-            yc[2] = yj1 + (level - z1)*(yj2 - yj1)/(z3 - z1);
-          else
-            yc[2] = yj1;
-        }
-        else
-          flag[2] = false;
-
-        // get point on right side for specified value (if in range)
-        if ((level >= z2 && level <= z4) || (level <= z2 && level >= z4)) {
-          flag[3] = true;
-
-          xc[3] = xi2;
-
-          if (z2 != z4)
-            yc[3] = yj1 + (level - z2)*(yj2 - yj1)/(z4 - z2);
-          else
-            yc[3] = yj1;
-        }
-        else
-          flag[3] = false;
-
-        //---
-
-        // get point on left half of diagonal up line
-        if ((level >= z1 && level <= zm) || (level <= z1 && level >= zm)) {
-          flag[4] = true;
-
-          if (z1 != zm) {
-            xc[4] = xi1 + (level - z1)*(xm - xi1)/(zm - z1);
-            yc[4] = yj1 + (level - z1)*(ym - yj1)/(zm - z1);
-          }
-          else {
-            xc[4] = xi1;
-            yc[4] = yj1;
-          }
-        }
-        else
-          flag[4] = false;
-
-        // get point on right half of diagonal down line
-        if ((level >= z2 && level <= zm) || (level <= z2 && level >= zm)) {
-          flag[5] = true;
-
-          if (z2 != zm) {
-            xc[5] = xi2 + (level - z2)*(xm - xi2)/(zm - z2);
-            yc[5] = yj1 + (level - z2)*(ym - yj1)/(zm - z2);
-          }
-          else {
-            xc[5] = xi2;
-            yc[5] = yj1;
-          }
-        }
-        else
-          flag[5] = false;
-
-        // get point on left half of diagonal down line
-        if ((level >= z3 && level <= zm) || (level <= z3 && level >= zm)) {
-          flag[6] = true;
-
-          if (z3 != zm) {
-            xc[6] = xi1 + (level - z3)*(xm - xi1)/(zm - z3);
-            yc[6] = yj2 + (level - z3)*(ym - yj2)/(zm - z3);
-          }
-          else {
-            xc[6] = xi1;
-            yc[6] = yj2;
-          }
-        }
-        else
-          flag[6] = false;
-
-        // get point on right half of diagonal up line
-        if ((level >= z4 && level <= zm) || (level <= z4 && level >= zm)) {
-          flag[7] = true;
-
-          if (z4 != zm) {
-            xc[7] = xi2 + (level - z4)*(xm - xi2)/(zm - z4);
-            yc[7] = yj2 + (level - z4)*(ym - yj2)/(zm - z4);
-          }
-          else {
-            xc[7] = xi2;
-            yc[7] = yj2;
-          }
-        }
-        else
-          flag[7] = false;
-
-        //---
-
-        // connect lines
-        for (int k = 0; k < 12; k++) {
-          int f1 = contourFlags[2*k + 0];
-          int f2 = contourFlags[2*k + 1];
-
-          if (flag[f1] && flag[f2])
-            drawLine(device, xc[f1], yc[f1], xc[f2], yc[f2]);
-        }
-      }
-    }
+    device->drawPath(linePaths_[l]);
   }
 }
 
@@ -353,33 +187,20 @@ void
 CQChartsContour::
 drawContourSolid(PaintDevice *device)
 {
-  ContourLevels levels;
-
-  initLevels(levels);
+  updateBandPaths();
 
   //---
 
-  minX_ = plot_->pixelToWindowWidth (1);
-  minY_ = plot_->pixelToWindowHeight(1);
-
-  for (uint i = 0; i < x_.size() - 1; i++) {
-    double x1 = x_[i + 0];
-    double x2 = x_[i + 1];
-
-    uint i1 =  i     *uint(y_.size());
-    uint i2 = (i + 1)*uint(y_.size());
+  for (uint b = 0; b < bandPaths_.size(); b++) {
+    if (bandPaths_[b].isEmpty())
+      continue;
 
-    for (uint j = 0; j < y_.size() - 1; j++) {
-      double y1 = y_[j + 0];
-      double y2 = y_[j + 1];
+    auto c = getLevelColor(int(b));
 
-      double z1 = z_[i1 + j    ];
-      double z2 = z_[i2 + j    ];
-      double z3 = z_[i1 + j + 1];
-      double z4 = z_[i2 + j + 1];
+    device->setPen  (c);
+    device->setBrush(c);
 
-      fillContourBox(device, x1, y1, x2, y2, z1, z2, z3, z4, levels);
-    }
+    device->drawPath(bandPaths_[b]);
   }
 }
 
@@ -406,136 +227,100 @@ initLevels(ContourLevels &levels) const
 
   // calc levels from specified number
   if (levels.empty()) {
-    double zmin = z_[0];
-    double zmax = z_[0];
-
     int numLevels = numContourLevels();
 
-    for (uint i = 0; i < x_.size(); i++) {
-      for (uint j = 0; j < y_.size(); j++) {
-        double zm = z_[i*y_.size() + j];
-
-        if (zm < zmin) zmin = zm;
-        if (zm > zmax) zmax = zm;
-      }
-    }
-
     levels.resize(size_t(numLevels));
 
     for (uint i = 0; i < uint(numLevels); i++)
-      levels[i] = zmin + (1.0*i)*(zmax - zmin)/(numLevels - 1);
+      levels[i] = (numLevels > 1 ? zmin_ + (1.0*i)*(zmax_ - zmin_)/(numLevels - 1) : zmin_);
   }
+  else
+    std::sort(levels.begin(), levels.end());
 }
 
 void
 CQChartsContour::
-fillContourBox(PaintDevice *device, double x1, double y1, double x2, double y2,
-               double z1, double z2, double z3, double z4, const ContourLevels &levels)
+updateLevels()
 {
-  // get box corner values
-  if      (std::abs(x2 - x1) <= minX_ && std::abs(y2 - y1) <= minY_) {
-    double z1234 = (z1 + z2 + z3 + z4)/4.0;
-
-    z1 = z1234;
-    z2 = z1234;
-    z3 = z1234;
-    z4 = z1234;
-  }
-  else if (std::abs(x2 - x1) <= minX_) {
-    double z12 = (z1 + z2)/2.0;
-    double z34 = (z3 + z4)/2.0;
-
-    z1 = z12;
-    z2 = z12;
-    z3 = z34;
-    z4 = z34;
-  }
-  else if (std::abs(y2 - y1) <= minY_) {
-    double z13 = (z1 + z3)/2.0;
-    double z24 = (z2 + z4)/2.0;
-
-    z1 = z13;
-    z2 = z13;
-    z3 = z24;
-    z4 = z24;
+  ContourLevels levels;
+
+  initLevels(levels);
+
+  if (tracer_.setLevels(levels)) {
+    linePathsValid_ = false;
+    bandPathsValid_ = false;
   }
+}
 
-  //---
+void
+CQChartsContour::
+updateLinePaths()
+{
+  updateLevels();
 
-  // get consistent level for four values
-  int l = 0;
-
-  if      (z1 < levels[0] && z2 < levels[0] && z3 < levels[0] && z4 < levels[0])
-    l = 0;
-  else if (z1 > levels[levels.size() - 1] && z2 > levels[levels.size() - 1] &&
-           z3 > levels[levels.size() - 1] && z4 > levels[levels.size() - 1])
-    l = int(levels.size());
-  else {
-    for (uint l = 1; l < uint(levels.size()); l++) {
-      if (z1 >= levels[l - 1] && z2 >= levels[l - 1] &&
-          z3 >= levels[l - 1] && z4 >= levels[l - 1] &&
-          z1 <= levels[l    ] && z2 <= levels[l    ] &&
-          z3 <= levels[l    ] && z4 <= levels[l    ])
-        break;
-
-      if (z1 >= levels[l - 1] && z3 >= levels[l - 1] &&
-          z2 >= levels[l - 1] && z4 >= levels[l - 1] &&
-          z1 <= levels[l    ] && z3 <= levels[l    ] &&
-          z2 <= levels[l    ] && z4 <= levels[l    ])
-        break;
-    }
+  if (linePathsValid_)
+    return;
 
-    if (l >= int(levels.size()))
-      l = -1;
-  }
+  linePathsValid_ = true;
 
   //---
 
-  // if consistent level then fill
-  if (l >= 0 && l <= int(levels.size())) {
-    auto c = getLevelColor(l);
+  // path per level from traced lines
+  int nl = tracer_.numLevels();
 
-    device->setPen  (c);
-    device->setBrush(c);
+  linePaths_.clear();
+  linePaths_.resize(size_t(nl));
 
-    double px[4], py[4];
+  for (int l = 0; l < nl; ++l) {
+    auto &path = linePaths_[size_t(l)];
 
-    px[0] = x1; py[0] = y1;
-    px[1] = x2; py[1] = y1;
-    px[2] = x2; py[2] = y2;
-    px[3] = x1; py[3] = y2;
+    for (const auto &line : tracer_.levelLines(l)) {
+      const auto &points = line.points;
 
-    fillPolygon(device, px, py, 4);
+      path.moveTo(points[0].qpoint());
 
-    return;
-  }
+      for (size_t i = 1; i < points.size(); ++i)
+        path.lineTo(points[i].qpoint());
 
-  //---
-
-  // sub-divide and draw
-  // TODO: iterate instead of recurse
-  double x12 = (x1 + x2)/2.0;
-  double y12 = (y1 + y2)/2.0;
-  double z12 = (z1 + z2)/2.0;
-  double z24 = (z2 + z4)/2.0;
-  double z13 = (z1 + z3)/2.0;
-  double z34 = (z3 + z4)/2.0;
-
-  double z1234 = (z1 + z2 + z3 + z4)/4.0;
-
-  fillContourBox(device, x1 , y1 , x12, y12, z1, z12, z13, z1234, levels);
-  fillContourBox(device, x12, y1 , x2 , y12, z12, z2, z1234, z24, levels);
-  fillContourBox(device, x1 , y12, x12, y2 , z13, z1234, z3, z34, levels);
-  fillContourBox(device, x12, y12, x2 , y2 , z1234, z24, z34, z4, levels);
+      if (line.closed)
+        path.closeSubpath();
+    }
+  }
 }
 
 void
 CQChartsContour::
-fillPolygon(PaintDevice *device, const double *x, const double *y, int n)
+updateBandPaths()
 {
-  auto path = CQChartsDrawUtil::polygonToPath(x, y, n, /*closed*/true);
+  updateLevels();
 
-  device->drawPath(path);
+  if (bandPathsValid_)
+    return;
+
+  bandPathsValid_ = true;
+
+  //---
+
+  // path per band from traced rings (holes are reversed so use winding fill)
+  int nb = tracer_.numBands();
+
+  bandPaths_.clear();
+  bandPaths_.resize(size_t(nb));
+
+  for (int b = 0; b < nb; ++b) {
+    auto &path = bandPaths_[size_t(b)];
+
+    path.setFillRule(Qt::WindingFill);
+
+    for (const auto &ring : tracer_.bandRings(b)) {
+      path.moveTo(ring[0].qpoint());
+
+      for (size_t i = 1; i < ring.size(); ++i)
+        path.lineTo(ring[i].qpoint());
+
+      path.closeSubpath();
+    }
+  }
 }
 
 void
@@ -544,10 +329,3 @@ drawPoint(PaintDevice *device, double x, double y)
 {
   device->drawPoint(CQChartsGeom::Point(x, y));
 }
-
-void
-CQChartsContour::
-drawLine(PaintDevice *device, double x1, double y1, double x2, double y2)
-{
-  device->drawLine(CQChartsGeom::Point(x1, y1), CQChartsGeom::Point(x2, y2));
-}
@@ -0,0 +1,506 @@
+#include <CQChartsContourTracer.h>
+#include <CQChartsParallel.h>
+#include <CMathUtil.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+CQChartsContourTracer::
+CQChartsContourTracer()
+{
+}
+
+void
+CQChartsContourTracer::
+setData(const Reals &x, const Reals &y, const Reals &z)
+{
+  x_ = x;
+  y_ = y;
+  z_ = z;
+
+  z_.resize(x_.size()*y_.size(), CMathUtil::getNaN());
+
+  invalidate();
+}
+
+bool
+CQChartsContourTracer::
+setLevels(const Reals &levels)
+{
+  if (levels == levels_)
+    return false;
+
+  levels_ = levels;
+
+  invalidate();
+
+  return true;
+}
+
+void
+CQChartsContourTracer::
+invalidate()
+{
+  linesValid_ = false;
+  bandsValid_ = false;
+
+  lines_.clear();
+  rings_.clear();
+}
+
+const CQChartsContourTracer::Lines &
+CQChartsContourTracer::
+levelLines(int l) const
+{
+  if (! linesValid_)
+    calcLines();
+
+  return lines_[size_t(l)];
+}
+
+const CQChartsContourTracer::Rings &
+CQChartsContourTracer::
+bandRings(int b) const
+{
+  if (! bandsValid_)
+    calcBands();
+
+  return rings_[size_t(b)];
+}
+
+//---
+
+bool
+CQChartsContourTracer::
+isCellValid(int i, int j) const
+{
+  int nx = numX();
+  int ny = numY();
+
+  if (i < 0 || i >= nx - 1 || j < 0 || j >= ny - 1)
+    return false;
+
+  size_t i1 = size_t(i    )*size_t(ny) + size_t(j);
+  size_t i2 = size_t(i + 1)*size_t(ny) + size_t(j);
+
+  return (! CMathUtil::isNaN(z_[i1]) && ! CMathUtil::isNaN(z_[i1 + 1]) &&
+          ! CMathUtil::isNaN(z_[i2]) && ! CMathUtil::isNaN(z_[i2 + 1]));
+}
+
+template<typename FUNC>
+void
+CQChartsContourTracer::
+visitTriangles(int i1, int i2, FUNC f) const
+{
+  int nx = numX();
+  int ny = numY();
+
+  // key ranges (grid points, cell centers) and edge id ranges (x edges, y edges)
+  Key numPoints = Key(nx)*Key(ny);
+  Key numXEdges = Key(nx - 1)*Key(ny);
+  Key numYEdges = Key(nx)*Key(ny - 1);
+
+  auto pointKey  = [&](int i, int j) { return Key(i)*Key(ny) + Key(j); };
+  auto centerKey = [&](int i, int j) { return numPoints + Key(i)*Key(ny - 1) + Key(j); };
+
+  auto xEdge = [&](int i, int j) { return Key(i)*Key(ny) + Key(j); };
+  auto yEdge = [&](int i, int j) { return numXEdges + Key(i)*Key(ny - 1) + Key(j); };
+
+  auto diagEdge = [&](int i, int j, int k) {
+    return numXEdges + numYEdges + 4*(Key(i)*Key(ny - 1) + Key(j)) + Key(k);
+  };
+
+  Triangle tri;
+
+  for (int i = i1; i < i2; ++i) {
+    for (int j = 0; j < ny - 1; ++j) {
+      if (! isCellValid(i, j))
+        continue;
+
+      // cell corners (counter clockwise from bottom left) and center
+      int ci[4] = { i, i + 1, i + 1, i     };
+      int cj[4] = { j, j    , j + 1, j + 1 };
+
+      Vertex corners[4];
+
+      for (int k = 0; k < 4; ++k) {
+        auto &v = corners[k];
+
+        v.key = pointKey(ci[k], cj[k]);
+        v.p   = Point(x_[size_t(ci[k])], y_[size_t(cj[k])]);
+        v.z   = z_[size_t(ci[k])*size_t(ny) + size_t(cj[k])];
+      }
+
+      Vertex center;
+
+      center.key = centerKey(i, j);
+      center.p   = Point((corners[0].p.x + corners[2].p.x)/2.0,
+                         (corners[0].p.y + corners[2].p.y)/2.0);
+      center.z   = (corners[0].z + corners[1].z + corners[2].z + corners[3].z)/4.0;
+
+      // cell sides (bottom, right, top, left) and cell on other side
+      Key sideEdges[4] = { xEdge(i, j), yEdge(i + 1, j), xEdge(i, j + 1), yEdge(i, j) };
+
+      bool sideShared[4] = {
+        isCellValid(i, j - 1), isCellValid(i + 1, j),
+        isCellValid(i, j + 1), isCellValid(i - 1, j) };
+
+      // triangle for each side (side, diagonal to center, diagonal from center)
+      for (int k = 0; k < 4; ++k) {
+        int k1 = (k + 1) % 4;
+
+        tri.v[0] = corners[k ];
+        tri.v[1] = corners[k1];
+        tri.v[2] = center;
+
+        tri.e[0] = sideEdges[k];
+        tri.e[1] = diagEdge(i, j, k1);
+        tri.e[2] = diagEdge(i, j, k );
+
+        tri.shared[0] = sideShared[k];
+        tri.shared[1] = true;
+        tri.shared[2] = true;
+
+        f(tri);
+      }
+    }
+  }
+}
+
+CQChartsContourTracer::Vertex
+CQChartsContourTracer::
+crossVertex(const Vertex &v1, const Vertex &v2, Key e, int l) const
+{
+  int nx = numX();
+  int ny = numY();
+
+  Key numPoints  = Key(nx)*Key(ny);
+  Key numCenters = Key(nx - 1)*Key(ny - 1);
+
+  // interpolate from lowest key so point is the same for both triangles of edge
+  const auto &va = (v1.key < v2.key ? v1 : v2);
+  const auto &vb = (v1.key < v2.key ? v2 : v1);
+
+  double level = levels_[size_t(l)];
+
+  double t = (level - va.z)/(vb.z - va.z);
+
+  Vertex v;
+
+  v.key = numPoints + numCenters + e*Key(numLevels()) + Key(l);
+  v.p   = Point(va.p.x + t*(vb.p.x - va.p.x), va.p.y + t*(vb.p.y - va.p.y));
+  v.z   = level;
+
+  return v;
+}
+
+int
+CQChartsContourTracer::
+levelClass(double z) const
+{
+  // number of levels less than or equal to value (band index)
+  return int(std::upper_bound(levels_.begin(), levels_.end(), z) - levels_.begin());
+}
+
+//---
+
+void
+CQChartsContourTracer::
+calcLines() const
+{
+  int nl = numLevels();
+
+  lines_.clear();
+  lines_.resize(size_t(nl));
+
+  linesValid_ = true;
+
+  if (nl == 0 || numX() < 2 || numY() < 2)
+    return;
+
+  //---
+
+  // get segments per level for each column tile
+  auto nc = size_t(CQChartsParallel::numChunks(numX() - 1, 8));
+
+  std::vector<EdgesList> tileEdges(nc);
+
+  for (auto &edgesList : tileEdges)
+    edgesList.resize(size_t(nl));
+
+  CQChartsParallel::forChunkInds(numX() - 1, [&](int ic, int i1, int i2) {
+    auto &edgesList = tileEdges[size_t(ic)];
+
+    visitTriangles(i1, i2, [&](const Triangle &tri) {
+      int cls[3];
+
+      for (int k = 0; k < 3; ++k)
+        cls[k] = levelClass(tri.v[k].z);
+
+      int cmin = std::min({cls[0], cls[1], cls[2]});
+      int cmax = std::max({cls[0], cls[1], cls[2]});
+
+      // segment goes from edge crossing above to below (counter clockwise) to
+      // edge crossing below to above so it continues in the adjacent triangle
+      for (int l = cmin; l < cmax; ++l) {
+        Edge edge;
+
+        for (int k = 0; k < 3; ++k) {
+          int k1 = (k + 1) % 3;
+
+          bool above1 = (cls[k ] > l);
+          bool above2 = (cls[k1] > l);
+
+          if (above1 == above2)
+            continue;
+
+          auto v = crossVertex(tri.v[k], tri.v[k1], tri.e[k], l);
+
+          if (above1) { edge.k1 = v.key; edge.p1 = v.p; }
+          else        { edge.k2 = v.key; edge.p2 = v.p; }
+        }
+
+        edgesList[size_t(l)].push_back(edge);
+      }
+    });
+  }, 8);
+
+  //---
+
+  // chain segments of each level
+  CQChartsParallel::forEach(nl, [&](int l) {
+    Edges edges;
+
+    for (const auto &edgesList : tileEdges) {
+      const auto &edges1 = edgesList[size_t(l)];
+
+      edges.insert(edges.end(), edges1.begin(), edges1.end());
+    }
+
+    chainLines(edges, lines_[size_t(l)]);
+  });
+}
+
+void
+CQChartsContourTracer::
+calcBands() const
+{
+  int nb = numBands();
+
+  rings_.clear();
+  rings_.resize(size_t(nb));
+
+  bandsValid_ = true;
+
+  if (numX() < 2 || numY() < 2)
+    return;
+
+  //---
+
+  // get unshared band polygon edges per band for each column tile
+  auto nc = size_t(CQChartsParallel::numChunks(numX() - 1, 8));
+
+  std::vector<EdgesList> tileEdges(nc);
+
+  for (auto &edgesList : tileEdges)
+    edgesList.resize(size_t(nb));
+
+  CQChartsParallel::forChunkInds(numX() - 1, [&](int ic, int i1, int i2) {
+    auto &edgesList = tileEdges[size_t(ic)];
+
+    std::vector<Vertex> poly;
+    std::vector<int>    polyEdges; // triangle edges of poly vertex (bit mask)
+
+    visitTriangles(i1, i2, [&](const Triangle &tri) {
+      int cls[3];
+
+      for (int k = 0; k < 3; ++k)
+        cls[k] = levelClass(tri.v[k].z);
+
+      int cmin = std::min({cls[0], cls[1], cls[2]});
+      int cmax = std::max({cls[0], cls[1], cls[2]});
+
+      for (int b = cmin; b <= cmax; ++b) {
+        poly     .clear();
+        polyEdges.clear();
+
+        // walk triangle edges adding vertices in band and band edge crossings
+        for (int k = 0; k < 3; ++k) {
+          int k1 = (k + 1) % 3;
+          int k2 = (k + 2) % 3;
+
+          if (cls[k] == b) {
+            poly     .push_back(tri.v[k]);
+            polyEdges.push_back((1 << k) | (1 << k2));
+          }
+
+          int c1 = cls[k], c2 = cls[k1];
+
+          int l1 = (c1 < c2 ? b - 1 : b    );
+          int l2 = (c1 < c2 ? b     : b - 1);
+
+          for (int l : { l1, l2 }) {
+            if (l >= std::min(c1, c2) && l < std::max(c1, c2)) {
+              poly     .push_back(crossVertex(tri.v[k], tri.v[k1], tri.e[k], l));
+              polyEdges.push_back(1 << k);
+            }
+          }
+        }
+
+        // add polygon edges not shared with other triangles (shared edges cancel)
+        auto &edges = edgesList[size_t(b)];
+
+        int np = int(poly.size());
+
+        for (int i = 0; i < np; ++i) {
+          int i1 = (i + 1) % np;
+
+          int common = (polyEdges[size_t(i)] & polyEdges[size_t(i1)]);
+
+          bool shared = false;
+
+          for (int k = 0; k < 3; ++k) {
+            if ((common & (1 << k)) && tri.shared[k])
+              shared = true;
+          }
+
+          if (shared)
+            continue;
+
+          Edge edge;
+
+          edge.k1 = poly[size_t(i )].key; edge.p1 = poly[size_t(i )].p;
+          edge.k2 = poly[size_t(i1)].key; edge.p2 = poly[size_t(i1)].p;
+
+          edges.push_back(edge);
+        }
+      }
+    });
+  }, 8);
+
+  //---
+
+  // chain edges of each band into rings
+  CQChartsParallel::forEach(nb, [&](int b) {
+    Edges edges;
+
+    for (const auto &edgesList : tileEdges) {
+      const auto &edges1 = edgesList[size_t(b)];
+
+      edges.insert(edges.end(), edges1.begin(), edges1.end());
+    }
+
+    chainRings(edges, rings_[size_t(b)]);
+  });
+}
+
+//---
+
+void
+CQChartsContourTracer::
+chainLines(const Edges &edges, Lines &lines)
+{
+  int ne = int(edges.size());
+
+  std::unordered_map<Key, int> startEdge;
+  std::unordered_map<Key, int> endEdge;
+
+  for (int i = 0; i < ne; ++i) {
+    startEdge.emplace(edges[size_t(i)].k1, i);
+    endEdge  .emplace(edges[size_t(i)].k2, i);
+  }
+
+  std::vector<bool> used(size_t(ne), false);
+
+  auto addLine = [&](int i, bool closed) {
+    Line line;
+
+    line.closed = closed;
+
+    int e = i;
+
+    while (e >= 0 && ! used[size_t(e)]) {
+      used[size_t(e)] = true;
+
+      line.points.push_back(edges[size_t(e)].p1);
+
+      auto pe = startEdge.find(edges[size_t(e)].k2);
+
+      if (pe == startEdge.end()) {
+        line.points.push_back(edges[size_t(e)].p2);
+        break;
+      }
+
+      e = (*pe).second;
+    }
+
+    lines.push_back(std::move(line));
+  };
+
+  // open lines start at segment with no previous segment
+  for (int i = 0; i < ne; ++i) {
+    if (endEdge.find(edges[size_t(i)].k1) == endEdge.end())
+      addLine(i, /*closed*/false);
+  }
+
+  // remaining segments are in closed lines
+  for (int i = 0; i < ne; ++i) {
+    if (! used[size_t(i)])
+      addLine(i, /*closed*/true);
+  }
+}
+
+void
+CQChartsContourTracer::
+chainRings(const Edges &edges, Rings &rings)
+{
+  int ne = int(edges.size());
+
+  // edges by start key (more than one when band touches itself at a point)
+  std::unordered_multimap<Key, int> startEdges;
+
+  for (int i = 0; i < ne; ++i)
+    startEdges.emplace(edges[size_t(i)].k1, i);
+
+  std::vector<bool> used(size_t(ne), false);
+
+  auto nextEdge = [&](Key k) {
+    auto pr = startEdges.equal_range(k);
+
+    for (auto p = pr.first; p != pr.second; ) {
+      int e = (*p).second;
+
+      p = startEdges.erase(p);
+
+      if (! used[size_t(e)])
+        return e;
+    }
+
+    return -1;
+  };
+
+  // each vertex has the same number of incoming and outgoing edges so the chain from
+  // an edge always returns to its start
+  for (int i = 0; i < ne; ++i) {
+    if (used[size_t(i)])
+      continue;
+
+    Points ring;
+
+    int e = i;
+
+    while (e >= 0) {
+      used[size_t(e)] = true;
+
+      ring.push_back(edges[size_t(e)].p1);
+
+      if (edges[size_t(e)].k2 == edges[size_t(i)].k1)
+        break;
+
+      e = nextEdge(edges[size_t(e)].k2);
+    }
+
+    if (ring.size() >= 3)
+      rings.push_back(std::move(ring));
+  }
+}
@@ -14,6 +14,7 @@
 #include <CQChartsPlotParameterEdit.h>
 #include <CQChartsHtml.h>
 #include <CQChartsWidgetUtil.h>
+#include <CQChartsSeriation.h>
 
 #include <CQPropertyViewItem.h>
 #include <CQPerfMonitor.h>
@@ -62,12 +63,17 @@ QString
 CQChartsCorrelationPlotType::
 description() const
 {
+  auto B   = [](const QString &str) { return CQChartsHtml::Str::bold(str); };
   auto IMG = [](const QString &src) { return CQChartsHtml::Str::img(src); };
 
   return CQChartsHtml().
    h2("Correlation Plot").
     h3("Summary").
      p("Draws correlation data for model.").
+    h3("Options").
+     p("The rows/columns can be reordered so strongly correlated columns are adjacent "
+       "(matrix seriation) using the " + B("sortType") + " option. The ordering can be "
+       "spectral, reverse Cuthill-McKee or cluster leaf order").
     h3("Limitations").
      p("None.").
     h3("Example").
@@ -181,6 +187,17 @@ setUpperDiagonalType(const OffDiagonalType &t)
   } );
 }
 
+void
+CQChartsCorrelationPlot::
+setSortType(const SortType &t)
+{
+  // column positions are calculated (from cached seriation) when objects are created
+  // in update thread so draw never sees partially reordered cells
+  CQChartsUtil::testAndSet(sortType_, t, [&]() {
+    updateObjs(); emit customDataChanged();
+  } );
+}
+
 //---
 
 void
@@ -220,6 +237,9 @@ addProperties()
   addProp("cell", "diagonalType"     , "diagonal"     , "Diagonal cell type");
   addProp("cell", "lowerDiagonalType", "lowerDiagonal", "Lower Diagonal cell type");
   addProp("cell", "upperDiagonalType", "upperDiagonal", "Upper Diagonal cell type");
+
+  // options
+  addProp("options", "sortType", "sort", "Row/column sort type");
 }
 
 //---
@@ -381,6 +401,10 @@ createObjs(PlotObjs &objs) const
 
   //---
 
+  updateColumnPos();
+
+  //---
+
   class RowVisitor : public CQModelVisitor {
    public:
     RowVisitor(const CQChartsCorrelationPlot *plot, PlotObjs &objs) :
@@ -389,7 +413,7 @@ createObjs(PlotObjs &objs) const
     }
 
     State visit(const QAbstractItemModel *model, const VisitData &data) override {
-      double y = (nc_ - 1 - data.row)*dy_;
+      double y = (nc_ - 1 - plot_->columnPos(data.row))*dy_;
 
       for (int col = 0; col < numCols(); ++col) {
         auto ind = model->index(data.row, col, data.parent);
@@ -400,7 +424,7 @@ createObjs(PlotObjs &objs) const
 
         //---
 
-        double x = col*dx_;
+        double x = plot_->columnPos(col)*dx_;
 
         plot_->addCellObj(data.row, col, x, y, dx_, dy_, value, ind, objs_);
       }
@@ -439,6 +463,63 @@ addCellObj(int row, int col, double x, double y, double dx, double dy, double va
   objs.push_back(cellObj);
 }
 
+void
+CQChartsCorrelationPlot::
+updateColumnPos() const
+{
+  CQPerfTrace trace("CQChartsCorrelationPlot::updateColumnPos");
+
+  int nc = numColumns();
+
+  columnPos_.resize(size_t(nc));
+
+  for (int c = 0; c < nc; ++c)
+    columnPos_[size_t(c)] = c;
+
+  //---
+
+  using Seriation = CQChartsSeriation;
+
+  Seriation::Type type = Seriation::Type::NONE;
+
+  switch (sortType()) {
+    case SortType::SPECTRAL: type = Seriation::Type::SPECTRAL; break;
+    case SortType::RCM     : type = Seriation::Type::RCM     ; break;
+    case SortType::CLUSTER : type = Seriation::Type::CLUSTER ; break;
+    default: return;
+  }
+
+  //---
+
+  // absolute correlation values (strong positive or negative correlations are adjacent)
+  Seriation::Matrix::Values values(static_cast<size_t>(nc*nc), 0.0);
+
+  for (int r = 0; r < nc; ++r) {
+    for (int c = 0; c < nc; ++c) {
+      if (r == c) continue;
+
+      auto ind = correlationModel_->index(r, c, QModelIndex());
+
+      bool ok;
+      double value = CQChartsModelUtil::modelReal(correlationModel_, ind, ok);
+      if (! ok) continue;
+
+      values[size_t(r*nc + c)] = std::abs(value);
+    }
+  }
+
+  auto matrix = Seriation::Matrix::fromDense(nc, values);
+
+  // calc (cached) permutation (position -> column)
+  auto perm = seriation_.calc(type, matrix);
+
+  if (int(perm.size()) != nc)
+    return;
+
+  for (int i = 0; i < nc; ++i)
+    columnPos_[size_t(perm[size_t(i)])] = i;
+}
+
 //---
 
 bool
@@ -633,7 +714,7 @@ drawXLabels(PaintDevice *device) const
     auto name = CQChartsModelUtil::modelHHeaderString(correlationModel_, col, Qt::DisplayRole, ok);
     if (! name.length()) continue;
 
-    Point p(c + 0.5, 0);
+    Point p(columnPos(c) + 0.5, 0);
 
     auto p1 = windowToPixel(p);
 
@@ -721,7 +802,7 @@ drawYLabels(PaintDevice *device) const
     auto name = CQChartsModelUtil::modelHHeaderString(correlationModel_, col, Qt::DisplayRole, ok);
     if (! name.length()) continue;
 
-    Point p(0, (nc - 1 - c) + 0.5);
+    Point p(0, (nc - 1 - columnPos(c)) + 0.5);
 
     auto p1 = windowToPixel(p);
 
@@ -1045,7 +1126,7 @@ draw(PaintDevice *device) const
   }
   // upper/lower diagonal
   else {
-    bool isLower = (row_ > col_);
+    bool isLower = (plot_->columnPos(row_) > plot_->columnPos(col_));
 
     auto type = (isLower ? plot_->lowerDiagonalType() : plot_->upperDiagonalType());
 
@@ -1,246 +1,1007 @@
 #include <CQChartsDelaunay.h>
+#include <CQChartsHullDelaunay.h>
 
-/*-------------------------------------------------------------------*/
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+
+// expansion arithmetic for exact predicates (Shewchuk). Expansions are sums of
+// non-overlapping components stored in increasing magnitude order
+using Expansion = std::vector<double>;
+
+inline void twoSum(double a, double b, double &x, double &y) {
+  x = a + b;
+
+  double bv = x - a;
+  double av = x - bv;
+  double br = b - bv;
+  double ar = a - av;
+
+  y = ar + br;
+}
+
+inline void twoProduct(double a, double b, double &x, double &y) {
+  x = a*b;
+  y = std::fma(a, b, -x);
+}
+
+Expansion diffExpansion(double a, double b) {
+  double x, y;
+
+  twoSum(a, -b, x, y);
+
+  if (y != 0.0)
+    return Expansion({y, x});
+
+  return Expansion({x});
+}
+
+Expansion growExpansion(const Expansion &e, double b) {
+  Expansion h;
+
+  double q = b;
+
+  for (auto ei : e) {
+    double qn, hh;
+
+    twoSum(q, ei, qn, hh);
+
+    if (hh != 0.0)
+      h.push_back(hh);
+
+    q = qn;
+  }
+
+  if (q != 0.0 || h.empty())
+    h.push_back(q);
+
+  return h;
+}
+
+Expansion sumExpansion(const Expansion &e, const Expansion &f) {
+  auto h = e;
+
+  for (auto fi : f)
+    h = growExpansion(h, fi);
+
+  return h;
+}
+
+Expansion scaleExpansion(const Expansion &e, double b) {
+  Expansion h;
+
+  if (e.empty())
+    return h;
+
+  double q, hh;
+
+  twoProduct(e[0], b, q, hh);
+
+  if (hh != 0.0)
+    h.push_back(hh);
+
+  for (size_t i = 1; i < e.size(); ++i) {
+    double p1, p0, sum;
+
+    twoProduct(e[i], b, p1, p0);
+
+    twoSum(q, p0, sum, hh);
+
+    if (hh != 0.0)
+      h.push_back(hh);
+
+    twoSum(p1, sum, q, hh);
+
+    if (hh != 0.0)
+      h.push_back(hh);
+  }
+
+  if (q != 0.0 || h.empty())
+    h.push_back(q);
+
+  return h;
+}
+
+Expansion mulExpansion(const Expansion &e, const Expansion &f) {
+  Expansion h;
+
+  for (auto fi : f)
+    h = sumExpansion(h, scaleExpansion(e, fi));
+
+  return h;
+}
+
+Expansion negExpansion(const Expansion &e) {
+  auto h = e;
+
+  for (auto &hi : h)
+    hi = -hi;
+
+  return h;
+}
+
+// sign (and approximate value) is given by largest component
+double expansionValue(const Expansion &e) {
+  return (e.empty() ? 0.0 : e.back());
+}
+
+const double epsilon      = DBL_EPSILON/2.0;
+const double ccwErrBound  = (3.0 + 16.0*epsilon)*epsilon;
+const double iccErrBound  = (10.0 + 96.0*epsilon)*epsilon;
+
+double orient2dExact(const CQChartsGeom::Point &a, const CQChartsGeom::Point &b,
+                     const CQChartsGeom::Point &c) {
+  auto acx = diffExpansion(a.x, c.x);
+  auto acy = diffExpansion(a.y, c.y);
+  auto bcx = diffExpansion(b.x, c.x);
+  auto bcy = diffExpansion(b.y, c.y);
+
+  auto det = sumExpansion(mulExpansion(acx, bcy), negExpansion(mulExpansion(acy, bcx)));
+
+  return expansionValue(det);
+}
+
+double incircleExact(const CQChartsGeom::Point &a, const CQChartsGeom::Point &b,
+                     const CQChartsGeom::Point &c, const CQChartsGeom::Point &d) {
+  auto adx = diffExpansion(a.x, d.x);
+  auto ady = diffExpansion(a.y, d.y);
+  auto bdx = diffExpansion(b.x, d.x);
+  auto bdy = diffExpansion(b.y, d.y);
+  auto cdx = diffExpansion(c.x, d.x);
+  auto cdy = diffExpansion(c.y, d.y);
+
+  auto lift = [](const Expansion &dx, const Expansion &dy) {
+    return sumExpansion(mulExpansion(dx, dx), mulExpansion(dy, dy));
+  };
+
+  auto cross = [](const Expansion &x1, const Expansion &y1,
+                  const Expansion &x2, const Expansion &y2) {
+    return sumExpansion(mulExpansion(x1, y2), negExpansion(mulExpansion(x2, y1)));
+  };
+
+  auto det = sumExpansion(
+    sumExpansion(mulExpansion(lift(adx, ady), cross(bdx, bdy, cdx, cdy)),
+                 mulExpansion(lift(bdx, bdy), cross(cdx, cdy, adx, ady))),
+    mulExpansion(lift(cdx, cdy), cross(adx, ady, bdx, bdy)));
+
+  return expansionValue(det);
+}
+
+// squared radius of circle through a, b, c
+double circumRadius2(const CQChartsGeom::Point &a, const CQChartsGeom::Point &b,
+                     const CQChartsGeom::Point &c) {
+  double dx = b.x - a.x, dy = b.y - a.y;
+  double ex = c.x - a.x, ey = c.y - a.y;
+
+  double denom = dx*ey - dy*ex;
+
+  if (denom == 0.0)
+    return std::numeric_limits<double>::max();
+
+  double bl = dx*dx + dy*dy;
+  double cl = ex*ex + ey*ey;
+
+  double d = 0.5/denom;
+
+  double x = (ey*bl - dy*cl)*d;
+  double y = (dx*cl - ex*bl)*d;
+
+  double r2 = x*x + y*y;
+
+  return (std::isfinite(r2) ? r2 : std::numeric_limits<double>::max());
+}
+
+bool circumCenter(const CQChartsGeom::Point &a, const CQChartsGeom::Point &b,
+                  const CQChartsGeom::Point &c, CQChartsGeom::Point &center) {
+  double dx = b.x - a.x, dy = b.y - a.y;
+  double ex = c.x - a.x, ey = c.y - a.y;
+
+  double denom = dx*ey - dy*ex;
+
+  if (denom == 0.0)
+    return false;
+
+  double bl = dx*dx + dy*dy;
+  double cl = ex*ex + ey*ey;
+
+  double d = 0.5/denom;
+
+  center = CQChartsGeom::Point(a.x + (ey*bl - dy*cl)*d, a.y + (dx*cl - ex*bl)*d);
+
+  return (std::isfinite(center.x) && std::isfinite(center.y));
+}
+
+// monotonic with angle of (dx, dy) in range [0, 1)
+double pseudoAngle(double dx, double dy) {
+  double s = std::abs(dx) + std::abs(dy);
+  if (s == 0.0) return 0.0;
+
+  double p = dx/s;
+
+  return (dy > 0.0 ? 3.0 - p : 1.0 + p)/4.0;
+}
+
+// clip convex polygon to half plane nx*x + ny*y <= c
+void clipHalfPlane(CQChartsGeom::Points &points, double nx, double ny, double c) {
+  auto np = points.size();
+  if (np == 0) return;
+
+  CQChartsGeom::Points points1;
+
+  for (size_t i = 0; i < np; ++i) {
+    const auto &p1 = points[i];
+    const auto &p2 = points[(i + 1) % np];
+
+    double d1 = nx*p1.x + ny*p1.y - c;
+    double d2 = nx*p2.x + ny*p2.y - c;
+
+    if (d1 <= 0.0)
+      points1.push_back(p1);
+
+    if ((d1 < 0.0 && d2 > 0.0) || (d1 > 0.0 && d2 < 0.0)) {
+      double t = d1/(d1 - d2);
+
+      points1.emplace_back(p1.x + t*(p2.x - p1.x), p1.y + t*(p2.y - p1.y));
+    }
+  }
+
+  points = std::move(points1);
+}
+
+}
+
+//---
 
 CQChartsDelaunay::
-CQChartsDelaunay() :
- CQChartsHull3D()
+CQChartsDelaunay()
 {
-  setUseLower(true);
 }
 
 void
 CQChartsDelaunay::
 clear()
 {
-  CQChartsHull3D::clear();
+  points_.clear();
+  values_.clear();
+
+  triangles_.clear();
+  halfedges_.clear();
+  hull_     .clear();
+
+  centers_     .clear();
+  radii_       .clear();
+  inedges_     .clear();
+  voronoiEdges_.clear();
+}
+
+int
+CQChartsDelaunay::
+addVertex(double x, double y, double value)
+{
+  points_.push_back(Point(x, y));
+  values_.push_back(value);
+
+  return int(points_.size()) - 1;
 }
 
 bool
 CQChartsDelaunay::
 calc()
 {
-  reset();
+  triangles_.clear();
+  halfedges_.clear();
+  hull_     .clear();
+
+  bool rc;
+
+  if (algorithm_ == Algorithm::HULL3D)
+    rc = calcHull3D();
+  else
+    rc = calcNative();
+
+  calcVoronoi();
+
+  return rc;
+}
+
+bool
+CQChartsDelaunay::
+calcNative()
+{
+  int n = numVertices();
+  if (n < 3) return false;
+
+  auto np = size_t(n);
+
+  //---
+
+  // find seed triangle (point nearest center of bbox, its nearest neighbor and
+  // the point giving the smallest circumcircle)
+  double xmin = points_[0].x, ymin = points_[0].y, xmax = xmin, ymax = ymin;
+
+  for (const auto &p : points_) {
+    xmin = std::min(xmin, p.x); ymin = std::min(ymin, p.y);
+    xmax = std::max(xmax, p.x); ymax = std::max(ymax, p.y);
+  }
+
+  Point c((xmin + xmax)/2.0, (ymin + ymax)/2.0);
+
+  auto dist2 = [](const Point &p1, const Point &p2) {
+    double dx = p1.x - p2.x, dy = p1.y - p2.y; return dx*dx + dy*dy;
+  };
+
+  int    i0 = 0;
+  double minDist = std::numeric_limits<double>::max();
+
+  for (int i = 0; i < n; ++i) {
+    double d = dist2(c, points_[size_t(i)]);
+
+    if (d < minDist) { i0 = i; minDist = d; }
+  }
+
+  const auto &p0 = points_[size_t(i0)];
+
+  int i1 = -1;
 
-  // initialize triangles
-  if (! doubleTriangle())
+  minDist = std::numeric_limits<double>::max();
+
+  for (int i = 0; i < n; ++i) {
+    if (i == i0) continue;
+
+    double d = dist2(p0, points_[size_t(i)]);
+
+    if (d > 0.0 && d < minDist) { i1 = i; minDist = d; }
+  }
+
+  if (i1 < 0) return false;
+
+  int    i2        = -1;
+  double minRadius = std::numeric_limits<double>::max();
+
+  for (int i = 0; i < n; ++i) {
+    if (i == i0 || i == i1) continue;
+
+    double r = circumRadius2(p0, points_[size_t(i1)], points_[size_t(i)]);
+
+    if (r < minRadius) { i2 = i; minRadius = r; }
+  }
+
+  // all points collinear
+  if (i2 < 0) return false;
+
+  // make seed triangle clockwise
+  if (orient2d(p0, points_[size_t(i1)], points_[size_t(i2)]) > 0.0)
+    std::swap(i1, i2);
+
+  if (! circumCenter(p0, points_[size_t(i1)], points_[size_t(i2)], center_))
     return false;
 
-  // build 3d convex hull
-  constructHull();
+  //---
 
-  // get delaunay points from lower faces
-  lowerFaces();
+  // sort points by distance from seed circle center
+  Reals dists(np);
 
-  // calc voronoi graph
-  calcVoronoi();
+  for (size_t i = 0; i < np; ++i)
+    dists[i] = dist2(points_[i], center_);
+
+  Inds ids(np);
+
+  std::iota(ids.begin(), ids.end(), 0);
+
+  std::sort(ids.begin(), ids.end(), [&](int lhs, int rhs) {
+    auto dl = dists[size_t(lhs)], dr = dists[size_t(rhs)];
+    return (dl != dr ? dl < dr : lhs < rhs);
+  });
+
+  //---
+
+  // initial hull is seed triangle
+  auto hashSize = size_t(std::ceil(std::sqrt(double(n))));
+
+  hullPrev_.assign(np, -1);
+  hullNext_.assign(np, -1);
+  hullTri_ .assign(np, -1);
+  hullHash_.assign(hashSize, -1);
+
+  hullStart_ = i0;
+
+  int hullSize = 3;
+
+  hullNext_[size_t(i0)] = hullPrev_[size_t(i2)] = i1;
+  hullNext_[size_t(i1)] = hullPrev_[size_t(i0)] = i2;
+  hullNext_[size_t(i2)] = hullPrev_[size_t(i1)] = i0;
+
+  hullTri_[size_t(i0)] = 0;
+  hullTri_[size_t(i1)] = 1;
+  hullTri_[size_t(i2)] = 2;
+
+  hullHash_[size_t(hashKey(p0                  ))] = i0;
+  hullHash_[size_t(hashKey(points_[size_t(i1)]))] = i1;
+  hullHash_[size_t(hashKey(points_[size_t(i2)]))] = i2;
+
+  auto maxTriangles = size_t(std::max(2*n - 5, 1));
+
+  triangles_.reserve(3*maxTriangles);
+  halfedges_.reserve(3*maxTriangles);
+
+  addTriangle(i0, i1, i2, -1, -1, -1);
+
+  //---
+
+  // add points in order (each is outside current hull)
+  Point pp;
+
+  for (size_t k = 0; k < np; ++k) {
+    int i = ids[k];
+
+    const auto &p = points_[size_t(i)];
+
+    // skip duplicate
+    if (k > 0 && p.x == pp.x && p.y == pp.y) continue;
+
+    pp = p;
+
+    // skip seed
+    if (i == i0 || i == i1 || i == i2) continue;
+
+    // find visible edge on hull using hash
+    int start = 0;
+
+    int key = hashKey(p);
+
+    for (size_t j = 0; j < hashSize; ++j) {
+      start = hullHash_[(size_t(key) + j) % hashSize];
+
+      if (start != -1 && start != hullNext_[size_t(start)])
+        break;
+    }
+
+    start = hullPrev_[size_t(start)];
+
+    int e = start;
+    int q = -1;
+
+    while (true) {
+      q = hullNext_[size_t(e)];
+
+      if (orient2d(p, points_[size_t(e)], points_[size_t(q)]) > 0.0)
+        break;
+
+      e = q;
+
+      if (e == start) {
+        e = -1;
+        break;
+      }
+    }
+
+    // point on hull or inside (duplicate)
+    if (e == -1) continue;
+
+    // add first triangle from point
+    int t = addTriangle(e, i, hullNext_[size_t(e)], -1, -1, hullTri_[size_t(e)]);
+
+    hullTri_[size_t(i)] = legalize(t + 2);
+    hullTri_[size_t(e)] = t;
+
+    ++hullSize;
+
+    // walk forward through hull adding triangles and flipping
+    int nn = hullNext_[size_t(e)];
+
+    while (true) {
+      q = hullNext_[size_t(nn)];
+
+      if (! (orient2d(p, points_[size_t(nn)], points_[size_t(q)]) > 0.0))
+        break;
+
+      t = addTriangle(nn, i, q, hullTri_[size_t(i)], -1, hullTri_[size_t(nn)]);
+
+      hullTri_[size_t(i)] = legalize(t + 2);
+
+      hullNext_[size_t(nn)] = nn; // mark as removed
+
+      --hullSize;
+
+      nn = q;
+    }
+
+    // walk backward from the other side adding more triangles and flipping
+    if (e == start) {
+      while (true) {
+        q = hullPrev_[size_t(e)];
+
+        if (! (orient2d(p, points_[size_t(q)], points_[size_t(e)]) > 0.0))
+          break;
+
+        t = addTriangle(q, i, e, -1, hullTri_[size_t(e)], hullTri_[size_t(q)]);
+
+        (void) legalize(t + 2);
+
+        hullTri_[size_t(q)] = t;
+
+        hullNext_[size_t(e)] = e; // mark as removed
+
+        --hullSize;
+
+        e = q;
+      }
+    }
+
+    // update hull indices
+    hullStart_ = hullPrev_[size_t(i)] = e;
+
+    hullNext_[size_t(e )] = i;
+    hullPrev_[size_t(nn)] = i;
+    hullNext_[size_t(i )] = nn;
+
+    // save the two new edges in the hash table
+    hullHash_[size_t(hashKey(p                  ))] = i;
+    hullHash_[size_t(hashKey(points_[size_t(e)]))] = e;
+  }
+
+  //---
+
+  hull_.resize(size_t(hullSize));
+
+  int e = hullStart_;
+
+  for (int i = 0; i < hullSize; ++i) {
+    hull_[size_t(i)] = e;
+
+    e = hullNext_[size_t(e)];
+  }
+
+  // free build state
+  Inds().swap(hullPrev_);
+  Inds().swap(hullNext_);
+  Inds().swap(hullTri_ );
+  Inds().swap(hullHash_);
 
   return true;
 }
 
-void
+int
 CQChartsDelaunay::
-lowerFaces()
+addTriangle(int i0, int i1, int i2, int a, int b, int c)
 {
-  auto f = faces_;
+  int t = int(triangles_.size());
 
-  uint numLower = 0; /* Total number of lower faces. */
+  triangles_.push_back(i0);
+  triangles_.push_back(i1);
+  triangles_.push_back(i2);
 
-  do {
-    if (normz(f) < 0) {
-      numLower++;
+  halfedges_.push_back(-1);
+  halfedges_.push_back(-1);
+  halfedges_.push_back(-1);
 
-      f->setLower(true);
-    }
-    else
-      f->setLower(false);
+  link(t    , a);
+  link(t + 1, b);
+  link(t + 2, c);
 
-    f = f->next;
-  } while (f != faces_);
+  return t;
 }
 
 void
 CQChartsDelaunay::
-calcVoronoi()
+link(int a, int b)
 {
-  for (PVertex v = vertices_, vn = nullptr; v && vn != vertices_; v = vn) {
-    v->clearVoronoi();
-  }
+  halfedges_[size_t(a)] = b;
 
-  //---
+  if (b != -1)
+    halfedges_[size_t(b)] = a;
+}
 
-  // get center of circle for each face
-  auto f = faces_;
+// flip edges until all triangles adjacent to new edge a satisfy the Delaunay condition
+int
+CQChartsDelaunay::
+legalize(int a)
+{
+  edgeStack_.clear();
 
-  do {
-    if (f->isLower()) {
-      double xc, yc, r;
+  int ar = 0;
 
-      if (faceCenter(f, &xc, &yc, &r)) {
-        auto v = new Vertex(xc, yc, r);
+  while (true) {
+    int b  = halfedges_[size_t(a)];
+    int a0 = a - a % 3;
 
-        f->setVoronoi(v);
+    ar = a0 + (a + 2) % 3;
 
-        v->addTo(&vvertices_);
+    if (b == -1) {
+      if (edgeStack_.empty())
+        break;
 
-        auto v1 = f->vertex(0);
-        auto v2 = f->vertex(1);
-        auto v3 = f->vertex(2);
+      a = edgeStack_.back(); edgeStack_.pop_back();
 
-        v1->addVoronoi(v);
-        v2->addVoronoi(v);
-        v3->addVoronoi(v);
+      continue;
+    }
+
+    int b0 = b - b % 3;
+    int al = a0 + (a + 1) % 3;
+    int bl = b0 + (b + 2) % 3;
+
+    int p0 = triangles_[size_t(ar)];
+    int pr = triangles_[size_t(a )];
+    int pl = triangles_[size_t(al)];
+    int p1 = triangles_[size_t(bl)];
+
+    // triangles are clockwise so p1 is inside circle if incircle is negative
+    bool illegal = (incircle(points_[size_t(p0)], points_[size_t(pr)],
+                             points_[size_t(pl)], points_[size_t(p1)]) < 0.0);
+
+    if (illegal) {
+      triangles_[size_t(a)] = p1;
+      triangles_[size_t(b)] = p0;
+
+      int hbl = halfedges_[size_t(bl)];
+
+      // edge swapped on the other side of the hull (rare), fix the halfedge reference
+      if (hbl == -1) {
+        int e = hullStart_;
+
+        do {
+          if (hullTri_[size_t(e)] == bl) {
+            hullTri_[size_t(e)] = a;
+            break;
+          }
+
+          e = hullPrev_[size_t(e)];
+        } while (e != hullStart_);
       }
+
+      link(a, hbl);
+      link(b, halfedges_[size_t(ar)]);
+      link(ar, bl);
+
+      int br = b0 + (b + 1) % 3;
+
+      edgeStack_.push_back(br);
     }
+    else {
+      if (edgeStack_.empty())
+        break;
 
-    f = f->next;
-  } while (f != faces_);
+      a = edgeStack_.back(); edgeStack_.pop_back();
+    }
+  }
 
-  //---
+  return ar;
+}
 
-  f = faces_;
+int
+CQChartsDelaunay::
+hashKey(const Point &p) const
+{
+  auto n = hullHash_.size();
 
-  do {
-    f->clearVoronoiEdges();
+  auto key = size_t(std::floor(pseudoAngle(p.x - center_.x, p.y - center_.y)*double(n)));
 
-    // get center point
-    auto v = f->getVoronoi();
+  return int(key % n);
+}
 
-    if (v) {
-      // get face edges
-      auto e1 = f->edge(0);
-      auto e2 = f->edge(1);
-      auto e3 = f->edge(2);
+bool
+CQChartsDelaunay::
+calcHull3D()
+{
+  CQChartsHullDelaunay hullDelaunay;
+
+  std::unordered_map<const CQChartsHullDelaunay::Vertex *, int> vertexInd;
+
+  int n = numVertices();
+
+  for (int i = 0; i < n; ++i) {
+    const auto &p = points_[size_t(i)];
 
-      // get face on other side of edge
-      auto f1 = e1->otherFace(f);
-      auto f2 = e2->otherFace(f);
-      auto f3 = e3->otherFace(f);
+    vertexInd[hullDelaunay.addVertex(p.x, p.y)] = i;
+  }
+
+  if (! hullDelaunay.calc())
+    return false;
 
-      // get center points of outside faces
-      auto v1 = (f1 ? f1->getVoronoi() : nullptr);
-      auto v2 = (f2 ? f2->getVoronoi() : nullptr);
-      auto v3 = (f3 ? f3->getVoronoi() : nullptr);
+  // add lower faces as clockwise triangles
+  for (auto pf = hullDelaunay.facesBegin(); pf != hullDelaunay.facesEnd(); ++pf) {
+    const auto *f = *pf;
 
-      //----
+    if (! f->isLower()) continue;
 
-      // calc edges for each face pair
-      if (! v1) { v1 = calcEdgePoint(f, v, e1); v1->addTo(&vvertices_); }
-      if (! v2) { v2 = calcEdgePoint(f, v, e2); v2->addTo(&vvertices_); }
-      if (! v3) { v3 = calcEdgePoint(f, v, e3); v3->addTo(&vvertices_); }
+    int i1 = vertexInd[f->vertex(0)];
+    int i2 = vertexInd[f->vertex(1)];
+    int i3 = vertexInd[f->vertex(2)];
 
-      auto pe1 = new Edge(v, v1);
-      pe1->setLeftFace(f1); pe1->setRightFace(f);
+    if (orient2d(points_[size_t(i1)], points_[size_t(i2)], points_[size_t(i3)]) > 0.0)
+      std::swap(i2, i3);
+
+    triangles_.push_back(i1);
+    triangles_.push_back(i2);
+    triangles_.push_back(i3);
+  }
 
-      f->addVoronoiEdge(pe1);
-      pe1->addTo(&vedges_);
+  // link matching half edges
+  halfedges_.assign(triangles_.size(), -1);
 
-      //--
+  auto edgeKey = [](int i1, int i2) {
+    return (uint64_t(uint32_t(i1)) << 32) | uint64_t(uint32_t(i2));
+  };
 
-      auto pe2 = new Edge(v, v2);
-      pe2->setLeftFace(f2); pe2->setRightFace(f);
+  std::unordered_map<uint64_t, int> edgeInd;
 
-      f->addVoronoiEdge(pe2);
-      pe2->addTo(&vedges_);
+  int ne = int(triangles_.size());
 
-      //--
+  for (int e = 0; e < ne; ++e)
+    edgeInd[edgeKey(triangles_[size_t(e)], triangles_[size_t(nextEdge(e))])] = e;
 
-      auto pe3 = new Edge(v, v3);
-      pe3->setLeftFace(f3); pe3->setRightFace(f);
+  for (int e = 0; e < ne; ++e) {
+    auto p = edgeInd.find(edgeKey(triangles_[size_t(nextEdge(e))], triangles_[size_t(e)]));
 
-      f->addVoronoiEdge(pe3);
-      pe3->addTo(&vedges_);
+    if (p != edgeInd.end())
+      halfedges_[size_t(e)] = (*p).second;
+  }
+
+  // hull from boundary edges
+  std::unordered_map<int, int> boundaryEdge;
+
+  for (int e = 0; e < ne; ++e) {
+    if (halfedges_[size_t(e)] == -1)
+      boundaryEdge[triangles_[size_t(e)]] = e;
+  }
+
+  if (! boundaryEdge.empty()) {
+    int e = (*boundaryEdge.begin()).second;
+
+    for (size_t i = 0; i < boundaryEdge.size(); ++i) {
+      hull_.push_back(triangles_[size_t(e)]);
+
+      auto p = boundaryEdge.find(triangles_[size_t(nextEdge(e))]);
+      if (p == boundaryEdge.end()) break;
+
+      e = (*p).second;
     }
+  }
 
-    f = f->next;
-  } while (f != faces_);
+  return true;
 }
 
-bool
+void
 CQChartsDelaunay::
-faceCenter(PFace f, double *xc, double *yc, double *r)
+calcVoronoi()
 {
-  auto v1 = f->vertex(0);
-  auto v2 = f->vertex(1);
-  auto v3 = f->vertex(2);
+  int nt = numTriangles();
+  int ne = 3*nt;
+
+  // circumcenter of each triangle (centroid for degenerate triangle)
+  centers_.resize(size_t(nt));
+  radii_  .resize(size_t(nt));
+
+  for (int t = 0; t < nt; ++t) {
+    int i1, i2, i3;
+
+    triangle(t, i1, i2, i3);
 
-  double A = v2->x() - v1->x();
-  double B = v2->y() - v1->y();
-  double C = v3->x() - v1->x();
-  double D = v3->y() - v1->y();
+    const auto &p1 = points_[size_t(i1)];
+    const auto &p2 = points_[size_t(i2)];
+    const auto &p3 = points_[size_t(i3)];
 
-  double E = A*(v1->x() + v2->x()) + B*(v1->y() + v2->y());
-  double F = C*(v1->x() + v3->x()) + D*(v1->y() + v3->y());
+    auto &center = centers_[size_t(t)];
 
-  double G = 2*(A*(v3->y() - v2->y()) - B*(v3->x() - v2->x()));
+    if (circumCenter(p1, p2, p3, center)) {
+      radii_[size_t(t)] = std::hypot(p1.x - center.x, p1.y - center.y);
+    }
+    else {
+      center = Point((p1.x + p2.x + p3.x)/3.0, (p1.y + p2.y + p3.y)/3.0);
 
-  if (std::abs(G) < 1E-6) return false;
+      radii_[size_t(t)] = 0.0;
+    }
+  }
 
-  *xc = (D*E - B*F)/G;
-  *yc = (A*F - C*E)/G;
+  //---
 
-  double dx = v1->x() - *xc;
-  double dy = v1->y() - *yc;
+  // incoming half edge for each point (hull edge for points on hull so walk around
+  // point starts at boundary)
+  inedges_.assign(points_.size(), -1);
 
-  *r = std::hypot(dx, dy);
+  for (int e = 0; e < ne; ++e) {
+    auto p = size_t(triangles_[size_t(nextEdge(e))]);
 
-  return true;
+    if (halfedges_[size_t(e)] == -1 || inedges_[p] == -1)
+      inedges_[p] = e;
+  }
+
+  //---
+
+  // edges between centers of adjacent triangles and rays out from hull edges
+  voronoiEdges_.clear();
+
+  double xmin = 0.0, ymin = 0.0, xmax = 0.0, ymax = 0.0;
+
+  for (size_t i = 0; i < points_.size(); ++i) {
+    const auto &p = points_[i];
+
+    if (i == 0) { xmin = xmax = p.x; ymin = ymax = p.y; }
+
+    xmin = std::min(xmin, p.x); ymin = std::min(ymin, p.y);
+    xmax = std::max(xmax, p.x); ymax = std::max(ymax, p.y);
+  }
+
+  double rayLen = std::max(xmax - xmin, ymax - ymin);
+
+  for (int e = 0; e < ne; ++e) {
+    int o = halfedges_[size_t(e)];
+    int t = e/3;
+
+    const auto &c = centers_[size_t(t)];
+
+    if      (o > e) {
+      voronoiEdges_.emplace_back(c, centers_[size_t(o/3)], t);
+    }
+    else if (o == -1) {
+      // triangles are clockwise so outside of hull edge is on left
+      const auto &p1 = points_[size_t(triangles_[size_t(e)])];
+      const auto &p2 = points_[size_t(triangles_[size_t(nextEdge(e))])];
+
+      double dx = p2.x - p1.x;
+      double dy = p2.y - p1.y;
+      double l  = std::hypot(dx, dy);
+
+      if (l <= 0.0) continue;
+
+      voronoiEdges_.emplace_back(c, Point(c.x - rayLen*dy/l, c.y + rayLen*dx/l), t);
+    }
+  }
+}
+
+void
+CQChartsDelaunay::
+voronoiCell(int i, Points &points) const
+{
+  points.clear();
+
+  if (i < 0 || size_t(i) >= inedges_.size())
+    return;
+
+  int e0 = inedges_[size_t(i)];
+  if (e0 == -1) return;
+
+  int e = e0;
+
+  do {
+    points.push_back(centers_[size_t(e/3)]);
+
+    e = halfedges_[size_t(nextEdge(e))];
+  } while (e != -1 && e != e0);
 }
 
-CQChartsDelaunay::PVertex
+void
 CQChartsDelaunay::
-calcEdgePoint(PFace f, PVertex v, PEdge e)
+voronoiCell(int i, const BBox &bbox, Points &points) const
 {
-  double fx, fy, fz;
+  points.clear();
 
-  f->getCenter(&fx, &fy, &fz);
+  if (i < 0 || size_t(i) >= inedges_.size() || ! bbox.isSet())
+    return;
 
-  auto v1 = e->start();
-  auto v2 = e->end();
+  int e0 = inedges_[size_t(i)];
+  if (e0 == -1) return;
 
-  double xe = (v1->x() + v2->x())/2, ye = (v1->y() + v2->y())/2;
+  auto clipBBox = [&]() {
+    clipHalfPlane(points, -1.0,  0.0, -bbox.getXMin());
+    clipHalfPlane(points,  1.0,  0.0,  bbox.getXMax());
+    clipHalfPlane(points,  0.0, -1.0, -bbox.getYMin());
+    clipHalfPlane(points,  0.0,  1.0,  bbox.getYMax());
+  };
 
-  double dx = xe - v->x();
-  double dy = ye - v->y();
+  // interior cell is closed polygon of circumcenters (clip to bbox)
+  if (halfedges_[size_t(e0)] != -1) {
+    voronoiCell(i, points);
 
-  double xe1 = v->x() + 100*dx, ye1 = v->y() + 100*dy;
-  double xe2 = v->x() - 100*dx, ye2 = v->y() - 100*dy;
+    clipBBox();
 
-//bool l1 = isLeft(v->x(), v->y(), e);
-  bool l2 = isLeft(xe1   , ye1   , e);
-  bool l3 = isLeft(xe2   , ye2   , e);
-  bool l4 = isLeft(fx    , fy    , e);
+    return;
+  }
 
-  if      (l2 != l4)
-    return new Vertex(xe1, ye1, 0);
-  else if (l3 != l4)
-    return new Vertex(xe2, ye2, 0);
-  else
-    return new Vertex(xe , ye , 0);
+  // hull cell is unbounded so clip bbox by bisectors of vertex and its neighbors
+  // (incoming edges start at neighbors, last outgoing edge ends at neighbor)
+  points = Points{{bbox.getXMin(), bbox.getYMin()}, {bbox.getXMax(), bbox.getYMin()},
+                  {bbox.getXMax(), bbox.getYMax()}, {bbox.getXMin(), bbox.getYMax()}};
+
+  const auto &p = points_[size_t(i)];
+
+  auto clipNeighbor = [&](int j) {
+    const auto &pj = points_[size_t(j)];
+
+    double nx = pj.x - p.x;
+    double ny = pj.y - p.y;
+
+    if (nx == 0.0 && ny == 0.0) return;
+
+    clipHalfPlane(points, nx, ny, (pj.x*pj.x + pj.y*pj.y - p.x*p.x - p.y*p.y)/2.0);
+  };
+
+  int e = e0;
+
+  while (true) {
+    clipNeighbor(triangles_[size_t(e)]);
+
+    int e1 = halfedges_[size_t(nextEdge(e))];
+
+    if (e1 == -1) {
+      clipNeighbor(triangles_[size_t(prevEdge(e))]);
+      break;
+    }
+
+    if (e1 == e0)
+      break;
+
+    e = e1;
+  }
 }
 
-bool
+//---
+
+// > 0 if a, b, c counter clockwise, < 0 if clockwise, 0 if collinear
+double
 CQChartsDelaunay::
-isLeft(double x, double y, PEdge e)
+orient2d(const Point &a, const Point &b, const Point &c)
 {
-  auto v1 = e->start();
-  auto v2 = e->end();
+  double detLeft  = (a.x - c.x)*(b.y - c.y);
+  double detRight = (a.y - c.y)*(b.x - c.x);
+  double det      = detLeft - detRight;
+
+  double detSum;
 
-  double area2 = (v1->x() - x)*(v2->y() - y) - (v2->x() - x)*(v1->y() - y);
+  if      (detLeft > 0.0) {
+    if (detRight <= 0.0) return det;
 
-  return (area2 > 0);
+    detSum = detLeft + detRight;
+  }
+  else if (detLeft < 0.0) {
+    if (detRight >= 0.0) return det;
+
+    detSum = -detLeft - detRight;
+  }
+  else
+    return det;
+
+  double errBound = ccwErrBound*detSum;
+
+  if (det >= errBound || -det >= errBound)
+    return det;
+
+  return orient2dExact(a, b, c);
 }
 
-/*---------------------------------------------------------------------
-Computes the z-coordinate of the vector normal to face f.
----------------------------------------------------------------------*/
+// > 0 if d inside circle through counter clockwise a, b, c, < 0 if outside, 0 if on
 double
 CQChartsDelaunay::
-normz(PFace f)
+incircle(const Point &a, const Point &b, const Point &c, const Point &d)
 {
-  auto a = f->vertex(0);
-  auto b = f->vertex(1);
-  auto c = f->vertex(2);
+  double adx = a.x - d.x, ady = a.y - d.y;
+  double bdx = b.x - d.x, bdy = b.y - d.y;
+  double cdx = c.x - d.x, cdy = c.y - d.y;
+
+  double bdxcdy = bdx*cdy, cdxbdy = cdx*bdy;
+  double cdxady = cdx*ady, adxcdy = adx*cdy;
+  double adxbdy = adx*bdy, bdxady = bdx*ady;
+
+  double alift = adx*adx + ady*ady;
+  double blift = bdx*bdx + bdy*bdy;
+  double clift = cdx*cdx + cdy*cdy;
+
+  double det = alift*(bdxcdy - cdxbdy) + blift*(cdxady - adxcdy) + clift*(adxbdy - bdxady);
+
+  double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy))*alift +
+                     (std::abs(cdxady) + std::abs(adxcdy))*blift +
+                     (std::abs(adxbdy) + std::abs(bdxady))*clift;
+
+  double errBound = iccErrBound*permanent;
+
+  if (det > errBound || -det > errBound)
+    return det;
 
-  return (b->x() - a->x())*(c->y() - a->y()) - (b->y() - a->y())*(c->x() - a->x());
+  return incircleExact(a, b, c, d);
 }
@@ -1,5 +1,4 @@
 #include <CQChartsDelaunayPlot.h>
-#include <CQChartsGrahamHull.h>
 #include <CQChartsView.h>
 #include <CQChartsAxis.h>
 #include <CQChartsModelDetails.h>
@@ -264,6 +263,15 @@ setVoronoiPolygon(bool b)
 
 //---
 
+void
+CQChartsDelaunayPlot::
+setAlgorithm(const Algorithm &a)
+{
+  CQChartsUtil::testAndSet(algorithm_, a, [&]() { updateObjs(); } );
+}
+
+//---
+
 void
 CQChartsDelaunayPlot::
 addProperties()
@@ -305,6 +313,9 @@ addProperties()
   addProp("points", "points", "visible", "Center points visible");
 
   addSymbolProperties("points/symbol", "", "Data points symbol");
+
+  // options
+  addProp("options", "algorithm", "algorithm", "Triangulation algorithm");
 }
 
 CQChartsGeom::Range
@@ -436,6 +447,9 @@ createObjs(PlotObjs &objs) const
 
   th->delaunayData_ = new CQChartsDelaunay;
 
+  th->delaunayData_->setAlgorithm(algorithm() == Algorithm::HULL3D ?
+    CQChartsDelaunay::Algorithm::HULL3D : CQChartsDelaunay::Algorithm::NATIVE);
+
   //---
 
   // create points for original data points
@@ -529,9 +543,7 @@ addPointObj(const Point &p, double value, const QModelIndex &xind,
 
   auto *th = const_cast<CQChartsDelaunayPlot *>(this);
 
-  auto v = th->delaunayData_->addVertex(p.x, p.y);
-
-  v->setValue(value);
+  th->delaunayData_->addVertex(p.x, p.y, value);
 
   //---
 
@@ -624,22 +636,17 @@ drawDelaunay(PaintDevice *device) const
     //---
 
     // draw delaunay triangles
-    for (auto pf = delaunayData_->facesBegin(); pf != delaunayData_->facesEnd(); ++pf) {
-      const auto *f = *pf;
-
-      if (! f->isLower()) continue;
+    int nt = delaunayData_->numTriangles();
 
-      auto *v1 = f->vertex(0);
-      auto *v2 = f->vertex(1);
-      auto *v3 = f->vertex(2);
+    for (int t = 0; t < nt; ++t) {
+      int i1, i2, i3;
 
-      Point p1(v1->x(), v1->y());
-      Point p2(v2->x(), v2->y());
-      Point p3(v3->x(), v3->y());
+      delaunayData_->triangle(t, i1, i2, i3);
 
       QPainterPath path;
 
-      CQChartsDrawUtil::trianglePath(path, p1, p2, p3);
+      CQChartsDrawUtil::trianglePath(path, delaunayData_->vertex(i1),
+                                     delaunayData_->vertex(i2), delaunayData_->vertex(i3));
 
       device->strokePath(path, pen);
     }
@@ -664,25 +671,29 @@ drawVoronoi(PaintDevice *device) const
 
     setPenBrush(penBrush, voronoiPenData(pc), voronoiBrushData(fc));
 
-    for (auto pv = delaunayData_->verticesBegin(); pv != delaunayData_->verticesEnd(); ++pv) {
-      const auto *v1 = *pv;
+    CQChartsDelaunay::Points points;
 
-      CQChartsGrahamHull hull;
+    // clip cells to data range (cells of hull vertices are unbounded)
+    auto dataRange = calcDataRange();
 
-      for (const auto &v2 : v1->voronoi()) {
-        Point p(v2->x(), v2->y());
+    int nv = delaunayData_->numVertices();
 
-        hull.addPoint(p);
-      }
+    for (int i = 0; i < nv; ++i) {
+      // cell points are already in order around vertex
+      delaunayData_->voronoiCell(i, dataRange, points);
+
+      if (points.size() < 3) continue;
 
       Polygon poly;
 
-      hull.getHull(poly);
+      for (const auto &p : points)
+        poly.addPoint(p);
 
       auto penBrush1 = penBrush;
 
       if (valueRange_.isSet()) {
-        double v = CMathUtil::map(v1->value(), valueRange_.min(), valueRange_.max(), 0.0, 1.0);
+        double v = CMathUtil::map(delaunayData_->vertexValue(i),
+                                  valueRange_.min(), valueRange_.max(), 0.0, 1.0);
 
         auto fc1 = interpVoronoiFillColor(ColorInd(v));
 
@@ -707,13 +718,10 @@ drawVoronoi(PaintDevice *device) const
     auto symbol     = this->voronoiSymbol();
     auto symbolSize = this->voronoiSymbolSize();
 
-    for (auto pf = delaunayData_->facesBegin(); pf != delaunayData_->facesEnd(); ++pf) {
-      const auto *f = *pf;
+    int nt = delaunayData_->numTriangles();
 
-      auto *v = f->getVoronoi();
-      if (! v) continue;
-
-      Point p(v->x(), v->y());
+    for (int t = 0; t < nt; ++t) {
+      const auto &p = delaunayData_->voronoiPoint(t);
 
       if (symbol.isValid())
         CQChartsDrawUtil::drawSymbol(device, penBrush, symbol, p, symbolSize, /*scale*/true);
@@ -730,24 +738,20 @@ drawVoronoi(PaintDevice *device) const
 
     CQChartsDrawUtil::setPenBrush(device, penBrush);
 
-    for (auto pve = delaunayData_->voronoiEdgesBegin();
-           pve != delaunayData_->voronoiEdgesEnd(); ++pve) {
-      const auto *e = *pve;
-
-      auto *v1 = e->start();
-      auto *v2 = e->end  ();
+    if (isVoronoiLines()) {
+      for (const auto &e : delaunayData_->voronoiEdges())
+        device->drawLine(e.p1, e.p2);
+    }
 
-      if (isVoronoiLines()) {
-        Point p1(v1->x(), v1->y());
-        Point p2(v2->x(), v2->y());
+    if (isVoronoiCircles()) {
+      int nt = delaunayData_->numTriangles();
 
-        device->drawLine(p1, p2);
-      }
+      for (int t = 0; t < nt; ++t) {
+        const auto &c = delaunayData_->voronoiPoint(t);
 
-      if (isVoronoiCircles()) {
-        double r = v1->z();
+        double r = delaunayData_->voronoiRadius(t);
 
-        BBox bbox(v1->x() - r, v1->y() - r, v1->x() + r, v1->y() + r);
+        BBox bbox(c.x - r, c.y - r, c.x + r, c.y + r);
 
         device->drawEllipse(bbox);
       }
@@ -15,21 +15,6 @@
 
 namespace {
 
-class Tree : public CBuchHeim::Tree {
- public:
-  using Node = CQChartsDendrogram::Node;
-
- public:
-  Tree(Node *node) :
-   CBuchHeim::Tree(node->name().toStdString()), node_(node) {
-  }
-
-  Node *node() const { return node_; }
-
- private:
-  Node *node_ { nullptr };
-};
-
 class PlotDendrogram : public CQChartsDendrogram {
  public:
   using ModelIndex = CQChartsModelIndex;
@@ -184,7 +169,6 @@ term()
   delete dendrogram_;
 
   delete cacheData_.buchheimTree;
-  delete cacheData_.buchheimDrawTree;
 }
 
 //---
@@ -471,6 +455,8 @@ placeModel() const
 
   th->dendrogram_ = new PlotDendrogram;
 
+  cacheData_.buchheimValid = false;
+
   //---
 
   if (linkColumn().isValid()) {
@@ -679,76 +665,114 @@ placeBuchheim() const
   auto *root = rootNode();
   if (! root) return;
 
-  delete cacheData_.buchheimTree;
-  delete cacheData_.buchheimDrawTree;
+  auto &tree  = cacheData_.buchheimTree;
+  auto &nodes = cacheData_.buchheimNodes;
+
+  // build tree of all nodes on reload and do full layout, otherwise only re-layout
+  // subtrees of nodes whose open state has changed
+  if (! tree || ! cacheData_.buchheimValid || nodes.empty() || nodes[0] != root) {
+    initBuchheimTree(root);
+
+    tree->place();
+  }
+  else {
+    std::vector<int> changed;
 
-  cacheData_.buchheimTree = new Tree(root);
+    int n = tree->numNodes();
 
-  addBuchheimHierNode(cacheData_.buchheimTree, root);
+    for (int i = 0; i < n; ++i) {
+      bool open = nodes[size_t(i)]->isOpen();
 
-  cacheData_.buchheimDrawTree = new CBuchHeim::DrawTree(cacheData_.buchheimTree);
+      if (open != tree->isOpen(i)) {
+        tree->setOpen(i, open);
 
-  cacheData_.buchheimDrawTree->place();
+        changed.push_back(i);
+      }
+    }
 
-  cacheData_.buchheimDrawTree->fixOverlaps();
+    // many changes (e.g. expand/collapse all) are faster as a full layout
+    if (changed.size() > 64)
+      tree->place();
+    else {
+      for (auto i : changed)
+        tree->replace(i);
+    }
+  }
 
-  cacheData_.buchheimDrawTree->normalize(/*equalScale*/false);
+  tree->normalize(/*equalScale*/false);
 
   //---
 
   root->resetPlaced();
 
-  moveBuchheimHierNode(cacheData_.buchheimDrawTree);
+  moveBuchheimNodes();
 }
 
 void
 CQChartsDendrogramPlot::
-addBuchheimHierNode(CBuchHeim::Tree *tree, Node *hierNode) const
+initBuchheimTree(Node *root) const
 {
-  if (! hierNode->isOpen())
-    return;
+  auto &tree  = cacheData_.buchheimTree;
+  auto &nodes = cacheData_.buchheimNodes;
 
-  for (auto &hierNode1 : hierNode->getChildren()) {
-    auto *childTree = new Tree(hierNode1.node);
+  if (! tree)
+    tree = new CBuchHeim::FlatTree;
 
-    tree->addChild(CBuchHeim::TreeP(childTree));
+  tree->clear();
 
-    addBuchheimHierNode(childTree, hierNode1.node);
-  }
+  nodes.clear();
+
+  // add nodes breadth first (children then leaf nodes) so sibling order is kept
+  auto addNode = [&](Node *node, int parent) {
+    int i = tree->addNode(parent);
+
+    tree->setOpen(i, node->isOpen());
+
+    nodes.push_back(node);
+
+    return i;
+  };
 
-  for (auto &node : hierNode->getNodes()) {
-    auto *childTree = new Tree(node.node);
+  addNode(root, -1);
 
-    tree->addChild(CBuchHeim::TreeP(childTree));
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    auto *node = nodes[i];
+
+    for (auto &child : node->getChildren())
+      addNode(child.node, int(i));
+
+    for (auto &child : node->getNodes())
+      addNode(child.node, int(i));
   }
+
+  cacheData_.buchheimValid = true;
 }
 
 void
 CQChartsDendrogramPlot::
-moveBuchheimHierNode(CBuchHeim::DrawTree *drawTree) const
+moveBuchheimNodes() const
 {
-  auto *tree = static_cast<Tree *>(drawTree->tree());
-
-  auto *node1 = tree->node();
+  const auto *tree = cacheData_.buchheimTree;
 
-  double x1 = drawTree->x1();
-  double y1 = drawTree->y1();
-  double x2 = drawTree->x2();
-  double y2 = drawTree->y2();
+  for (auto i : tree->visibleNodes()) {
+    auto *node = cacheData_.buchheimNodes[size_t(i)];
 
-  double xc = CMathUtil::avg(x1, x2);
-  double yc = CMathUtil::avg(y1, y2);
-  double r  = 0.4*std::min(x2 - x1, y2 - y1);
+    double x1 = tree->x1(i);
+    double y1 = tree->y1(i);
+    double x2 = tree->x2(i);
+    double y2 = tree->y2(i);
 
-  if (orientation() == Qt::Horizontal)
-    node1->setBBox(BBox(yc - r, xc - r, yc + r, xc + r));
-  else
-    node1->setBBox(BBox(xc - r, 1.0 - (yc - r), xc + r, 1.0 - (yc + r)));
+    double xc = CMathUtil::avg(x1, x2);
+    double yc = CMathUtil::avg(y1, y2);
+    double r  = 0.4*std::min(x2 - x1, y2 - y1);
 
-  node1->setPlaced(true);
+    if (orientation() == Qt::Horizontal)
+      node->setBBox(BBox(yc - r, xc - r, yc + r, xc + r));
+    else
+      node->setBBox(BBox(xc - r, 1.0 - (yc - r), xc + r, 1.0 - (yc + r)));
 
-  for (const auto &node : drawTree->children())
-    moveBuchheimHierNode(node.get());
+    node->setPlaced(true);
+  }
 }
 
 void
@@ -0,0 +1,649 @@
+#include <CQChartsDisplayList.h>
+
+#include <cassert>
+
+CQChartsDisplayList::
+CQChartsDisplayList()
+{
+}
+
+void
+CQChartsDisplayList::
+clear()
+{
+  cmds_      .clear();
+  reals_     .clear();
+  pens_      .clear();
+  brushes_   .clear();
+  fonts_     .clear();
+  paths_     .clear();
+  strings_   .clear();
+  transforms_.clear();
+  qimages_   .clear();
+  images_    .clear();
+  groups_    .clear();
+  segments_  .clear();
+
+  segmentStart_ = -1;
+}
+
+size_t
+CQChartsDisplayList::
+memUsage() const
+{
+  // approximate (Qt value types counted as size of handle)
+  return cmds_      .capacity()*sizeof(Cmd) +
+         reals_     .capacity()*sizeof(double) +
+         pens_      .capacity()*sizeof(QPen) +
+         brushes_   .capacity()*sizeof(QBrush) +
+         fonts_     .capacity()*sizeof(QFont) +
+         paths_     .capacity()*sizeof(QPainterPath) +
+         strings_   .capacity()*sizeof(QString) +
+         transforms_.capacity()*sizeof(QTransform) +
+         qimages_   .capacity()*sizeof(QImage) +
+         images_    .capacity()*sizeof(Image) +
+         groups_    .capacity()*sizeof(GroupData) +
+         segments_  .capacity()*sizeof(Segment);
+}
+
+//---
+
+void
+CQChartsDisplayList::
+beginSegment(const BBox &bbox)
+{
+  segmentStart_ = numCmds();
+  segmentBBox_  = bbox;
+}
+
+void
+CQChartsDisplayList::
+endSegment()
+{
+  if (segmentStart_ < 0)
+    return;
+
+  // only store segments with commands and a valid bbox (others are always drawn)
+  if (numCmds() > segmentStart_ && segmentBBox_.isSet()) {
+    Segment segment;
+
+    segment.bbox  = segmentBBox_;
+    segment.start = segmentStart_;
+    segment.end   = numCmds();
+
+    segments_.push_back(segment);
+  }
+
+  segmentStart_ = -1;
+}
+
+//---
+
+void
+CQChartsDisplayList::
+addClipPath(const QPainterPath &path, Qt::ClipOperation op)
+{
+  paths_.push_back(path);
+
+  addCmd(Op::SET_CLIP_PATH, addReals({double(paths_.size() - 1), double(op)}));
+}
+
+void
+CQChartsDisplayList::
+addClipRect(const BBox &bbox, Qt::ClipOperation op)
+{
+  addCmd(Op::SET_CLIP_RECT, addReals({bbox.getXMin(), bbox.getYMin(),
+                                      bbox.getXMax(), bbox.getYMax(), double(op)}));
+}
+
+void
+CQChartsDisplayList::
+addPen(const QPen &pen)
+{
+  if (pens_.empty() || pens_.back() != pen)
+    pens_.push_back(pen);
+
+  addCmd(Op::SET_PEN, int(pens_.size() - 1));
+}
+
+void
+CQChartsDisplayList::
+addBrush(const QBrush &brush)
+{
+  if (brushes_.empty() || brushes_.back() != brush)
+    brushes_.push_back(brush);
+
+  addCmd(Op::SET_BRUSH, int(brushes_.size() - 1));
+}
+
+void
+CQChartsDisplayList::
+addAltColor(const QColor &c)
+{
+  addCmd(Op::SET_ALT_COLOR, addReals({c.redF(), c.greenF(), c.blueF(), c.alphaF()}));
+}
+
+void
+CQChartsDisplayList::
+addReal(const Op &op, double r)
+{
+  addCmd(op, addReals({r}));
+}
+
+void
+CQChartsDisplayList::
+addInt(const Op &op, int i)
+{
+  addCmd(op, i);
+}
+
+void
+CQChartsDisplayList::
+addFont(const QFont &font, bool scale)
+{
+  if (fonts_.empty() || fonts_.back() != font)
+    fonts_.push_back(font);
+
+  addCmd(Op::SET_FONT, addReals({double(fonts_.size() - 1), scale ? 1.0 : 0.0}));
+}
+
+void
+CQChartsDisplayList::
+addTransformRotate(const Point &p, double angle)
+{
+  addCmd(Op::SET_TRANSFORM_ROTATE, addReals({p.x, p.y, angle}));
+}
+
+void
+CQChartsDisplayList::
+addTransform(const QTransform &t, bool combine)
+{
+  transforms_.push_back(t);
+
+  addCmd(Op::SET_TRANSFORM, addReals({double(transforms_.size() - 1), combine ? 1.0 : 0.0}));
+}
+
+void
+CQChartsDisplayList::
+addRenderHints(QPainter::RenderHints hints, bool on)
+{
+  addCmd(Op::SET_RENDER_HINTS, addReals({double(int(hints)), on ? 1.0 : 0.0}));
+}
+
+void
+CQChartsDisplayList::
+addColorNames(const QString &strokeName, const QString &fillName)
+{
+  strings_.push_back(strokeName);
+  strings_.push_back(fillName);
+
+  addCmd(Op::SET_COLOR_NAMES, int(strings_.size() - 2));
+}
+
+void
+CQChartsDisplayList::
+addStartGroup(const QString &id, const GroupData &groupData)
+{
+  strings_.push_back(id);
+  groups_ .push_back(groupData);
+
+  addCmd(Op::START_GROUP, addReals({double(strings_.size() - 1), double(groups_.size() - 1)}));
+}
+
+//---
+
+void
+CQChartsDisplayList::
+addPath(const Op &op, const QPainterPath &path)
+{
+  paths_.push_back(path);
+
+  addCmd(op, addReals({double(paths_.size() - 1), -1.0}));
+}
+
+void
+CQChartsDisplayList::
+addFillPath(const QPainterPath &path, const QBrush &brush)
+{
+  paths_.push_back(path);
+
+  if (brushes_.empty() || brushes_.back() != brush)
+    brushes_.push_back(brush);
+
+  addCmd(Op::FILL_PATH, addReals({double(paths_.size() - 1), double(brushes_.size() - 1)}));
+}
+
+void
+CQChartsDisplayList::
+addStrokePath(const QPainterPath &path, const QPen &pen)
+{
+  paths_.push_back(path);
+
+  if (pens_.empty() || pens_.back() != pen)
+    pens_.push_back(pen);
+
+  addCmd(Op::STROKE_PATH, addReals({double(paths_.size() - 1), double(pens_.size() - 1)}));
+}
+
+void
+CQChartsDisplayList::
+addRect(const Op &op, const BBox &bbox)
+{
+  addCmd(op, addReals({bbox.getXMin(), bbox.getYMin(), bbox.getXMax(), bbox.getYMax()}));
+}
+
+void
+CQChartsDisplayList::
+addEllipse(const BBox &bbox, const Angle &angle)
+{
+  addCmd(Op::DRAW_ELLIPSE, addReals({bbox.getXMin(), bbox.getYMin(),
+                                     bbox.getXMax(), bbox.getYMax(), angle.value()}));
+}
+
+void
+CQChartsDisplayList::
+addPolygon(const Op &op, const Polygon &poly)
+{
+  // store point count followed by x, y values
+  int n = poly.size();
+
+  int ind = int(reals_.size());
+
+  reals_.reserve(reals_.size() + size_t(2*n + 1));
+
+  reals_.push_back(double(n));
+
+  for (int i = 0; i < n; ++i) {
+    const auto &p = poly.qpoint(i);
+
+    reals_.push_back(p.x());
+    reals_.push_back(p.y());
+  }
+
+  addCmd(op, ind);
+}
+
+void
+CQChartsDisplayList::
+addLine(const Point &p1, const Point &p2)
+{
+  addCmd(Op::DRAW_LINE, addReals({p1.x, p1.y, p2.x, p2.y}));
+}
+
+void
+CQChartsDisplayList::
+addPoint(const Point &p)
+{
+  addCmd(Op::DRAW_POINT, addReals({p.x, p.y}));
+}
+
+void
+CQChartsDisplayList::
+addText(const Op &op, const Point &p, const QString &text)
+{
+  strings_.push_back(text);
+
+  addCmd(op, addReals({p.x, p.y, double(strings_.size() - 1)}));
+}
+
+void
+CQChartsDisplayList::
+addImage(const Point &p, const QImage &image)
+{
+  qimages_.push_back(image);
+
+  addCmd(Op::DRAW_IMAGE, addReals({p.x, p.y, double(qimages_.size() - 1)}));
+}
+
+void
+CQChartsDisplayList::
+addImageInRect(const BBox &bbox, const Image &image, bool stretch, const Angle &angle)
+{
+  images_.push_back(image);
+
+  addCmd(Op::DRAW_IMAGE_IN_RECT,
+         addReals({bbox.getXMin(), bbox.getYMin(), bbox.getXMax(), bbox.getYMax(),
+                   double(images_.size() - 1), stretch ? 1.0 : 0.0, angle.value()}));
+}
+
+//---
+
+int
+CQChartsDisplayList::
+addReals(std::initializer_list<double> values)
+{
+  int ind = int(reals_.size());
+
+  reals_.insert(reals_.end(), values);
+
+  return ind;
+}
+
+CQChartsDisplayList::Pool
+CQChartsDisplayList::
+opPool(const Op &op)
+{
+  switch (op) {
+    case Op::SET_PEN          : return Pool::PEN;
+    case Op::SET_BRUSH        : return Pool::BRUSH;
+    case Op::SET_COLOR_NAMES  : return Pool::STRING;
+    case Op::SET_ALT_COLOR    :
+    case Op::SET_ALT_ALPHA    :
+    case Op::SET_FILL_ANGLE   :
+    case Op::SET_FILL_RADIUS  :
+    case Op::SET_FILL_DELTA   :
+    case Op::SET_FILL_WIDTH   :
+    case Op::SET_CLIP_PATH    :
+    case Op::SET_CLIP_RECT    :
+    case Op::SET_FONT         :
+    case Op::SET_TRANSFORM_ROTATE:
+    case Op::SET_TRANSFORM    :
+    case Op::SET_RENDER_HINTS :
+    case Op::START_GROUP      :
+    case Op::FILL_PATH        :
+    case Op::STROKE_PATH      :
+    case Op::DRAW_PATH        :
+    case Op::FILL_RECT        :
+    case Op::DRAW_RECT        :
+    case Op::DRAW_ELLIPSE     :
+    case Op::DRAW_POLYGON     :
+    case Op::DRAW_POLYLINE    :
+    case Op::DRAW_LINE        :
+    case Op::DRAW_POINT       :
+    case Op::DRAW_TEXT        :
+    case Op::DRAW_TRANSFORMED_TEXT:
+    case Op::DRAW_IMAGE       :
+    case Op::DRAW_IMAGE_IN_RECT: return Pool::REAL;
+    default                   : return Pool::NONE;
+  }
+}
+
+void
+CQChartsDisplayList::
+append(const CQChartsDisplayList &list)
+{
+  if (list.isEmpty())
+    return;
+
+  // pool offsets
+  auto realOffset      = double(reals_     .size());
+  auto penOffset       = double(pens_      .size());
+  auto brushOffset     = double(brushes_   .size());
+  auto fontOffset      = double(fonts_     .size());
+  auto pathOffset      = double(paths_     .size());
+  auto stringOffset    = double(strings_   .size());
+  auto transformOffset = double(transforms_.size());
+  auto qimageOffset    = double(qimages_   .size());
+  auto imageOffset     = double(images_    .size());
+  auto groupOffset     = double(groups_    .size());
+
+  int cmdOffset = numCmds();
+
+  //---
+
+  // copy reals and fix up pool indices stored in arena
+  reals_.insert(reals_.end(), list.reals_.begin(), list.reals_.end());
+
+  auto fixReal = [&](const Cmd &cmd, int i, double offset) {
+    reals_[size_t(cmd.ind + int(realOffset) + i)] += offset;
+  };
+
+  cmds_.reserve(cmds_.size() + list.cmds_.size());
+
+  for (const auto &cmd : list.cmds_) {
+    auto pool = opPool(cmd.op);
+
+    Cmd cmd1 = cmd;
+
+    if      (pool == Pool::REAL) {
+      switch (cmd.op) {
+        case Op::SET_CLIP_PATH: fixReal(cmd, 0, pathOffset); break;
+        case Op::SET_FONT     : fixReal(cmd, 0, fontOffset); break;
+        case Op::SET_TRANSFORM: fixReal(cmd, 0, transformOffset); break;
+        case Op::START_GROUP  : fixReal(cmd, 0, stringOffset); fixReal(cmd, 1, groupOffset); break;
+        case Op::DRAW_PATH    : fixReal(cmd, 0, pathOffset); break;
+        case Op::FILL_PATH    : fixReal(cmd, 0, pathOffset); fixReal(cmd, 1, brushOffset); break;
+        case Op::STROKE_PATH  : fixReal(cmd, 0, pathOffset); fixReal(cmd, 1, penOffset); break;
+        case Op::DRAW_TEXT:
+        case Op::DRAW_TRANSFORMED_TEXT: fixReal(cmd, 2, stringOffset); break;
+        case Op::DRAW_IMAGE        : fixReal(cmd, 2, qimageOffset); break;
+        case Op::DRAW_IMAGE_IN_RECT: fixReal(cmd, 4, imageOffset); break;
+        default: break;
+      }
+
+      cmd1.ind += int(realOffset);
+    }
+    else if (pool == Pool::PEN)
+      cmd1.ind += int(penOffset);
+    else if (pool == Pool::BRUSH)
+      cmd1.ind += int(brushOffset);
+    else if (pool == Pool::STRING)
+      cmd1.ind += int(stringOffset);
+
+    cmds_.push_back(cmd1);
+  }
+
+  pens_      .insert(pens_      .end(), list.pens_      .begin(), list.pens_      .end());
+  brushes_   .insert(brushes_   .end(), list.brushes_   .begin(), list.brushes_   .end());
+  fonts_     .insert(fonts_     .end(), list.fonts_     .begin(), list.fonts_     .end());
+  paths_     .insert(paths_     .end(), list.paths_     .begin(), list.paths_     .end());
+  strings_   .insert(strings_   .end(), list.strings_   .begin(), list.strings_   .end());
+  transforms_.insert(transforms_.end(), list.transforms_.begin(), list.transforms_.end());
+  qimages_   .insert(qimages_   .end(), list.qimages_   .begin(), list.qimages_   .end());
+  images_    .insert(images_    .end(), list.images_    .begin(), list.images_    .end());
+  groups_    .insert(groups_    .end(), list.groups_    .begin(), list.groups_    .end());
+
+  for (const auto &segment : list.segments_) {
+    auto segment1 = segment;
+
+    segment1.start += cmdOffset;
+    segment1.end   += cmdOffset;
+
+    segments_.push_back(segment1);
+  }
+}
+
+//---
+
+void
+CQChartsDisplayList::
+replay(PaintDevice *device, const BBox &cullRect) const
+{
+  bool cull = cullRect.isSet();
+
+  int nc = numCmds();
+  int ns = numSegments();
+
+  int is = 0;
+
+  for (int ic = 0; ic < nc; ++ic) {
+    const auto &cmd = cmds_[size_t(ic)];
+
+    // skip draw commands of segments outside cull rect
+    if (cull && isDrawOp(cmd.op)) {
+      while (is < ns && segments_[size_t(is)].end <= ic)
+        ++is;
+
+      if (is < ns) {
+        const auto &segment = segments_[size_t(is)];
+
+        if (ic >= segment.start && ! segment.bbox.overlaps(cullRect))
+          continue;
+      }
+    }
+
+    replayCmd(device, cmd);
+  }
+}
+
+void
+CQChartsDisplayList::
+replayCmd(PaintDevice *device, const Cmd &cmd) const
+{
+  auto bboxArg = [&](const double *r) { return BBox(r[0], r[1], r[2], r[3]); };
+
+  switch (cmd.op) {
+    case Op::SAVE:
+      device->save();
+      break;
+    case Op::RESTORE:
+      device->restore();
+      break;
+    case Op::SET_CLIP_PATH: {
+      const auto *r = reals(cmd.ind);
+      device->setClipPath(paths_[size_t(r[0])], Qt::ClipOperation(int(r[1])));
+      break;
+    }
+    case Op::SET_CLIP_RECT: {
+      const auto *r = reals(cmd.ind);
+      device->setClipRect(bboxArg(r), Qt::ClipOperation(int(r[4])));
+      break;
+    }
+    case Op::SET_PEN:
+      device->setPen(pens_[size_t(cmd.ind)]);
+      break;
+    case Op::SET_BRUSH:
+      device->setBrush(brushes_[size_t(cmd.ind)]);
+      break;
+    case Op::SET_ALT_COLOR: {
+      const auto *r = reals(cmd.ind);
+      device->setAltColor(QColor::fromRgbF(r[0], r[1], r[2], r[3]));
+      break;
+    }
+    case Op::SET_ALT_ALPHA:
+      device->setAltAlpha(*reals(cmd.ind));
+      break;
+    case Op::SET_FILL_ANGLE:
+      device->setFillAngle(*reals(cmd.ind));
+      break;
+    case Op::SET_FILL_TYPE:
+      device->setFillType(CQChartsFillPattern::Type(cmd.ind));
+      break;
+    case Op::SET_FILL_RADIUS:
+      device->setFillRadius(*reals(cmd.ind));
+      break;
+    case Op::SET_FILL_DELTA:
+      device->setFillDelta(*reals(cmd.ind));
+      break;
+    case Op::SET_FILL_WIDTH:
+      device->setFillWidth(*reals(cmd.ind));
+      break;
+    case Op::SET_FONT: {
+      const auto *r = reals(cmd.ind);
+      device->setFont(fonts_[size_t(r[0])], r[1] > 0.5);
+      break;
+    }
+    case Op::SET_TRANSFORM_ROTATE: {
+      const auto *r = reals(cmd.ind);
+      device->setTransformRotate(Point(r[0], r[1]), r[2]);
+      break;
+    }
+    case Op::SET_TRANSFORM: {
+      const auto *r = reals(cmd.ind);
+      device->setTransform(transforms_[size_t(r[0])], r[1] > 0.5);
+      break;
+    }
+    case Op::SET_RENDER_HINTS: {
+      const auto *r = reals(cmd.ind);
+      device->setRenderHints(QPainter::RenderHints(int(r[0])), r[1] > 0.5);
+      break;
+    }
+    case Op::SET_COLOR_NAMES:
+      device->setColorNames(strings_[size_t(cmd.ind)], strings_[size_t(cmd.ind + 1)]);
+      break;
+    case Op::SET_DEFAULT_COLOR_NAMES:
+      device->setColorNames();
+      break;
+    case Op::RESET_COLOR_NAMES:
+      device->resetColorNames();
+      break;
+    case Op::SET_ZOOM_FONT:
+      device->setZoomFont(cmd.ind != 0);
+      break;
+    case Op::START_GROUP: {
+      const auto *r = reals(cmd.ind);
+      device->startGroup(strings_[size_t(r[0])], groups_[size_t(r[1])]);
+      break;
+    }
+    case Op::END_GROUP:
+      device->endGroup();
+      break;
+    case Op::FILL_PATH: {
+      const auto *r = reals(cmd.ind);
+      device->fillPath(paths_[size_t(r[0])], brushes_[size_t(r[1])]);
+      break;
+    }
+    case Op::STROKE_PATH: {
+      const auto *r = reals(cmd.ind);
+      device->strokePath(paths_[size_t(r[0])], pens_[size_t(r[1])]);
+      break;
+    }
+    case Op::DRAW_PATH:
+      device->drawPath(paths_[size_t(*reals(cmd.ind))]);
+      break;
+    case Op::FILL_RECT:
+      device->fillRect(bboxArg(reals(cmd.ind)));
+      break;
+    case Op::DRAW_RECT:
+      device->drawRect(bboxArg(reals(cmd.ind)));
+      break;
+    case Op::DRAW_ELLIPSE: {
+      const auto *r = reals(cmd.ind);
+      device->drawEllipse(bboxArg(r), Angle(r[4]));
+      break;
+    }
+    case Op::DRAW_POLYGON:
+    case Op::DRAW_POLYLINE: {
+      const auto *r = reals(cmd.ind);
+
+      int n = int(r[0]);
+
+      QPolygonF qpoly;
+
+      qpoly.reserve(n);
+
+      for (int i = 0; i < n; ++i)
+        qpoly << QPointF(r[2*i + 1], r[2*i + 2]);
+
+      if (cmd.op == Op::DRAW_POLYGON)
+        device->drawPolygon (Polygon(qpoly));
+      else
+        device->drawPolyline(Polygon(qpoly));
+
+      break;
+    }
+    case Op::DRAW_LINE: {
+      const auto *r = reals(cmd.ind);
+      device->drawLine(Point(r[0], r[1]), Point(r[2], r[3]));
+      break;
+    }
+    case Op::DRAW_POINT: {
+      const auto *r = reals(cmd.ind);
+      device->drawPoint(Point(r[0], r[1]));
+      break;
+    }
+    case Op::DRAW_TEXT: {
+      const auto *r = reals(cmd.ind);
+      device->drawText(Point(r[0], r[1]), strings_[size_t(r[2])]);
+      break;
+    }
+    case Op::DRAW_TRANSFORMED_TEXT: {
+      const auto *r = reals(cmd.ind);
+      device->drawTransformedText(Point(r[0], r[1]), strings_[size_t(r[2])]);
+      break;
+    }
+    case Op::DRAW_IMAGE: {
+      const auto *r = reals(cmd.ind);
+      device->drawImage(Point(r[0], r[1]), qimages_[size_t(r[2])]);
+      break;
+    }
+    case Op::DRAW_IMAGE_IN_RECT: {
+      const auto *r = reals(cmd.ind);
+      device->drawImageInRect(bboxArg(r), images_[size_t(r[4])], r[5] > 0.5, Angle(r[6]));
+      break;
+    }
+    default:
+      assert(false);
+      break;
+  }
+}
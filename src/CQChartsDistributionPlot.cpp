@@ -353,7 +353,7 @@ setStartBucketValue(double r)
   if (r != startBucketValue()) {
     bucketer_.setRStart(r);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -371,7 +371,7 @@ setDeltaBucketValue(double r)
   if (r != deltaBucketValue()) {
     bucketer_.setRDelta(r);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -389,7 +389,7 @@ setMinBucketValue(double r)
   if (r != minBucketValue()) {
     bucketer_.setRMin(r);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -407,7 +407,7 @@ setMaxBucketValue(double r)
   if (r != maxBucketValue()) {
     bucketer_.setRMax(r);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -439,7 +439,7 @@ setNumAutoBuckets(int n)
   if (n != numAutoBuckets()) {
     bucketer_.setNumAuto(n);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -450,7 +450,7 @@ setExactBucketValue(bool b)
   if (b != exactValue_) {
     exactValue_ = b;
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -461,7 +461,7 @@ CQChartsDistributionPlot::
 setUnderflowBucket(const CQChartsOptReal &r)
 {
   CQChartsUtil::testAndSet(underflowBucket_, r, [&]() {
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   } );
 }
 
@@ -470,7 +470,7 @@ CQChartsDistributionPlot::
 setOverflowBucket(const CQChartsOptReal &r)
 {
   CQChartsUtil::testAndSet(overflowBucket_, r, [&]() {
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   } );
 }
 
@@ -486,7 +486,7 @@ setBucketStops(const CQChartsReals &r)
 
     bucketer_.setRStops(rstops);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   } );
 }
 
@@ -515,7 +515,7 @@ setBucketType(const CQBucketer::Type &type)
 
     bucketer_.setType(type);
 
-    updateGroupBucketers(); updateRangeAndObjs(); emit customDataChanged();
+    updateBuckets();
   }
 }
 
@@ -542,6 +542,20 @@ updateGroupBucketers()
   }
 }
 
+void
+CQChartsDistributionPlot::
+updateBuckets()
+{
+  updateGroupBucketers();
+
+  // only bucket settings changed so re-bucket cached sorted values on range calc
+  bucketCacheData_.rebucket = true;
+
+  CQChartsBarPlot::updateRangeAndObjs();
+
+  emit customDataChanged();
+}
+
 void
 CQChartsDistributionPlot::
 initBucketer(CQBucketer &bucketer)
@@ -938,6 +952,26 @@ setStatsLines(bool b)
 
 //---
 
+void
+CQChartsDistributionPlot::
+updateRange()
+{
+  // model values may have changed
+  bucketCacheData_.valid = false;
+
+  CQChartsBarPlot::updateRange();
+}
+
+void
+CQChartsDistributionPlot::
+updateRangeAndObjs()
+{
+  // model values may have changed
+  bucketCacheData_.valid = false;
+
+  CQChartsBarPlot::updateRangeAndObjs();
+}
+
 CQChartsGeom::Range
 CQChartsDistributionPlot::
 calcRange() const
@@ -970,42 +1004,49 @@ calcRange() const
 
   //---
 
-  // init grouping
-  initGroupData(valueColumns(), nameColumn());
+  // if only bucket settings changed then re-bucket existing (sorted) group values
+  bool rebucket = (bucketCacheData_.rebucket && bucketCacheData_.valid);
 
-  //---
+  th->bucketCacheData_.rebucket = false;
 
-  clearGroupValues();
+  if (! rebucket) {
+    // init grouping
+    initGroupData(valueColumns(), nameColumn());
 
-  //---
+    //---
 
-  // process model data (build grouped sets of values)
-  class DistributionVisitor : public ModelVisitor {
-   public:
-    DistributionVisitor(const CQChartsDistributionPlot *plot) :
-     plot_(plot) {
-    }
+    clearGroupValues();
 
-    State visit(const QAbstractItemModel *, const VisitData &data) override {
-      plot_->addRow(data);
+    //---
 
-      return State::OK;
-    }
+    // process model data (build grouped sets of values)
+    class DistributionVisitor : public ModelVisitor {
+     public:
+      DistributionVisitor(const CQChartsDistributionPlot *plot) :
+       plot_(plot) {
+      }
 
-   private:
-    const CQChartsDistributionPlot *plot_ { nullptr };
-  };
+      State visit(const QAbstractItemModel *, const VisitData &data) override {
+        plot_->addRow(data);
 
-  DistributionVisitor distributionVisitor(this);
+        return State::OK;
+      }
 
-  visitModel(distributionVisitor);
+     private:
+      const CQChartsDistributionPlot *plot_ { nullptr };
+    };
+
+    DistributionVisitor distributionVisitor(this);
+
+    visitModel(distributionVisitor);
+  }
 
   //---
 
   // bucket values sets
   clearGroupBuckets();
 
-  bucketGroupValues();
+  bucketGroupValues(rebucket);
 
   auto range = calcBucketRanges();
 
@@ -1070,7 +1111,7 @@ calcRange() const
 
 void
 CQChartsDistributionPlot::
-bucketGroupValues() const
+bucketGroupValues(bool rebucket) const
 {
   CQPerfTrace trace("CQChartsDistributionPlot::bucketGroupValues");
 
@@ -1213,16 +1254,41 @@ bucketGroupValues() const
   //---
 
   // bucket grouped sets of values
+  bool sorted = isBucketed();
+
   for (auto &groupValues : groupData_.groupValues) {
     int   groupInd = groupValues.first;
     auto *values   = groupValues.second;
 
     //---
 
+    // re-bucket from values sorted on previous calc
+    if (rebucket) {
+      bucketSortedValues(groupInd, values);
+      continue;
+    }
+
+    //---
+
+    // save sorted real values (if bucketed and numeric)
+    auto valueType = values->valueSet->type();
+
+    bool sortValues = (isBucketed() && (valueType == CQChartsValueSet::Type::REAL ||
+                                        valueType == CQChartsValueSet::Type::TIME ||
+                                        valueType == CQChartsValueSet::Type::INTEGER));
+
+    values->sortedValues.clear();
+
+    if (! sortValues)
+      sorted = false;
+
+    //---
+
     // add each index to associated bucket
     for (auto &ind : values->inds) {
       Bucket   bucket;
       QVariant value;
+      double   rvalue { 0.0 };
 
       //---
 
@@ -1241,7 +1307,10 @@ bucketGroupValues() const
             if (outlier) continue;
           }
 
-          bucket = calcBucket(groupInd, r);
+          if (! sortValues)
+            bucket = calcBucket(groupInd, r);
+
+          rvalue = r;
 
           if (type == CQChartsValueSet::Type::REAL)
             value = CQChartsVariant::fromReal(r);
@@ -1257,8 +1326,11 @@ bucketGroupValues() const
             if (outlier) continue;
           }
 
-          bucket = calcBucket(groupInd, int(i));
+          if (! sortValues)
+            bucket = calcBucket(groupInd, int(i));
+
           value  = CQChartsVariant::fromInt(i);
+          rvalue = double(i);
         }
         else {
           bool hierValue = isHierarchical();
@@ -1303,9 +1375,59 @@ bucketGroupValues() const
 
       VariantInd varInd(value, ind, dvalue);
 
-      values->bucketValues[bucket].inds.push_back(std::move(varInd));
+      // numeric values are bucketed from sorted values
+      if (sortValues)
+        values->sortedValues.emplace_back(rvalue, varInd);
+      else
+        values->bucketValues[bucket].inds.push_back(std::move(varInd));
+    }
+
+    //---
+
+    if (sortValues) {
+      std::sort(values->sortedValues.begin(), values->sortedValues.end(),
+        [](const SortedValue &lhs, const SortedValue &rhs) { return lhs.r < rhs.r; });
+
+      bucketSortedValues(groupInd, values);
     }
   }
+
+  if (! rebucket)
+    th->bucketCacheData_.valid = sorted;
+}
+
+void
+CQChartsDistributionPlot::
+bucketSortedValues(int groupInd, Values *values) const
+{
+  CQPerfTrace trace("CQChartsDistributionPlot::bucketSortedValues");
+
+  // each bucket is a contiguous range of sorted values so find end of each
+  // bucket's range with a binary search and store range (values not copied)
+  auto isSameBucket = [](const Bucket &lhs, const Bucket &rhs) {
+    return (! (lhs < rhs) && ! (rhs < lhs));
+  };
+
+  const auto &sortedValues = values->sortedValues;
+
+  auto pv1 = sortedValues.begin();
+  auto pv2 = sortedValues.end();
+
+  while (pv1 != pv2) {
+    auto bucket = calcBucket(groupInd, (*pv1).r);
+
+    auto pe = std::partition_point(pv1, pv2, [&](const SortedValue &sv) {
+      return isSameBucket(calcBucket(groupInd, sv.r), bucket);
+    });
+
+    auto &varsData = values->bucketValues[bucket];
+
+    varsData.sortedValues = &sortedValues;
+    varsData.i1           = int(pv1 - sortedValues.begin());
+    varsData.i2           = int(pe  - sortedValues.begin());
+
+    pv1 = pe;
+  }
 }
 
 CQChartsGeom::Range
@@ -1413,7 +1535,7 @@ calcBucketRanges() const
 
         //---
 
-        int n = int(varsData.inds.size());
+        int n = varsData.numInds();
 
         if (isSkipEmpty()) {
           if (isEmptyValue(n))
@@ -1689,6 +1811,8 @@ clearGroupValues() const
     delete groupValues.second;
 
   th->groupData_.groupValues.clear();
+
+  th->bucketCacheData_.valid = false;
 }
 
 void
@@ -2115,7 +2239,7 @@ createObjs(PlotObjs &objs) const
       const auto &bucket   = bucketValues.first;
       const auto &varsData = bucketValues.second;
 
-      int n = int(varsData.inds.size());
+      int n = varsData.numInds();
 
       if (isSkipEmpty()) {
         if (isEmptyValue(n))
@@ -2240,7 +2364,7 @@ createObjs(PlotObjs &objs) const
         const auto &bucket   = bucketValues.first;
         const auto &varsData = bucketValues.second;
 
-        int n = int(varsData.inds.size());
+        int n = varsData.numInds();
 
         data.buckets.emplace_back(bucket, n);
       }
@@ -2302,7 +2426,7 @@ createObjs(PlotObjs &objs) const
 
         //---
 
-        int n = int(pVarsData->inds.size());
+        int n = pVarsData->numInds();
 
         auto bbox = makeBBox(ig - 0.5, iv - 0.5, ig + 0.5, iv + 0.5);
 
@@ -2714,10 +2838,10 @@ calcVarIndsData(VariantIndsData &varInds) const
 
   CQChartsRValues rvals;
 
-  int n = int(varInds.inds.size());
+  int n = varInds.numInds();
 
   for (int i = 0; i < n; ++i) {
-    const auto &var = varInds.inds[size_t(i)];
+    const auto &var = varInds.ind(i);
 
     double r  = 0.0;
     bool   ok = false;
@@ -2747,7 +2871,7 @@ varIndsValue(const VariantIndsData &varInds) const
 {
   BarValue barValue;
 
-  if      (isValueCount()) { barValue.n1 = 0          ; barValue.n2 = int(varInds.inds.size()); }
+  if      (isValueCount()) { barValue.n1 = 0          ; barValue.n2 = varInds.numInds()       ; }
   else if (isValueRange()) { barValue.n1 = varInds.min; barValue.n2 = varInds.max             ; }
   else if (isValueMin  ()) { barValue.n1 = 0          ; barValue.n2 = varInds.min             ; }
   else if (isValueMax  ()) { barValue.n1 = 0          ; barValue.n2 = varInds.max             ; }
@@ -2767,7 +2891,15 @@ getInds(int groupInd, const Bucket &bucket, VariantInds &inds) const
   auto pb = values->bucketValues.find(bucket);
   if (pb == values->bucketValues.end()) return;
 
-  inds = (*pb).second.inds;
+  const auto &varsData = (*pb).second;
+
+  int n = varsData.numInds();
+
+  inds.clear();
+  inds.reserve(size_t(n));
+
+  for (int i = 0; i < n; ++i)
+    inds.push_back(varsData.ind(i));
 }
 
 void
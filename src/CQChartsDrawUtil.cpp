@@ -3,6 +3,7 @@
 #include <CQChartsPlotSymbol.h>
 #include <CQChartsViewPlotPaintDevice.h>
 #include <CQChartsUtil.h>
+#include <CQChartsTextCache.h>
 
 #include <CMathUtil.h>
 
@@ -340,8 +341,8 @@ drawTextInBox(PaintDevice *device, const BBox &rect,
                      prect.getXMid() + w/2.0, prect.getYMid() + h/2.0);
       }
 
-      CQChartsUtil::formatStringInRect(text1, device->font(), prect, strs,
-                                       CQChartsUtil::FormatData(options.formatSeps));
+      strs = CQChartsTextCacheInst->formatStringInRect(text1, device->font(), prect,
+                                                       options.formatSeps);
     }
     else
       strs << text1;
@@ -374,7 +375,7 @@ drawStringsInBox(PaintDevice *device, const BBox &rect, const QStringList &strs,
 {
   auto prect = device->windowToPixel(rect);
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double th = strs.size()*fm.height() + 2*options.margin;
 
@@ -411,7 +412,7 @@ drawStringsInBox(PaintDevice *device, const BBox &rect, const QStringList &strs,
 
     device->setZoomFont(zoomFont);
 
-    fm = QFontMetricsF(device->font());
+    fm = CQChartsFontMetrics(device->font());
 
     th = strs.size()*fm.height();
   }
@@ -473,7 +474,7 @@ calcTextAtPointRect(PaintDevice *device, const Point &point, const QString &text
 
   // handle html separately
   if (options.html) {
-    Size psize = CQChartsDrawPrivate::calcHtmlTextSize(text1, device->font(), options.margin);
+    Size psize = CQChartsTextCacheInst->htmlTextSize(text1, device->font(), options.margin);
 
     auto sw = device->pixelToWindowWidth (psize.width () + 4);
     auto sh = device->pixelToWindowHeight(psize.height() + 4);
@@ -486,7 +487,7 @@ calcTextAtPointRect(PaintDevice *device, const Point &point, const QString &text
 
   //---
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double ta = fm.ascent();
   double td = fm.descent();
@@ -560,7 +561,7 @@ drawTextsAtPoint(PaintDevice *device, const Point &point, const QStringList &tex
     drawTextAtPoint(device, point, texts[0], options);
   }
   else if (texts.size() == 2) {
-    QFontMetricsF fm(device->font());
+    CQChartsFontMetrics fm(device->font());
 
     double th = fm.height();
 
@@ -585,7 +586,7 @@ drawTextAtPoint(PaintDevice *device, const Point &point, const QString &text,
 
   //---
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double ta = fm.ascent();
   double td = fm.descent();
@@ -596,7 +597,7 @@ drawTextAtPoint(PaintDevice *device, const Point &point, const QString &text,
 
   // handle html separately
   if (options.html) {
-    auto psize = CQChartsDrawPrivate::calcHtmlTextSize(text1, device->font(), options.margin);
+    auto psize = CQChartsTextCacheInst->htmlTextSize(text1, device->font(), options.margin);
 
     auto sw = device->pixelToWindowWidth (psize.width () + 4);
     auto sh = device->pixelToWindowHeight(psize.height() + 4);
@@ -678,7 +679,7 @@ void
 drawAlignedText(PaintDevice *device, const Point &p, const QString &text,
                 Qt::Alignment align, double pdx, double pdy)
 {
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double tw = fm.horizontalAdvance(text);
   double ta = fm.ascent ();
@@ -706,7 +707,7 @@ CQChartsGeom::BBox
 calcAlignedTextRect(PaintDevice *device, const QFont &font, const Point &p,
                     const QString &text, Qt::Alignment align, double pdx, double pdy)
 {
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double tw = fm.horizontalAdvance(text);
   double ta = fm.ascent ();
@@ -777,11 +778,11 @@ CQChartsGeom::Size
 calcTextSize(const QString &text, const QFont &font, const TextOptions &options)
 {
   if (options.html)
-    return CQChartsDrawPrivate::calcHtmlTextSize(text, font, options.margin);
+    return CQChartsTextCacheInst->htmlTextSize(text, font, options.margin);
 
   //---
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   return Size(fm.horizontalAdvance(text), fm.height());
 }
@@ -791,7 +792,7 @@ calcTextSize(const QString &text, const QFont &font, const TextOptions &options)
 void
 drawCenteredText(PaintDevice *device, const Point &pos, const QString &text)
 {
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   auto ppos = device->windowToPixel(pos);
 
@@ -1911,7 +1912,7 @@ clipTextToLength(const QString &text, const QFont &font, double clipLength,
 
   //---
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   auto ellipseStr = QString(QChar(0x2026));
   //auto ellipseStr = "...";
@@ -2025,7 +2026,7 @@ drawPointLabel(PaintDevice *device, const Point &point, const QString &text, boo
 
   auto pp = device->windowToPixel(point);
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double fw = fm.horizontalAdvance(text);
   double fa = fm.ascent();
@@ -2069,7 +2070,7 @@ drawScaledHtmlText(PaintDevice *device, const BBox &tbbox, const QString &text,
   double s = options.scale;
 
   if (s <= 0.0) {
-    auto psize = calcHtmlTextSize(text, device->font(), options.margin);
+    auto psize = CQChartsTextCacheInst->htmlTextSize(text, device->font(), options.margin);
 
     double pw = psize.width ();
     double ph = psize.height();
@@ -2111,7 +2112,7 @@ drawHtmlText(PaintDevice *device, const Point &center, const BBox &tbbox,
 
   //---
 
-  auto psize = calcHtmlTextSize(text, device->font(), options.margin);
+  auto psize = CQChartsTextCacheInst->htmlTextSize(text, device->font(), options.margin);
 
   double c = options.angle.cos();
   double s = options.angle.sin();
@@ -2147,18 +2148,50 @@ drawHtmlText(PaintDevice *device, const Point &center, const BBox &tbbox,
 
   //---
 
+  // text transform in device pixels (rotate about center and move to text rect)
+  double tx = ptbbox1.getXMin();
+  double ty = ptbbox1.getYMin();
+
+  QTransform transform;
+
+  if (! options.angle.isZero()) {
+  //auto tc = ptbbox1.getCenter().qpoint();
+    auto tc = device->windowToPixel(center).qpoint();
+
+    transform.translate(tc.x(), tc.y());
+    transform.rotate(-options.angle.value());
+    transform.translate(-tc.x(), -tc.y());
+  }
+
+  transform.translate(tx, ty);
+
+  //---
+
   QImage    image;
+  QRect     irect;
   QPainter *painter  = nullptr;
   QPainter *ipainter = nullptr;
 
-  if (device->isInteractive()) {
-    painter = dynamic_cast<CQChartsViewPlotPaintDevice *>(device)->painter();
+  // draw directly to painter for interactive plot/view devices (not recorded)
+  auto *viewPlotDevice =
+    (device->isInteractive() ? dynamic_cast<CQChartsViewPlotPaintDevice *>(device) : nullptr);
+
+  if (viewPlotDevice) {
+    painter = viewPlotDevice->painter();
   }
   else {
-    image = CQChartsUtil::initImage(QSize(int(ptbbox.getWidth()), int(ptbbox.getHeight())));
+    // image covers transformed text rect (with contrast border) in device pixels
+    irect = transform.mapRect(QRectF(-2, -2, psize.width() + 4, psize.height() + 4)).
+              toAlignedRect();
+
+    image = CQChartsUtil::initImage(irect.size());
+
+    image.fill(Qt::transparent);
 
     ipainter = new QPainter(&image);
 
+    ipainter->translate(-irect.x(), -irect.y());
+
     painter = ipainter;
   }
 
@@ -2169,14 +2202,7 @@ drawHtmlText(PaintDevice *device, const Point &center, const BBox &tbbox,
   //painter->drawRect(ptbbox .qrect()); // DEBUG
   //painter->drawRect(ptbbox1.qrect()); // DEBUG
 
-  if (! options.angle.isZero()) {
-  //auto tc = ptbbox1.getCenter().qpoint();
-    auto tc = device->windowToPixel(center).qpoint();
-
-    painter->translate(tc);
-    painter->rotate(-options.angle.value());
-    painter->translate(-tc);
-  }
+  painter->setTransform(transform, /*combine*/true);
 
   QTextDocument td;
 
@@ -2184,14 +2210,6 @@ drawHtmlText(PaintDevice *device, const Point &center, const BBox &tbbox,
   td.setHtml(text);
   td.setDefaultFont(device->font());
 
-  //auto ptbbox2 = ptbbox1.translated(-ptbbox.getXMin(), -ptbbox.getYMin()); // move to origin
-
-  double tx = ptbbox1.getXMin();
-  double ty = ptbbox1.getYMin();
-
-  if (device->isInteractive())
-    painter->translate(tx, ty);
-
   //if (options.angle.isZero())
   //  painter->setClipRect(ptbbox2.qrect(), Qt::IntersectClip);
 
@@ -2254,14 +2272,17 @@ drawHtmlText(PaintDevice *device, const Point &center, const BBox &tbbox,
     layout->draw(painter, ctx);
   }
 
-  if (device->isInteractive())
-    painter->translate(-tx, -ty);
-
   //---
 
   painter->restore();
 
   delete ipainter;
+
+  //---
+
+  // recording device has no painter so record rendered text image
+  if (device->type() == CQChartsPaintDevice::Type::RECORD)
+    device->drawImage(device->pixelToWindow(Point(irect.x(), irect.y())), image);
 }
 
 }
@@ -11,6 +11,7 @@
 #include <CQChartsVariant.h>
 #include <CQChartsHtml.h>
 #include <CQChartsWidgetUtil.h>
+#include <CQChartsParallel.h>
 
 #include <CQPropertyViewItem.h>
 #include <CQPerfMonitor.h>
@@ -39,6 +40,7 @@ QString
 CQChartsImagePlotType::
 description() const
 {
+  auto B   = [](const QString &str) { return CQChartsHtml::Str::bold(str); };
   auto IMG = [](const QString &src) { return CQChartsHtml::Str::img(src); };
 
   return CQChartsHtml().
@@ -57,6 +59,10 @@ description() const
      p("X and/or Y labels can be added to the outside of the grid.").
      p("Labels can be added to each grid cell and the labels can be scaled "
        "to represent the size of the associated value.").
+     p("Large grids are drawn as a raster (instead of a cell object per value) when "
+       "the number of visible cells is greater than " + B("maxCellObjs") + ". This can be "
+       "controlled using the " + B("drawType") + " option. Zoomed out raster pixels show the "
+       "min, mean or max of their cells (" + B("rasterValue") + " option).").
     h3("Limitations").
      p("Does not support axes.").
     h3("Example").
@@ -128,6 +134,12 @@ addProperties()
   // cell style
   addProp("cell", "cellStyle", "style", "Cell style (rect or balloon)");
 
+  // cell draw type
+  addProp("cell", "drawType"   , "drawType"   , "Draw cells as objects or raster");
+  addProp("cell", "maxCellObjs", "maxCellObjs",
+          "Max visible cells drawn as objects for auto draw type")->setMinValue(0);
+  addProp("cell", "rasterValue", "rasterValue", "Value of zoomed out raster pixel cells");
+
   // cell labels
 //addProp("cell/labels", "scaleCellLabels", "scaled" , "Scale cell labels");
 
@@ -236,6 +248,29 @@ setCellStyle(const CellStyle &cellStyle)
 
 //---
 
+void
+CQChartsImagePlot::
+setDrawType(const DrawType &t)
+{
+  CQChartsUtil::testAndSet(drawType_, t, [&]() { updateObjs(); } );
+}
+
+void
+CQChartsImagePlot::
+setMaxCellObjs(int n)
+{
+  CQChartsUtil::testAndSet(maxCellObjs_, std::max(n, 0), [&]() { updateObjs(); } );
+}
+
+void
+CQChartsImagePlot::
+setRasterValue(const RasterValue &v)
+{
+  CQChartsUtil::testAndSet(rasterValue_, v, [&]() { drawObjs(); } );
+}
+
+//---
+
 CQChartsGeom::Range
 CQChartsImagePlot::
 calcRange() const
@@ -246,10 +281,11 @@ calcRange() const
 
   //---
 
-  // calc min/max value
+  // calc min/max value and save cell values
   class RowVisitor : public ModelVisitor {
    public:
-    using Plot = CQChartsImagePlot;
+    using Plot   = CQChartsImagePlot;
+    using Values = std::vector<float>;
 
    public:
     RowVisitor(const Plot *plot) :
@@ -274,14 +310,23 @@ calcRange() const
 
         if (columnTypes_[size_t(ic)] == CQBaseModelType::IMAGE) {
           valueRange_.add(0.0);
+
+          values_.push_back(float(CMathUtil::getNaN()));
+
+          hasImages_ = true;
         }
         else {
           bool ok;
 
           double value = plot_->modelReal(columnModelInd, ok);
 
-          if (ok && ! CMathUtil::isNaN(value))
+          if (ok && ! CMathUtil::isNaN(value)) {
             valueRange_.add(value);
+
+            values_.push_back(float(value));
+          }
+          else
+            values_.push_back(float(CMathUtil::getNaN()));
         }
       }
 
@@ -291,12 +336,18 @@ calcRange() const
     double minValue() const { return valueRange_.min(0.0); }
     double maxValue() const { return valueRange_.max(1.0); }
 
+    Values &values() { return values_; }
+
+    bool hasImages() const { return hasImages_; }
+
    private:
     using ColumnTypes = std::vector<ColumnType>;
 
-    const Plot* plot_     { nullptr };
+    const Plot* plot_      { nullptr };
     RMinMax     valueRange_;
     ColumnTypes columnTypes_;
+    Values      values_;
+    bool        hasImages_ { false };
   };
 
   RowVisitor visitor(this);
@@ -329,6 +380,21 @@ calcRange() const
 
   //---
 
+  // save cell values for raster
+  th->gridData_.nr        = nr_;
+  th->gridData_.nc        = nc_;
+  th->gridData_.hasImages = visitor.hasImages();
+
+  std::swap(th->gridData_.values, visitor.values());
+
+  {
+  std::unique_lock<std::mutex> lock(rasterMutex_);
+
+  rasterData_.valid = false;
+  }
+
+  //---
+
   return dataRange;
 }
 
@@ -342,6 +408,43 @@ createObjs(PlotObjs &objs) const
 
   NoUpdate noUpdate(this);
 
+  auto *th = const_cast<CQChartsImagePlot *>(this);
+
+  //---
+
+  // create objects for visible cells if few enough (otherwise cells are drawn as raster)
+  CellRange visibleRange;
+
+  calcVisibleCellRange(visibleRange);
+
+  th->drawRaster_   = ! isCellObjs(visibleRange);
+  th->cellObjRange_ = CellRange();
+
+  if (isDrawRaster() || nr_ <= 0 || nc_ <= 0)
+    return true;
+
+  CellRange range;
+
+  range.set = true;
+  range.r1  = 0; range.r2 = nr_ - 1;
+  range.c1  = 0; range.c2 = nc_ - 1;
+
+  if (drawType() == DrawType::AUTO) {
+    if (! visibleRange.set)
+      return true;
+
+    range = visibleRange;
+
+    // add margin so small pans don't need new objects
+    int dr = (range.r2 - range.r1 + 1)/4;
+    int dc = (range.c2 - range.c1 + 1)/4;
+
+    range.r1 = std::max(range.r1 - dr, 0); range.r2 = std::min(range.r2 + dr, nr_ - 1);
+    range.c1 = std::max(range.c1 - dc, 0); range.c2 = std::min(range.c2 + dc, nc_ - 1);
+  }
+
+  th->cellObjRange_ = range;
+
   //---
 
   class RowVisitor : public ModelVisitor {
@@ -349,8 +452,8 @@ createObjs(PlotObjs &objs) const
     using Plot = CQChartsImagePlot;
 
    public:
-    RowVisitor(const Plot *plot, PlotObjs &objs) :
-     plot_(plot), objs_(objs) {
+    RowVisitor(const Plot *plot, const CellRange &range, PlotObjs &objs) :
+     plot_(plot), range_(range), objs_(objs) {
     }
 
     void initVisit() override {
@@ -364,9 +467,21 @@ createObjs(PlotObjs &objs) const
     }
 
     State visit(const QAbstractItemModel *, const VisitData &data) override {
-      x_ = 0.0;
+      // skip rows outside object range
+      if (data.vrow < range_.r1) {
+        y_ += dy_;
 
-      for (int ic = 0; ic < numCols(); ++ic) {
+        return State::OK;
+      }
+
+      if (data.vrow > range_.r2)
+        return State::TERMINATE;
+
+      //---
+
+      x_ = range_.c1*dx_;
+
+      for (int ic = range_.c1; ic <= range_.c2; ++ic) {
         Column c(ic);
 
         ModelIndex columnInd(plot_, data.row, c, data.parent);
@@ -422,6 +537,7 @@ createObjs(PlotObjs &objs) const
     using ColumnTypes = std::vector<ColumnType>;
 
     const Plot* plot_ { nullptr };
+    CellRange   range_;
     PlotObjs&   objs_;
     double      x_    { 0.0 };
     double      y_    { 0.0 };
@@ -430,7 +546,7 @@ createObjs(PlotObjs &objs) const
     ColumnTypes columnTypes_;
   };
 
-  RowVisitor visitor(this, objs);
+  RowVisitor visitor(this, range, objs);
 
   visitModel(visitor);
 
@@ -475,12 +591,96 @@ addImageObj(int row, int col, const BBox &bbox, const CQChartsImage &image,
   return imageObj;
 }
 
+void
+CQChartsImagePlot::
+calcVisibleCellRange(CellRange &range) const
+{
+  range = CellRange();
+
+  if (nr_ <= 0 || nc_ <= 0)
+    return;
+
+  range.set = true;
+  range.r1  = 0; range.r2 = nr_ - 1;
+  range.c1  = 0; range.c2 = nc_ - 1;
+
+  //---
+
+  // restrict to rows/columns inside plot area (cell is unit square)
+  auto vbbox = calcPlotViewRect();
+
+  if (! vbbox.isValid())
+    return;
+
+  int c1 = int(std::floor(vbbox.getXMin()));
+  int c2 = int(std::floor(vbbox.getXMax()));
+  int r1 = int(std::floor(vbbox.getYMin()));
+  int r2 = int(std::floor(vbbox.getYMax()));
+
+  if (c2 < 0 || c1 >= nc_ || r2 < 0 || r1 >= nr_) {
+    range.set = false;
+    return;
+  }
+
+  range.r1 = std::max(r1, 0); range.r2 = std::min(r2, nr_ - 1);
+  range.c1 = std::max(c1, 0); range.c2 = std::min(c2, nc_ - 1);
+}
+
+bool
+CQChartsImagePlot::
+isCellObjs(const CellRange &visibleRange) const
+{
+  if      (drawType() == DrawType::CELLS)
+    return true;
+  else if (drawType() == DrawType::RASTER)
+    return false;
+
+  // raster can't draw image cells
+  if (gridData_.hasImages)
+    return true;
+
+  return (visibleRange.numCells() <= maxCellObjs());
+}
+
+bool
+CQChartsImagePlot::
+cellAtPoint(const Point &p, int &row, int &col) const
+{
+  if (gridData_.nr <= 0 || gridData_.nc <= 0)
+    return false;
+
+  col = int(std::floor(p.x));
+  row = int(std::floor(p.y));
+
+  return (row >= 0 && row < gridData_.nr && col >= 0 && col < gridData_.nc);
+}
+
 //---
 
 bool
 CQChartsImagePlot::
 probe(ProbeData &probeData) const
 {
+  // map point to cell
+  if (isDrawRaster()) {
+    int row, col;
+
+    if (! cellAtPoint(probeData.p, row, col))
+      return false;
+
+    Point c(col + 0.5, row + 0.5);
+
+    probeData.p    = c;
+    probeData.both = true;
+
+    probeData.xvals.emplace_back(c.x, "", "");
+    probeData.yvals.emplace_back(c.y, "", "");
+
+    return true;
+  }
+
+  //---
+
   CQChartsPlotObj *obj;
 
   if (! objNearestPoint(probeData.p, obj))
@@ -499,6 +699,80 @@ probe(ProbeData &probeData) const
 
 //---
 
+void
+CQChartsImagePlot::
+applyDataRangeAndDraw()
+{
+  CQChartsPlot::applyDataRangeAndDraw();
+
+  //---
+
+  // recreate objects if zoom/pan changes draw of visible cells (objects or raster)
+  if (drawType() != DrawType::AUTO)
+    return;
+
+  CellRange visibleRange;
+
+  calcVisibleCellRange(visibleRange);
+
+  bool cellObjs = isCellObjs(visibleRange);
+
+  if      (cellObjs == isDrawRaster())
+    updateObjs();
+  else if (cellObjs && visibleRange.set && ! cellObjRange_.contains(visibleRange))
+    updateObjs();
+}
+
+bool
+CQChartsImagePlot::
+plotTipText(const Point &p, QString &tip, bool single) const
+{
+  if (! isDrawRaster())
+    return CQChartsPlot::plotTipText(p, tip, single);
+
+  // map point to cell
+  int row, col;
+
+  if (! cellAtPoint(p, row, col))
+    return false;
+
+  if (CMathUtil::isNaN(gridData_.values[size_t(row)*size_t(gridData_.nc) + size_t(col)]))
+    return false;
+
+  //---
+
+  ModelIndex columnInd(this, row, Column(col), QModelIndex());
+
+  bool ok;
+
+  double value = modelReal(columnInd, ok);
+
+  auto ind = normalizeIndex(modelIndex(columnInd));
+
+  //---
+
+  CQChartsTableTip tableTip;
+
+  auto xname = modelHHeaderString(Column(col), ok);
+  auto yname = modelVHeaderString(row, ok);
+
+  if (xname.length())
+    tableTip.addTableRow("X", xname);
+
+  if (yname.length())
+    tableTip.addTableRow("Y", yname);
+
+  tableTip.addTableRow("Value", value);
+
+  addTipColumns(tableTip, ind);
+
+  tip = tableTip.str();
+
+  return true;
+}
+
+//---
+
 bool
 CQChartsImagePlot::
 addMenuItems(QMenu *menu)
@@ -527,6 +801,403 @@ addMenuItems(QMenu *menu)
 
 //------
 
+void
+CQChartsImagePlot::
+preDrawObjs(PaintDevice *) const
+{
+  // calc value cell fill colors in one batch from palette lookup table
+  using ImageObjs = std::vector<CQChartsImageObj *>;
+
+  ImageObjs           imageObjs;
+  std::vector<double> values;
+
+  bool batch = (colorType() == ColorType::AUTO && isCellFilled());
+
+  for (const auto &plotObj : plotObjects()) {
+    auto *imageObj = dynamic_cast<CQChartsImageObj *>(plotObj);
+    if (! imageObj) continue;
+
+    imageObj->setLutFillColor(QColor());
+
+    if (! batch || imageObj->isImage() || imageObj->bgColor().isValid())
+      continue;
+
+    imageObjs.push_back(imageObj);
+
+    values.push_back(CMathUtil::norm(imageObj->value(), minValue(), maxValue()));
+  }
+
+  if (imageObjs.empty())
+    return;
+
+  std::vector<QRgb> rgbs;
+
+  if (! interpColorValues(cellFillColor(), values, rgbs))
+    return;
+
+  for (size_t i = 0; i < imageObjs.size(); ++i)
+    imageObjs[i]->setLutFillColor(QColor::fromRgba(rgbs[i]));
+}
+
+bool
+CQChartsImagePlot::
+hasBackground() const
+{
+  return isDrawRaster();
+}
+
+void
+CQChartsImagePlot::
+execDrawBackground(PaintDevice *device) const
+{
+  if (isDrawRaster())
+    drawRaster(device);
+}
+
+void
+CQChartsImagePlot::
+drawRaster(PaintDevice *device) const
+{
+  CQPerfTrace trace("CQChartsImagePlot::drawRaster");
+
+  if (! isCellFilled())
+    return;
+
+  std::unique_lock<std::mutex> lock(rasterMutex_);
+
+  updateRasterLevels();
+
+  auto &levels = rasterData_.levels;
+
+  int nl = int(levels.size());
+  int nr = gridData_.nr;
+  int nc = gridData_.nc;
+
+  if (nl == 0)
+    return;
+
+  //---
+
+  // clear colored tiles if palette, value or value range changed
+  RGBs colors;
+
+  for (int i = 0; i <= 4; ++i)
+    colors.push_back(interpCellFillColor(ColorInd(i/4.0)).rgba());
+
+  double fillAlpha = cellFillAlpha().valueOr(1.0);
+
+  if (colors != rasterData_.colors || rasterValue() != rasterData_.value ||
+      minValue() != rasterData_.minValue || maxValue() != rasterData_.maxValue ||
+      fillAlpha != rasterData_.fillAlpha) {
+    rasterData_.colors    = colors;
+    rasterData_.value     = rasterValue();
+    rasterData_.minValue  = minValue();
+    rasterData_.maxValue  = maxValue();
+    rasterData_.fillAlpha = fillAlpha;
+
+    for (auto &rlevel : levels) {
+      for (auto &tile : rlevel.tiles)
+        tile = QImage();
+    }
+  }
+
+  //---
+
+  // get visible part of cells (pixels)
+  auto pbbox = windowToPixel(BBox(0.0, 0.0, nc, nr));
+
+  BBox vbbox;
+
+  if (! pbbox.intersect(calcPlotPixelRect(), vbbox))
+    return;
+
+  int x1 = int(std::floor(vbbox.getXMin())), x2 = int(std::ceil(vbbox.getXMax()));
+  int y1 = int(std::floor(vbbox.getYMin())), y2 = int(std::ceil(vbbox.getYMax()));
+
+  int w = x2 - x1;
+  int h = y2 - y1;
+
+  if (w <= 0 || h <= 0)
+    return;
+
+  //---
+
+  // use mip level where each texel is no more than a pixel
+  double cellPixels = std::min(pbbox.getWidth()/nc, pbbox.getHeight()/nr);
+
+  int level = 0;
+
+  while (level + 1 < nl && cellPixels*(1 << (level + 1)) <= 1.0)
+    ++level;
+
+  const auto &rlevel = levels[size_t(level)];
+
+  //---
+
+  // get level texel at each pixel center
+  std::vector<int> texelCols(size_t(w));
+  std::vector<int> texelRows(size_t(h));
+
+  for (int i = 0; i < w; ++i) {
+    auto p = pixelToWindow(Point(x1 + i + 0.5, 0.0));
+
+    int c = std::min(std::max(int(std::floor(p.x)), 0), nc - 1);
+
+    texelCols[size_t(i)] = std::min(c >> level, rlevel.nc - 1);
+  }
+
+  for (int j = 0; j < h; ++j) {
+    auto p = pixelToWindow(Point(0.0, y1 + j + 0.5));
+
+    int r = std::min(std::max(int(std::floor(p.y)), 0), nr - 1);
+
+    texelRows[size_t(j)] = std::min(r >> level, rlevel.nr - 1);
+  }
+
+  //---
+
+  // color visible tiles
+  auto tileSize = rasterTileSize();
+
+  auto tcr = std::minmax_element(texelCols.begin(), texelCols.end());
+  auto trr = std::minmax_element(texelRows.begin(), texelRows.end());
+
+  for (int tr = *trr.first/tileSize; tr <= *trr.second/tileSize; ++tr) {
+    for (int tc = *tcr.first/tileSize; tc <= *tcr.second/tileSize; ++tc)
+      (void) rasterTile(level, tr, tc);
+  }
+
+  //---
+
+  // sample tile texels for each pixel
+  QImage pimage(w, h, QImage::Format_ARGB32);
+
+  CQChartsParallel::forChunks(h, [&](int j1, int j2) {
+    for (int j = j1; j < j2; ++j) {
+      int tr = texelRows[size_t(j)];
+
+      const auto *tileRow = &rlevel.tiles[size_t(tr/tileSize)*size_t(rlevel.ntc)];
+
+      int ty = tr % tileSize;
+
+      auto *dst = reinterpret_cast<QRgb *>(pimage.scanLine(j));
+
+      for (int i = 0; i < w; ++i) {
+        int tc = texelCols[size_t(i)];
+
+        const auto &tile = tileRow[tc/tileSize];
+
+        dst[i] = reinterpret_cast<const QRgb *>(tile.constScanLine(ty))[tc % tileSize];
+      }
+    }
+  }, 64);
+
+  device->drawImage(pixelToWindow(Point(x1, y1)), pimage);
+}
+
+void
+CQChartsImagePlot::
+updateRasterLevels() const
+{
+  if (rasterData_.valid)
+    return;
+
+  CQPerfTrace trace("CQChartsImagePlot::updateRasterLevels");
+
+  rasterData_.valid = true;
+
+  rasterData_.levels.clear();
+
+  int nr = gridData_.nr;
+  int nc = gridData_.nc;
+
+  if (nr <= 0 || nc <= 0)
+    return;
+
+  //---
+
+  // number of levels (last level is single texel)
+  int nl = 1;
+
+  while ((1 << (nl - 1)) < std::max(nr, nc))
+    ++nl;
+
+  auto &levels = rasterData_.levels;
+
+  levels.resize(size_t(nl));
+
+  auto tileSize = rasterTileSize();
+
+  auto initLevel = [&](RasterLevel &rlevel, int nr1, int nc1) {
+    rlevel.nr  = nr1;
+    rlevel.nc  = nc1;
+    rlevel.ntr = (nr1 + tileSize - 1)/tileSize;
+    rlevel.ntc = (nc1 + tileSize - 1)/tileSize;
+
+    rlevel.tiles.resize(size_t(rlevel.ntr)*size_t(rlevel.ntc));
+  };
+
+  // level 0 uses grid values
+  initLevel(levels[0], nr, nc);
+
+  // each level texel is min/mean/max of (up to) 2x2 texels of previous level
+  for (int level = 1; level < nl; ++level) {
+    const auto &plevel = levels[size_t(level - 1)];
+    auto       &rlevel = levels[size_t(level    )];
+
+    initLevel(rlevel, (plevel.nr + 1)/2, (plevel.nc + 1)/2);
+
+    size_t n = size_t(rlevel.nr)*size_t(rlevel.nc);
+
+    rlevel.minValues .resize(n);
+    rlevel.meanValues.resize(n);
+    rlevel.maxValues .resize(n);
+    rlevel.counts    .resize(n);
+
+    CQChartsParallel::forChunks(rlevel.nr, [&](int r1, int r2) {
+      for (int r = r1; r < r2; ++r) {
+        for (int c = 0; c < rlevel.nc; ++c) {
+          float  vmin  = 0.0f, vmax = 0.0f;
+          double sum   = 0.0;
+          int    count = 0;
+
+          for (int pr = 2*r; pr < std::min(2*r + 2, plevel.nr); ++pr) {
+            for (int pc = 2*c; pc < std::min(2*c + 2, plevel.nc); ++pc) {
+              size_t pi = size_t(pr)*size_t(plevel.nc) + size_t(pc);
+
+              float pmin, pmean, pmax;
+              int   pcount;
+
+              if (level == 1) {
+                pmin = pmean = pmax = gridData_.values[pi];
+
+                pcount = (CMathUtil::isNaN(pmin) ? 0 : 1);
+              }
+              else {
+                pmin   = plevel.minValues [pi];
+                pmean  = plevel.meanValues[pi];
+                pmax   = plevel.maxValues [pi];
+                pcount = plevel.counts    [pi];
+              }
+
+              if (pcount == 0)
+                continue;
+
+              if (count == 0) {
+                vmin = pmin;
+                vmax = pmax;
+              }
+              else {
+                vmin = std::min(vmin, pmin);
+                vmax = std::max(vmax, pmax);
+              }
+
+              sum   += double(pmean)*pcount;
+              count += pcount;
+            }
+          }
+
+          size_t i = size_t(r)*size_t(rlevel.nc) + size_t(c);
+
+          float nan = float(CMathUtil::getNaN());
+
+          rlevel.minValues [i] = (count > 0 ? vmin             : nan);
+          rlevel.meanValues[i] = (count > 0 ? float(sum/count) : nan);
+          rlevel.maxValues [i] = (count > 0 ? vmax             : nan);
+          rlevel.counts    [i] = count;
+        }
+      }
+    }, 16);
+  }
+}
+
+const QImage &
+CQChartsImagePlot::
+rasterTile(int level, int tr, int tc) const
+{
+  auto &rlevel = rasterData_.levels[size_t(level)];
+
+  auto &tile = rlevel.tiles[size_t(tr)*size_t(rlevel.ntc) + size_t(tc)];
+
+  if (! tile.isNull())
+    return tile;
+
+  //---
+
+  auto tileSize = rasterTileSize();
+
+  int r1 = tr*tileSize;
+  int c1 = tc*tileSize;
+  int h  = std::min(tileSize, rlevel.nr - r1);
+  int w  = std::min(tileSize, rlevel.nc - c1);
+
+  // get normalized values of non-missing texels
+  std::vector<double> values;
+  std::vector<int>    inds;
+
+  for (int r = 0; r < h; ++r) {
+    for (int c = 0; c < w; ++c) {
+      float value = rasterTexelValue(level, r1 + r, c1 + c);
+      if (CMathUtil::isNaN(value)) continue;
+
+      double v = CMathUtil::norm(value, minValue(), maxValue());
+
+      values.push_back(std::min(std::max(v, 0.0), 1.0));
+      inds  .push_back(r*w + c);
+    }
+  }
+
+  // calc colors using palette lookup (one color per value if not palette)
+  std::vector<QRgb> rgbs;
+
+  if (! interpColorValues(cellFillColor(), values, rgbs)) {
+    rgbs.resize(values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+      rgbs[i] = interpCellFillColor(ColorInd(values[i])).rgba();
+  }
+
+  //---
+
+  // missing texels are transparent
+  tile = QImage(w, h, QImage::Format_ARGB32);
+
+  tile.fill(Qt::transparent);
+
+  double fillAlpha = rasterData_.fillAlpha;
+
+  for (size_t i = 0; i < inds.size(); ++i) {
+    auto rgb = rgbs[i];
+
+    if (fillAlpha < 1.0)
+      rgb = qRgba(qRed(rgb), qGreen(rgb), qBlue(rgb), int(qAlpha(rgb)*fillAlpha));
+
+    auto *dst = reinterpret_cast<QRgb *>(tile.scanLine(inds[i]/w));
+
+    dst[inds[i] % w] = rgb;
+  }
+
+  return tile;
+}
+
+float
+CQChartsImagePlot::
+rasterTexelValue(int level, int r, int c) const
+{
+  if (level == 0)
+    return gridData_.values[size_t(r)*size_t(gridData_.nc) + size_t(c)];
+
+  const auto &rlevel = rasterData_.levels[size_t(level)];
+
+  size_t i = size_t(r)*size_t(rlevel.nc) + size_t(c);
+
+  switch (rasterValue()) {
+    case RasterValue::MIN : return rlevel.minValues [i];
+    case RasterValue::MAX : return rlevel.maxValues [i];
+    default               : return rlevel.meanValues[i];
+  }
+}
+
 bool
 CQChartsImagePlot::
 hasForeground() const
@@ -995,7 +1666,7 @@ calcPenBrush(PenBrush &penBrush, bool updateState) const
   //---
 
   // set pen and brush
-  auto fc = plot_->interpCellFillColor  (ic);
+  auto fc = (lutFillColor().isValid() ? lutFillColor() : plot_->interpCellFillColor(ic));
   auto bc = plot_->interpCellStrokeColor(ic);
 
   if (bgColor().isValid())
@@ -48,6 +48,21 @@ invalidate(bool reload)
   }
 }
 
+void
+CQChartsInvalidator::
+invalidateProperty(const char *name, bool reload)
+{
+  auto *plot = (name ? qobject_cast<CQChartsPlot *>(obj_) : nullptr);
+
+  if (! plot)
+    return invalidate(reload);
+
+  // record invalidate as stages requested by property (declared stages applied instead)
+  CQChartsPlot::PropertyStagesScope scope(plot, name);
+
+  invalidate(reload);
+}
+
 //---
 
 QColor
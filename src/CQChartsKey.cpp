@@ -13,6 +13,7 @@
 #include <CQChartsViewPlotPaintDevice.h>
 #include <CQChartsSymbolSet.h>
 #include <CQCharts.h>
+#include <CQChartsTextCache.h>
 
 #include <CQPropertyViewModel.h>
 #include <CQPropertyViewItem.h>
@@ -294,7 +295,7 @@ doLayout()
 
   auto font = view()->viewFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double bs = fm.height() + 4.0;
 
@@ -560,7 +561,7 @@ draw(PaintDevice *device) const
 
   view()->setPainterFont(device, textFont());
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double px1 = px + xlp;
   double py1 = py + ytp;
@@ -2838,7 +2839,7 @@ size() const
 
   auto font = plot->view()->plotFont(plot, key_->textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double clipLength = drawPlot->lengthPixelWidth(key_->textClipLength());
   auto   clipElide  = key_->textClipElide();
@@ -2933,7 +2934,7 @@ size() const
 
   auto font = plot->view()->plotFont(plot, key_->textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double h = fm.height();
 
@@ -3101,7 +3102,7 @@ size() const
 
   auto font = plot->view()->plotFont(plot, key_->textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double w = fm.horizontalAdvance("-X-");
   double h = fm.height();
@@ -3203,7 +3204,7 @@ size() const
   // get char width/height
   auto font = plot_->view()->plotFont(plot_, key_->textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double fw = fm.horizontalAdvance("X");
   double fh = fm.height();
@@ -3235,7 +3236,7 @@ draw(PaintDevice *device, const BBox &rect) const
   // get char height
   plot_->setPainterFont(device, key_->textFont());
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double fh = fm.height();
 
@@ -3395,7 +3396,7 @@ size() const
   // get char width/height
   auto font = plot_->view()->plotFont(plot_, key_->textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double fw = fm.horizontalAdvance("X") + 4;
   double fh = fm.height() + 4;
@@ -3454,7 +3455,7 @@ draw(PaintDevice *device, const BBox &rect) const
   // get char height
   plot_->setPainterFont(device, key_->textFont());
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double fw = fm.horizontalAdvance("X") + 4;
   double fh = fm.height() + 4;
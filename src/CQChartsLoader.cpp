@@ -6,6 +6,7 @@
 #include <CQChartsVarsModel.h>
 #include <CQChartsTclModel.h>
 #include <CQChartsCorrelationModel.h>
+#include <CQChartsCluster.h>
 #include <CQChartsExprDataModel.h>
 #include <CQChartsModelUtil.h>
 #include <CQChartsColumnType.h>
@@ -25,6 +26,8 @@
 #include <CQTclUtil.h>
 #include <CMathCorrelation.h>
 
+#include <set>
+
 CQChartsLoader::
 CQChartsLoader(CQCharts *charts) :
  charts_(charts)
@@ -880,6 +883,182 @@ createCorrelationModel(QAbstractItemModel *model, const CorrelationData &correla
   return filterModel;
 }
 
+CQChartsFilterModel *
+CQChartsLoader::
+createClusterModel(QAbstractItemModel *model, const ClusterData &clusterData)
+{
+  CQPerfTrace trace("CQChartsLoader::createClusterModel");
+
+  CQChartsCluster::Linkage linkage;
+
+  if (! CQChartsCluster::stringToLinkage(clusterData.linkage.toStdString(), linkage)) {
+    charts_->errorMsg("Invalid linkage '" + clusterData.linkage + "'");
+    return nullptr;
+  }
+
+  //---
+
+  int nr = model->rowCount   ();
+  int nc = model->columnCount();
+
+  auto *columnTypeMgr = charts_->columnTypeMgr();
+
+  // get numeric value columns
+  std::vector<CQChartsColumn> columns;
+
+  if (clusterData.columns.empty()) {
+    for (int ic = 0; ic < nc; ++ic) {
+      CQChartsColumn c(ic);
+
+      if (c == clusterData.nameColumn)
+        continue;
+
+      CQChartsModelTypeData typeData;
+
+      if (! columnTypeMgr->getModelColumnType(model, c, typeData))
+        typeData.type = CQBaseModelType::STRING;
+
+      if (typeData.type == CQBaseModelType::INTEGER || typeData.type == CQBaseModelType::REAL)
+        columns.push_back(c);
+    }
+  }
+  else
+    columns = clusterData.columns;
+
+  int nv = int(columns.size());
+
+  if (nr <= 0 || nv <= 0) {
+    charts_->errorMsg("No numeric values to cluster");
+    return nullptr;
+  }
+
+  //---
+
+  // get row major values (and unique row names)
+  CQChartsCluster::Reals values;
+
+  values.resize(size_t(nr)*size_t(nv));
+
+  std::vector<QString> names;
+  std::set<QString>    nameSet;
+
+  // add unique name (append first unused ':<n>' suffix if name already used)
+  auto addUniqueName = [&](const QString &name) {
+    auto name1 = name;
+
+    for (int i = 1; nameSet.find(name1) != nameSet.end(); ++i)
+      name1 = QString("%1:%2").arg(name).arg(i);
+
+    nameSet.insert(name1);
+
+    return name1;
+  };
+
+  names.resize(size_t(nr));
+
+  for (int ir = 0; ir < nr; ++ir) {
+    for (int iv = 0; iv < nv; ++iv) {
+      auto ind = model->index(ir, columns[size_t(iv)].column(), QModelIndex());
+
+      bool ok;
+
+      double v = CQChartsModelUtil::modelReal(model, ind, ok);
+
+      values[size_t(ir)*size_t(nv) + size_t(iv)] = (ok ? v : CMathUtil::getNaN());
+    }
+
+    bool ok;
+
+    QString name;
+
+    if (clusterData.nameColumn.isValid()) {
+      auto ind = model->index(ir, clusterData.nameColumn.column(), QModelIndex());
+
+      name = CQChartsModelUtil::modelString(model, ind, ok);
+    }
+    else
+      name = CQChartsModelUtil::modelVHeaderString(model, ir, ok);
+
+    if (! ok || name.isEmpty())
+      name = QString::number(ir + 1);
+
+    // names are used as link path elements so must be unique and not contain separator
+    name.replace('/', '_');
+
+    names[size_t(ir)] = addUniqueName(name);
+  }
+
+  //---
+
+  CQChartsCluster cluster;
+
+  cluster.setLinkage  (linkage);
+  cluster.setNormalize(clusterData.normalize);
+  cluster.setMaxMemory(size_t(std::max(clusterData.maxMemory, 0))*1024*1024);
+
+  cluster.setValues(nr, nv, values);
+
+  if (! cluster.calc()) {
+    charts_->errorMsg(QString("Cluster failed : ") + cluster.errorMsg().c_str());
+    return nullptr;
+  }
+
+  const auto &merges = cluster.merges();
+
+  //---
+
+  // create link (parent/child) model for merged clusters (root first)
+  auto nm = merges.size();
+
+  auto *dataModel = new CQDataModel(3, int(2*nm));
+
+  auto *filterModel = new CQChartsFilterModel(charts_, dataModel);
+  filterModel->setObjectName("clusterFilterModel");
+
+  CQChartsModelUtil::setModelHeaderValue(dataModel, 0, Qt::Horizontal, "Link"  , Qt::DisplayRole);
+  CQChartsModelUtil::setModelHeaderValue(dataModel, 1, Qt::Horizontal, "Size"  , Qt::DisplayRole);
+  CQChartsModelUtil::setModelHeaderValue(dataModel, 2, Qt::Horizontal, "Height", Qt::DisplayRole);
+
+  (void) columnTypeMgr->setModelColumnType(dataModel, CQChartsColumn(0), CQBaseModelType::NAME_PAIR);
+  (void) columnTypeMgr->setModelColumnType(dataModel, CQChartsColumn(1), CQBaseModelType::INTEGER);
+  (void) columnTypeMgr->setModelColumnType(dataModel, CQChartsColumn(2), CQBaseModelType::REAL);
+
+  // merged cluster names must not match leaf (or other cluster) names
+  names.resize(size_t(nr) + nm);
+
+  for (size_t i = 0; i < nm; ++i)
+    names[size_t(nr) + i] = addUniqueName(QString("cluster%1").arg(i + 1));
+
+  auto clusterName = [&](int id) {
+    return names[size_t(id)];
+  };
+
+  auto clusterSize = [&](int id) {
+    return (id < nr ? 1 : merges[size_t(id - nr)].size);
+  };
+
+  int row = 0;
+
+  for (size_t i = nm; i > 0; --i) {
+    const auto &merge = merges[i - 1];
+
+    auto parentName = clusterName(int(i - 1) + nr);
+
+    for (auto id : {merge.id1, merge.id2}) {
+      CQChartsModelUtil::setModelValue(dataModel, row, CQChartsColumn(0), QModelIndex(),
+                                       parentName + "/" + clusterName(id));
+      CQChartsModelUtil::setModelValue(dataModel, row, CQChartsColumn(1), QModelIndex(),
+                                       clusterSize(id));
+      CQChartsModelUtil::setModelValue(dataModel, row, CQChartsColumn(2), QModelIndex(),
+                                       merge.height);
+
+      ++row;
+    }
+  }
+
+  return filterModel;
+}
+
 void
 CQChartsLoader::
 setFilter(ModelFilter *model, const InputData &inputData)
@@ -4,6 +4,8 @@
 #include <CQChartsSymbolSet.h>
 #include <CQChartsPixelPaintDevice.h>
 #include <CQCharts.h>
+#include <CQChartsTextCache.h>
+#include <CQChartsPaletteLUT.h>
 
 #include <CQPropertyViewModel.h>
 #include <CQPropertyViewItem.h>
@@ -749,7 +751,7 @@ drawHeader(PaintDevice *device)
 
   auto headerFont = calcDrawFont(headerTextFont());
 
-  QFontMetricsF hfm(headerFont);
+  CQChartsFontMetrics hfm(headerFont);
 
   auto py1 = pbbox_.getYMin() + bm; // top
 
@@ -765,7 +767,7 @@ drawContiguous(PaintDevice *device)
 {
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double bm = this->padding();
   double bw = fm.horizontalAdvance("X") + 16; // color box width
@@ -870,7 +872,7 @@ drawDiscreet(PaintDevice *device, DrawType drawType)
 {
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double bm = this->padding();
   double bs = fm.height() + 2 + 2*bm; // color box size (match CQChartsKey)
@@ -916,6 +918,24 @@ drawDiscreet(PaintDevice *device, DrawType drawType)
 
   int n = numUnique();
 
+  // palette colors of unique values (batched palette lookup)
+  std::vector<double> paletteValues;
+  std::vector<QRgb>   paletteRgbs;
+
+  for (int i = 0; i < n; ++i)
+    paletteValues.push_back(CMathUtil::map(i, 0, n - 1, mapMin, mapMax));
+
+  charts()->paletteLUT(colorsPalette)->map(paletteValues, paletteRgbs);
+
+  auto uniqueColor = [&](int i, const QString &name) {
+    Color color;
+
+    if (colorData_.colorMap.valueToColor(name, color))
+      return color.color();
+
+    return QColor::fromRgba(paletteRgbs[size_t(i)]);
+  };
+
   for (int i = 0; i < n; ++i) {
     QString itemLabel;
 
@@ -923,16 +943,7 @@ drawDiscreet(PaintDevice *device, DrawType drawType)
 
     //---
 
-    Color  color;
-    QColor c;
-
-    if (! colorData_.colorMap.valueToColor(name, color)) {
-      double r = CMathUtil::map(i, 0, n - 1, mapMin, mapMax);
-
-      c = colorsPalette->getColor(r);
-    }
-    else
-      c = color.color();
+    auto c = uniqueColor(i, name);
 
     //---
 
@@ -1001,16 +1012,7 @@ drawDiscreet(PaintDevice *device, DrawType drawType)
 
     //---
 
-    Color  color;
-    QColor c;
-
-    if (! colorData_.colorMap.valueToColor(name, color)) {
-      double r = CMathUtil::map(i, 0, n - 1, mapMin, mapMax);
-
-      c = colorsPalette->getColor(r);
-    }
-    else
-      c = color.color();
+    auto c = uniqueColor(i, name);
 
     //---
 
@@ -1078,7 +1080,7 @@ calcHeaderSize() const
 
     auto headerFont = calcDrawFont(headerTextFont());
 
-    QFontMetricsF hfm(headerFont);
+    CQChartsFontMetrics hfm(headerFont);
 
     hw = hfm.horizontalAdvance(headerStr());
     hh = hfm.height();
@@ -1095,7 +1097,7 @@ calcContiguousSize() const
 {
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double bm = this->padding();
 
@@ -1129,7 +1131,7 @@ calcDiscreetSize() const
 {
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double bm = this->padding();
   double bs = fm.height() + 2 + 2*bm; // color box size (match CQChartsKey)
@@ -1469,7 +1471,7 @@ initDraw(PaintDevice *device)
   if (headerStr().length()) {
     auto headerFont = calcDrawFont(headerTextFont());
 
-    QFontMetricsF hfm(headerFont);
+    CQChartsFontMetrics hfm(headerFont);
 
     yoffset_ = hfm.height() + bm;
   }
@@ -1528,7 +1530,7 @@ drawHeader(PaintDevice *device)
 
   auto headerFont = calcDrawFont(headerTextFont());
 
-  QFontMetricsF hfm(headerFont);
+  CQChartsFontMetrics hfm(headerFont);
 
   auto py1 = pbbox_.getYMin() + bm; // top
 
@@ -1610,8 +1612,8 @@ drawDiscreet(PaintDevice *device, DrawType drawType)
   auto lfont = calcDrawFont(sizeTextFont());
   auto rfont = calcDrawFont(textFont());
 
-  QFontMetricsF lfm(lfont);
-  QFontMetricsF rfm(rfont);
+  CQChartsFontMetrics lfm(lfont);
+  CQChartsFontMetrics rfm(rfont);
 
   // outer margin
   double bm = this->padding();
@@ -1809,7 +1811,7 @@ drawContiguousText(PaintDevice *device, const CQChartsTextOptions &textOptions,
 
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   auto drawText = [&](const Point &p, double value, Qt::Alignment align) {
     auto text = valueText(value);
@@ -1897,7 +1899,7 @@ calcHeaderSize() const
   if (headerStr().length()) {
     auto headerFont = calcDrawFont(headerTextFont());
 
-    QFontMetricsF hfm(headerFont);
+    CQChartsFontMetrics hfm(headerFont);
 
     hw = hfm.horizontalAdvance(headerStr());
     hh = hfm.height();
@@ -1929,8 +1931,8 @@ calcDiscreetSize() const
   auto lfont = calcDrawFont(sizeTextFont());
   auto rfont = calcDrawFont(textFont());
 
-  QFontMetricsF lfm(lfont);
-  QFontMetricsF rfm(rfont);
+  CQChartsFontMetrics lfm(lfont);
+  CQChartsFontMetrics rfm(rfont);
 
   // outer margin
   double bm = this->padding();
@@ -2106,7 +2108,7 @@ calcContiguousTextBBox() const
 
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   double fh = fm.height();
   double fa = fm.ascent();
@@ -2398,7 +2400,7 @@ draw(PaintDevice *device, const DrawData &drawData, DrawType drawType)
 
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   // outer margin
   double bm = this->padding();
@@ -2490,7 +2492,7 @@ draw(PaintDevice *device, const DrawData &drawData, DrawType drawType)
   if (headerStr().length()) {
     auto headerFont = calcDrawFont(headerTextFont());
 
-    QFontMetricsF hfm(headerFont);
+    CQChartsFontMetrics hfm(headerFont);
 
     auto hx = pbbox_.getXMid() - hfm.horizontalAdvance(headerStr())/2.0;
     auto hy = py1 + hfm.ascent();
@@ -2659,7 +2661,7 @@ calcSize(const DrawData &drawData) const
 
   auto font = calcDrawFont(textFont());
 
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   // outer margin
   double bm = this->padding();
@@ -2672,7 +2674,7 @@ calcSize(const DrawData &drawData) const
   if (headerStr().length()) {
     auto headerFont = calcDrawFont(headerTextFont());
 
-    QFontMetricsF hfm(headerFont);
+    CQChartsFontMetrics hfm(headerFont);
 
     hw = hfm.horizontalAdvance(headerStr());
     hh = hfm.height();
@@ -472,7 +472,7 @@ CQChartsModelData::
 addSelectionModel(QItemSelectionModel *model)
 {
   connect(model, SIGNAL(selectionChanged(const QItemSelection &, const QItemSelection &)),
-          this, SLOT(selectionSlot()));
+          this, SLOT(selectionSlot(const QItemSelection &, const QItemSelection &)));
 
   selectionModels_.emplace_back(model);
 }
@@ -493,7 +493,7 @@ removeSelectionModel(QItemSelectionModel *model)
     return;
 
   disconnect(model, SIGNAL(selectionChanged(const QItemSelection &, const QItemSelection &)),
-             this, SLOT(selectionSlot()));
+             this, SLOT(selectionSlot(const QItemSelection &, const QItemSelection &)));
 
   ++i;
 
@@ -512,7 +512,7 @@ select(const QItemSelection &sel)
 
     CQChartsWidgetUtil::AutoDisconnect autoDisconnect(
       sm, SIGNAL(selectionChanged(const QItemSelection &, const QItemSelection &)),
-      this, SLOT(selectionSlot()));
+      this, SLOT(selectionSlot(const QItemSelection &, const QItemSelection &)));
 
     sm->select(sel, QItemSelectionModel::ClearAndSelect);
   }
@@ -520,12 +520,12 @@ select(const QItemSelection &sel)
 
 void
 CQChartsModelData::
-selectionSlot()
+selectionSlot(const QItemSelection &selected, const QItemSelection &deselected)
 {
   auto *sm = qobject_cast<QItemSelectionModel *>(sender());
   assert(sm);
 
-  emit selectionChanged(sm);
+  emit selectionChanged(sm, selected, deselected);
 }
 
 //---
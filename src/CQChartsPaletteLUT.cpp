@@ -0,0 +1,164 @@
+#include <CQChartsPaletteLUT.h>
+
+#include <CQColors.h>
+#include <CQColorsPalette.h>
+
+#include <algorithm>
+
+namespace {
+
+// number of values mapped per block (index buffer on stack)
+const int blockSize = 256;
+
+}
+
+//---
+
+CQChartsPaletteLUT::
+CQChartsPaletteLUT(CQColorsPalette *palette, bool scale, bool invert) :
+ palette_(palette), scale_(scale), invert_(invert)
+{
+  rgbs_.resize(size_t(NUM_COLORS));
+
+  for (int i = 0; i < NUM_COLORS; ++i) {
+    double r = double(i)/double(NUM_COLORS - 1);
+
+    rgbs_[size_t(i)] = interpRgb(r);
+  }
+}
+
+QRgb
+CQChartsPaletteLUT::
+rgb(double r) const
+{
+  if (! (r >= 0.0 && r <= 1.0))
+    return interpRgb(r);
+
+  auto i = int(r*double(NUM_COLORS - 1) + 0.5);
+
+  return rgbs_[size_t(i)];
+}
+
+void
+CQChartsPaletteLUT::
+map(const double *values, int n, QRgb *rgbs) const
+{
+  const double s = double(NUM_COLORS - 1);
+
+  const auto *lut = rgbs_.data();
+
+  int inds[blockSize];
+
+  for (int i0 = 0; i0 < n; i0 += blockSize) {
+    int nb = std::min(n - i0, blockSize);
+
+    const double *values1 = values + i0;
+    QRgb         *rgbs1   = rgbs   + i0;
+
+    // clamped table index (NaN maps to 0), no branches so loop is vectorized
+    for (int i = 0; i < nb; ++i) {
+      double r = values1[i];
+
+      r = (r > 0.0 ? r : 0.0);
+      r = (r < 1.0 ? r : 1.0);
+
+      inds[i] = int(r*s + 0.5);
+    }
+
+    // gather
+    for (int i = 0; i < nb; ++i)
+      rgbs1[i] = lut[inds[i]];
+
+    // interpolate out of range values from palette
+    for (int i = 0; i < nb; ++i) {
+      double r = values1[i];
+
+      if (! (r >= 0.0 && r <= 1.0))
+        rgbs1[i] = interpRgb(r);
+    }
+  }
+}
+
+void
+CQChartsPaletteLUT::
+map(const Reals &values, Rgbs &rgbs) const
+{
+  rgbs.resize(values.size());
+
+  map(values.data(), int(values.size()), rgbs.data());
+}
+
+QRgb
+CQChartsPaletteLUT::
+interpRgb(double r) const
+{
+  return palette_->getColor(r, scale_, invert_).rgba();
+}
+
+//------
+
+CQChartsPaletteLUTMgr::
+CQChartsPaletteLUTMgr()
+{
+  setObjectName("paletteLUTMgr");
+
+  // palette colors (or theme palettes) changed
+  connect(CQColorsMgrInst, SIGNAL(themeChanged(const QString &)), this, SLOT(clear()));
+  connect(CQColorsMgrInst, SIGNAL(paletteChanged(const QString &)), this, SLOT(clear()));
+  connect(CQColorsMgrInst, SIGNAL(themesChanged()), this, SLOT(clear()));
+  connect(CQColorsMgrInst, SIGNAL(palettesChanged()), this, SLOT(clear()));
+}
+
+const CQChartsPaletteLUTMgr::LUT *
+CQChartsPaletteLUTMgr::
+lut(CQColorsPalette *palette, bool scale, bool invert)
+{
+  if (! palette)
+    return nullptr;
+
+  auto key = Key(palette, scale, invert);
+
+  {
+  std::shared_lock<Mutex> lock(mutex_);
+
+  auto p = luts_.find(key);
+
+  if (p != luts_.end())
+    return (*p).second.get();
+  }
+
+  //---
+
+  // build outside lock (if another thread added table first then new one is discarded)
+  auto lut = std::make_unique<LUT>(palette, scale, invert);
+
+  std::unique_lock<Mutex> lock(mutex_);
+
+  auto p = luts_.find(key);
+
+  if (p == luts_.end())
+    p = luts_.insert(p, LUTs::value_type(key, std::move(lut)));
+
+  return (*p).second.get();
+}
+
+int
+CQChartsPaletteLUTMgr::
+numLUTs() const
+{
+  std::shared_lock<Mutex> lock(mutex_);
+
+  return int(luts_.size());
+}
+
+void
+CQChartsPaletteLUTMgr::
+clear()
+{
+  std::unique_lock<Mutex> lock(mutex_);
+
+  for (auto &pl : luts_)
+    retired_.push_back(std::move(pl.second));
+
+  luts_.clear();
+}
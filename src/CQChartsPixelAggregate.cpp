@@ -0,0 +1,325 @@
+#include <CQChartsPixelAggregate.h>
+#include <CQChartsParallel.h>
+
+#include <CQPerfMonitor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+
+// max total pixels of per thread canvases (limits memory for large canvases)
+const size_t maxThreadPixels = 64*1024*1024;
+
+}
+
+//---
+
+void
+CQChartsPixelAggregate::Canvas::
+init(const BBox &rect, int width, int height, bool hasSums)
+{
+  this->rect      = rect;
+  this->width     = width;
+  this->height    = height;
+  this->numPoints = 0;
+
+  auto n = size_t(width)*size_t(height);
+
+  counts.assign(n, 0);
+
+  if (hasSums)
+    sums.assign(n, 0.0);
+  else
+    sums.clear();
+}
+
+bool
+CQChartsPixelAggregate::Canvas::
+pixelAt(const Point &p, int &i, int &j) const
+{
+  if (! isValid() || ! rect.inside(p))
+    return false;
+
+  i = int((p.x - rect.getXMin())*width /rect.getWidth ());
+  j = int((rect.getYMax() - p.y)*height/rect.getHeight());
+
+  i = std::min(std::max(i, 0), width  - 1);
+  j = std::min(std::max(j, 0), height - 1);
+
+  return true;
+}
+
+double
+CQChartsPixelAggregate::Canvas::
+count(int i, int j) const
+{
+  return double(counts[size_t(j)*size_t(width) + size_t(i)])*stride;
+}
+
+double
+CQChartsPixelAggregate::Canvas::
+value(int i, int j, const ValueType &valueType) const
+{
+  return value(size_t(j)*size_t(width) + size_t(i), valueType);
+}
+
+double
+CQChartsPixelAggregate::Canvas::
+value(size_t ind, const ValueType &valueType) const
+{
+  auto n = counts[ind];
+
+  if (valueType == ValueType::COUNT || sums.empty())
+    return double(n)*stride;
+
+  if (valueType == ValueType::SUM)
+    return sums[ind]*stride;
+
+  return (n > 0 ? sums[ind]/n : 0.0);
+}
+
+//---
+
+bool
+CQChartsPixelAggregate::
+calc(const Points &points, const BBox &rect, int width, int height, int stride,
+     Canvas &canvas, const Interrupt &interrupt)
+{
+  CQPerfTrace trace("CQChartsPixelAggregate::calc");
+
+  bool hasSums = points.hasValues();
+
+  canvas.init(rect, width, height, hasSums);
+
+  canvas.stride = std::max(stride, 1);
+
+  if (! canvas.isValid())
+    return true;
+
+  //---
+
+  int np = points.size();
+  int ns = (np + canvas.stride - 1)/canvas.stride; // number of sampled points
+
+  double xmin = rect.getXMin(), xmax = rect.getXMax();
+  double ymin = rect.getYMin(), ymax = rect.getYMax();
+
+  double xs = width /(xmax - xmin);
+  double ys = height/(ymax - ymin);
+
+  auto npixels = size_t(width)*size_t(height);
+
+  // use enough points per chunk to keep per thread canvases below max pixels
+  int maxCanvases = int(std::max(maxThreadPixels/npixels, size_t(1)));
+
+  int minChunk = std::max(ns/maxCanvases + 1, 16384);
+
+  int nc = CQChartsParallel::numChunks(ns, minChunk);
+
+  if (nc <= 0)
+    return true;
+
+  //---
+
+  // accumulate chunks of points into per thread canvases (first is result canvas)
+  std::vector<Canvas> canvases(size_t(nc - 1));
+
+  std::vector<long> chunkPoints(size_t(nc), 0);
+
+  std::atomic<bool> interrupted { false };
+
+  CQChartsParallel::forChunkInds(ns, [&](int ic, int i1, int i2) {
+    auto &canvas1 = (ic == 0 ? canvas : canvases[size_t(ic - 1)]);
+
+    if (ic > 0)
+      canvas1.init(rect, width, height, hasSums);
+
+    auto *counts = canvas1.counts.data();
+    auto *sums   = (hasSums ? canvas1.sums.data() : nullptr);
+
+    long n = 0;
+
+    for (int is = i1; is < i2; ++is) {
+      // check interrupt every 64K points
+      if ((is & 0xffff) == 0 && interrupt && interrupt()) {
+        interrupted = true;
+        return;
+      }
+
+      auto ip = size_t(is)*size_t(canvas.stride);
+
+      double x = points.x[ip];
+      double y = points.y[ip];
+
+      if (x < xmin || x > xmax || y < ymin || y > ymax)
+        continue;
+
+      int i = std::min(int((x - xmin)*xs), width  - 1);
+      int j = std::min(int((ymax - y)*ys), height - 1);
+
+      auto ind = size_t(j)*size_t(width) + size_t(i);
+
+      ++counts[ind];
+
+      if (sums)
+        sums[ind] += points.v[ip];
+
+      ++n;
+    }
+
+    chunkPoints[size_t(ic)] = n;
+  }, minChunk);
+
+  if (interrupted)
+    return false;
+
+  //---
+
+  // reduce thread canvases into result (in row chunks)
+  if (! canvases.empty()) {
+    CQChartsParallel::forChunks(height, [&](int j1, int j2) {
+      auto ind1 = size_t(j1)*size_t(width);
+      auto ind2 = size_t(j2)*size_t(width);
+
+      for (const auto &canvas1 : canvases) {
+        for (auto ind = ind1; ind < ind2; ++ind)
+          canvas.counts[ind] += canvas1.counts[ind];
+
+        if (hasSums) {
+          for (auto ind = ind1; ind < ind2; ++ind)
+            canvas.sums[ind] += canvas1.sums[ind];
+        }
+      }
+    }, 64);
+  }
+
+  for (const auto &n : chunkPoints)
+    canvas.numPoints += n;
+
+  return true;
+}
+
+void
+CQChartsPixelAggregate::
+shade(const Canvas &canvas, const ValueType &valueType, const ShadeType &shadeType,
+      Values &tvalues)
+{
+  CQPerfTrace trace("CQChartsPixelAggregate::shade");
+
+  auto npixels = canvas.counts.size();
+
+  tvalues.assign(npixels, -1.0f);
+
+  //---
+
+  // get non-empty pixel values and range
+  std::vector<double> values;
+
+  values.reserve(npixels/4);
+
+  double vmin = 0.0, vmax = 0.0;
+
+  for (size_t ind = 0; ind < npixels; ++ind) {
+    if (canvas.counts[ind] == 0)
+      continue;
+
+    double v = canvas.value(ind, valueType);
+
+    if (values.empty()) {
+      vmin = v;
+      vmax = v;
+    }
+    else {
+      vmin = std::min(vmin, v);
+      vmax = std::max(vmax, v);
+    }
+
+    values.push_back(v);
+  }
+
+  if (values.empty())
+    return;
+
+  // counts are relative to zero
+  if (valueType == ValueType::COUNT)
+    vmin = 0.0;
+
+  //---
+
+  if (shadeType == ShadeType::EQ_HIST) {
+    // map to fraction of pixels with value less than or equal to value (histogram equalization)
+    std::sort(values.begin(), values.end());
+
+    double nv = double(values.size());
+
+    CQChartsParallel::forChunks(int(npixels), [&](int i1, int i2) {
+      for (int i = i1; i < i2; ++i) {
+        auto ind = size_t(i);
+
+        if (canvas.counts[ind] == 0)
+          continue;
+
+        double v = canvas.value(ind, valueType);
+
+        auto p = std::upper_bound(values.begin(), values.end(), v);
+
+        tvalues[ind] = float(double(p - values.begin())/nv);
+      }
+    }, 65536);
+  }
+  else {
+    double dv = vmax - vmin;
+
+    double lscale = (dv > 0.0 ? 1.0/std::log1p(dv) : 0.0);
+    double scale  = (dv > 0.0 ? 1.0/dv : 0.0);
+
+    CQChartsParallel::forChunks(int(npixels), [&](int i1, int i2) {
+      for (int i = i1; i < i2; ++i) {
+        auto ind = size_t(i);
+
+        if (canvas.counts[ind] == 0)
+          continue;
+
+        double v = canvas.value(ind, valueType) - vmin;
+
+        double t = (shadeType == ShadeType::LOG ? std::log1p(v)*lscale : v*scale);
+
+        tvalues[ind] = float(dv > 0.0 ? std::min(std::max(t, 0.0), 1.0) : 1.0);
+      }
+    }, 65536);
+  }
+}
+
+QImage
+CQChartsPixelAggregate::
+image(const Canvas &canvas, const Values &tvalues, const Colors &colors)
+{
+  CQPerfTrace trace("CQChartsPixelAggregate::image");
+
+  if (! canvas.isValid() || colors.empty() ||
+      tvalues.size() != size_t(canvas.width)*size_t(canvas.height))
+    return QImage();
+
+  QImage image(canvas.width, canvas.height, QImage::Format_ARGB32);
+
+  int nc = int(colors.size());
+
+  CQChartsParallel::forChunks(canvas.height, [&](int j1, int j2) {
+    for (int j = j1; j < j2; ++j) {
+      auto *dst = reinterpret_cast<QRgb *>(image.scanLine(j));
+
+      const auto *t = &tvalues[size_t(j)*size_t(canvas.width)];
+
+      for (int i = 0; i < canvas.width; ++i) {
+        if (t[i] < 0.0f)
+          dst[i] = qRgba(0, 0, 0, 0);
+        else
+          dst[i] = colors[size_t(std::min(int(t[i]*float(nc - 1) + 0.5f), nc - 1))];
+      }
+    }
+  }, 64);
+
+  return image;
+}
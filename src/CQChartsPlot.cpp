@@ -9,6 +9,7 @@
 #include <CQChartsPlotObjTree.h>
 #include <CQChartsNoDataObj.h>
 #include <CQChartsAnnotation.h>
+#include <CQChartsAnnotationTree.h>
 #include <CQChartsValueSet.h>
 #include <CQChartsDisplayRange.h>
 #include <CQChartsModelExprMatch.h>
@@ -31,6 +32,9 @@
 #include <CQChartsHtml.h>
 #include <CQChartsEnv.h>
 #include <CQChartsJS.h>
+#include <CQChartsDisplayList.h>
+#include <CQChartsRecordPaintDevice.h>
+#include <CQChartsParallel.h>
 #include <CQCharts.h>
 
 #include <CQChartsPlotControlWidgets.h>
@@ -57,6 +61,7 @@
 #include <CMathRound.h>
 
 #include <QApplication>
+#include <QThread>
 #include <QItemSelectionModel>
 #include <QAbstractProxyModel>
 #include <QTextBrowser>
@@ -107,6 +112,8 @@ init()
   queueUpdate_   = CQChartsEnv::getBool("CQ_CHARTS_PLOT_QUEUE"    , queueUpdate_);
   bufferSymbols_ = CQChartsEnv::getInt ("CQ_CHARTS_BUFFER_SYMBOLS", bufferSymbols_);
 
+  drawRecordData_.enabled = CQChartsEnv::getBool("CQ_CHARTS_DRAW_RECORD", false);
+
   displayRange_    = std::make_unique<DisplayRange>();
   rawDisplayRange_ = std::make_unique<DisplayRange>();
 
@@ -119,6 +126,8 @@ init()
 
   objTreeData_.tree = std::make_unique<CQChartsPlotObjTree>(this, objTreeWait);
 
+  annotationTree_ = std::make_unique<CQChartsAnnotationTree>();
+
   //---
 
   animateData_.tickLen = CQChartsEnv::getInt("CQ_CHARTS_TICK_LEN", animateData_.tickLen);
@@ -318,6 +327,8 @@ setModel(const ModelP &model)
 
   connectModel();
 
+  stageData_.modelRead = true;
+
   updateRangeAndObjs();
 
   emit modelChanged();
@@ -378,8 +389,11 @@ connectDisconnectModel(bool isConnect)
     connectDisconnect(isConnect, modelData, SIGNAL(currentModelChanged()),
                       SLOT(currentModelChangedSlot()));
 
-    connectDisconnect(isConnect, modelData, SIGNAL(selectionChanged(QItemSelectionModel *)),
-                      SLOT(selectionSlot(QItemSelectionModel *)));
+    connectDisconnect(isConnect, modelData,
+      SIGNAL(selectionChanged(QItemSelectionModel *, const QItemSelection &,
+                              const QItemSelection &)),
+      SLOT(selectionSlot(QItemSelectionModel *, const QItemSelection &,
+                         const QItemSelection &)));
   }
   else {
     modelNameSet_ = false;
@@ -454,6 +468,8 @@ void
 CQChartsPlot::
 modelChangedSlot()
 {
+  stageData_.modelRead = true;
+
   updateRangeAndObjs();
 }
 
@@ -473,27 +489,38 @@ currentModelChangedSlot()
 
 void
 CQChartsPlot::
-selectionSlot(QItemSelectionModel *sm)
+selectionSlot(QItemSelectionModel *sm, const QItemSelection &selected,
+              const QItemSelection &deselected)
 {
-  // get selected (normalized) indices from selection model
-  // TODO: optimize for row select or column select ?
-  PlotObj::Indices selectIndices;
+  CQPerfTrace trace("CQChartsPlot::selectionSlot");
+
+  auto *model = sm->model();
+  if (! model) return;
+
+  // get objects for changed (normalized) rows from row index (only these objects
+  // can change selection, mouse selected objects are in selection model rows)
+  PlotObjSet selectObjs, deselectObjs;
 
-  getSelectIndices(sm, selectIndices);
+  getSelectRowObjs(model, selected  , selectObjs  );
+  getSelectRowObjs(model, deselected, deselectObjs);
+
+  // object of deselected row stays selected if any of its other rows is selected
+  PlotObjSet currentObjs;
+
+  if (! deselectObjs.empty())
+    getSelectRowObjs(model, sm->selection(), currentObjs);
 
   //---
 
   startSelection();
 
-  // deselect all objects
-  deselectAllObjs();
-
-  // select objects with matching indices
-  for (auto &plotObj : plotObjects()) {
-    if (! plotObj->isSelectable())
-      continue;
+  for (auto &plotObj : deselectObjs) {
+    if (plotObj->isSelected() && currentObjs.find(plotObj) == currentObjs.end())
+      plotObj->setSelected(false);
+  }
 
-    if (plotObj->isSelectIndices(selectIndices))
+  for (auto &plotObj : selectObjs) {
+    if (! plotObj->isSelected())
       plotObj->setSelected(true);
   }
 
@@ -525,6 +552,82 @@ getSelectIndices(QItemSelectionModel *sm, QModelIndexSet &selectIndices)
 
 //---
 
+// build index of plot objects for each normalized model row from object select indices
+void
+CQChartsPlot::
+buildSelectRowIndex()
+{
+  CQPerfTrace trace("CQChartsPlot::buildSelectRowIndex");
+
+  clearSelectRowIndex();
+
+  for (auto &plotObj : plotObjects()) {
+    if (! plotObj->isSelectable())
+      continue;
+
+    PlotObj::Indices inds;
+
+    plotObj->getNormalizedSelectIndices(inds);
+
+    for (const auto &ind : inds) {
+      auto &rowObjs = selectRowData_.parentRowObjs[ind.parent()];
+
+      auto row = size_t(ind.row());
+
+      if (row >= rowObjs.size())
+        rowObjs.resize(row + 1);
+
+      // object indices are processed together so object is last if already added
+      auto &objs = rowObjs[row];
+
+      if (objs.empty() || objs.back() != plotObj)
+        objs.push_back(plotObj);
+    }
+  }
+}
+
+void
+CQChartsPlot::
+clearSelectRowIndex()
+{
+  selectRowData_.parentRowObjs.clear();
+}
+
+// get objects for rows in selection model selection (one lookup per selected row)
+void
+CQChartsPlot::
+getSelectRowObjs(const QAbstractItemModel *model, const QItemSelection &selection,
+                 PlotObjSet &objs) const
+{
+  if (selectRowData_.parentRowObjs.empty())
+    return;
+
+  // one lookup per row of each range (row selects all objects using row)
+  for (const auto &range : selection) {
+    if (! range.isValid()) continue;
+
+    for (int row = range.top(); row <= range.bottom(); ++row) {
+      auto ind = model->index(row, range.left(), range.parent());
+
+      auto ind1 = normalizeIndex(ind);
+      if (! ind1.isValid()) continue;
+
+      auto pp = selectRowData_.parentRowObjs.find(ind1.parent());
+      if (pp == selectRowData_.parentRowObjs.end()) continue;
+
+      const auto &rowObjs = (*pp).second;
+
+      auto row1 = size_t(ind1.row());
+      if (row1 >= rowObjs.size()) continue;
+
+      for (auto &plotObj : rowObjs[row1])
+        objs.insert(plotObj);
+    }
+  }
+}
+
+//---
+
 CQCharts *
 CQChartsPlot::
 charts() const
@@ -698,6 +801,9 @@ void
 CQChartsPlot::
 updateRange()
 {
+  if (traceStages(Stages(Stage::RANGE)))
+    return;
+
   if (isOverlay() && ! isFirstPlot())
     return firstPlot()->updateRange1();
 
@@ -753,6 +859,9 @@ void
 CQChartsPlot::
 updateRangeAndObjs()
 {
+  if (traceStages(Stages(Stage::RANGE) | Stages(Stage::OBJS)))
+    return;
+
   if (isOverlay() && ! isFirstPlot())
     return firstPlot()->updateRangeAndObjs1();
 
@@ -819,6 +928,9 @@ void
 CQChartsPlot::
 updateObjs()
 {
+  if (traceStages(Stages(Stage::OBJS)))
+    return;
+
   if (isOverlay() && ! isFirstPlot())
     return firstPlot()->updateObjs1();
 
@@ -911,6 +1023,9 @@ void
 CQChartsPlot::
 drawBackground()
 {
+  if (traceStages(Stages(Stage::DRAW_BACKGROUND)))
+    return;
+
   if (! isUpdatesEnabled())
     return;
 
@@ -954,6 +1069,9 @@ void
 CQChartsPlot::
 drawForeground()
 {
+  if (traceStages(Stages(Stage::DRAW_FOREGROUND)))
+    return;
+
   if (! isUpdatesEnabled())
     return;
 
@@ -999,6 +1117,10 @@ void
 CQChartsPlot::
 drawObjs()
 {
+  if (traceStages(Stages(Stage::DRAW_BACKGROUND) | Stages(Stage::DRAW_OBJS) |
+                  Stages(Stage::DRAW_FOREGROUND)))
+    return;
+
   if (view()->is3D()) {
     view()->update();
     return;
@@ -1026,6 +1148,12 @@ drawObjs1()
 
   //---
 
+  // objects need redraw (recorded display lists are invalid unless only panned)
+  if (! drawRecordData_.panning)
+    ++drawRecordData_.generation;
+
+  //---
+
   if (isQueueUpdate()) {
     startUpdateDrawObjs();
   }
@@ -1058,6 +1186,298 @@ startUpdateDrawObjs()
 
 //---
 
+void
+CQChartsPlot::
+drawMiddle()
+{
+  if (traceStages(Stages(Stage::DRAW_OBJS)))
+    return;
+
+  if (view()->is3D()) {
+    view()->update();
+    return;
+  }
+
+  if (isOverlay() && ! isFirstPlot())
+    return firstPlot()->drawMiddle();
+
+  if (parentPlot())
+    return parentPlot()->drawMiddle();
+
+  if (! isUpdatesEnabled())
+    return;
+
+  //---
+
+  // objects need redraw (recorded display lists are invalid unless only panned)
+  if (! drawRecordData_.panning)
+    ++drawRecordData_.generation;
+
+  //---
+
+  if (isQueueUpdate()) {
+    startUpdateDrawMiddle();
+  }
+  else {
+    invalidateMiddleLayers();
+  }
+}
+
+void
+CQChartsPlot::
+invalidateMiddleLayers()
+{
+  // selected and inside objects are drawn in the overlay layer
+  invalidateLayer(Buffer::Type::OVERLAY);
+  invalidateLayer(Buffer::Type::MIDDLE);
+}
+
+void
+CQChartsPlot::
+startUpdateDrawMiddle()
+{
+  if (parentPlot())
+    return parentPlot()->startUpdateDrawMiddle();
+
+  //---
+
+  if (debugUpdate_)
+    std::cerr << "drawMiddle : " << id().toStdString() << "\n";
+
+  assert(! parentPlot());
+
+  {
+  std::unique_lock<std::mutex> lock(updatesMutex_);
+
+  ++updatesData_.stateFlag[UpdateState::UPDATE_DRAW_MIDDLE];
+  }
+
+  startThreadTimer();
+}
+
+//------
+
+CQChartsPlot::Stages
+CQChartsPlot::
+propertyStages(const QString &name) const
+{
+  // property path or name of plot property
+  const auto *item = propertyModel()->propertyItem(this, name, /*hidden*/true);
+
+  if (item && item->object() == this)
+    return stageGraph_.stages(item->name());
+
+  return stageGraph_.stages(name);
+}
+
+void
+CQChartsPlot::
+declarePropertyStages(const QString &name, Stages stages)
+{
+  stageGraph_.declare(name, stages);
+}
+
+void
+CQChartsPlot::
+declareStyleStages(const QString &prefix, const QStringList &names, Stages stages)
+{
+  for (const auto &name : names)
+    declarePropertyStages(prefix + name, stages);
+}
+
+// Note: style properties are not declared by add...Properties as many are also drawn
+// in background or foreground layers. Plots declare the ones only drawn by objects.
+
+void
+CQChartsPlot::
+declareObjFillStages(const QString &prefix)
+{
+  declareStyleStages(prefix, {"Color", "Alpha", "Pattern"},
+                     Stages(Stage::DRAW_OBJS) | Stages(Stage::DRAW_KEY));
+}
+
+void
+CQChartsPlot::
+declareObjStrokeStages(const QString &prefix)
+{
+  declareStyleStages(prefix, {"Color", "Alpha", "Dash", "Cap", "Join"},
+                     Stages(Stage::DRAW_OBJS) | Stages(Stage::DRAW_KEY));
+}
+
+void
+CQChartsPlot::
+declareObjSymbolStages(const QString &prefix)
+{
+  auto symbolPrefix = (prefix.length() ? prefix + "Symbol" : "symbol");
+
+  declareStyleStages(symbolPrefix, {"FillColor", "FillAlpha", "FillPattern", "StrokeColor",
+                     "StrokeAlpha", "StrokeDash", "StrokeJoin", "StrokeCap"},
+                     Stages(Stage::DRAW_OBJS) | Stages(Stage::DRAW_KEY));
+}
+
+void
+CQChartsPlot::
+invalidateStages(Stages stages)
+{
+  stages = CQChartsPlotStage::dependents(stages);
+
+  auto hasStage = [&](const Stage &stage) { return (stages & Stages(stage)); };
+
+  // model, range and objects stages use existing (queued) update pipeline
+  if (hasStage(Stage::MODEL))
+    stageData_.modelRead = true;
+
+  if (hasStage(Stage::MODEL) || hasStage(Stage::RANGE))
+    return updateRangeAndObjs();
+
+  if (hasStage(Stage::OBJS))
+    return updateObjs();
+
+  // rebuild object tree from existing objects
+  if (hasStage(Stage::TREE)) {
+    invalidateObjTree();
+
+    initObjTree();
+  }
+
+  //---
+
+  // redraw only invalidated layers (key is in background or foreground layer)
+  bool drawBg  = hasStage(Stage::DRAW_BACKGROUND);
+  bool drawMid = hasStage(Stage::DRAW_OBJS);
+  bool drawFg  = hasStage(Stage::DRAW_FOREGROUND);
+
+  if (hasStage(Stage::DRAW_KEY)) {
+    auto *key = this->key();
+
+    if (key && key->isVisible()) {
+      if (key->isAbove())
+        drawFg = true;
+      else
+        drawBg = true;
+    }
+  }
+
+  if (drawBg && drawMid && drawFg)
+    return drawObjs();
+
+  if (drawBg ) drawBackground();
+  if (drawMid) drawMiddle();
+  if (drawFg ) drawForeground();
+}
+
+void
+CQChartsPlot::
+setStageTrace(bool b)
+{
+  stageData_.trace = b;
+
+  if (! b)
+    clearStageTrace();
+}
+
+bool
+CQChartsPlot::
+beginPropertyStages(const QString &name, Stages declared)
+{
+  // only record property changes on main thread
+  if (QThread::currentThread() != thread())
+    return false;
+
+  bool outer = (stageData_.depth == 0);
+
+  if (outer) {
+    if (! declared && ! isStageTrace() && ! debugUpdate_)
+      return false;
+
+    stageData_.name      = name;
+    stageData_.declared  = declared;
+    stageData_.requested = 0;
+  }
+
+  ++stageData_.depth;
+
+  return true;
+}
+
+void
+CQChartsPlot::
+endPropertyStages()
+{
+  --stageData_.depth;
+
+  if (stageData_.depth > 0)
+    return;
+
+  StageTraceEntry entry;
+
+  entry.name      = stageData_.name;
+  entry.declared  = stageData_.declared;
+  entry.requested = stageData_.requested;
+  entry.applied   = (entry.declared ? (entry.requested ? entry.declared : 0) :
+                                      CQChartsPlotStage::dependents(entry.requested));
+
+  stageData_.declared  = 0;
+  stageData_.requested = 0;
+
+  if (entry.declared && entry.requested)
+    invalidateStages(entry.declared);
+
+  //---
+
+  if (debugUpdate_)
+    std::cerr << "setProperty : " << id().toStdString() << " " << entry.name.toStdString() <<
+                 " declared=" << CQChartsPlotStage::toString(entry.declared).toStdString() <<
+                 " requested=" << CQChartsPlotStage::toString(entry.requested).toStdString() <<
+                 " applied=" << CQChartsPlotStage::toString(entry.applied).toStdString() << "\n";
+
+  if (isStageTrace()) {
+    stageData_.entries.push_back(entry);
+
+    // keep last 1000 entries
+    if (stageData_.entries.size() > 1000)
+      stageData_.entries.erase(stageData_.entries.begin());
+  }
+}
+
+bool
+CQChartsPlot::
+traceStages(Stages stages)
+{
+  // only record requests from property setter (main thread)
+  if (stageData_.depth <= 0 || QThread::currentThread() != thread())
+    return false;
+
+  stageData_.requested |= stages;
+
+  // defer to declared stages
+  return (stageData_.declared != 0);
+}
+
+int
+CQChartsPlot::
+stageCount(const Stage &stage) const
+{
+  for (int i = 0; i < CQChartsPlotStage::NUM_STAGES; ++i) {
+    if (Stages(stage) == (1U<<i))
+      return stageData_.counts[i].load();
+  }
+
+  return 0;
+}
+
+void
+CQChartsPlot::
+incStageCount(const Stage &stage)
+{
+  for (int i = 0; i < CQChartsPlotStage::NUM_STAGES; ++i) {
+    if (Stages(stage) == (1U<<i))
+      ++stageData_.counts[i];
+  }
+}
+
+//---
+
 void
 CQChartsPlot::
 writeScript(ScriptPaintDevice *device) const
@@ -2046,7 +2466,7 @@ void
 CQChartsPlot::
 setFilterStr(const QString &s)
 {
-  CQChartsUtil::testAndSet(filterStr_, s, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("filterStr", filterStr_, s, [&]() { updateRangeAndObjs(); } );
 }
 
 const QString &
@@ -2062,7 +2482,9 @@ void
 CQChartsPlot::
 setVisibleFilterStr(const QString &s)
 {
-  CQChartsUtil::testAndSet(visibleFilterStr_, s, [&]() { applyVisibleFilter(); drawObjs(); } );
+  testAndSetProperty("visibleFilterStr", visibleFilterStr_, s, [&]() {
+    applyVisibleFilter(); drawObjs();
+  } );
 }
 
 //---
@@ -2073,21 +2495,21 @@ setSkipBad(bool b)
 {
   assert(! isComposite());
 
-  CQChartsUtil::testAndSet(badData_.skip, b, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("skipBad", badData_.skip, b, [&]() { updateRangeAndObjs(); } );
 }
 
 void
 CQChartsPlot::
 setBadUseRow(bool b)
 {
-  CQChartsUtil::testAndSet(badData_.useRow, b, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("badUseRow", badData_.useRow, b, [&]() { updateRangeAndObjs(); } );
 }
 
 void
 CQChartsPlot::
 setBadValue(double v)
 {
-  CQChartsUtil::testAndSet(badData_.value, v, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("badValue", badData_.value, v, [&]() { updateRangeAndObjs(); } );
 }
 
 double
@@ -2337,14 +2759,14 @@ void
 CQChartsPlot::
 setPlotBorderSides(const Sides &s)
 {
-  CQChartsUtil::testAndSet(plotBorderSides_, s, [&]() { drawBackground(); } );
+  testAndSetProperty("plotBorderSides", plotBorderSides_, s, [&]() { drawBackground(); } );
 }
 
 void
 CQChartsPlot::
 setPlotClip(bool b)
 {
-  CQChartsUtil::testAndSet(plotClip_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("plotClip", plotClip_, b, [&]() { drawObjs(); } );
 }
 
 //---
@@ -2353,28 +2775,28 @@ void
 CQChartsPlot::
 setDataBorderSides(const Sides &s)
 {
-  CQChartsUtil::testAndSet(dataBorderSides_, s, [&]() { drawBackground(); } );
+  testAndSetProperty("dataBorderSides", dataBorderSides_, s, [&]() { drawBackground(); } );
 }
 
 void
 CQChartsPlot::
 setDataClip(bool b)
 {
-  CQChartsUtil::testAndSet(dataClip_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("dataClip", dataClip_, b, [&]() { drawObjs(); } );
 }
 
 void
 CQChartsPlot::
 setDataRawClip(bool b)
 {
-  CQChartsUtil::testAndSet(dataRawClip_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("dataRawClip", dataRawClip_, b, [&]() { drawObjs(); } );
 }
 
 void
 CQChartsPlot::
 setDataRawRange(bool b)
 {
-  CQChartsUtil::testAndSet(dataRawRange_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("dataRawRange", dataRawRange_, b, [&]() { drawObjs(); } );
 }
 
 //---
@@ -2383,14 +2805,14 @@ void
 CQChartsPlot::
 setFitBorderSides(const Sides &s)
 {
-  CQChartsUtil::testAndSet(fitBorderSides_, s, [&]() { drawBackground(); } );
+  testAndSetProperty("fitBorderSides", fitBorderSides_, s, [&]() { drawBackground(); } );
 }
 
 void
 CQChartsPlot::
 setFitClip(bool b)
 {
-  CQChartsUtil::testAndSet(fitClip_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("fitClip", fitClip_, b, [&]() { drawObjs(); } );
 }
 
 //---
@@ -2399,7 +2821,7 @@ void
 CQChartsPlot::
 setFont(const Font &f)
 {
-  CQChartsUtil::testAndSet(font_, f, [&]() { drawObjs(); } );
+  testAndSetProperty("font", font_, f, [&]() { drawObjs(); } );
 }
 
 QFont
@@ -2422,7 +2844,7 @@ void
 CQChartsPlot::
 setDefaultPalette(const PaletteName &name)
 {
-  CQChartsUtil::testAndSet(defaultPalette_, name, [&]() { drawObjs(); } );
+  testAndSetProperty("defaultPalette", defaultPalette_, name, [&]() { drawObjs(); } );
 }
 
 //---
@@ -2431,7 +2853,9 @@ void
 CQChartsPlot::
 setDefaultSymbolSetName(const QString &name)
 {
-  CQChartsUtil::testAndSet(defaultSymbolSetName_, name, [&]() { drawObjs(); } );
+  testAndSetProperty("defaultSymbolSetName", defaultSymbolSetName_, name, [&]() {
+    drawObjs();
+  } );
 }
 
 //---
@@ -2440,7 +2864,7 @@ void
 CQChartsPlot::
 setScaleSymbolSize(bool b)
 {
-  CQChartsUtil::testAndSet(scaleSymbolSize_, b, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("scaleSymbolSize", scaleSymbolSize_, b, [&]() { updateRangeAndObjs(); } );
 }
 
 //---
@@ -2675,14 +3099,53 @@ void
 CQChartsPlot::
 setShowBoxes(bool b)
 {
-  CQChartsUtil::testAndSet(showBoxes_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("showBoxes", showBoxes_, b, [&]() { drawObjs(); } );
+}
+
+void
+CQChartsPlot::
+setDrawRecord(bool b)
+{
+  CQChartsUtil::testAndSet(drawRecordData_.enabled, b, [&]() {
+    clearDrawRecord(); drawObjs();
+  } );
+}
+
+void
+CQChartsPlot::
+setDrawRecordParallel(bool b)
+{
+  CQChartsUtil::testAndSet(drawRecordData_.parallel, b, [&]() {
+    clearDrawRecord(); drawObjs();
+  } );
+}
+
+void
+CQChartsPlot::
+setProgressive(bool b)
+{
+  CQChartsUtil::testAndSet(progressiveData_.enabled, b, [&]() { updateObjs(); } );
+}
+
+void
+CQChartsPlot::
+setProgressiveSampleSize(int n)
+{
+  CQChartsUtil::testAndSet(progressiveData_.sampleSize, n, [&]() { updateObjs(); } );
+}
+
+void
+CQChartsPlot::
+clearDrawRecord()
+{
+  drawRecordData_.layerLists.clear();
 }
 
 void
 CQChartsPlot::
 setShowSelectedBoxes(bool b)
 {
-  CQChartsUtil::testAndSet(showSelectedBoxes_, b, [&]() { drawObjs(); } );
+  testAndSetProperty("showSelectedBoxes", showSelectedBoxes_, b, [&]() { drawObjs(); } );
 }
 
 //---
@@ -3606,6 +4069,10 @@ addBaseProperties()
 
   addProp("columns", "controlColumns", "controls", "Control columns");
 
+  // id, visible and image columns are read from model
+  for (const auto &name : {"idColumn", "visibleColumn", "imageColumn"})
+    declarePropertyStages(name, Stages(Stage::MODEL));
+
   // range
   addProp("range", "viewRect", "view", "View rectangle");
   addProp("range", "dataRect", "data", "Data rectangle");
@@ -3652,6 +4119,18 @@ addBaseProperties()
 
   addProp("debug", "followMouse", "", "Enable mouse tracking", /*hidden*/true);
 
+  // draw record
+  addProp("drawRecord", "drawRecord"        , "enabled" ,
+          "Record object draws into cached display lists", /*hidden*/true);
+  addProp("drawRecord", "drawRecordParallel", "parallel",
+          "Record object display lists in parallel", /*hidden*/true);
+
+  // progressive update
+  addProp("progressive", "progressive"          , "enabled"   ,
+          "Draw objects from sample of rows before all rows", /*hidden*/true);
+  addProp("progressive", "progressiveSampleSize", "sampleSize",
+          "Number of sampled rows for progressive update", /*hidden*/true);
+
   //------
 
   // plot box
@@ -3723,6 +4202,18 @@ addBaseProperties()
   addLineProperties(fitStyleStrokeStr, "fitStroke", "Fit background",
                      uint(CQChartsStrokeDataTypes::STANDARD), /*hidden*/true);
 
+  // background box style only changes background layer
+  for (const auto &prefix : {"plotFill", "dataFill", "fitFill"})
+    declareStyleStages(prefix, {"Color", "Alpha", "Pattern"}, Stages(Stage::DRAW_BACKGROUND));
+
+  for (const auto &prefix : {"plotStroke", "dataStroke", "fitStroke"})
+    declareStyleStages(prefix, {"Color", "Alpha", "Dash", "Cap", "Join"},
+                       Stages(Stage::DRAW_BACKGROUND));
+
+  for (const auto &prefix : {"plot", "data", "fit"})
+    declareStyleStages(prefix, {"Filled", "Stroked", "BorderSides"},
+                       Stages(Stage::DRAW_BACKGROUND));
+
   addStyleProp(fitStyleStrokeStr, "fitBorderSides", "sides",
                "Fit background bounding box stroked sides", /*hidden*/true);
 
@@ -3761,6 +4252,10 @@ addBaseProperties()
   addProp("filter/bad", "badUseRow", "useRow", "Use row number for bad values");
   addProp("filter/bad", "badValue" , "value" , "Bad value (when not using row number)");
 
+  // filter and bad data change model rows/values read
+  for (const auto &name : {"filterStr", "skipBad", "badUseRow", "badValue"})
+    declarePropertyStages(name, Stages(Stage::MODEL));
+
   //---
 
   // xaxis
@@ -4038,7 +4533,15 @@ bool
 CQChartsPlot::
 setProperty(const QString &name, const QVariant &value)
 {
-  return propertyModel()->setProperty(this, name, value);
+  // record stages requested by setter and invalidate declared stages instead (if any)
+  if (! beginPropertyStages(name, propertyStages(name)))
+    return propertyModel()->setProperty(this, name, value);
+
+  bool rc = propertyModel()->setProperty(this, name, value);
+
+  endPropertyStages();
+
+  return rc;
 }
 
 bool
@@ -4836,6 +5339,20 @@ isValueVisible(int row, const QModelIndex &parent) const
   return true;
 }
 
+bool
+CQChartsPlot::
+isModelRowsUnfiltered() const
+{
+  // filters applied by CQChartsPlotModelVisitor::preVisit
+  if (filterStr().length() || isEveryEnabled() || progressiveStride() > 1)
+    return false;
+
+  if (visibleColumn().isValid() || ! filterColumns_.empty())
+    return false;
+
+  return true;
+}
+
 void
 CQChartsPlot::
 setColumnValueVisible(const Column &column, const QVariant &value, bool visible)
@@ -4884,6 +5401,7 @@ threadTimerSlot()
   auto updateState = this->updateState();
   auto nextState   = UpdateState::INVALID;
   bool updateView  = false;
+  bool refine      = false;
 
   {
   TryLockMutex lock(this, "threadTimerSlot");
@@ -4960,6 +5478,9 @@ threadTimerSlot()
 
       // need draw
       updateView = true;
+
+      // objects from progressive sample drawn so refine using all rows
+      refine = true;
     }
     // draw running so redraw view (busy)
     else {
@@ -5022,6 +5543,7 @@ threadTimerSlot()
       std::unique_lock<std::mutex> lock(updatesMutex_);
 
       updatesData_.stateFlag[UpdateState::UPDATE_DRAW_OBJS      ] = 0;
+      updatesData_.stateFlag[UpdateState::UPDATE_DRAW_MIDDLE    ] = 0;
       updatesData_.stateFlag[UpdateState::UPDATE_DRAW_BACKGROUND] = 0;
       updatesData_.stateFlag[UpdateState::UPDATE_DRAW_FOREGROUND] = 0;
       }
@@ -5031,6 +5553,21 @@ threadTimerSlot()
       updateView = true;
     }
   }
+  else if (nextState == UpdateState::UPDATE_DRAW_MIDDLE) {
+    // don't update until range and objs calculated
+    if (updateState != UpdateState::CALC_RANGE &&
+        updateState != UpdateState::CALC_OBJS) {
+      {
+      std::unique_lock<std::mutex> lock(updatesMutex_);
+
+      updatesData_.stateFlag[UpdateState::UPDATE_DRAW_MIDDLE] = 0;
+      }
+
+      this->invalidateMiddleLayers();
+
+      updateView = true;
+    }
+  }
   else if (nextState == UpdateState::UPDATE_DRAW_BACKGROUND) {
     // don't update until objs drawn
     if (updateState != UpdateState::DRAW_OBJS) {
@@ -5066,8 +5603,15 @@ threadTimerSlot()
 
   //---
 
+  // refine progressive sample (unless new objects already queued)
+  if (refine && nextState != UpdateState::UPDATE_RANGE && nextState != UpdateState::UPDATE_OBJS)
+    refineProgressive();
+
+  //---
+
+  // only plot area changed (busy or drawn layers)
   if (updateView)
-    view()->doUpdate();
+    view()->doUpdatePlot(this);
 }
 
 void
@@ -5117,6 +5661,13 @@ calcNextState() const
 
     nextState = UpdateState::UPDATE_DRAW_OBJS;
   }
+  else if (th->updatesData_.stateFlag[UpdateState::UPDATE_DRAW_MIDDLE] > 0) {
+    if (debugUpdate_)
+      std::cerr << "UpdateState::UPDATE_DRAW_MIDDLE : " <<
+        th->updatesData_.stateFlag[UpdateState::UPDATE_DRAW_MIDDLE] << "\n";
+
+    nextState = UpdateState::UPDATE_DRAW_MIDDLE;
+  }
   else if (th->updatesData_.stateFlag[UpdateState::UPDATE_DRAW_BACKGROUND] > 0) {
     if (debugUpdate_)
       std::cerr << "UpdateState::UPDATE_DRAW_BACKGROUND : " <<
@@ -5170,6 +5721,7 @@ setUpdateState(UpdateState state)
       case UpdateState::UPDATE_RANGE:     std::cerr << "Update Range\n"; break;
       case UpdateState::UPDATE_OBJS:      std::cerr << "Update Objs\n"; break;
       case UpdateState::UPDATE_DRAW_OBJS: std::cerr << "Update Draw Objs\n"; break;
+      case UpdateState::UPDATE_DRAW_MIDDLE: std::cerr << "Update Draw Middle\n"; break;
       case UpdateState::UPDATE_VIEW:      std::cerr << "Update View\n"; break;
       case UpdateState::DRAWN:            std::cerr << "Drawn\n"; break;
       default:                            std::cerr << "Invalid\n"; break;
@@ -5254,6 +5806,12 @@ updateAndApplyRange(bool apply, bool updateObjs)
 {
   CQPerfTrace trace("CQChartsPlot::updateAndApplyRange");
 
+  // model reread by range calc after model, column or filter change
+  if (stageData_.modelRead.exchange(false))
+    incStageCount(Stage::MODEL);
+
+  incStageCount(Stage::RANGE);
+
   // update overlay objects
   if (isOverlay()) {
     if (! isFirstPlot())
@@ -5586,41 +6144,119 @@ execUpdateObjs()
     return;
   }
 
-  // update overlay objects
+  // update overlay objects
+  if (isOverlay()) {
+    if (! isFirstPlot())
+      return;
+
+    processOverlayPlots([&](Plot *plot) {
+      plot->updatePlotObjs();
+    });
+  }
+  else {
+    updatePlotObjs();
+  }
+}
+
+void
+CQChartsPlot::
+updatePlotObjs()
+{
+  incStageCount(Stage::OBJS);
+
+  if (! isSequential()) {
+    initProgressive();
+
+    startCalcObjs();
+  }
+  else {
+    progressiveData_.sampleStride = 1;
+
+    // add objs
+    // TODO: non threaded version ?
+    updateObjsThread();
+
+    postUpdateObjs();
+
+    //---
+
+    // draw objects
+    drawObjs();
+
+    postDraw();
+  }
+}
+
+void
+CQChartsPlot::
+initProgressive()
+{
+  // use sample of rows for new objects unless refining previous sample
+  // (overlay plots use first plot's settings so are sampled and refined together)
   if (isOverlay()) {
     if (! isFirstPlot())
       return;
 
+    bool refine = progressiveData_.refine;
+
     processOverlayPlots([&](Plot *plot) {
-      plot->updatePlotObjs();
+      plot->progressiveData_.sampleStride = (! refine ? calcProgressiveStride(plot) : 1);
+      plot->progressiveData_.refine       = false;
     });
   }
   else {
-    updatePlotObjs();
+    progressiveData_.sampleStride = (! progressiveData_.refine ? calcProgressiveStride(this) : 1);
+    progressiveData_.refine       = false;
   }
 }
 
+int
+CQChartsPlot::
+calcProgressiveStride(const Plot *plot) const
+{
+  // only sample rows of flat models for plots with per row objects
+  if (! isProgressive() || progressiveSampleSize() <= 0)
+    return 1;
+
+  if (! plot->canProgressiveSample() || plot->isHierarchical())
+    return 1;
+
+  auto *model = plot->model().data();
+  if (! model) return 1;
+
+  int nr = model->rowCount();
+
+  // not worth sampling if not much larger than sample
+  if (nr <= 2*progressiveSampleSize())
+    return 1;
+
+  return (nr + progressiveSampleSize() - 1)/progressiveSampleSize();
+}
+
 void
 CQChartsPlot::
-updatePlotObjs()
+refineProgressive()
 {
-  if (! isSequential()) {
-    startCalcObjs();
+  // recreate objects from all rows if current objects are from sample
+  bool sampled = false;
+
+  if (isOverlay()) {
+    processOverlayPlots([&](Plot *plot) {
+      if (plot->isProgressiveSample())
+        sampled = true;
+    });
   }
-  else {
-    // add objs
-    // TODO: non threaded version ?
-    updateObjsThread();
+  else
+    sampled = isProgressiveSample();
 
-    postUpdateObjs();
+  if (! sampled || isInterrupt())
+    return;
 
-    //---
+  auto *plot = (isOverlay() ? firstPlot() : this);
 
-    // draw objects
-    drawObjs();
+  plot->progressiveData_.refine = true;
 
-    postDraw();
-  }
+  updateObjs();
 }
 
 void
@@ -5767,8 +6403,13 @@ updateObjsThread()
 
   initColorColumnData();
 
+  // model visits only use every n'th (pseudo random) row for progressive sample
+  progressiveData_.visitStride = progressiveData_.sampleStride;
+
   initPlotObjs();
 
+  progressiveData_.visitStride = 1;
+
   //---
 
   assert(! parentPlot());
@@ -6570,6 +7211,10 @@ createObjs()
 
   applyVisibleFilter();
 
+  //---
+
+  buildSelectRowIndex();
+
   return true;
 }
 
@@ -6673,8 +7318,11 @@ execInitObjTree()
   if (objTreeData_.init) {
     objTreeData_.init = false;
 
-    if (! isPreview())
+    if (! isPreview()) {
+      incStageCount(Stage::TREE);
+
       objTreeData_.tree->addObjects();
+    }
   }
 }
 
@@ -6699,6 +7347,15 @@ clearPlotObjects1()
 
   objTreeData_.tree->clearObjects();
 
+  // annotation positions can reference plot objects
+  annotationTree_->invalidate();
+
+  view()->annotationTree()->invalidate();
+
+  clearSelectRowIndex();
+
+  clearDrawRecord();
+
   PlotObjs plotObjs;
 
   std::swap(plotObjs, plotObjs_);
@@ -9273,7 +9930,7 @@ void
 CQChartsPlot::
 setIdColumn(const Column &c)
 {
-  CQChartsUtil::testAndSet(idColumn_, c, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("idColumn", idColumn_, c, [&]() { updateRangeAndObjs(); } );
 }
 
 void
@@ -9301,14 +9958,14 @@ void
 CQChartsPlot::
 setVisibleColumn(const Column &c)
 {
-  CQChartsUtil::testAndSet(visibleColumn_, c, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("visibleColumn", visibleColumn_, c, [&]() { updateRangeAndObjs(); } );
 }
 
 void
 CQChartsPlot::
 setImageColumn(const Column &c)
 {
-  CQChartsUtil::testAndSet(imageColumn_, c, [&]() { updateRangeAndObjs(); } );
+  testAndSetProperty("imageColumn", imageColumn_, c, [&]() { updateRangeAndObjs(); } );
 }
 
 void
@@ -10795,7 +11452,7 @@ panLeft(double f)
 
     plot->adjustPan();
 
-    plot->applyDataRangeAndDraw();
+    plot->applyPanDataRangeAndDraw();
   };
 
   panX(this);
@@ -10833,7 +11490,7 @@ panRight(double f)
 
     plot->adjustPan();
 
-    plot->applyDataRangeAndDraw();
+    plot->applyPanDataRangeAndDraw();
   };
 
   panX(this);
@@ -10871,7 +11528,7 @@ panUp(double f)
 
     plot->adjustPan();
 
-    plot->applyDataRangeAndDraw();
+    plot->applyPanDataRangeAndDraw();
   };
 
   panY(this);
@@ -10909,7 +11566,7 @@ panDown(double f)
 
     plot->adjustPan();
 
-    plot->applyDataRangeAndDraw();
+    plot->applyPanDataRangeAndDraw();
   };
 
   panY(this);
@@ -10945,11 +11602,23 @@ pan(double dx, double dy)
 
   adjustPan();
 
-  applyDataRangeAndDraw();
+  applyPanDataRangeAndDraw();
 
   emit zoomPanChanged();
 }
 
+void
+CQChartsPlot::
+applyPanDataRangeAndDraw()
+{
+  // pan only changes data to pixel offset so recorded object draws can be reused
+  drawRecordData_.panning = true;
+
+  applyDataRangeAndDraw();
+
+  drawRecordData_.panning = false;
+}
+
 //---
 
 void
@@ -11473,7 +12142,15 @@ annotationsAtPoint(const Point &p, Annotations &annotations, const Constraints &
 {
   int iconstraints = static_cast<int>(constraints);
 
-  for (const auto &annotation : this->annotations()) {
+  // candidates from bbox tree (tolerance for line hit test)
+  checkAnnotationTree();
+
+  Annotations annotations1;
+
+  annotationTree_->annotationsAtPoint(p, pixelToWindowWidth(4), pixelToWindowHeight(4),
+                                      annotations1);
+
+  for (const auto &annotation : annotations1) {
     if (! annotation->isVisible())
       continue;
 
@@ -11608,7 +12285,14 @@ annotationsIntersectRect1(const BBox &r, Annotations &annotations, bool inside,
 {
   int iconstraints = static_cast<int>(constraints);
 
-  for (const auto &annotation : this->annotations()) {
+  // candidates from bbox tree
+  checkAnnotationTree();
+
+  Annotations annotations1;
+
+  annotationTree_->annotationsTouchingRect(r, annotations1);
+
+  for (const auto &annotation : annotations1) {
     if (! annotation->isVisible())
       continue;
 
@@ -11628,6 +12312,15 @@ annotationsIntersectRect1(const BBox &r, Annotations &annotations, bool inside,
   }
 }
 
+void
+CQChartsPlot::
+checkAnnotationTree() const
+{
+  // annotations sized or positioned in pixels move when pixel mapping changes
+  // (only these are unindexed, annotations in parent coords stay indexed)
+  annotationTree_->checkMapping(pixelToWindow(BBox(0, 0, 100, 100)));
+}
+
 bool
 CQChartsPlot::
 objNearestPoint(const Point &p, PlotObj* &obj) const
@@ -12069,11 +12762,20 @@ drawThread()
 
   //---
 
-  view()->lockPainter(true);
+  if (isBufferLayers() && ! isOverview()) {
+    // only rasterize into plot buffers (composited in view paint) so plots
+    // can draw in parallel without locking the view painter
+    std::unique_lock<std::mutex> lock(bufferMutex_);
 
-  drawParts(view()->ipainter());
+    drawParts(nullptr);
+  }
+  else {
+    view()->lockPainter(true);
+
+    drawParts(view()->ipainter());
 
-  view()->lockPainter(false);
+    view()->lockPainter(false);
+  }
 
   //---
 
@@ -12182,10 +12884,12 @@ drawLayers(QPainter *painter) const
 {
   assert(! parentPlot());
 
+  // Note: draw thread paints back buffers so draw last completed (front) buffers
+  // (buffer only locked while draw thread swaps completed buffer)
   for (auto &tb : buffers_) {
     auto *buffer = tb.second;
 
-    if (buffer->isActive() && buffer->isValid())
+    if (buffer->isActive())
       buffer->draw(painter);
   }
 }
@@ -13284,82 +13988,44 @@ execDrawObjs(PaintDevice *device, const Layer::Type &layerType) const
 //auto bbox = displayRangeBBox();
   auto bbox = calcPlotViewRect();
 
-  for (const auto &plotObj : plotObjects()) {
-    if (! plotObj->isVisible())
-      continue;
-
-    // skip unselected objects on selection layer
-    if      (layerType == Layer::Type::SELECTION) {
-      if (! plotObj->isSelected())
-        continue;
-    }
-    // skip non-inside objects on mouse over layer
-    else if (layerType == Layer::Type::MOUSE_OVER) {
-      if (! plotObj->isInside())
+  if (canDrawRecord(device, layerType)) {
+    drawRecordObjs(device, layerType);
+  }
+  else {
+    for (const auto &plotObj : plotObjects()) {
+      if (! plotObj->isVisible())
         continue;
 
-      if (! plotObj->drawMouseOver())
-        continue;
-    }
+      // skip unselected objects on selection layer
+      if      (layerType == Layer::Type::SELECTION) {
+        if (! plotObj->isSelected())
+          continue;
+      }
+      // skip non-inside objects on mouse over layer
+      else if (layerType == Layer::Type::MOUSE_OVER) {
+        if (! plotObj->isInside())
+          continue;
 
-    //---
+        if (! plotObj->drawMouseOver())
+          continue;
+      }
 
-    // skip objects not inside plot
-    if (isPlotClip() && ! objInsideBox(plotObj, bbox))
-      continue;
+      //---
 
-    //---
+      // skip objects not inside plot
+      if (isPlotClip() && ! objInsideBox(plotObj, bbox))
+        continue;
 
-    bool isZoomText = plotObj->isZoomText().boolOr(this->isZoomText());
+      //---
 
-    auto *viewPlotDevice = dynamic_cast<CQChartsViewPlotPaintDevice *>(device);
+      execDrawObj(device, plotObj, layerType);
 
-    if (isZoomText && viewPlotDevice)
-      viewPlotDevice->setZoomFont(true);
+      //---
 
-    // draw object on layer
-    if      (layerType == Layer::Type::SELECTION) {
-      plotObj->draw  (device);
-      plotObj->drawFg(device);
-    }
-    else if (layerType == Layer::Type::MOUSE_OVER) {
-      plotObj->draw  (device);
-      plotObj->drawFg(device);
-    }
-    else {
-      auto drawLayer = plotObj->drawLayer();
-
-      if (drawLayer != CQChartsPlotObj::DrawLayer::NONE) {
-        bool draw = ((drawLayer == CQChartsPlotObj::DrawLayer::BACKGROUND &&
-                      layerType == Layer::Type::BG_PLOT) ||
-                     (drawLayer == CQChartsPlotObj::DrawLayer::MIDDLE &&
-                      layerType == Layer::Type::MID_PLOT) ||
-                     (drawLayer == CQChartsPlotObj::DrawLayer::FOREGROUND &&
-                      layerType == Layer::Type::FG_PLOT));
-
-        if (draw)
-          plotObj->draw(device);
-      }
-      else {
-        if      (layerType == Layer::Type::BG_PLOT)
-          plotObj->drawBg(device);
-        else if (layerType == Layer::Type::FG_PLOT)
-          plotObj->drawFg(device);
-        else if (layerType == Layer::Type::MID_PLOT)
-          plotObj->draw  (device);
-      }
+      // show debug box
+      if (showBoxes() || (plotObj->isSelected() && showSelectedBoxes()))
+        plotObj->drawDebugRect(device);
     }
-
-    //---
-
-    if (isZoomText && viewPlotDevice)
-      viewPlotDevice->setZoomFont(false);
-
-    //---
-
-    // show debug box
-    if (showBoxes() || (plotObj->isSelected() && showSelectedBoxes()))
-      plotObj->drawDebugRect(device);
   }
 
   //---
@@ -13381,6 +14047,188 @@ execDrawObjs(PaintDevice *device, const Layer::Type &layerType) const
   device->restore();
 }
 
+void
+CQChartsPlot::
+execDrawObj(PaintDevice *device, PlotObj *plotObj, const Layer::Type &layerType) const
+{
+  bool isZoomText = plotObj->isZoomText().boolOr(this->isZoomText());
+
+  auto *viewPlotDevice = dynamic_cast<CQChartsViewPlotPaintDevice *>(device);
+  auto *recordDevice   = dynamic_cast<CQChartsRecordPaintDevice   *>(device);
+
+  if (isZoomText) {
+    if      (viewPlotDevice)
+      viewPlotDevice->setZoomFont(true);
+    else if (recordDevice)
+      recordDevice->setRecordZoomFont(true);
+  }
+
+  // draw object on layer
+  if      (layerType == Layer::Type::SELECTION) {
+    plotObj->draw  (device);
+    plotObj->drawFg(device);
+  }
+  else if (layerType == Layer::Type::MOUSE_OVER) {
+    plotObj->draw  (device);
+    plotObj->drawFg(device);
+  }
+  else {
+    auto drawLayer = plotObj->drawLayer();
+
+    if (drawLayer != CQChartsPlotObj::DrawLayer::NONE) {
+      bool draw = ((drawLayer == CQChartsPlotObj::DrawLayer::BACKGROUND &&
+                    layerType == Layer::Type::BG_PLOT) ||
+                   (drawLayer == CQChartsPlotObj::DrawLayer::MIDDLE &&
+                    layerType == Layer::Type::MID_PLOT) ||
+                   (drawLayer == CQChartsPlotObj::DrawLayer::FOREGROUND &&
+                    layerType == Layer::Type::FG_PLOT));
+
+      if (draw)
+        plotObj->draw(device);
+    }
+    else {
+      if      (layerType == Layer::Type::BG_PLOT)
+        plotObj->drawBg(device);
+      else if (layerType == Layer::Type::FG_PLOT)
+        plotObj->drawFg(device);
+      else if (layerType == Layer::Type::MID_PLOT)
+        plotObj->draw  (device);
+    }
+  }
+
+  //---
+
+  if (isZoomText) {
+    if      (viewPlotDevice)
+      viewPlotDevice->setZoomFont(false);
+    else if (recordDevice)
+      recordDevice->setRecordZoomFont(false);
+  }
+}
+
+bool
+CQChartsPlot::
+canDrawRecord(PaintDevice *device, const Layer::Type &layerType) const
+{
+  if (! isDrawRecord())
+    return false;
+
+  // only object layers (selection and mouse over change too often)
+  if (layerType != Layer::Type::BG_PLOT && layerType != Layer::Type::MID_PLOT &&
+      layerType != Layer::Type::FG_PLOT)
+    return false;
+
+  // only top level plots (redraw of child/overlay plots is handled by other plot)
+  if (isComposite() || parentPlot() || isOverlay())
+    return false;
+
+  // only for cached plot buffers
+  if (! dynamic_cast<CQChartsViewPlotPaintDevice *>(device))
+    return false;
+
+  return true;
+}
+
+void
+CQChartsPlot::
+drawRecordObjs(PaintDevice *device, const Layer::Type &layerType) const
+{
+  CQPerfTrace trace("CQChartsPlot::drawRecordObjs");
+
+  auto &layerList = drawRecordData_.layerLists[layerType];
+
+  // recorded pixel coords depend on scale (not offset) so re-record on zoom or resize
+  double pixelWidth  = windowToPixelWidth (1.0);
+  double pixelHeight = windowToPixelHeight(1.0);
+  bool   interactive = device->isInteractive();
+
+  bool valid = (layerList.list &&
+                layerList.generation  == drawRecordData_.generation &&
+                layerList.pixelWidth  == pixelWidth &&
+                layerList.pixelHeight == pixelHeight &&
+                layerList.interactive == interactive);
+
+  if (! valid) {
+    CQPerfTrace trace1("CQChartsPlot::drawRecordObjs:record");
+
+    auto *th = const_cast<CQChartsPlot *>(this);
+
+    layerList.list        = std::make_unique<CQChartsDisplayList>();
+    layerList.generation  = drawRecordData_.generation;
+    layerList.pixelWidth  = pixelWidth;
+    layerList.pixelHeight = pixelHeight;
+    layerList.interactive = interactive;
+
+    // record all visible objects (culled to visible area on replay)
+    PlotObjs plotObjs;
+
+    for (const auto &plotObj : plotObjects()) {
+      if (plotObj->isVisible())
+        plotObjs.push_back(plotObj);
+    }
+
+    auto recordObjs = [&](CQChartsDisplayList *list, int i1, int i2) {
+      CQChartsRecordPaintDevice recordDevice(th, list);
+
+      recordDevice.setInteractive(interactive);
+
+      for (int i = i1; i < i2; ++i) {
+        auto *plotObj = plotObjs[size_t(i)];
+
+        recordDevice.beginObject(plotObj->rect());
+
+        execDrawObj(&recordDevice, plotObj, layerType);
+
+        recordDevice.endObject();
+      }
+    };
+
+    int n = int(plotObjs.size());
+
+    // recording in parallel is opt-in (see setDrawRecordParallel) as it runs plot
+    // object draw code on pool threads concurrently
+    if (isDrawRecordParallel() && ! isSequential()) {
+      using DisplayLists = std::vector<CQChartsDisplayList>;
+
+      DisplayLists chunkLists(size_t(CQChartsParallel::numChunks(n, 256)));
+
+      CQChartsParallel::forChunkInds(n, [&](int ic, int i1, int i2) {
+        recordObjs(&chunkLists[size_t(ic)], i1, i2);
+      }, 256);
+
+      for (const auto &chunkList : chunkLists)
+        layerList.list->append(chunkList);
+    }
+    else
+      recordObjs(layerList.list.get(), 0, n);
+  }
+
+  //---
+
+  // replay (skip objects outside plot if clipped)
+  // Note: replay paints the layer image with the draw thread's QPainter (painting a
+  // QImage outside the GUI thread is supported by Qt) so view paint is not blocked
+  layerList.list->replay(device, isPlotClip() ? calcPlotViewRect() : BBox());
+
+  //---
+
+  // show debug boxes (not recorded as depend on selection)
+  if (showBoxes() || showSelectedBoxes()) {
+    auto bbox = calcPlotViewRect();
+
+    for (const auto &plotObj : plotObjects()) {
+      if (! plotObj->isVisible())
+        continue;
+
+      if (isPlotClip() && ! objInsideBox(plotObj, bbox))
+        continue;
+
+      if (showBoxes() || (plotObj->isSelected() && showSelectedBoxes()))
+        plotObj->drawDebugRect(device);
+    }
+  }
+}
+
 bool
 CQChartsPlot::
 objInsideBox(PlotObj *plotObj, const BBox &bbox) const
@@ -13993,7 +14841,17 @@ drawAnnotations(PaintDevice *device, const Layer::Type &layerType) const
 
   //---
 
-  for (auto &annotation : annotations()) {
+  // cull annotation layers to annotations touching view
+  checkAnnotationTree();
+
+  Annotations annotations1;
+
+  if (layerType == Layer::Type::BG_ANNOTATION || layerType == Layer::Type::FG_ANNOTATION)
+    annotationTree_->annotationsTouchingRect(pixelToWindow(view()->prect()), annotations1);
+  else
+    annotations1 = annotations();
+
+  for (auto &annotation : annotations1) {
     if (! annotation->isVisible())
       continue;
 
@@ -14010,9 +14868,6 @@ drawAnnotations(PaintDevice *device, const Layer::Type &layerType) const
         continue;
     }
 
-//  if (! bbox.overlaps(annotation->rect()))
-//    continue;
-
     annotation->draw(device);
   }
 
@@ -14491,6 +15346,23 @@ calcPlotPixelRect() const
   return view()->windowToPixel(calcViewBBox());
 }
 
+CQChartsGeom::BBox
+CQChartsPlot::
+calcBufferPixelRect() const
+{
+  // plot pixel rect and last painted buffer rects (in case plot moved)
+  auto bbox = calcPlotPixelRect();
+
+  for (const auto &tb : buffers_) {
+    const auto &rect = tb.second->rect();
+
+    if (rect.isValid())
+      bbox += BBox(rect);
+  }
+
+  return bbox;
+}
+
 CQChartsGeom::BBox
 CQChartsPlot::
 calcPlotViewRect() const
@@ -15169,6 +16041,8 @@ addAnnotationI(Annotation *annotation)
 {
   annotations_.push_back(annotation);
 
+  annotationTree_->addAnnotation(annotation);
+
   connect(annotation, SIGNAL(idChanged()), this, SLOT(updateAnnotationSlot()));
   connect(annotation, SIGNAL(dataChanged()), this, SLOT(updateAnnotationSlot()));
 
@@ -15229,6 +16103,8 @@ raiseAnnotation(Annotation *annotation)
   if (pos < np - 1)
     std::swap(annotations_[size_t(pos + 1)], annotations_[size_t(pos)]);
 
+  annotationTree_->setOrder(annotations_);
+
   drawObjs();
 
   emit annotationsReordered();
@@ -15247,6 +16123,8 @@ lowerAnnotation(Annotation *annotation)
   if (pos > 0)
     std::swap(annotations_[size_t(pos - 1)], annotations_[size_t(pos)]);
 
+  annotationTree_->setOrder(annotations_);
+
   drawObjs();
 
   emit annotationsReordered();
@@ -15285,6 +16163,8 @@ removeAnnotation(Annotation *annotation)
 
   propertyModel()->removeProperties("annotations/" + annotation->propertyId());
 
+  annotationTree_->removeAnnotation(annotation);
+
   delete annotation;
 
   for (int i = pos + 1; i < n; ++i)
@@ -15299,6 +16179,8 @@ void
 CQChartsPlot::
 removeAllAnnotations()
 {
+  annotationTree_->clear();
+
   for (auto &annotation : annotations_)
     delete annotation;
 
@@ -15526,6 +16408,11 @@ invalidateLayers()
 
   //---
 
+  if (! drawRecordData_.panning)
+    ++drawRecordData_.generation;
+
+  //---
+
   execInvalidateLayers();
 }
 
@@ -15558,6 +16445,10 @@ execInvalidateLayers()
       buffer.second->setValid(false);
   }
 
+  incStageCount(Stage::DRAW_BACKGROUND);
+  incStageCount(Stage::DRAW_OBJS);
+  incStageCount(Stage::DRAW_FOREGROUND);
+
   setLayersChanged(true);
 
   fromInvalidate_ = true;
@@ -15614,6 +16505,10 @@ invalidateLayer1(const Buffer::Type &type)
 
   layer->setValid(false);
 
+  if      (type == Buffer::Type::BACKGROUND) incStageCount(Stage::DRAW_BACKGROUND);
+  else if (type == Buffer::Type::MIDDLE    ) incStageCount(Stage::DRAW_OBJS);
+  else if (type == Buffer::Type::FOREGROUND) incStageCount(Stage::DRAW_FOREGROUND);
+
   setLayersChanged(false);
 
   fromInvalidate_ = true;
@@ -15645,7 +16540,11 @@ setLayersChanged(bool update)
   else {
   //drawNonMiddleParts(view()->ipainter());
 
+    {
+    std::unique_lock<std::mutex> lock(bufferMutex_);
+
     drawParts(view()->ipainter());
+    }
 
     fromInvalidate_ = true;
 
@@ -15926,7 +16825,7 @@ update()
 {
   assert(fromInvalidate_);
 
-  view()->doUpdate();
+  view()->doUpdatePlot(this);
 
   fromInvalidate_ = false;
 }
@@ -16119,6 +17018,19 @@ interpColor(const Color &c, const ColorInd &ind) const
   return view()->interpColor(c1, ind);
 }
 
+bool
+CQChartsPlot::
+interpColorValues(const Color &c, const std::vector<double> &values,
+                  std::vector<QRgb> &rgbs) const
+{
+  auto c1 = c;
+
+  if (defaultPalette_.isValid())
+    c1 = charts()->adjustDefaultPalette(c, defaultPalette_.name());
+
+  return view()->interpColorValues(c1, values, rgbs);
+}
+
 //---
 
 QColor
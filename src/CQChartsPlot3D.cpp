@@ -1,6 +1,7 @@
 #include <CQChartsPlot3D.h>
 #include <CQChartsCamera.h>
 #include <CQChartsPaintDevice.h>
+#include <CQChartsRadixSort.h>
 #include <CQPropertyViewItem.h>
 
 CQChartsPlot3DType::
@@ -180,24 +181,9 @@ void
 CQChartsPlot3D::
 deletePointObjs()
 {
-  for (auto &po : bgPointObjs_) {
-    for (const auto &obj : po.second)
-      delete obj;
-  }
-
-  for (auto &po : pointObjs_) {
-    for (const auto &obj : po.second)
-      delete obj;
-  }
-
-  for (auto &po : fgPointObjs_) {
-    for (const auto &obj : po.second)
-      delete obj;
-  }
-
-  bgPointObjs_.clear();
-  pointObjs_  .clear();
-  fgPointObjs_.clear();
+  bgPointObjs_.deleteObjs();
+  pointObjs_  .deleteObjs();
+  fgPointObjs_.deleteObjs();
 }
 
 //---
@@ -206,15 +192,13 @@ bool
 CQChartsPlot3D::
 objNearestPoint(const Point &p, CQChartsPlotObj* &nearestObj) const
 {
-  for (auto &po : pointObjs_) {
-    for (const auto &obj : po.second) {
-      if (! obj->drawBBox().inside(p))
-        continue;
+  for (const auto &obj : pointObjs_.objs()) {
+    if (! obj->drawBBox().inside(p))
+      continue;
 
-      nearestObj = obj;
+    nearestObj = obj;
 
-      return true;
-    }
+    return true;
   }
 
   return false;
@@ -224,13 +208,11 @@ void
 CQChartsPlot3D::
 plotObjsAtPoint(const Point &p, PlotObjs &objs, const Constraints & /*constraints*/) const
 {
-  for (auto &po : pointObjs_) {
-    for (const auto &obj : po.second) {
-      if (! obj->drawBBox().inside(p))
-        continue;
+  for (const auto &obj : pointObjs_.objs()) {
+    if (! obj->drawBBox().inside(p))
+      continue;
 
-      objs.push_back(obj);
-    }
+    objs.push_back(obj);
   }
 }
 
@@ -574,7 +556,7 @@ addBgPointObj(const Point3D &p, CQChartsPlot3DObj *obj)
 {
   obj->setRefPoint(p);
 
-  bgPointObjs_[p].push_back(obj);
+  bgPointObjs_.add(p, obj);
 }
 
 void
@@ -583,7 +565,7 @@ addPointObj(const Point3D &p, CQChartsPlot3DObj *obj)
 {
   obj->setRefPoint(p);
 
-  pointObjs_[p].push_back(obj);
+  pointObjs_.add(p, obj);
 }
 
 void
@@ -592,7 +574,7 @@ addFgPointObj(const Point3D &p, CQChartsPlot3DObj *obj)
 {
   obj->setRefPoint(p);
 
-  fgPointObjs_[p].push_back(obj);
+  fgPointObjs_.add(p, obj);
 }
 
 void
@@ -628,55 +610,147 @@ drawPointObjs(PaintDevice *device) const
 
   //---
 
-  using ZObjs = std::map<double, Objs>;
+  // cull objects outside plot (if clipped)
+  BBox bbox;
 
-  //---
+  if (isPlotClip())
+    bbox = calcPlotViewRect();
 
-  ZObjs bgZObjs;
+  drawPointObjs(device, bgPointObjs_, bbox);
+  drawPointObjs(device, pointObjs_  , bbox);
+  drawPointObjs(device, fgPointObjs_, bbox);
+}
 
-  for (auto &po : bgPointObjs_) {
-    double z = camera->transform(po.first).z;
+void
+CQChartsPlot3D::
+drawPointObjs(PaintDevice *device, const CQChartsPlot3DPointObjs &pointObjs,
+              const BBox &bbox) const
+{
+  // draw back to front
+  CQChartsPlot3DPointObjs::Inds inds;
 
-    for (const auto &bgObj : po.second)
-      bgZObjs[-z].push_back(bgObj);
-  }
+  pointObjs.drawOrder(camera(), bbox, inds);
+
+  const auto &objs = pointObjs.objs();
+
+  for (const auto &i : inds) {
+    auto *obj = objs[size_t(i)];
+
+    obj->setDrawRefPoint(pointObjs.projPoint(i));
 
-  for (auto &po : bgZObjs) {
-    for (const auto &bgObj : po.second)
-      bgObj->postDraw(device);
+    obj->postDraw(device);
   }
+}
+
+//------
+
+void
+CQChartsPlot3DPointObjs::
+add(const Point3D &p, Obj *obj)
+{
+  xs_.push_back(p.x);
+  ys_.push_back(p.y);
+  zs_.push_back(p.z);
+
+  objs_.push_back(obj);
+}
+
+void
+CQChartsPlot3DPointObjs::
+clear()
+{
+  xs_.clear();
+  ys_.clear();
+  zs_.clear();
+
+  objs_.clear();
+
+  txs_.clear();
+  tys_.clear();
+  tzs_.clear();
+}
+
+void
+CQChartsPlot3DPointObjs::
+deleteObjs()
+{
+  for (const auto &obj : objs_)
+    delete obj;
+
+  clear();
+}
+
+void
+CQChartsPlot3DPointObjs::
+drawOrder(const CQChartsCamera *camera, const BBox &bbox, Inds &inds) const
+{
+  inds.clear();
+
+  int n = size();
+
+  if (n == 0)
+    return;
 
   //---
 
-  ZObjs zObjs;
+  // project all reference points
+  auto sn = size_t(n);
 
-  for (auto &po : pointObjs_) {
-    double z = camera->transform(po.first).z;
+  txs_.resize(sn);
+  tys_.resize(sn);
+  tzs_.resize(sn);
 
-    for (const auto &obj : po.second)
-      zObjs[-z].push_back(obj);
-  }
+  camera->transformPoints(xs_.data(), ys_.data(), zs_.data(), n,
+                          txs_.data(), tys_.data(), tzs_.data());
+
+  //---
+
+  // cull objects outside box (object checks its extent if reference point outside)
+  Inds visInds;
 
-  for (auto &po : zObjs) {
-    for (const auto &obj : po.second)
-      obj->postDraw(device);
+  visInds.reserve(sn);
+
+  if (bbox.isValid()) {
+    double xmin = bbox.getXMin(), ymin = bbox.getYMin();
+    double xmax = bbox.getXMax(), ymax = bbox.getYMax();
+
+    for (int i = 0; i < n; ++i) {
+      double x = txs_[size_t(i)];
+      double y = tys_[size_t(i)];
+
+      bool inside = (x >= xmin && x <= xmax && y >= ymin && y <= ymax);
+
+      if (! inside && ! objs_[size_t(i)]->isDrawInside(projPoint(i), bbox)) {
+        objs_[size_t(i)]->setDrawBBox(BBox());
+        continue;
+      }
+
+      visInds.push_back(i);
+    }
+  }
+  else {
+    for (int i = 0; i < n; ++i)
+      visInds.push_back(i);
   }
 
   //---
 
-  ZObjs fgZObjs;
+  // sort by decreasing z (stable so equal z objects are drawn in add order)
+  std::vector<uint32_t> keys;
 
-  for (auto &po : fgPointObjs_) {
-    double z = camera->transform(po.first).z;
+  keys.resize(visInds.size());
 
-    for (const auto &fgObj : po.second)
-      fgZObjs[-z].push_back(fgObj);
-  }
+  for (size_t i = 0; i < visInds.size(); ++i)
+    keys[i] = CQChartsRadixSort::floatKey(float(-tzs_[size_t(visInds[i])]));
 
-  for (auto &po : fgZObjs) {
-    for (const auto &fgObj : po.second)
-      fgObj->postDraw(device);
-  }
+  Inds sortInds;
+
+  CQChartsRadixSort::sortInds(keys, sortInds);
+
+  inds.resize(sortInds.size());
+
+  for (size_t i = 0; i < sortInds.size(); ++i)
+    inds[i] = visInds[size_t(sortInds[i])];
 }
 
 //---
@@ -94,6 +94,18 @@ preVisit(const QAbstractItemModel *model, const VisitData &data)
 
   //---
 
+  // progressive sample (pseudo random 1 in stride rows)
+  int stride = plot_->progressiveStride();
+
+  if (stride > 1) {
+    auto h = uint32_t(vrow)*2654435761u;
+
+    if ((h >> 8) % uint32_t(stride) != 0)
+      return State::SKIP;
+  }
+
+  //---
+
   // filter by visible column value
   using ModelIndex = CQChartsModelIndex;
 
@@ -0,0 +1,173 @@
+#include <CQChartsPlotStage.h>
+
+namespace {
+
+using Stage  = CQChartsPlotStage::Stage;
+using Stages = CQChartsPlotStage::Stages;
+
+// direct downstream stages of each stage
+Stages directDependents(Stage stage) {
+  switch (stage) {
+    case Stage::MODEL:
+      return Stages(Stage::RANGE);
+    case Stage::RANGE:
+      // axes are drawn in background/foreground layers
+      return Stages(Stage::OBJS) | Stages(Stage::DRAW_BACKGROUND) | Stages(Stage::DRAW_FOREGROUND);
+    case Stage::OBJS:
+      return Stages(Stage::TREE) | Stages(Stage::DRAW_OBJS) | Stages(Stage::DRAW_KEY);
+    default:
+      return Stages(Stage::NONE);
+  }
+}
+
+}
+
+//---
+
+CQChartsPlotStage::Stages
+CQChartsPlotStage::
+dependents(Stages stages)
+{
+  // transitive closure of downstream stages
+  Stages stages1 = stages;
+
+  while (true) {
+    Stages stages2 = stages1;
+
+    for (int i = 0; i < NUM_STAGES; ++i) {
+      auto stage = Stage(1U<<i);
+
+      if (stages1 & Stages(stage))
+        stages2 |= directDependents(stage);
+    }
+
+    if (stages2 == stages1)
+      break;
+
+    stages1 = stages2;
+  }
+
+  return stages1;
+}
+
+QString
+CQChartsPlotStage::
+toString(Stages stages)
+{
+  QStringList strs;
+
+  for (int i = 0; i < NUM_STAGES; ++i) {
+    if (stages & (1U<<i))
+      strs << stageName(i);
+  }
+
+  if (strs.empty())
+    return "NONE";
+
+  return strs.join("|");
+}
+
+CQChartsPlotStage::Stages
+CQChartsPlotStage::
+fromString(const QString &str, bool &ok)
+{
+  ok = true;
+
+  Stages stages = 0;
+
+  for (const auto &name : str.split("|", QString::SkipEmptyParts)) {
+    auto name1 = name.trimmed().toUpper();
+
+    if (name1 == "NONE")
+      continue;
+
+    int i = stageNames().indexOf(name1);
+
+    if (i < 0) {
+      ok = false;
+      continue;
+    }
+
+    stages |= (1U<<i);
+  }
+
+  return stages;
+}
+
+QStringList
+CQChartsPlotStage::
+stageNames()
+{
+  static QStringList names;
+
+  if (names.empty()) {
+    for (int i = 0; i < NUM_STAGES; ++i)
+      names << stageName(i);
+  }
+
+  return names;
+}
+
+QString
+CQChartsPlotStage::
+stageName(int i)
+{
+  switch (Stage(1U<<i)) {
+    case Stage::MODEL          : return "MODEL";
+    case Stage::RANGE          : return "RANGE";
+    case Stage::OBJS           : return "OBJS";
+    case Stage::TREE           : return "TREE";
+    case Stage::DRAW_BACKGROUND: return "DRAW_BACKGROUND";
+    case Stage::DRAW_OBJS      : return "DRAW_OBJS";
+    case Stage::DRAW_FOREGROUND: return "DRAW_FOREGROUND";
+    case Stage::DRAW_KEY       : return "DRAW_KEY";
+    default                    : return "NONE";
+  }
+}
+
+//---
+
+void
+CQChartsPlotStageGraph::
+declare(const QString &name, Stages stages)
+{
+  if (stages)
+    propertyStages_[name] = stages;
+  else
+    propertyStages_.erase(name);
+}
+
+bool
+CQChartsPlotStageGraph::
+isDeclared(const QString &name) const
+{
+  return (propertyStages_.find(name) != propertyStages_.end());
+}
+
+CQChartsPlotStageGraph::Stages
+CQChartsPlotStageGraph::
+declaredStages(const QString &name) const
+{
+  auto p = propertyStages_.find(name);
+
+  return (p != propertyStages_.end() ? (*p).second : 0);
+}
+
+CQChartsPlotStageGraph::Stages
+CQChartsPlotStageGraph::
+stages(const QString &name) const
+{
+  return CQChartsPlotStage::dependents(declaredStages(name));
+}
+
+QStringList
+CQChartsPlotStageGraph::
+names() const
+{
+  QStringList names;
+
+  for (const auto &p : propertyStages_)
+    names << p.first;
+
+  return names;
+}
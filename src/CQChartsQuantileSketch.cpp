@@ -0,0 +1,342 @@
+#include <CQChartsQuantileSketch.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// min compactor capacity
+const int minCapacity = 8;
+
+// compactor capacity decay per level
+const double capacityDecay = 2.0/3.0;
+
+// calc compactor size from normalized rank error (approximation of KLL error bound)
+int errorToK(double error) {
+  error = std::min(std::max(error, 1E-4), 0.5);
+
+  int k = int(std::ceil(std::pow(2.446/error, 1.0/0.9433)));
+
+  return std::min(std::max(k, minCapacity), 65535);
+}
+
+}
+
+//---
+
+CQChartsQuantileSketch::
+CQChartsQuantileSketch(double error)
+{
+  setError(error);
+}
+
+void
+CQChartsQuantileSketch::
+setError(double e)
+{
+  error_ = e;
+  k_     = errorToK(e);
+
+  clear();
+}
+
+void
+CQChartsQuantileSketch::
+clear()
+{
+  levels_.clear();
+
+  levels_.resize(1);
+
+  n_    = 0;
+  min_  = 0.0;
+  max_  = 0.0;
+  mean_ = 0.0;
+  m2_   = 0.0;
+}
+
+void
+CQChartsQuantileSketch::
+add(double v)
+{
+  if (! std::isfinite(v))
+    return;
+
+  if (n_ == 0) {
+    min_ = v;
+    max_ = v;
+  }
+  else {
+    min_ = std::min(min_, v);
+    max_ = std::max(max_, v);
+  }
+
+  // update running mean and variance (Welford)
+  ++n_;
+
+  double d = v - mean_;
+
+  mean_ += d/double(n_);
+  m2_   += d*(v - mean_);
+
+  //---
+
+  levels_[0].push_back(v);
+
+  if (int(levels_[0].size()) >= capacity(0))
+    compress();
+}
+
+void
+CQChartsQuantileSketch::
+merge(const CQChartsQuantileSketch &sketch)
+{
+  if (sketch.n_ == 0)
+    return;
+
+  if (n_ == 0) {
+    min_ = sketch.min_;
+    max_ = sketch.max_;
+  }
+  else {
+    min_ = std::min(min_, sketch.min_);
+    max_ = std::max(max_, sketch.max_);
+  }
+
+  // combine running mean and variance (Chan)
+  auto n1 = double(n_);
+  auto n2 = double(sketch.n_);
+  auto n  = n1 + n2;
+
+  double d = sketch.mean_ - mean_;
+
+  mean_ += d*n2/n;
+  m2_   += sketch.m2_ + d*d*n1*n2/n;
+
+  n_ += sketch.n_;
+
+  //---
+
+  // append other levels (same weight) and recompact
+  if (levels_.size() < sketch.levels_.size())
+    levels_.resize(sketch.levels_.size());
+
+  for (size_t i = 0; i < sketch.levels_.size(); ++i) {
+    const auto &values = sketch.levels_[i];
+
+    levels_[i].insert(levels_[i].end(), values.begin(), values.end());
+  }
+
+  compress();
+}
+
+double
+CQChartsQuantileSketch::
+stddev() const
+{
+  return (n_ > 1 ? std::sqrt(m2_/double(n_)) : 0.0);
+}
+
+//---
+
+double
+CQChartsQuantileSketch::
+quantile(double q) const
+{
+  Reals values;
+
+  quantiles(Reals({q}), values);
+
+  return values[0];
+}
+
+void
+CQChartsQuantileSketch::
+quantiles(const Reals &qs, Reals &values) const
+{
+  values.clear();
+
+  if (n_ == 0) {
+    values.resize(qs.size(), 0.0);
+    return;
+  }
+
+  Items items;
+
+  sortedItems(items);
+
+  // cumulative weights
+  std::vector<uint64_t> cumWeights(items.size());
+
+  uint64_t w = 0;
+
+  for (size_t i = 0; i < items.size(); ++i) {
+    w += items[i].weight;
+
+    cumWeights[i] = w;
+  }
+
+  for (const auto &q : qs) {
+    if      (q <= 0.0) { values.push_back(min_); continue; }
+    else if (q >= 1.0) { values.push_back(max_); continue; }
+
+    // first item with cumulative weight >= target rank
+    auto target = uint64_t(std::ceil(q*double(w)));
+
+    auto p = std::lower_bound(cumWeights.begin(), cumWeights.end(), target);
+
+    auto i = size_t(p - cumWeights.begin());
+
+    values.push_back(i < items.size() ? items[i].value : max_);
+  }
+}
+
+void
+CQChartsQuantileSketch::
+sample(int n, Reals &values) const
+{
+  Reals qs;
+
+  if      (n == 1)
+    qs.push_back(0.5);
+  else if (n > 1) {
+    for (int i = 0; i < n; ++i)
+      qs.push_back(double(i)/double(n - 1));
+  }
+
+  quantiles(qs, values);
+}
+
+double
+CQChartsQuantileSketch::
+rank(double v) const
+{
+  if (n_ == 0)
+    return 0.0;
+
+  if (v <  min_) return 0.0;
+  if (v >= max_) return 1.0;
+
+  uint64_t w = 0, tw = 0;
+
+  for (size_t i = 0; i < levels_.size(); ++i) {
+    uint64_t weight = uint64_t(1) << i;
+
+    for (const auto &v1 : levels_[i]) {
+      if (v1 <= v)
+        w += weight;
+
+      tw += weight;
+    }
+  }
+
+  return (tw > 0 ? double(w)/double(tw) : 0.0);
+}
+
+int
+CQChartsQuantileSketch::
+numRetained() const
+{
+  size_t n = 0;
+
+  for (const auto &values : levels_)
+    n += values.size();
+
+  return int(n);
+}
+
+//---
+
+int
+CQChartsQuantileSketch::
+capacity(int level) const
+{
+  int depth = int(levels_.size()) - level - 1;
+
+  int c = int(std::ceil(double(k_)*std::pow(capacityDecay, depth)));
+
+  return std::max(c, minCapacity);
+}
+
+void
+CQChartsQuantileSketch::
+compress()
+{
+  // compact lowest full level until all levels are below capacity
+  // (capacities change as levels are added so restart from bottom)
+  bool compacted = true;
+
+  while (compacted) {
+    compacted = false;
+
+    for (int i = 0; i < int(levels_.size()); ++i) {
+      if (int(levels_[size_t(i)].size()) >= capacity(i)) {
+        compactLevel(i);
+
+        compacted = true;
+
+        break;
+      }
+    }
+  }
+}
+
+void
+CQChartsQuantileSketch::
+compactLevel(int level)
+{
+  if (level + 1 >= int(levels_.size()))
+    levels_.resize(size_t(level + 2));
+
+  auto &values = levels_[size_t(level)];
+  auto &next   = levels_[size_t(level + 1)];
+
+  std::sort(values.begin(), values.end());
+
+  // keep largest value at this level if odd number of values
+  size_t n = values.size();
+  size_t m = n & ~size_t(1);
+
+  // promote every other value (random offset) with twice weight
+  size_t offset = (randomBit() ? 1 : 0);
+
+  for (size_t i = offset; i < m; i += 2)
+    next.push_back(values[i]);
+
+  if (m < n)
+    values[0] = values[n - 1];
+
+  values.resize(n - m);
+}
+
+void
+CQChartsQuantileSketch::
+sortedItems(Items &items) const
+{
+  items.clear();
+
+  items.reserve(size_t(numRetained()));
+
+  for (size_t i = 0; i < levels_.size(); ++i) {
+    uint64_t weight = uint64_t(1) << i;
+
+    for (const auto &v : levels_[i])
+      items.push_back(Item{v, weight});
+  }
+
+  std::sort(items.begin(), items.end(), [](const Item &lhs, const Item &rhs) {
+    return lhs.value < rhs.value;
+  });
+}
+
+bool
+CQChartsQuantileSketch::
+randomBit()
+{
+  // xorshift64
+  seed_ ^= seed_ << 13;
+  seed_ ^= seed_ >> 7;
+  seed_ ^= seed_ << 17;
+
+  return (seed_ & 1);
+}
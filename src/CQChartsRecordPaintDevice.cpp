@@ -0,0 +1,347 @@
+#include <CQChartsRecordPaintDevice.h>
+#include <CQChartsDisplayList.h>
+#include <CQChartsPlot.h>
+#include <CQChartsView.h>
+#include <CQChartsUtil.h>
+
+CQChartsRecordPaintDevice::
+CQChartsRecordPaintDevice(View *view, DisplayList *displayList) :
+ CQChartsPaintDevice(view), displayList_(displayList)
+{
+  assert(displayList_);
+}
+
+CQChartsRecordPaintDevice::
+CQChartsRecordPaintDevice(Plot *plot, DisplayList *displayList) :
+ CQChartsPaintDevice(plot), displayList_(displayList)
+{
+  assert(displayList_);
+}
+
+//---
+
+void
+CQChartsRecordPaintDevice::
+beginObject(const BBox &bbox)
+{
+  displayList_->beginSegment(bbox);
+}
+
+void
+CQChartsRecordPaintDevice::
+endObject()
+{
+  displayList_->endSegment();
+}
+
+void
+CQChartsRecordPaintDevice::
+setRecordZoomFont(bool b)
+{
+  setZoomFont(b);
+
+  displayList_->addZoomFont(b);
+}
+
+//---
+
+void
+CQChartsRecordPaintDevice::
+save()
+{
+  states_.push_back(state_);
+
+  displayList_->addSave();
+}
+
+void
+CQChartsRecordPaintDevice::
+restore()
+{
+  assert(! states_.empty());
+
+  state_ = states_.back();
+
+  states_.pop_back();
+
+  displayList_->addRestore();
+}
+
+void
+CQChartsRecordPaintDevice::
+setClipPath(const QPainterPath &path, Qt::ClipOperation operation)
+{
+  state_.clipRect = BBox(path.boundingRect());
+
+  displayList_->addClipPath(path, operation);
+}
+
+void
+CQChartsRecordPaintDevice::
+setClipRect(const BBox &bbox, Qt::ClipOperation operation)
+{
+  if (! bbox.isValid()) return;
+
+  state_.clipRect = bbox;
+
+  displayList_->addClipRect(bbox, operation);
+}
+
+void
+CQChartsRecordPaintDevice::
+setPen(const QPen &pen)
+{
+  state_.pen = pen;
+
+  displayList_->addPen(pen);
+}
+
+void
+CQChartsRecordPaintDevice::
+setBrush(const QBrush &brush)
+{
+  state_.brush = brush;
+
+  displayList_->addBrush(brush);
+}
+
+void
+CQChartsRecordPaintDevice::
+setAltColor(const QColor &c)
+{
+  displayList_->addAltColor(c);
+}
+
+void
+CQChartsRecordPaintDevice::
+setAltAlpha(double alpha)
+{
+  displayList_->addReal(DisplayList::Op::SET_ALT_ALPHA, alpha);
+}
+
+void
+CQChartsRecordPaintDevice::
+setFillAngle(double a)
+{
+  displayList_->addReal(DisplayList::Op::SET_FILL_ANGLE, a);
+}
+
+void
+CQChartsRecordPaintDevice::
+setFillType(CQChartsFillPattern::Type t)
+{
+  displayList_->addInt(DisplayList::Op::SET_FILL_TYPE, int(t));
+}
+
+void
+CQChartsRecordPaintDevice::
+setFillRadius(double r)
+{
+  displayList_->addReal(DisplayList::Op::SET_FILL_RADIUS, r);
+}
+
+void
+CQChartsRecordPaintDevice::
+setFillDelta(double d)
+{
+  displayList_->addReal(DisplayList::Op::SET_FILL_DELTA, d);
+}
+
+void
+CQChartsRecordPaintDevice::
+setFillWidth(double w)
+{
+  displayList_->addReal(DisplayList::Op::SET_FILL_WIDTH, w);
+}
+
+//---
+
+void
+CQChartsRecordPaintDevice::
+fillPath(const QPainterPath &path, const QBrush &brush)
+{
+  displayList_->addFillPath(path, brush);
+}
+
+void
+CQChartsRecordPaintDevice::
+strokePath(const QPainterPath &path, const QPen &pen)
+{
+  displayList_->addStrokePath(path, pen);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawPath(const QPainterPath &path)
+{
+  displayList_->addPath(DisplayList::Op::DRAW_PATH, path);
+}
+
+void
+CQChartsRecordPaintDevice::
+fillRect(const BBox &bbox)
+{
+  displayList_->addRect(DisplayList::Op::FILL_RECT, bbox);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawRect(const BBox &bbox)
+{
+  displayList_->addRect(DisplayList::Op::DRAW_RECT, bbox);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawEllipse(const BBox &bbox, const Angle &a)
+{
+  displayList_->addEllipse(bbox, a);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawPolygon(const Polygon &poly)
+{
+  displayList_->addPolygon(DisplayList::Op::DRAW_POLYGON, poly);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawPolyline(const Polygon &poly)
+{
+  displayList_->addPolygon(DisplayList::Op::DRAW_POLYLINE, poly);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawLine(const Point &p1, const Point &p2)
+{
+  displayList_->addLine(p1, p2);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawPoint(const Point &p)
+{
+  displayList_->addPoint(p);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawText(const Point &p, const QString &text)
+{
+  displayList_->addText(DisplayList::Op::DRAW_TEXT, p, text);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawTransformedText(const Point &p, const QString &text)
+{
+  displayList_->addText(DisplayList::Op::DRAW_TRANSFORMED_TEXT, p, text);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawImage(const Point &p, const QImage &image)
+{
+  displayList_->addImage(p, image);
+}
+
+void
+CQChartsRecordPaintDevice::
+drawImageInRect(const BBox &bbox, const Image &image, bool stretch, const Angle &angle)
+{
+  displayList_->addImageInRect(bbox, image, stretch, angle);
+}
+
+//---
+
+void
+CQChartsRecordPaintDevice::
+setFont(const QFont &f, bool scale)
+{
+  // track font as it will be set on replay device
+  if (scale && isZoomFont() && plot_)
+    state_.font = CQChartsUtil::scaleFontSize(f, plot_->dataScale(), 1.0/72.0);
+  else
+    state_.font = f;
+
+  displayList_->addFont(f, scale);
+}
+
+void
+CQChartsRecordPaintDevice::
+setTransformRotate(const Point &p, double angle)
+{
+  auto p1 = windowToPixel(p);
+
+  // Note: reverse order (rotate at zero and move to pos)
+  state_.transform.translate(p1.x, p1.y);
+  state_.transform.rotate(-angle);
+
+  displayList_->addTransformRotate(p, angle);
+}
+
+void
+CQChartsRecordPaintDevice::
+setTransform(const QTransform &t, bool combine)
+{
+  if (combine)
+    state_.transform = t*state_.transform;
+  else
+    state_.transform = t;
+
+  displayList_->addTransform(t, combine);
+}
+
+void
+CQChartsRecordPaintDevice::
+setRenderHints(QPainter::RenderHints hints, bool on)
+{
+  displayList_->addRenderHints(hints, on);
+}
+
+void
+CQChartsRecordPaintDevice::
+setColorNames()
+{
+  displayList_->addDefaultColorNames();
+}
+
+void
+CQChartsRecordPaintDevice::
+setColorNames(const QString &strokeName, const QString &fillName)
+{
+  displayList_->addColorNames(strokeName, fillName);
+}
+
+void
+CQChartsRecordPaintDevice::
+resetColorNames()
+{
+  displayList_->addResetColorNames();
+}
+
+void
+CQChartsRecordPaintDevice::
+startGroup(const QString &id, const GroupData &groupData)
+{
+  displayList_->addStartGroup(id, groupData);
+}
+
+void
+CQChartsRecordPaintDevice::
+endGroup()
+{
+  displayList_->addEndGroup();
+}
+
+void
+CQChartsRecordPaintDevice::
+setPainterFont(const Font &font)
+{
+  if      (plot_)
+    plot_->setPainterFont(this, font);
+  else if (view_)
+    view_->setPainterFont(this, font);
+}
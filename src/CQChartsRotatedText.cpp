@@ -3,6 +3,7 @@
 #include <CQChartsPaintDevice.h>
 #include <CQChartsDrawUtil.h>
 #include <CQChartsUtil.h>
+#include <CQChartsTextCache.h>
 
 #include <cmath>
 
@@ -19,7 +20,7 @@ drawInBox(PaintDevice *device, const BBox &rect, const QString &text,
 
   //---
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double th = fm.height();
   double tw = fm.horizontalAdvance(text);
@@ -69,7 +70,7 @@ drawInBox(PaintDevice *device, const BBox &rect, const QString &text,
 
     //--
 
-    fm = QFontMetricsF(device->font());
+    fm = CQChartsFontMetrics(device->font());
 
     th = fm.height();
     tw = fm.horizontalAdvance(text);
@@ -117,7 +118,7 @@ void
 draw(PaintDevice *device, const Point &p, const QString &text,
      const CQChartsTextOptions &options, bool alignBBox, bool isRadial)
 {
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   double th = fm.height();
   double tw = fm.horizontalAdvance(text);
@@ -285,7 +286,7 @@ calcBBoxData(double px, double py, const QString &text, const QFont &font,
              const CQChartsTextOptions &options, const Margin &border, BBox &pbbox,
              Points &ppoints, bool alignBBox, bool isRadial)
 {
-  QFontMetricsF fm(font);
+  CQChartsFontMetrics fm(font);
 
   //------
 
@@ -17,6 +17,7 @@
 #include <CQChartsTextPlacer.h>
 #include <CQChartsHtml.h>
 #include <CQChartsRand.h>
+#include <CQChartsTextCache.h>
 
 #include <CQPropertyViewModel.h>
 #include <CQPropertyViewItem.h>
@@ -492,7 +493,7 @@ calcRange() const
   if (! isTextInternal()) {
     auto font = view()->plotFont(this, textFont());
 
-    QFontMetricsF fm(font);
+    CQChartsFontMetrics fm(font);
 
     if (isHorizontal())
       dx = pixelToWindowWidth (fm.height())*1.1;
@@ -4440,7 +4441,7 @@ drawFgImage(PaintDevice *device, const BBox &rect) const
 {
   double pTextMargin = 4; // pixels
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   auto iw = plot_->pixelToWindowWidth (fm.height())*1.1;
   auto ih = plot_->pixelToWindowHeight(fm.height())*1.1;
@@ -4517,7 +4518,7 @@ drawFgText(PaintDevice *device, const BBox &rect) const
 
   auto prect = plot()->windowToPixel(rect);
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   //---
 
@@ -4628,7 +4629,7 @@ drawValueLabel(PaintDevice *device, const BBox &rect) const
   double value = node()->edgeSum();
   if (value <= 1) return; // TODO: check value column type
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   auto str = QString::number(value);
 
@@ -5086,7 +5087,7 @@ drawFg(PaintDevice *device) const
   // set font
   plot()->setPainterFont(device, plot()->textFont());
 
-  QFontMetricsF fm(device->font());
+  CQChartsFontMetrics fm(device->font());
 
   //---
 
@@ -67,6 +67,7 @@ addParameters()
     addNameValue("SYMBOLS"   , static_cast<int>(CQChartsScatterPlot::PlotType::SYMBOLS   )).
     addNameValue("GRID_CELLS", static_cast<int>(CQChartsScatterPlot::PlotType::GRID_CELLS)).
     addNameValue("HEX_CELLS" , static_cast<int>(CQChartsScatterPlot::PlotType::HEX_CELLS )).
+    addNameValue("AGGREGATE" , static_cast<int>(CQChartsScatterPlot::PlotType::AGGREGATE )).
     setTip("Plot type");
 
   addBoolParameter("pointLabels", "Point Labels", "pointLabels").
@@ -230,6 +231,23 @@ void
 CQChartsScatterPlot::
 term()
 {
+  // interrupt and wait for aggregate thread
+  if (aggregateData_.thread) {
+    {
+    std::unique_lock<std::mutex> lock(aggregateData_.mutex);
+
+    aggregateData_.points.reset();
+
+    ++aggregateData_.generation;
+    }
+
+    aggregateData_.thread->term();
+
+    delete aggregateData_.thread;
+
+    aggregateData_.thread = nullptr;
+  }
+
   clearDensityData();
 
   for (const auto &groupWhisker_ : groupXWhiskers_)
@@ -455,6 +473,49 @@ setHexCells(bool b)
   }
 }
 
+void
+CQChartsScatterPlot::
+setAggregate(bool b)
+{
+  if (isOverlay()) {
+    processOverlayPlots([&](CQChartsPlot *plot) {
+      auto *splot = qobject_cast<CQChartsScatterPlot *>(plot);
+
+      if (splot)
+        splot->plotType_ = (b ? PlotType::AGGREGATE : PlotType::SYMBOLS);
+    });
+
+    updateRangeAndObjs();
+  }
+  else {
+    CQChartsUtil::testAndSet(plotType_,
+     (b ? PlotType::AGGREGATE : PlotType::NONE), [&]() { updateRangeAndObjs(); } );
+  }
+}
+
+//---
+
+void
+CQChartsScatterPlot::
+setAggregateValue(const AggregateValue &v)
+{
+  CQChartsUtil::testAndSet(aggregateData_.value, v, [&]() { calcAggregate(); } );
+}
+
+void
+CQChartsScatterPlot::
+setAggregateShade(const AggregateShade &s)
+{
+  CQChartsUtil::testAndSet(aggregateData_.shade, s, [&]() { calcAggregate(); } );
+}
+
+void
+CQChartsScatterPlot::
+setAggregateSampleSize(int n)
+{
+  CQChartsUtil::testAndSet(aggregateData_.sampleSize, n, [&]() { calcAggregate(); } );
+}
+
 //------
 
 void
@@ -620,6 +681,15 @@ addProperties()
 
   //---
 
+  // aggregate
+  addProp("aggregate", "aggregateValue"     , "value"     ,
+          "Aggregate pixel value (value from color column for sum and mean)");
+  addProp("aggregate", "aggregateShade"     , "shade"     , "Aggregate pixel value shading");
+  addProp("aggregate", "aggregateSampleSize", "sampleSize",
+          "Aggregate preview sample size (<= 0 for no preview)");
+
+  //---
+
   auto axisAnnotationsPath = QString("axisAnnotations");
 
   // rug axis
@@ -709,6 +779,10 @@ updateProperties()
   enableProp(this, "gridCells.stroke.alpha"  , hasGrid);
   enableProp(this, "gridCells.stroke.width"  , hasGrid);
 
+  enableProp(this, "aggregate.value"     , isAggregate());
+  enableProp(this, "aggregate.shade"     , isAggregate());
+  enableProp(this, "aggregate.sampleSize", isAggregate());
+
   CQChartsPointPlot::updateProperties();
 }
 
@@ -750,6 +824,26 @@ interpColor(const Color &c, const ColorInd &ind) const
   }
 }
 
+bool
+CQChartsScatterPlot::
+interpColorValues(const Color &c, const std::vector<double> &values,
+                  std::vector<QRgb> &rgbs) const
+{
+  if (c.type() != Color::Type::PALETTE)
+    return CQChartsPlot::interpColorValues(c, values, rgbs);
+
+  // overlay uses plot index (not value)
+  if (isOverlay())
+    return false;
+
+  auto c1 = Color::makePalette();
+
+  c1.setScale (c.isScale ());
+  c1.setInvert(c.isInvert());
+
+  return view()->interpColorValues(c1, values, rgbs);
+}
+
 //---
 
 CQChartsGeom::Range
@@ -1308,6 +1402,8 @@ clearPlotObjects()
   groupNameGridData_.clear();
   groupNameHexData_ .clear();
 
+  aggregateData_.addPoints.clear();
+
   CQChartsPlot::clearPlotObjects();
 }
 
@@ -1332,9 +1428,20 @@ createObjs(PlotObjs &objs) const
   th->hexMap_.clear();
   th->hexMapMaxN_ = 0;
 
-  if (groupInds_.empty())
+  if (groupInds_.empty()) {
     addNameValues();
 
+    // publish added aggregate points for calc thread
+    if (isAggregate()) {
+      std::unique_lock<std::mutex> lock(aggregateData_.mutex);
+
+      th->aggregateData_.points =
+        std::make_shared<AggregateData::Points>(std::move(th->aggregateData_.addPoints));
+
+      th->aggregateData_.addPoints.clear();
+    }
+  }
+
   th->groupPoints_  .clear();
   th->groupStatData_.clear();
 
@@ -1371,6 +1478,8 @@ createObjs(PlotObjs &objs) const
     addGridObjects(objs);
   else if (isHexCells())
     addHexObjects(objs);
+  else if (isAggregate())
+    addAggregateObjects(objs);
 
   //---
 
@@ -1911,6 +2020,18 @@ addHexObjects(PlotObjs &objs) const
   }
 }
 
+void
+CQChartsScatterPlot::
+addAggregateObjects(PlotObjs &objs) const
+{
+  // single object for image of all points (calculated in thread for current view)
+  auto *aggregateObj = createAggregateObj(getCalcDataRange().bbox());
+
+  objs.push_back(aggregateObj);
+
+  calcAggregate();
+}
+
 //---
 
 void
@@ -2513,7 +2634,10 @@ addNameValues() const
 
       Point p(x, y);
 
-      plot->addNameValue(groupInd, name, p, data.row, xInd1, color);
+      if (plot_->isAggregate())
+        plot->addAggregatePoint(groupInd, p, data.row, data.parent);
+      else
+        plot->addNameValue(groupInd, name, p, data.row, xInd1, color);
 
       return State::OK;
     }
@@ -2651,6 +2775,34 @@ addNameValue(int groupInd, const QString &name, const Point &p, int row,
   }
 }
 
+void
+CQChartsScatterPlot::
+addAggregatePoint(int groupInd, const Point &p, int row, const QModelIndex &parent)
+{
+  groupInds_.insert(groupInd);
+
+  if (numGroups() > 1 && isSetHidden(groupInd))
+    return;
+
+  auto gp = adjustGroupPoint(groupInd, p);
+
+  // add optional value (from color column) for sum/mean
+  if (colorColumn().isValid()) {
+    ModelIndex colorModelInd(this, row, colorColumn(), parent);
+
+    bool ok;
+
+    double value = modelReal(colorModelInd, ok);
+
+    if (! ok || CMathUtil::isNaN(value))
+      value = 0.0;
+
+    aggregateData_.addPoints.add(gp, value);
+  }
+  else
+    aggregateData_.addPoints.add(gp);
+}
+
 //---
 
 CQChartsScatterPointObj *
@@ -2684,6 +2836,75 @@ createDensityObj(int groupInd, const QString &name, const BBox &rect) const
   return new CQChartsScatterDensityObj(this, groupInd, name, rect);
 }
 
+CQChartsScatterAggregateObj *
+CQChartsScatterPlot::
+createAggregateObj(const BBox &rect) const
+{
+  return new CQChartsScatterAggregateObj(this, rect);
+}
+
+//---
+
+void
+CQChartsScatterPlot::
+postResize()
+{
+  CQChartsPointPlot::postResize();
+
+  if (isAggregate())
+    calcAggregate();
+}
+
+void
+CQChartsScatterPlot::
+applyDataRangeAndDraw()
+{
+  CQChartsPointPlot::applyDataRangeAndDraw();
+
+  //---
+
+  // recalc aggregate canvas for new view (zoom/pan)
+  if (isAggregate())
+    calcAggregate();
+}
+
+bool
+CQChartsScatterPlot::
+plotTipText(const Point &p, QString &tip, bool single) const
+{
+  if (! isAggregate())
+    return CQChartsPointPlot::plotTipText(p, tip, single);
+
+  // map point to canvas pixel
+  std::unique_lock<std::mutex> lock(aggregateData_.mutex);
+
+  const auto &canvas = aggregateData_.canvas;
+
+  int i, j;
+
+  if (! canvas.pixelAt(p, i, j) || canvas.count(i, j) <= 0.0)
+    return false;
+
+  CQChartsTableTip tableTip;
+
+  tableTip.addBoldLine("Aggregate Pixel");
+  tableTip.addTableRow("Count", canvas.count(i, j));
+
+  if (aggregateValue() != AggregateValue::COUNT && ! canvas.sums.empty()) {
+    auto valueType = static_cast<CQChartsPixelAggregate::ValueType>(aggregateValue());
+
+    tableTip.addTableRow(aggregateValue() == AggregateValue::SUM ? "Sum" : "Mean",
+                         canvas.value(i, j, valueType));
+  }
+
+  if (canvas.stride > 1)
+    tableTip.addTableRow("Sample", QString("1/%1").arg(canvas.stride));
+
+  tip = tableTip.str();
+
+  return true;
+}
+
 //---
 
 void
@@ -2891,6 +3112,7 @@ addMenuItems(QMenu *menu)
   (void) addMenuCheckedAction(typeMenu, "Symbols"   , isSymbols  (), SLOT(setSymbols(bool)));
   (void) addMenuCheckedAction(typeMenu, "Grid Cells", isGridCells(), SLOT(setGridCells(bool)));
   (void) addMenuCheckedAction(typeMenu, "Hex Cells" , isHexCells (), SLOT(setHexCells(bool)));
+  (void) addMenuCheckedAction(typeMenu, "Aggregate" , isAggregate(), SLOT(setAggregate(bool)));
 
   menu->addMenu(typeMenu);
 
@@ -3949,6 +4171,178 @@ calcDensityMapImpl(int groupInd)
 
 //------
 
+void
+CQChartsScatterPlot::
+calcAggregate() const
+{
+  auto *th = const_cast<CQChartsScatterPlot *>(this);
+
+  auto &aggregateData = th->aggregateData_;
+
+  std::unique_lock<std::mutex> lock(aggregateData.mutex);
+
+  if (! aggregateData.points)
+    return;
+
+  // set new request (interrupts current calc)
+  aggregateData.rect  = calcPlotViewRect();
+  aggregateData.psize = calcPixelSize();
+
+  ++aggregateData.generation;
+
+  // start thread if not running (running thread restarts for new generation)
+  if (! aggregateData.thread)
+    aggregateData.thread = new CQThreadObject;
+
+  if (! aggregateData.thread->isBusy())
+    aggregateData.thread->exec(calcAggregateThread, th);
+}
+
+void
+CQChartsScatterPlot::
+calcAggregateThread(CQChartsScatterPlot *plot)
+{
+  plot->calcAggregateImpl();
+}
+
+void
+CQChartsScatterPlot::
+calcAggregateImpl()
+{
+  CQPerfTrace trace("CQChartsScatterPlot::calcAggregateImpl");
+
+  using Aggregate = CQChartsPixelAggregate;
+
+  auto &aggregateData = aggregateData_;
+
+  while (true) {
+    // get current request
+    AggregateData::PointsP points;
+    BBox                   rect;
+    Size                   psize;
+    int                    generation;
+    int                    sampleSize;
+    Aggregate::ValueType   valueType;
+    Aggregate::ShadeType   shadeType;
+
+    {
+    std::unique_lock<std::mutex> lock(aggregateData.mutex);
+
+    // no points (terminated)
+    if (! aggregateData.points) {
+      aggregateData.thread->end();
+      return;
+    }
+
+    points     = aggregateData.points;
+    rect       = aggregateData.rect;
+    psize      = aggregateData.psize;
+    generation = aggregateData.generation;
+    sampleSize = aggregateData.sampleSize;
+    valueType  = static_cast<Aggregate::ValueType>(aggregateData.value);
+    shadeType  = static_cast<Aggregate::ShadeType>(aggregateData.shade);
+    }
+
+    auto interrupt = [&]() { return (aggregateData.generation != generation); };
+
+    //---
+
+    int w  = CMathRound::RoundNearest(psize.width ());
+    int h  = CMathRound::RoundNearest(psize.height());
+    int np = points->size();
+
+    // preview pass with every n'th point (if more points than sample size) then full pass
+    std::vector<int> strides;
+
+    if (sampleSize > 0 && np > sampleSize)
+      strides.push_back((np + sampleSize - 1)/sampleSize);
+
+    strides.push_back(1);
+
+    for (const auto &stride : strides) {
+      Aggregate::Canvas canvas;
+      Aggregate::Values tvalues;
+
+      if (! Aggregate::calc(*points, rect, w, h, stride, canvas, interrupt))
+        break;
+
+      Aggregate::shade(canvas, valueType, shadeType, tvalues);
+
+      {
+      std::unique_lock<std::mutex> lock(aggregateData.mutex);
+
+      if (aggregateData.generation != generation)
+        break;
+
+      aggregateData.canvas  = std::move(canvas);
+      aggregateData.tvalues = std::move(tvalues);
+
+      ++aggregateData.resultId;
+      }
+
+      // trigger redraw to show calculated results
+      updateSlot();
+    }
+
+    //---
+
+    // finish if no new request (end under lock so new request restarts thread)
+    std::unique_lock<std::mutex> lock(aggregateData.mutex);
+
+    if (aggregateData.generation == generation) {
+      aggregateData.thread->end();
+      break;
+    }
+  }
+}
+
+QImage
+CQChartsScatterPlot::
+aggregateImage(const CQChartsPixelAggregate::Colors &colors, BBox &rect, bool &sampled) const
+{
+  std::unique_lock<std::mutex> lock(aggregateData_.mutex);
+
+  const auto &canvas = aggregateData_.canvas;
+
+  rect    = canvas.rect;
+  sampled = (canvas.stride > 1);
+
+  // update cached image if new result or colors changed
+  if (aggregateData_.imageId != aggregateData_.resultId || aggregateData_.imageColors != colors) {
+    aggregateData_.image       = CQChartsPixelAggregate::image(canvas, aggregateData_.tvalues, colors);
+    aggregateData_.imageColors = colors;
+    aggregateData_.imageId     = aggregateData_.resultId;
+  }
+
+  return aggregateData_.image;
+}
+
+QString
+CQChartsScatterPlot::
+aggregateTipText() const
+{
+  std::unique_lock<std::mutex> lock(aggregateData_.mutex);
+
+  const auto &canvas = aggregateData_.canvas;
+
+  CQChartsTableTip tableTip;
+
+  tableTip.addBoldLine("Aggregate");
+
+  if (aggregateData_.points)
+    tableTip.addTableRow("Points", aggregateData_.points->size());
+
+  tableTip.addTableRow("Pixels", QString("%1x%2").arg(canvas.width).arg(canvas.height));
+  tableTip.addTableRow("In View", canvas.numPoints*canvas.stride);
+
+  if (canvas.stride > 1)
+    tableTip.addTableRow("Sample", QString("1/%1").arg(canvas.stride));
+
+  return tableTip.str();
+}
+
+//------
+
 void
 CQChartsScatterPlot::
 initWhiskerData() const
@@ -5150,6 +5544,88 @@ calcPenBrush(PenBrush &, bool) const
 
 //------
 
+CQChartsScatterAggregateObj::
+CQChartsScatterAggregateObj(const Plot *plot, const BBox &rect) :
+ CQChartsPlotObj(const_cast<Plot *>(plot), rect, ColorInd(), ColorInd(), ColorInd()), plot_(plot)
+{
+  setDetailHint(DetailHint::MAJOR);
+}
+
+QString
+CQChartsScatterAggregateObj::
+calcId() const
+{
+  return typeName();
+}
+
+QString
+CQChartsScatterAggregateObj::
+calcTipId() const
+{
+  return plot_->aggregateTipText();
+}
+
+void
+CQChartsScatterAggregateObj::
+draw(PaintDevice *device) const
+{
+  // color table from palette (batched palette lookup)
+  int nc = 256;
+
+  std::vector<double> values;
+
+  values.resize(size_t(nc));
+
+  for (int i = 0; i < nc; ++i)
+    values[size_t(i)] = double(i)/(nc - 1);
+
+  CQChartsPixelAggregate::Colors colors;
+
+  if (! plot_->interpColorValues(Color::makePalette(), values, colors)) {
+    colors.resize(size_t(nc));
+
+    for (int i = 0; i < nc; ++i)
+      colors[size_t(i)] = plot_->interpPaletteColor(ColorInd(values[size_t(i)])).rgba();
+  }
+
+  //---
+
+  BBox rect;
+  bool sampled;
+
+  auto image = plot_->aggregateImage(colors, rect, sampled);
+
+  if (image.isNull() || ! rect.isValid())
+    return;
+
+  //---
+
+  // draw image at canvas rect (scale last result to current view until recalculated)
+  auto prect = plot_->windowToPixel(rect);
+
+  int w = CMathRound::RoundNearest(prect.getWidth ());
+  int h = CMathRound::RoundNearest(prect.getHeight());
+
+  if (w <= 0 || h <= 0)
+    return;
+
+  if (w != image.width() || h != image.height()) {
+    // skip if too magnified or too large
+    if (w > 4*image.width() || h > 4*image.height())
+      return;
+
+    image = image.scaled(w, h, Qt::IgnoreAspectRatio, Qt::FastTransformation);
+  }
+
+  PaintDevice::SaveRestore saveRestore(device);
+
+  plot_->setClipRect(device);
+
+  device->drawImage(plot_->pixelToWindow(Point(prect.getXMin(), prect.getYMin())), image);
+}
+
+//------
+
 CQChartsScatterColorKeyItem::
 CQChartsScatterColorKeyItem(Plot *plot, int groupInd, const ColorInd &is, const ColorInd &ig) :
  CQChartsColorBoxKeyItem(plot, is, ig, ColorInd()), plot_(plot), groupInd_(groupInd)
@@ -2114,6 +2114,19 @@ calcPenBrush(CQChartsPenBrush &penBrush, bool updateState) const
     plot_->updateObjPenBrushState(this, penBrush, CQChartsPlot::DrawType::SYMBOL);
 }
 
+bool
+CQChartsScatterPoint3DObj::
+isDrawInside(const Point3D &pt, const BBox &bbox) const
+{
+  // symbol box overlaps box
+  auto symbolSize = this->symbolSize();
+
+  double sx = plot_->lengthPlotWidth (symbolSize);
+  double sy = plot_->lengthPlotHeight(symbolSize);
+
+  return bbox.overlaps(BBox(pt.x - sx, pt.y - sy, pt.x + sx, pt.y + sy));
+}
+
 void
 CQChartsScatterPoint3DObj::
 postDraw(PaintDevice *device)
@@ -2140,9 +2153,8 @@ postDraw(PaintDevice *device)
 
   //---
 
-  auto *camera = plot3D()->camera();
-
-  auto pt = camera->transform(point());
+  // projected point (reference point is point)
+  const auto &pt = drawRefPoint();
 
   auto pt2 = pt.point2D();
 
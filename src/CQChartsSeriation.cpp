@@ -0,0 +1,915 @@
+#include <CQChartsSeriation.h>
+#include <CQChartsParallel.h>
+
+#include <CQPerfMonitor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+using Matrix      = CQChartsSeriation::Matrix;
+using Permutation = CQChartsSeriation::Permutation;
+
+// connected components of graph (component per node, nodes of each component)
+void calcComponents(const Matrix &graph, std::vector<int> &nodeComp,
+                    std::vector<std::vector<int>> &compNodes) {
+  int n = graph.n;
+
+  nodeComp.assign(size_t(n), -1);
+  compNodes.clear();
+
+  std::vector<int> stack;
+
+  for (int i = 0; i < n; ++i) {
+    if (nodeComp[size_t(i)] >= 0) continue;
+
+    int comp = int(compNodes.size());
+
+    compNodes.emplace_back();
+
+    auto &nodes = compNodes.back();
+
+    nodeComp[size_t(i)] = comp;
+
+    stack.push_back(i);
+
+    while (! stack.empty()) {
+      int j = stack.back(); stack.pop_back();
+
+      nodes.push_back(j);
+
+      for (int k = graph.rowStart[size_t(j)]; k < graph.rowStart[size_t(j + 1)]; ++k) {
+        int c = graph.cols[size_t(k)];
+
+        if (nodeComp[size_t(c)] < 0) {
+          nodeComp[size_t(c)] = comp;
+
+          stack.push_back(c);
+        }
+      }
+    }
+  }
+}
+
+int degree(const Matrix &graph, int i) {
+  return graph.rowStart[size_t(i + 1)] - graph.rowStart[size_t(i)];
+}
+
+}
+
+//---
+
+CQChartsSeriation::Matrix
+CQChartsSeriation::Matrix::
+fromDense(int n, const Values &values)
+{
+  Matrix matrix;
+
+  matrix.n = n;
+
+  matrix.rowStart.resize(size_t(n + 1));
+
+  for (int r = 0; r < n; ++r) {
+    matrix.rowStart[size_t(r)] = matrix.numValues();
+
+    for (int c = 0; c < n; ++c) {
+      double v = values[size_t(r*n + c)];
+      if (v == 0.0) continue;
+
+      matrix.cols  .push_back(c);
+      matrix.values.push_back(v);
+    }
+  }
+
+  matrix.rowStart[size_t(n)] = matrix.numValues();
+
+  return matrix;
+}
+
+//---
+
+CQChartsSeriation::
+CQChartsSeriation()
+{
+}
+
+CQChartsSeriation::Permutation
+CQChartsSeriation::
+calc(const Type &type, const Matrix &matrix)
+{
+  if (type == Type::NONE || matrix.n <= 0) {
+    Permutation perm(size_t(std::max(matrix.n, 0)));
+
+    std::iota(perm.begin(), perm.end(), 0);
+
+    return perm;
+  }
+
+  //---
+
+  auto hash = matrixHash(matrix);
+
+  {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto pc = cache_.find(type);
+
+  if (pc != cache_.end() && (*pc).second.hash == hash && (*pc).second.n == matrix.n)
+    return (*pc).second.perm;
+  }
+
+  //---
+
+  Permutation perm;
+
+  if      (type == Type::SPECTRAL)
+    perm = calcSpectral(matrix, maxIterations());
+  else if (type == Type::RCM)
+    perm = calcRCM(matrix);
+  else if (type == Type::CLUSTER) {
+    if (matrix.n <= maxClusterRows())
+      perm = calcCluster(matrix);
+    else
+      perm = calcSpectral(matrix, maxIterations());
+  }
+
+  //---
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto &cacheData = cache_[type];
+
+  cacheData.hash = hash;
+  cacheData.n    = matrix.n;
+  cacheData.perm = perm;
+
+  return perm;
+}
+
+bool
+CQChartsSeriation::
+isCached(const Type &type, const Matrix &matrix)
+{
+  if (type == Type::NONE || matrix.n <= 0)
+    return true;
+
+  auto hash = matrixHash(matrix);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  auto pc = cache_.find(type);
+
+  return (pc != cache_.end() && (*pc).second.hash == hash && (*pc).second.n == matrix.n);
+}
+
+void
+CQChartsSeriation::
+clearCache()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  cache_.clear();
+}
+
+//---
+
+CQChartsSeriation::Permutation
+CQChartsSeriation::
+calcSpectral(const Matrix &matrix, int maxIterations)
+{
+  CQPerfTrace trace("CQChartsSeriation::calcSpectral");
+
+  auto graph = symmetricGraph(matrix);
+
+  int n = graph.n;
+
+  //---
+
+  std::vector<int>              nodeComp;
+  std::vector<std::vector<int>> compNodes;
+
+  calcComponents(graph, nodeComp, compNodes);
+
+  int nc = int(compNodes.size());
+
+  //---
+
+  // weighted degrees
+  std::vector<double> degrees(size_t(n), 0.0);
+
+  for (int i = 0; i < n; ++i) {
+    for (int k = graph.rowStart[size_t(i)]; k < graph.rowStart[size_t(i + 1)]; ++k)
+      degrees[size_t(i)] += graph.values[size_t(k)];
+  }
+
+  // Laplacian product (L = D - W)
+  auto laplacianProduct = [&](const std::vector<double> &v, std::vector<double> &lv) {
+    CQChartsParallel::forChunks(n, [&](int i1, int i2) {
+      for (int i = i1; i < i2; ++i) {
+        double wv = 0.0;
+
+        for (int k = graph.rowStart[size_t(i)]; k < graph.rowStart[size_t(i + 1)]; ++k)
+          wv += graph.values[size_t(k)]*v[size_t(graph.cols[size_t(k)])];
+
+        lv[size_t(i)] = degrees[size_t(i)]*v[size_t(i)] - wv;
+      }
+    }, 1024);
+  };
+
+  auto compDot = [&](int ic, const std::vector<double> &v1, const std::vector<double> &v2) {
+    double d = 0.0;
+
+    for (const auto &i : compNodes[size_t(ic)])
+      d += v1[size_t(i)]*v2[size_t(i)];
+
+    return d;
+  };
+
+  auto dot = [&](const std::vector<double> &v1, const std::vector<double> &v2) {
+    double d = 0.0;
+
+    for (int i = 0; i < n; ++i)
+      d += v1[size_t(i)]*v2[size_t(i)];
+
+    return d;
+  };
+
+  // remove per component constant vector (null space of L)
+  auto deflate = [&](std::vector<double> &v) {
+    for (int ic = 0; ic < nc; ++ic) {
+      const auto &nodes = compNodes[size_t(ic)];
+
+      double sum = 0.0;
+
+      for (const auto &i : nodes)
+        sum += v[size_t(i)];
+
+      double mean = sum/double(nodes.size());
+
+      for (const auto &i : nodes)
+        v[size_t(i)] -= mean;
+    }
+  };
+
+  // deflate and normalize each component (L is block diagonal so each component's
+  // vector converges independently)
+  auto deflateNormalize = [&](std::vector<double> &v) {
+    deflate(v);
+
+    for (int ic = 0; ic < nc; ++ic) {
+      double len = std::sqrt(compDot(ic, v, v));
+      if (len <= 0.0) continue;
+
+      for (const auto &i : compNodes[size_t(ic)])
+        v[size_t(i)] /= len;
+    }
+  };
+
+  //---
+
+  // start vector is breadth first distance from pseudo-peripheral node of each
+  // component (close to Fiedler vector for path like graphs)
+  std::vector<double> x(static_cast<size_t>(n), 0.0);
+
+  std::vector<int> level(size_t(n), -1), queue;
+
+  auto bfsLevels = [&](int start) {
+    queue.clear();
+
+    queue.push_back(start);
+
+    level[size_t(start)] = 0;
+
+    for (size_t qi = 0; qi < queue.size(); ++qi) {
+      int j = queue[qi];
+
+      for (int k = graph.rowStart[size_t(j)]; k < graph.rowStart[size_t(j + 1)]; ++k) {
+        int c = graph.cols[size_t(k)];
+
+        if (level[size_t(c)] < 0) {
+          level[size_t(c)] = level[size_t(j)] + 1;
+
+          queue.push_back(c);
+        }
+      }
+    }
+
+    int last = queue.back();
+
+    for (const auto &j : queue) {
+      x[size_t(j)] = level[size_t(j)];
+
+      level[size_t(j)] = -1;
+    }
+
+    return last;
+  };
+
+  for (int ic = 0; ic < nc; ++ic)
+    bfsLevels(bfsLevels(compNodes[size_t(ic)][0]));
+
+  deflateNormalize(x);
+
+  //---
+
+  // inverse iteration (x = L^-1 x) in space orthogonal to component constant vectors
+  // converges to Fiedler vector of each component with ratio lambda2/lambda3. Each
+  // solve uses conjugate gradient and maxIterations limits total Laplacian products
+  std::vector<double> y(static_cast<size_t>(n)), r(static_cast<size_t>(n)),
+                      p(static_cast<size_t>(n)), lp(static_cast<size_t>(n));
+
+  int numProducts = 0;
+
+  // solve L y = b (b orthogonal to null space) to relative tolerance
+  auto solve = [&](const std::vector<double> &b, double tol) {
+    std::fill(y.begin(), y.end(), 0.0);
+
+    r = b;
+    p = r;
+
+    double rr = dot(r, r);
+
+    double rr0 = rr;
+
+    while (rr > tol*tol*rr0 && numProducts < maxIterations) {
+      laplacianProduct(p, lp); ++numProducts;
+
+      double plp = dot(p, lp);
+      if (plp <= 0.0) break;
+
+      double alpha = rr/plp;
+
+      for (int i = 0; i < n; ++i) {
+        y[size_t(i)] += alpha*p [size_t(i)];
+        r[size_t(i)] -= alpha*lp[size_t(i)];
+      }
+
+      deflate(r);
+
+      double rr1 = dot(r, r);
+
+      double beta = rr1/rr;
+
+      for (int i = 0; i < n; ++i)
+        p[size_t(i)] = r[size_t(i)] + beta*p[size_t(i)];
+
+      rr = rr1;
+    }
+  };
+
+  // converged when each component's eigen residual |L x - lambda x| is small relative
+  // to its eigen value (lambda is Rayleigh quotient)
+  std::vector<double> lx(static_cast<size_t>(n));
+
+  auto isConverged = [&]() {
+    laplacianProduct(x, lx); ++numProducts;
+
+    for (int ic = 0; ic < nc; ++ic) {
+      const auto &nodes = compNodes[size_t(ic)];
+      if (nodes.size() < 3) continue;
+
+      double lambda = compDot(ic, x, lx);
+
+      double res = 0.0;
+
+      for (const auto &i : nodes) {
+        double d = lx[size_t(i)] - lambda*x[size_t(i)];
+
+        res += d*d;
+      }
+
+      if (std::sqrt(res) > 1E-4*lambda)
+        return false;
+    }
+
+    return true;
+  };
+
+  while (numProducts < maxIterations && ! isConverged()) {
+    solve(x, 1E-6);
+
+    deflateNormalize(y);
+
+    std::swap(x, y);
+  }
+
+  //---
+
+  // order components by size (largest first) then nodes by Fiedler value
+  std::vector<int> compOrder(static_cast<size_t>(nc));
+
+  std::iota(compOrder.begin(), compOrder.end(), 0);
+
+  std::stable_sort(compOrder.begin(), compOrder.end(), [&](int lhs, int rhs) {
+    return compNodes[size_t(lhs)].size() > compNodes[size_t(rhs)].size();
+  });
+
+  Permutation perm;
+
+  perm.reserve(size_t(n));
+
+  for (const auto &ic : compOrder) {
+    auto nodes = compNodes[size_t(ic)];
+
+    std::sort(nodes.begin(), nodes.end(), [&](int lhs, int rhs) {
+      if (x[size_t(lhs)] != x[size_t(rhs)])
+        return x[size_t(lhs)] < x[size_t(rhs)];
+
+      return lhs < rhs;
+    });
+
+    for (const auto &i : nodes)
+      perm.push_back(i);
+  }
+
+  return perm;
+}
+
+CQChartsSeriation::Permutation
+CQChartsSeriation::
+calcRCM(const Matrix &matrix)
+{
+  CQPerfTrace trace("CQChartsSeriation::calcRCM");
+
+  auto graph = symmetricGraph(matrix);
+
+  int n = graph.n;
+
+  //---
+
+  // nodes in increasing degree order (for start node of each component)
+  std::vector<int> degreeOrder(static_cast<size_t>(n));
+
+  std::iota(degreeOrder.begin(), degreeOrder.end(), 0);
+
+  std::stable_sort(degreeOrder.begin(), degreeOrder.end(), [&](int lhs, int rhs) {
+    return degree(graph, lhs) < degree(graph, rhs);
+  });
+
+  //---
+
+  std::vector<int> level(size_t(n), -1);
+
+  // breadth first levels from node (returns last level nodes)
+  auto bfsLevels = [&](int start, std::vector<int> &nodes) {
+    nodes.clear();
+
+    nodes.push_back(start);
+
+    level[size_t(start)] = 0;
+
+    size_t i = 0;
+
+    while (i < nodes.size()) {
+      int j = nodes[i++];
+
+      for (int k = graph.rowStart[size_t(j)]; k < graph.rowStart[size_t(j + 1)]; ++k) {
+        int c = graph.cols[size_t(k)];
+
+        if (level[size_t(c)] < 0) {
+          level[size_t(c)] = level[size_t(j)] + 1;
+
+          nodes.push_back(c);
+        }
+      }
+    }
+
+    int maxLevel = level[size_t(nodes.back())];
+
+    // reset levels for reuse
+    std::vector<int> lastNodes;
+
+    for (const auto &j : nodes) {
+      if (level[size_t(j)] == maxLevel)
+        lastNodes.push_back(j);
+    }
+
+    for (const auto &j : nodes)
+      level[size_t(j)] = -1;
+
+    return std::make_pair(maxLevel, lastNodes);
+  };
+
+  //---
+
+  std::vector<bool> visited(size_t(n), false);
+
+  Permutation perm;
+
+  perm.reserve(size_t(n));
+
+  std::vector<int> nodes, neighbors;
+
+  size_t di = 0;
+
+  while (int(perm.size()) < n) {
+    while (visited[size_t(degreeOrder[di])])
+      ++di;
+
+    // find pseudo-peripheral start node (repeat bfs from min degree node of last level)
+    int start = degreeOrder[di];
+
+    auto levelData = bfsLevels(start, nodes);
+
+    for (int tries = 0; tries < 4; ++tries) {
+      const auto &lastNodes = levelData.second;
+
+      int start1 = *std::min_element(lastNodes.begin(), lastNodes.end(), [&](int lhs, int rhs) {
+        return degree(graph, lhs) < degree(graph, rhs);
+      });
+
+      auto levelData1 = bfsLevels(start1, nodes);
+
+      if (levelData1.first <= levelData.first)
+        break;
+
+      start     = start1;
+      levelData = levelData1;
+    }
+
+    //---
+
+    // cuthill-mckee breadth first order (neighbors in increasing degree order)
+    size_t qi = perm.size();
+
+    perm.push_back(start);
+
+    visited[size_t(start)] = true;
+
+    while (qi < perm.size()) {
+      int j = perm[qi++];
+
+      neighbors.clear();
+
+      for (int k = graph.rowStart[size_t(j)]; k < graph.rowStart[size_t(j + 1)]; ++k) {
+        int c = graph.cols[size_t(k)];
+
+        if (! visited[size_t(c)]) {
+          visited[size_t(c)] = true;
+
+          neighbors.push_back(c);
+        }
+      }
+
+      std::stable_sort(neighbors.begin(), neighbors.end(), [&](int lhs, int rhs) {
+        return degree(graph, lhs) < degree(graph, rhs);
+      });
+
+      for (const auto &c : neighbors)
+        perm.push_back(c);
+    }
+  }
+
+  std::reverse(perm.begin(), perm.end());
+
+  return perm;
+}
+
+CQChartsSeriation::Permutation
+CQChartsSeriation::
+calcCluster(const Matrix &matrix)
+{
+  CQPerfTrace trace("CQChartsSeriation::calcCluster");
+
+  auto graph = symmetricGraph(matrix);
+
+  int n = graph.n;
+
+  if (n <= 2) {
+    Permutation perm(static_cast<size_t>(n));
+
+    std::iota(perm.begin(), perm.end(), 0);
+
+    return perm;
+  }
+
+  //---
+
+  // row vectors are graph rows plus unit diagonal (node similar to its neighbors)
+  std::vector<double> norms(static_cast<size_t>(n));
+
+  for (int i = 0; i < n; ++i) {
+    double s = 1.0;
+
+    for (int k = graph.rowStart[size_t(i)]; k < graph.rowStart[size_t(i + 1)]; ++k)
+      s += graph.values[size_t(k)]*graph.values[size_t(k)];
+
+    norms[size_t(i)] = std::sqrt(s);
+  }
+
+  // cosine distance of row pair from sparse product B*B^T (parallel over rows)
+  auto nn = size_t(n);
+
+  std::vector<float> dist(nn*nn);
+
+  CQChartsParallel::forChunks(n, [&](int i1, int i2) {
+    std::vector<double> acc(nn, 0.0);
+
+    auto addRow = [&](int j, double w) {
+      acc[size_t(j)] += w;
+
+      for (int k = graph.rowStart[size_t(j)]; k < graph.rowStart[size_t(j + 1)]; ++k)
+        acc[size_t(graph.cols[size_t(k)])] += w*graph.values[size_t(k)];
+    };
+
+    for (int i = i1; i < i2; ++i) {
+      std::fill(acc.begin(), acc.end(), 0.0);
+
+      addRow(i, 1.0);
+
+      for (int k = graph.rowStart[size_t(i)]; k < graph.rowStart[size_t(i + 1)]; ++k)
+        addRow(graph.cols[size_t(k)], graph.values[size_t(k)]);
+
+      auto *drow = &dist[size_t(i)*nn];
+
+      for (int j = 0; j < n; ++j)
+        drow[j] = float(1.0 - acc[size_t(j)]/(norms[size_t(i)]*norms[size_t(j)]));
+
+      drow[i] = 0.0f;
+    }
+  }, 16);
+
+  //---
+
+  // average linkage clustering (nearest neighbor chain, Lance-Williams update)
+  struct Cluster {
+    int  size   { 1 };
+    int  left   { -1 }; //!< left child (-1 for leaf)
+    int  right  { -1 }; //!< right child
+    int  first  { -1 }; //!< first leaf
+    int  last   { -1 }; //!< last leaf
+    bool flip   { false }; //!< reverse leaf order
+  };
+
+  std::vector<Cluster> clusters(size_t(2*n - 1));
+
+  for (int i = 0; i < n; ++i) {
+    clusters[size_t(i)].first = i;
+    clusters[size_t(i)].last  = i;
+  }
+
+  // matrix row -> cluster and active flags
+  std::vector<int>  rowCluster(nn);
+  std::vector<bool> active(nn, true);
+
+  std::iota(rowCluster.begin(), rowCluster.end(), 0);
+
+  // original (cosine) distance of leaves for flip test
+  auto leafDist = [&](int i, int j) {
+    double s = (i == j ? 1.0 : 0.0);
+
+    auto pi = graph.rowStart[size_t(i)], pi2 = graph.rowStart[size_t(i + 1)];
+    auto pj = graph.rowStart[size_t(j)], pj2 = graph.rowStart[size_t(j + 1)];
+
+    // b(i).b(j) with unit diagonals
+    auto value = [&](int col, int p1, int p2) {
+      auto p = std::lower_bound(graph.cols.begin() + p1, graph.cols.begin() + p2, col);
+      if (p == graph.cols.begin() + p2 || *p != col) return 0.0;
+      return graph.values[size_t(p - graph.cols.begin())];
+    };
+
+    s += value(j, pi, pi2) + value(i, pj, pj2);
+
+    while (pi < pi2 && pj < pj2) {
+      int ci = graph.cols[size_t(pi)], cj = graph.cols[size_t(pj)];
+
+      if      (ci < cj) ++pi;
+      else if (cj < ci) ++pj;
+      else { s += graph.values[size_t(pi)]*graph.values[size_t(pj)]; ++pi; ++pj; }
+    }
+
+    return 1.0 - s/(norms[size_t(i)]*norms[size_t(j)]);
+  };
+
+  std::vector<int> chain;
+
+  int nextCluster = n;
+  int numActive   = n;
+
+  while (numActive > 1) {
+    if (chain.empty()) {
+      for (int i = 0; i < n; ++i) {
+        if (active[size_t(i)]) { chain.push_back(i); break; }
+      }
+    }
+
+    int a = chain.back();
+
+    // nearest active row (prefer previous chain element on ties)
+    int   b     = (chain.size() > 1 ? chain[chain.size() - 2] : -1);
+    float bDist = (b >= 0 ? dist[size_t(a)*nn + size_t(b)] : 0.0f);
+
+    const auto *arow = &dist[size_t(a)*nn];
+
+    for (int j = 0; j < n; ++j) {
+      if (j == a || ! active[size_t(j)]) continue;
+
+      if (b < 0 || arow[j] < bDist) {
+        b     = j;
+        bDist = arow[j];
+      }
+    }
+
+    if (chain.size() > 1 && b == chain[chain.size() - 2]) {
+      // reciprocal nearest neighbors: merge a and b (into row a)
+      chain.pop_back(); chain.pop_back();
+
+      int ca = rowCluster[size_t(a)];
+      int cb = rowCluster[size_t(b)];
+
+      auto &clusterA = clusters[size_t(ca)];
+      auto &clusterB = clusters[size_t(cb)];
+
+      int sa = clusterA.size;
+      int sb = clusterB.size;
+
+      // flip children so adjacent end leaves are closest
+      bool flipA = false, flipB = false;
+
+      double dmin = 0.0;
+
+      for (int f = 0; f < 4; ++f) {
+        bool fa = (f & 2), fb = (f & 1);
+
+        double d = leafDist(fa ? clusterA.first : clusterA.last,
+                            fb ? clusterB.last  : clusterB.first);
+
+        if (f == 0 || d < dmin) {
+          flipA = fa;
+          flipB = fb;
+          dmin  = d;
+        }
+      }
+
+      clusterA.flip = flipA;
+      clusterB.flip = flipB;
+
+      auto &cluster = clusters[size_t(nextCluster)];
+
+      cluster.size  = sa + sb;
+      cluster.left  = ca;
+      cluster.right = cb;
+      cluster.first = (flipA ? clusterA.last  : clusterA.first);
+      cluster.last  = (flipB ? clusterB.first : clusterB.last );
+
+      // update distances of merged row
+      auto *brow = &dist[size_t(b)*nn];
+      auto *mrow = &dist[size_t(a)*nn];
+
+      for (int j = 0; j < n; ++j) {
+        if (! active[size_t(j)] || j == a || j == b) continue;
+
+        float d = float((sa*double(mrow[j]) + sb*double(brow[j]))/(sa + sb));
+
+        mrow[j] = d;
+
+        dist[size_t(j)*nn + size_t(a)] = d;
+      }
+
+      active[size_t(b)] = false;
+
+      rowCluster[size_t(a)] = nextCluster++;
+
+      --numActive;
+    }
+    else
+      chain.push_back(b);
+  }
+
+  //---
+
+  // leaf order from root (apply flips)
+  Permutation perm;
+
+  perm.reserve(nn);
+
+  using ClusterFlip = std::pair<int, bool>;
+
+  std::vector<ClusterFlip> stack;
+
+  stack.push_back(ClusterFlip(nextCluster - 1, false));
+
+  while (! stack.empty()) {
+    auto cf = stack.back(); stack.pop_back();
+
+    const auto &cluster = clusters[size_t(cf.first)];
+
+    if (cluster.left < 0) {
+      perm.push_back(cf.first);
+      continue;
+    }
+
+    bool flip = cf.second;
+
+    bool leftFlip  = (clusters[size_t(cluster.left )].flip != flip);
+    bool rightFlip = (clusters[size_t(cluster.right)].flip != flip);
+
+    // push second visited first
+    if (! flip) {
+      stack.push_back(ClusterFlip(cluster.right, rightFlip));
+      stack.push_back(ClusterFlip(cluster.left , leftFlip ));
+    }
+    else {
+      stack.push_back(ClusterFlip(cluster.left , leftFlip ));
+      stack.push_back(ClusterFlip(cluster.right, rightFlip));
+    }
+  }
+
+  return perm;
+}
+
+//---
+
+CQChartsSeriation::Matrix
+CQChartsSeriation::
+symmetricGraph(const Matrix &matrix)
+{
+  int n = matrix.n;
+
+  using ColValue  = std::pair<int, double>;
+  using ColValues = std::vector<ColValue>;
+
+  std::vector<ColValues> rows(static_cast<size_t>(n));
+
+  for (int r = 0; r < n; ++r) {
+    for (int k = matrix.rowStart[size_t(r)]; k < matrix.rowStart[size_t(r + 1)]; ++k) {
+      int c = matrix.cols[size_t(k)];
+      if (c == r || c < 0 || c >= n) continue;
+
+      double w = std::abs(matrix.values[size_t(k)]);
+      if (w == 0.0) continue;
+
+      rows[size_t(r)].push_back(ColValue(c, w));
+      rows[size_t(c)].push_back(ColValue(r, w));
+    }
+  }
+
+  // sort and merge duplicate columns of each row
+  CQChartsParallel::forEach(n, [&](int r) {
+    auto &colValues = rows[size_t(r)];
+
+    std::sort(colValues.begin(), colValues.end());
+
+    size_t j = 0;
+
+    for (size_t i = 0; i < colValues.size(); ++i) {
+      if (j > 0 && colValues[j - 1].first == colValues[i].first)
+        colValues[j - 1].second += colValues[i].second;
+      else
+        colValues[j++] = colValues[i];
+    }
+
+    colValues.resize(j);
+  }, 256);
+
+  Matrix graph;
+
+  graph.n = n;
+
+  graph.rowStart.resize(size_t(n + 1));
+
+  for (int r = 0; r < n; ++r) {
+    graph.rowStart[size_t(r)] = graph.numValues();
+
+    for (const auto &colValue : rows[size_t(r)]) {
+      graph.cols  .push_back(colValue.first );
+      graph.values.push_back(colValue.second);
+    }
+  }
+
+  graph.rowStart[size_t(n)] = graph.numValues();
+
+  return graph;
+}
+
+size_t
+CQChartsSeriation::
+matrixHash(const Matrix &matrix)
+{
+  // FNV-1a of matrix structure and values
+  size_t h = 14695981039346656037ULL;
+
+  auto addHash = [&](const void *data, size_t len) {
+    auto *p = static_cast<const unsigned char *>(data);
+
+    for (size_t i = 0; i < len; ++i) {
+      h ^= p[i];
+      h *= 1099511628211ULL;
+    }
+  };
+
+  addHash(&matrix.n, sizeof(matrix.n));
+
+  if (! matrix.rowStart.empty())
+    addHash(matrix.rowStart.data(), matrix.rowStart.size()*sizeof(int));
+
+  if (! matrix.cols.empty())
+    addHash(matrix.cols.data(), matrix.cols.size()*sizeof(int));
+
+  if (! matrix.values.empty())
+    addHash(matrix.values.data(), matrix.values.size()*sizeof(double));
+
+  return h;
+}
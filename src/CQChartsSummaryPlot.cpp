@@ -19,6 +19,7 @@
 #include <CQChartsDrawUtil.h>
 #include <CQChartsTip.h>
 #include <CQChartsFitData.h>
+#include <CQChartsParallel.h>
 
 #include <CQChartsScatterPlot.h>
 #include <CQChartsDistributionPlot.h>
@@ -27,7 +28,6 @@
 #include <CQPropertyViewItem.h>
 #include <CQTableWidget.h>
 #include <CQPerfMonitor.h>
-#include <CMathCorrelation.h>
 
 #include <QMenu>
 #include <QCheckBox>
@@ -369,14 +369,33 @@ setDensity(bool b)
 
 //---
 
+void
+CQChartsSummaryPlot::
+setLodPoints(int n)
+{
+  CQChartsUtil::testAndSet(lodPoints_, std::max(n, 0), [&]() { updateObjs(); } );
+}
+
+void
+CQChartsSummaryPlot::
+setLodBins(int n)
+{
+  CQChartsUtil::testAndSet(lodBins_, std::max(n, 1), [&]() { updateObjs(); } );
+}
+
+//---
+
 void
 CQChartsSummaryPlot::
 modelTypeChangedSlot(int modelInd)
 {
   auto *modelData = charts()->getModelData(model_);
 
-  if (modelData && modelData->isInd(modelInd))
+  if (modelData && modelData->isInd(modelInd)) {
+    resetColumnValues();
+
     updateRangeAndObjs();
+  }
 }
 
 //---
@@ -403,6 +422,10 @@ setGroupColumn(const Column &c)
   CQChartsUtil::testAndSet(groupColumn_, c, [&]() {
     resetSetHidden();
 
+    resetColumnValues();
+
+    updateObjs();
+
     if (isExpanded() && (expandRow_ != expandCol_)) {
       scatterPlot_->setGroupColumn(groupColumn());
     }
@@ -500,6 +523,10 @@ addProperties()
   // overlays
   addProp("overlays", "bestFit", "bestFit", "Show best fit on scatter");
   addProp("overlays", "density", "density", "Show density on distribution");
+
+  // level of detail
+  addProp("lod", "lodPoints", "points", "Number of cell points above which points are binned");
+  addProp("lod", "lodBins"  , "bins"  , "Number of bins for binned points");
 }
 
 //---
@@ -575,7 +602,12 @@ calcRange() const
 
   //---
 
-  const_cast<CQChartsSummaryPlot *>(this)->updateVisibleColumns();
+  auto *th = const_cast<CQChartsSummaryPlot *>(this);
+
+  th->updateVisibleColumns();
+
+  // range update (model or column change) invalidates cached column values
+  th->resetColumnValues();
 
   // square (nc, nc)
   int nc = std::max(visibleColumns().count(), 1);
@@ -616,8 +648,16 @@ createObjs(PlotObjs &objs) const
 
   //---
 
+  auto *th = const_cast<CQChartsSummaryPlot *>(this);
+
+  th->initColumnValues();
+
+  //---
+
   int nc = visibleColumns().count();
 
+  std::vector<CellObj *> cellObjs;
+
   for (int ir = 0; ir < nc; ++ir) {
     for (int ic = 0; ic < nc; ++ic) {
       auto *obj = createCellObj(cellBBox(ir, ic), ir, ic);
@@ -625,14 +665,144 @@ createObjs(PlotObjs &objs) const
       connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
 
       objs.push_back(obj);
+
+      cellObjs.push_back(obj);
     }
   }
 
   //---
 
+  // build cell data (from shared column values) in parallel
+  CQChartsParallel::forEach(int(cellObjs.size()), [&](int i) { cellObjs[size_t(i)]->initData(); });
+
+  //---
+
   return true;
 }
 
+void
+CQChartsSummaryPlot::
+resetColumnValues()
+{
+  columnValuesValid_ = false;
+}
+
+void
+CQChartsSummaryPlot::
+initColumnValues()
+{
+  CQPerfTrace trace("CQChartsSummaryPlot::initColumnValues");
+
+  if (columnValuesValid_)
+    return;
+
+  columnValuesValid_ = true;
+
+  //---
+
+  int nc = visibleColumns().count();
+
+  columnValues_.clear();
+  columnValues_.resize(size_t(nc));
+
+  numValueRows_ = 0;
+
+  groupRows_.clear();
+  rowGroups_.clear();
+
+  //---
+
+  // get details on main thread (details are created on demand)
+  using Details = std::vector<const ModelColumnDetails *>;
+
+  Details details;
+
+  for (int ic = 0; ic < nc; ++ic) {
+    auto *details1 = columnDetails(visibleColumns().getColumn(ic));
+
+    details.push_back(details1);
+
+    if (details1)
+      numValueRows_ = std::max(numValueRows_, details1->numRows());
+  }
+
+  auto *groupDetails = (groupColumn().isValid() ? columnDetails(groupColumn()) : nullptr);
+
+  //---
+
+  // extract each column once into typed array (one column per task)
+  auto nan = CMathUtil::getNaN();
+
+  CQChartsParallel::forEach(nc, [&](int ic) {
+    auto *details1 = details[size_t(ic)];
+    if (! details1) return;
+
+    auto &columnValues = columnValues_[size_t(ic)];
+
+    columnValues.numeric = details1->isNumeric();
+
+    if (columnValues.numeric) {
+      bool ok;
+      columnValues.min = CQChartsVariant::toReal(details1->minValue(), ok);
+      columnValues.max = CQChartsVariant::toReal(details1->maxValue(), ok);
+    }
+    else {
+      columnValues.min = 0.0;
+      columnValues.max = details1->numUnique();
+    }
+
+    int nr = details1->numRows();
+
+    columnValues.values.resize(size_t(numValueRows_), nan);
+
+    for (int ir = 0; ir < nr; ++ir) {
+      auto value = details1->value(ir);
+
+      if (columnValues.numeric) {
+        bool ok;
+        double r = CQChartsVariant::toReal(value, ok);
+        if (! ok) continue;
+
+        columnValues.values[size_t(ir)] = r;
+      }
+      else
+        columnValues.values[size_t(ir)] = details1->uniqueId(value);
+    }
+  });
+
+  //---
+
+  // group rows
+  if (groupDetails) {
+    int ng = groupDetails->numUnique();
+    int nr = groupDetails->numRows();
+
+    groupRows_.resize(size_t(ng));
+    rowGroups_.resize(size_t(numValueRows_), -1);
+
+    for (int ir = 0; ir < nr && ir < numValueRows_; ++ir) {
+      int ig = groupDetails->uniqueId(groupDetails->value(ir));
+      if (ig < 0 || ig >= ng) continue;
+
+      groupRows_[size_t(ig)].push_back(ir);
+
+      rowGroups_[size_t(ir)] = ig;
+    }
+  }
+}
+
+const CQChartsSummaryPlot::ColumnValues &
+CQChartsSummaryPlot::
+columnValues(int ic) const
+{
+  static ColumnValues dummyColumnValues;
+
+  if (ic < 0 || ic >= int(columnValues_.size()))
+    return dummyColumnValues;
+
+  return columnValues_[size_t(ic)];
+}
+
 CQChartsGeom::BBox
 CQChartsSummaryPlot::
 cellBBox(int row, int col) const
@@ -741,7 +911,8 @@ postResize()
 {
   CQChartsPlot::postResize();
 
-  updateRangeAndObjs();
+  // range is fixed (nc x nc) so keep cached column values and only rebuild cells
+  updateObjs();
 }
 
 //------
@@ -914,6 +1085,8 @@ setColumnVisible(int ic, bool visible)
 {
   columnVisible_[ic] = visible;
 
+  resetColumnValues();
+
   if (! isExpanded() && (plotType() == PlotType::PARALLEL))
     parallelPlot_->setYColumnVisible(ic, visible);
 
@@ -1073,29 +1246,23 @@ calcTipId() const
 
     if (details1 && details2 && details1->isNumeric() && details2->isNumeric()) {
       if (! plot_->groupColumn().isValid()) {
-        auto correlation = plot_->modelDetails()->correlation(column1, column2);
-
-        tableTip.addTableRow("Correlation", correlation);
+        tableTip.addTableRow("Correlation", cellData_.correlation);
       }
       else {
         auto *groupDetails = plot_->columnDetails(plot_->groupColumn());
 
-        const_cast<CQChartsSummaryCellObj *>(this)->initGroupedValues();
+        for (const auto &pg : cellData_.groupCorrelation) {
+          int ig = pg.first;
 
-        for (const auto &pg : groupValues_.groupIndData) {
-          int         ig      = pg.first;
-          const auto &indData = pg.second;
+          auto groupVar = (groupDetails ? groupDetails->uniqueValue(ig) : QVariant());
 
-          if (indData.x.size() == indData.y.size()) {
-            auto correlation = CMathCorrelation::calc(indData.x, indData.y);
-
-            auto groupVar = (groupDetails ? groupDetails->uniqueValue(ig) : QVariant());
-
-            tableTip.addTableRow(QString("Correlation (%1)").arg(groupVar.toString()), correlation);
-          }
+          tableTip.addTableRow(QString("Correlation (%1)").arg(groupVar.toString()), pg.second);
         }
       }
     }
+
+    if (cellData_.binned)
+      tableTip.addTableRow("Num Points", cellData_.numPoints);
   }
   else {
     auto column = plot_->visibleColumns().getColumn(row_);
@@ -1203,124 +1370,126 @@ drawScatter(PaintDevice *device) const
 
   //---
 
-  auto column1 = plot_->visibleColumns().getColumn(row_);
-  auto column2 = plot_->visibleColumns().getColumn(col_);
-
-  auto *details1 = plot_->columnDetails(column1);
-  auto *details2 = plot_->columnDetails(column2);
-  if (! details1 || ! details2) return;
-
-  auto *groupDetails = (plot_->groupColumn().isValid() ?
-    plot_->columnDetails(plot_->groupColumn()) : nullptr);
+  const auto &xvalues = plot_->columnValues(row_);
+  const auto &yvalues = plot_->columnValues(col_);
 
-  int ng = (groupDetails ? groupDetails->numUnique() : 0);
+  xmin_ = xvalues.min; xmax_ = xvalues.max;
+  ymin_ = yvalues.min; ymax_ = yvalues.max;
 
   //---
 
-  int nc = plot_->visibleColumns().count();
-
-  auto pc = plot_->interpInterfaceColor(1.0);
-  auto bc = plot_->interpPaletteColor(ColorInd(row_, nc));
-
-  if (details1->isNumeric()) {
-    bool ok;
-    xmin_ = CQChartsVariant::toReal(details1->minValue(), ok);
-    xmax_ = CQChartsVariant::toReal(details1->maxValue(), ok);
+  if (cellData_.binned) {
+    drawBinnedPoints(device);
   }
   else {
-    xmin_ = 0.0;
-    xmax_ = details1->numUnique();
-  }
+    int ng = plot_->numGroups();
 
-  if (details2->isNumeric()) {
-    bool ok;
-    ymin_ = CQChartsVariant::toReal(details2->minValue(), ok);
-    ymax_ = CQChartsVariant::toReal(details2->maxValue(), ok);
-  }
-  else {
-    ymin_ = 0.0;
-    ymax_ = details2->numUnique();
-  }
+    int nc = plot_->visibleColumns().count();
 
-  int nx = details1->numRows();
-  int ny = details2->numRows();
-  if (nx != ny) return;
+    auto pc = plot_->interpInterfaceColor(1.0);
+    auto bc = plot_->interpPaletteColor(ColorInd(row_, nc));
 
-  auto symbol = CQChartsSymbol::circle();
+    auto symbol = CQChartsSymbol::circle();
 
-  PenBrush penBrush;
+    PenBrush penBrush;
 
-  plot_->setPenBrush(penBrush, PenData(true, pc, Alpha(0.5)), BrushData(true, bc));
+    plot_->setPenBrush(penBrush, PenData(true, pc, Alpha(0.5)), BrushData(true, bc));
 
-  CQChartsDrawUtil::setPenBrush(device, penBrush);
+    CQChartsDrawUtil::setPenBrush(device, penBrush);
 
-  poly_ = Polygon();
+    int nr = std::min(plot_->numValueRows(), int(std::min(xvalues.values.size(),
+                                                          yvalues.values.size())));
 
-  for (int i = 0; i < nx; ++i) {
-    double x = 0.0, y = 0.0;
+    for (int i = 0; i < nr; ++i) {
+      double x = xvalues.values[size_t(i)];
+      double y = yvalues.values[size_t(i)];
 
-    if (details1->isNumeric()) {
-      bool ok;
-      x = CQChartsVariant::toReal(details1->value(i), ok);
-      if (! ok) continue;
-    }
-    else
-      x = details1->uniqueId(details1->value(i));
+      if (CMathUtil::isNaN(x) || CMathUtil::isNaN(y))
+        continue;
 
-    if (details2->isNumeric()) {
-      bool ok;
-      y = CQChartsVariant::toReal(details2->value(i), ok);
-      if (! ok) continue;
-    }
-    else
-      y = details2->uniqueId(details2->value(i));
+      //---
 
-    //---
+      auto x1 = CMathUtil::map(x, xmin_, xmax_, pxmin_, pxmax_);
+      auto y1 = CMathUtil::map(y, ymin_, ymax_, pymin_, pymax_);
 
-    auto x1 = CMathUtil::map(x, xmin_, xmax_, pxmin_, pxmax_);
-    auto y1 = CMathUtil::map(y, ymin_, ymax_, pymin_, pymax_);
+      Point ps(x1, y1);
 
-    Point ps(x1, y1);
+      //---
 
-    //---
+      PenBrush       penBrush1;
+      CQChartsSymbol symbol1;
 
-    PenBrush       penBrush1;
-    CQChartsSymbol symbol1;
+      int ig = (ng > 0 ? plot_->rowGroup(i) : -1);
 
-    if (groupDetails) {
-      auto var = groupDetails->value(i);
+      if (ig >= 0) {
+        auto bc1 = plot_->interpPaletteColor(ColorInd(ig, ng));
 
-      int ig = groupDetails->uniqueId(var);
+        plot_->setPenBrush(penBrush1, PenData(true, pc, Alpha(0.5)), BrushData(true, bc1));
 
-      auto bc1 = plot_->interpPaletteColor(ColorInd(ig, ng));
+        auto *symbolSet = plot_->defaultSymbolSet();
 
-      plot_->setPenBrush(penBrush1, PenData(true, pc, Alpha(0.5)), BrushData(true, bc1));
+        symbol1 = symbolSet->interpI(ig).symbol;
+      }
+      else {
+        penBrush1 = penBrush;
+        symbol1   = symbol;
+      }
 
-      auto *symbolSet = plot_->defaultSymbolSet();
+      //---
 
-      symbol1 = symbolSet->interpI(ig).symbol;
-    }
-    else {
-      penBrush1 = penBrush;
-      symbol1   = symbol;
+      CQChartsDrawUtil::setPenBrush(device, penBrush1);
+
+      CQChartsDrawUtil::drawSymbol(device, penBrush1, symbol1, ps,
+                                   plot_->symbolSize(), /*scale*/true);
     }
+  }
 
-    //---
+  //---
+
+  if (plot_->isBestFit())
+    drawBestFit(device);
+}
 
-    CQChartsDrawUtil::setPenBrush(device, penBrush1);
+void
+CQChartsSummaryCellObj::
+drawBinnedPoints(PaintDevice *device) const
+{
+  CQPerfTrace trace("CQChartsSummaryCellObj::drawBinnedPoints");
 
-    CQChartsDrawUtil::drawSymbol(device, penBrush1, symbol1, ps,
-                                 plot_->symbolSize(), /*scale*/true);
+  //---
 
-    //---
+  int nb = cellData_.numBins;
+  if (nb <= 0 || cellData_.maxBin <= 0) return;
 
-    poly_.addPoint(Point(x, y)); // untransformed point
-  }
+  int nc = plot_->visibleColumns().count();
 
-  //---
+  auto bc = plot_->interpPaletteColor(ColorInd(row_, nc));
 
-  if (plot_->isBestFit())
-    drawBestFit(device);
+  double dx = (pxmax_ - pxmin_)/nb;
+  double dy = (pymax_ - pymin_)/nb;
+
+  // log scale alpha so sparse bins are still visible
+  double lmax = std::log(1.0 + cellData_.maxBin);
+
+  for (int iy = 0; iy < nb; ++iy) {
+    for (int ix = 0; ix < nb; ++ix) {
+      int n = cellData_.bins[size_t(iy*nb + ix)];
+      if (n <= 0) continue;
+
+      double a = 0.1 + 0.9*std::log(1.0 + n)/lmax;
+
+      PenBrush penBrush;
+
+      plot_->setPenBrush(penBrush, PenData(false), BrushData(true, bc, Alpha(a)));
+
+      CQChartsDrawUtil::setPenBrush(device, penBrush);
+
+      double x1 = pxmin_ + ix*dx;
+      double y1 = pymin_ + iy*dy;
+
+      device->drawRect(BBox(x1, y1, x1 + dx, y1 + dy));
+    }
+  }
 }
 
 void
@@ -1368,17 +1537,14 @@ drawBestFit(PaintDevice *device) const
     device->restore();
   };
 
-  if (! plot_->groupColumn().isValid()) {
-    drawFitPoly(poly_);
+  int ng = plot_->numGroups();
+
+  if (ng <= 0) {
+    drawFitPoly(calcPoints());
   }
   else {
-    const_cast<CQChartsSummaryCellObj *>(this)->initGroupedValues();
-
-    for (const auto &pg : groupValues_.groupIndData) {
-      const auto &indData = pg.second;
-
-      drawFitPoly(indData.poly);
-    }
+    for (int ig = 0; ig < ng; ++ig)
+      drawFitPoly(calcPoints(ig));
   }
 }
 
@@ -1417,29 +1583,25 @@ drawCorrelation(PaintDevice *device) const
     double y = by;
 
     if (! plot_->groupColumn().isValid()) {
-      auto correlation = plot_->modelDetails()->correlation(column1, column2);
-
-      auto cstr = CQChartsUtil::realToString(correlation, 5);
+      auto cstr = CQChartsUtil::realToString(cellData_.correlation, 5);
 
       auto *drawText = new CQChartsDrawText(Point(x, y), cstr, device->font(), tpenBrush);
 
       drawObj->addChild(drawText);
     }
     else {
-      const_cast<CQChartsSummaryCellObj *>(this)->initGroupedValues();
-
-      int ng = int(groupValues_.groupIndData.size());
+      int ng = plot_->numGroups();
 
       QFontMetricsF fm(device->font());
 
       double dx = plot_->pixelToWindowWidth (fm.height());
       double dy = plot_->pixelToWindowHeight(fm.height());
 
-      y += double(groupValues_.groupIndData.size() - 1)*(dy + by);
+      y += double(cellData_.groupCorrelation.size() - 1)*(dy + by);
 
-      for (const auto &pg : groupValues_.groupIndData) {
-        int         ig      = pg.first;
-        const auto &indData = pg.second;
+      for (const auto &pg : cellData_.groupCorrelation) {
+        int    ig          = pg.first;
+        double correlation = pg.second;
 
         PenBrush rpenBrush;
 
@@ -1453,16 +1615,12 @@ drawCorrelation(PaintDevice *device) const
 
         //---
 
-        if (indData.x.size() == indData.y.size()) {
-          auto correlation = CMathCorrelation::calc(indData.x, indData.y);
+        auto cstr = CQChartsUtil::realToString(correlation, 5);
 
-          auto cstr = CQChartsUtil::realToString(correlation, 5);
+        auto *drawText = new CQChartsDrawText(Point(x + dx + 2*bx, y + dy/2.0), cstr,
+                                              device->font(), tpenBrush);
 
-          auto *drawText = new CQChartsDrawText(Point(x + dx + 2*bx, y + dy/2.0), cstr,
-                                                device->font(), tpenBrush);
-
-          drawObj->addChild(drawText);
-        }
+        drawObj->addChild(drawText);
 
         //---
 
@@ -1503,11 +1661,7 @@ drawBoxPlot(PaintDevice *device) const
   auto bc = plot_->interpPaletteColor(ColorInd(row_, nc));
 
   if (details->isNumeric()) {
-    bool ok;
-    double min = CQChartsVariant::toReal(details->minValue(), ok);
-    double max = CQChartsVariant::toReal(details->maxValue(), ok);
-
-    int n = details->numRows();
+    const auto &values = plot_->columnValues(row_);
 
     PenBrush penBrush;
 
@@ -1517,12 +1671,10 @@ drawBoxPlot(PaintDevice *device) const
 
     CQChartsBoxWhisker whisker;
 
-    for (int i = 0; i < n; ++i) {
-      bool ok;
-      double r = CQChartsVariant::toReal(details->value(i), ok);
-      if (! ok) continue;
+    for (const auto &r : values.values) {
+      if (CMathUtil::isNaN(r)) continue;
 
-      double r1 = CMathUtil::map(r, min, max, pymin_, pymax_);
+      double r1 = CMathUtil::map(r, values.min, values.max, pymin_, pymax_);
 
       whisker.addValue(r1);
     }
@@ -1698,14 +1850,10 @@ drawDensity(PaintDevice *device) const
 
   CQChartsDensity::XVals xvals;
 
-  int n = details->numRows();
+  const auto &values = plot_->columnValues(row_);
 
-  for (int i = 0; i < n; ++i) {
-    auto value = details->value(i);
-
-    bool ok;
-    double r = CQChartsVariant::toReal(value, ok);
-    if (! ok) continue;
+  for (const auto &r : values.values) {
+    if (CMathUtil::isNaN(r)) continue;
 
     double x = CMathUtil::map(r, bmin_, bmax_, pxmin_, pxmax_);
 
@@ -1783,96 +1931,156 @@ drawPie(PaintDevice *device) const
 
 void
 CQChartsSummaryCellObj::
-initGroupedValues()
+initData()
 {
-  CQPerfTrace trace("CQChartsSummaryCellObj::initGroupedValues");
+  CQPerfTrace trace("CQChartsSummaryCellObj::initData");
 
   //---
 
-  if (groupValues_.set)
+  cellData_ = CellData();
+
+  if (row_ == col_)
     return;
 
-  groupValues_.set = true;
+  const auto &xvalues = plot_->columnValues(row_);
+  const auto &yvalues = plot_->columnValues(col_);
+
+  int nr = plot_->numValueRows();
+  int ng = plot_->numGroups();
 
-  if (! plot_->groupColumn().isValid())
+  if (int(xvalues.values.size()) < nr || int(yvalues.values.size()) < nr)
     return;
 
-  auto *groupDetails = plot_->columnDetails(plot_->groupColumn());
-  if (! groupDetails) return;
+  //---
 
-  int nr = groupDetails->numRows();
+  // single pass (Welford) centered moments for (grouped) correlation of plot rows
+  // (raw sums n*sxy - sx*sy lose precision for large or offset values)
+  // Note: uses filtered rows (pairs with both values) not all model column values
+  struct Moments {
+    int    n   { 0 };
+    double mx  { 0.0 };
+    double my  { 0.0 };
+    double cxx { 0.0 };
+    double cyy { 0.0 };
+    double cxy { 0.0 };
+
+    void add(double x, double y) {
+      ++n;
+
+      double dx = x - mx;
+      double dy = y - my;
+
+      mx += dx/n;
+      my += dy/n;
+
+      cxx += dx*(x - mx);
+      cyy += dy*(y - my);
+      cxy += dx*(y - my);
+    }
 
-  if (row_ != col_) {
-    auto column1 = plot_->visibleColumns().getColumn(row_);
-    auto column2 = plot_->visibleColumns().getColumn(col_);
+    double correlation() const {
+      if (n < 2) return 0.0;
 
-    auto *details1 = plot_->columnDetails(column1);
-    auto *details2 = plot_->columnDetails(column2);
-    if (! details1 || ! details2) return;
+      double d = std::sqrt(cxx*cyy);
 
-    for (int ir = 0; ir < nr; ++ir) {
-      auto var = groupDetails->value(ir);
+      return (d > 0.0 ? cxy/d : 0.0);
+    }
+  };
 
-      int ig = groupDetails->uniqueId(var);
+  Moments              moments;
+  std::vector<Moments> groupMoments(size_t(std::max(ng, 0)));
 
-      auto &indData = groupValues_.groupIndData[ig];
+  for (int i = 0; i < nr; ++i) {
+    double x = xvalues.values[size_t(i)];
+    double y = yvalues.values[size_t(i)];
 
-      auto value1 = details1->value(ir);
-      auto value2 = details2->value(ir);
+    if (CMathUtil::isNaN(x) || CMathUtil::isNaN(y))
+      continue;
 
-      indData.xvals.push_back(value1);
-      indData.yvals.push_back(value2);
+    moments.add(x, y);
 
-      double x = 0.0, y = 0.0;
+    int ig = (ng > 0 ? plot_->rowGroup(i) : -1);
 
-      if (details1->isNumeric()) {
-        bool ok;
-        x = CQChartsVariant::toReal(value1, ok);
+    if (ig >= 0)
+      groupMoments[size_t(ig)].add(x, y);
+  }
 
-        indData.x.push_back(x);
-      }
+  cellData_.numPoints = moments.n;
 
-      if (details2->isNumeric()) {
-        bool ok;
-        y = CQChartsVariant::toReal(value2, ok);
+  if (xvalues.numeric && yvalues.numeric) {
+    cellData_.correlation = moments.correlation();
 
-        indData.y.push_back(y);
-      }
-
-      indData.poly.addPoint(Point(x, y));
+    for (int ig = 0; ig < ng; ++ig) {
+      if (groupMoments[size_t(ig)].n > 0)
+        cellData_.groupCorrelation[ig] = groupMoments[size_t(ig)].correlation();
     }
   }
-  else {
-    auto column = plot_->visibleColumns().getColumn(row_);
 
-    auto *details = plot_->columnDetails(column);
-    if (! details) return;
+  //---
 
-    for (int ir = 0; ir < nr; ++ir) {
-      auto var = groupDetails->value(ir);
+  // bin points if too many to draw individually
+  if (cellData_.numPoints <= plot_->lodPoints())
+    return;
 
-      int ig = groupDetails->uniqueId(var);
+  int nb = plot_->lodBins();
 
-      auto &indData = groupValues_.groupIndData[ig];
+  cellData_.binned  = true;
+  cellData_.numBins = nb;
 
-      auto value = details->value(ir);
+  cellData_.bins.resize(size_t(nb*nb), 0);
 
-      indData.xvals.push_back(value);
-      indData.yvals.push_back(value);
+  double xs = (xvalues.max > xvalues.min ? nb/(xvalues.max - xvalues.min) : 0.0);
+  double ys = (yvalues.max > yvalues.min ? nb/(yvalues.max - yvalues.min) : 0.0);
 
-      if (details->isNumeric()) {
-        bool ok;
-        double r = CQChartsVariant::toReal(value, ok);
+  for (int i = 0; i < nr; ++i) {
+    double x = xvalues.values[size_t(i)];
+    double y = yvalues.values[size_t(i)];
 
-        indData.x.push_back(r);
-        indData.y.push_back(r);
+    if (CMathUtil::isNaN(x) || CMathUtil::isNaN(y))
+      continue;
 
-        indData.poly.addPoint(Point(r, r));
-      }
-    }
+    int ix = std::min(std::max(int((x - xvalues.min)*xs), 0), nb - 1);
+    int iy = std::min(std::max(int((y - yvalues.min)*ys), 0), nb - 1);
+
+    int n = ++cellData_.bins[size_t(iy*nb + ix)];
+
+    cellData_.maxBin = std::max(cellData_.maxBin, n);
   }
 }
 
+CQChartsGeom::Polygon
+CQChartsSummaryCellObj::
+calcPoints(int ig) const
+{
+  // untransformed points (for group or all)
+  Polygon poly;
+
+  const auto &xvalues = plot_->columnValues(row_);
+  const auto &yvalues = plot_->columnValues(col_);
+
+  auto addRow = [&](int i) {
+    double x = xvalues.values[size_t(i)];
+    double y = yvalues.values[size_t(i)];
+
+    if (! CMathUtil::isNaN(x) && ! CMathUtil::isNaN(y))
+      poly.addPoint(Point(x, y));
+  };
+
+  int nr = std::min(plot_->numValueRows(), int(std::min(xvalues.values.size(),
+                                                        yvalues.values.size())));
+
+  if (ig >= 0) {
+    for (const auto &i : plot_->groupRows(ig))
+      if (i < nr) addRow(i);
+  }
+  else {
+    for (int i = 0; i < nr; ++i)
+      addRow(i);
+  }
+
+  return poly;
+}
+
 //------
 
 CQChartsSummaryPlotGroupStats::
@@ -12,6 +12,10 @@
 
 #include <QMenu>
 
+#include <functional>
+#include <set>
+#include <tuple>
+
 //---
 
 CQChartsSunburstPlotType::
@@ -164,6 +168,22 @@ setClipText(bool b)
 
 //---
 
+void
+CQChartsSunburstPlot::
+setLod(bool b)
+{
+  CQChartsUtil::testAndSet(lodData_.enabled, b, [&]() { updateLodObjs(); } );
+}
+
+void
+CQChartsSunburstPlot::
+setLodSize(double s)
+{
+  CQChartsUtil::testAndSet(lodData_.size, s, [&]() { updateLodObjs(); } );
+}
+
+//---
+
 bool
 CQChartsSunburstPlot::
 isRoot(const HierNode *node) const
@@ -246,6 +266,10 @@ addProperties()
   addProp("options", "followViewExpand", "", "Follow view expand");
   addProp("options", "sortType"        , "", "Sort type");
 
+  // level of detail
+  addProp("lod", "lod"    , "enabled", "Aggregate small nodes");
+  addProp("lod", "lodSize", "size"   , "Min pixel arc length/width of node object");
+
   // coloring
   addProp("coloring", "colorById", "colorById", "Color by id");
 
@@ -323,6 +347,9 @@ calcRange() const
 {
   CQPerfTrace trace("CQChartsSunburstPlot::calcRange");
 
+  // range update (data or column change) needs roots reloaded
+  const_cast<CQChartsSunburstPlot *>(this)->rootsValid_ = false;
+
   Range dataRange;
 
   double r = 1.0;
@@ -339,11 +366,30 @@ void
 CQChartsSunburstPlot::
 clearPlotObjects()
 {
-  resetRoots();
+  // keep loaded roots for level of detail only update
+  if (! rootsValid_)
+    resetRoots();
 
   CQChartsPlot::clearPlotObjects();
 }
 
+void
+CQChartsSunburstPlot::
+updateObjs()
+{
+  // general object update (columns, colors, ...) so reload roots
+  rootsValid_ = false;
+
+  CQChartsHierPlot::updateObjs();
+}
+
+void
+CQChartsSunburstPlot::
+updateLodObjs()
+{
+  CQChartsHierPlot::updateObjs();
+}
+
 bool
 CQChartsSunburstPlot::
 createObjs(PlotObjs &objs) const
@@ -385,6 +431,8 @@ createObjs(PlotObjs &objs) const
   if (roots_.empty())
     th->initRoots();
 
+  th->rootsValid_ = true;
+
   //---
 
   th->initColorIds();
@@ -399,6 +447,8 @@ createObjs(PlotObjs &objs) const
 
   //---
 
+  initLod();
+
   int nr = int(roots_.size());
 
   bool isUnnamedRoot = (nr == 1 && roots_[0]->name() == "");
@@ -998,15 +1048,31 @@ void
 CQChartsSunburstPlot::
 addPlotObjs(HierNode *hier, PlotObjs &objs, const ColorInd &ir) const
 {
+  // small nodes and sub-trees are added to single level of detail object
+  Nodes lodNodes;
+
   for (auto &node : hier->getNodes()) {
+    if (isLodNode(node)) {
+      lodNodes.push_back(node);
+      continue;
+    }
+
     addPlotObj(node, objs, ir);
   }
 
   for (auto &hierNode : hier->getChildren()) {
+    if (isLodNode(hierNode)) {
+      lodNodes.push_back(hierNode);
+      continue;
+    }
+
     addPlotObj(hierNode, objs, ir);
 
     addPlotObjs(hierNode, objs, ir);
   }
+
+  if (! lodNodes.empty())
+    addLodObj(hier, lodNodes, objs, ir);
 }
 
 void
@@ -1029,6 +1095,77 @@ addPlotObj(Node *node, PlotObjs &objs, const ColorInd &ir) const
   objs.push_back(obj);
 }
 
+void
+CQChartsSunburstPlot::
+addLodObj(HierNode *hier, const Nodes &nodes, PlotObjs &objs, const ColorInd &ir) const
+{
+  double r = std::max(outerRadius(), 0.0);
+
+  BBox bbox(-r, -r, r, r);
+
+  auto *obj = createLodObj(bbox, hier, nodes);
+
+  connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
+
+  obj->setIs(ir);
+
+  objs.push_back(obj);
+
+  for (auto &node : nodes)
+    numLodNodes_ += node->numNodes();
+}
+
+void
+CQChartsSunburstPlot::
+initLod() const
+{
+  // save scale used to aggregate nodes
+  numLodNodes_ = 0;
+
+  lodScale_ = (isLod() ? windowToPixelWidth(1.0) : 0.0);
+}
+
+bool
+CQChartsSunburstPlot::
+isLodNode(Node *node) const
+{
+  if (! isLod() || ! node->placed())
+    return false;
+
+  // aggregate if ring width smaller than lod size
+  if (windowToPixelWidth(node->dr()) < lodSize())
+    return true;
+
+  // aggregate if outer arc length (of outermost ring for sub-tree) smaller than lod size
+  double r = (dynamic_cast<HierNode *>(node) ?
+    std::max(outerRadius(), node->r() + node->dr()) : node->r() + node->dr());
+
+  if (windowToPixelWidth(r*node->da().radians()) < lodSize())
+    return true;
+
+  return false;
+}
+
+bool
+CQChartsSunburstPlot::
+isLodUpdate() const
+{
+  if (! isLod() || lodScale_ <= 0.0)
+    return false;
+
+  auto scale = windowToPixelWidth(1.0);
+
+  // zoomed out so more nodes can be aggregated
+  if (scale < lodScale_/4.0)
+    return true;
+
+  // zoomed in so aggregated nodes may need objects
+  if (numLodNodes_ > 0 && scale > 2.0*lodScale_)
+    return true;
+
+  return false;
+}
+
 //------
 
 bool
@@ -1127,6 +1264,22 @@ postResize()
   CQChartsPlot::postResize();
 
   resetDataRange(/*updateRange*/true, /*updateObjs*/false);
+
+  if (isLodUpdate())
+    updateLodObjs();
+}
+
+void
+CQChartsSunburstPlot::
+applyDataRangeAndDraw()
+{
+  CQChartsHierPlot::applyDataRangeAndDraw();
+
+  //---
+
+  // recreate objects if zoom changes level of detail of visible nodes
+  if (isLodUpdate())
+    updateLodObjs();
 }
 
 //------
@@ -1377,6 +1530,13 @@ createNodeObj(const BBox &rect, Node *node) const
   return new NodeObj(this, rect, node);
 }
 
+CQChartsSunburstLodObj *
+CQChartsSunburstPlot::
+createLodObj(const BBox &rect, HierNode *hier, const Nodes &nodes) const
+{
+  return new LodObj(this, rect, hier, nodes);
+}
+
 //---
 
 bool
@@ -1474,38 +1634,7 @@ inside(const Point &p) const
   double r1 = node_->r();
   double r2 = r1 + node_->dr();
 
-  Point c(0, 0);
-
-  double r = p.distanceTo(c);
-
-  if (r < r1 || r > r2)
-    return false;
-
-  //---
-
-  // check angle
-  double a = CMathUtil::Rad2Deg(CQChartsGeom::pointAngle(c, p)); while (a < 0) a += 360.0;
-
-  double a1 = node_->a().value();
-  double a2 = a1 + node_->da().value();
-
-  while (a1 < 0) a1 += 360.0;
-  while (a2 < 0) a2 += 360.0;
-
-  if (a1 > a2) {
-    // crosses zero
-    if (a >= 0 && a <= a2)
-      return true;
-
-    if (a <= 360 && a >= a1)
-      return true;
-  }
-  else {
-    if (a >= a1 && a <= a2)
-      return true;
-  }
-
-  return false;
+  return node_->pointInside(p, r1, r2);
 }
 
 void
@@ -1570,6 +1699,199 @@ calcTextPenBrush(PenBrush &tPenBrush, bool updateState) const
 
 //------
 
+CQChartsSunburstLodObj::
+CQChartsSunburstLodObj(const Plot *plot, const BBox &rect, HierNode *hier, const Nodes &nodes) :
+ CQChartsPlotObj(const_cast<Plot *>(plot), rect), plot_(plot), hier_(hier), nodes_(nodes)
+{
+  // calc outer radius of each node (outermost placed ring for sub-tree)
+  std::function<double(Node *)> outerRadius;
+
+  outerRadius = [&](Node *node) {
+    double r = node->r() + node->dr();
+
+    auto *hierNode = dynamic_cast<HierNode *>(node);
+    if (! hierNode || ! hierNode->isExpanded()) return r;
+
+    for (auto &child : hierNode->getChildren()) {
+      if (child->placed())
+        r = std::max(r, outerRadius(child));
+    }
+
+    for (auto &node1 : hierNode->getNodes()) {
+      if (node1->placed())
+        r = std::max(r, node1->r() + node1->dr());
+    }
+
+    return r;
+  };
+
+  for (auto &node : nodes_) {
+    radii_.push_back(outerRadius(node));
+
+    if (! dynamic_cast<HierNode *>(node) && node->ind().isValid())
+      addModelInd(node->ind());
+  }
+}
+
+int
+CQChartsSunburstLodObj::
+numNodes() const
+{
+  int n = 0;
+
+  for (auto &node : nodes_)
+    n += node->numNodes();
+
+  return n;
+}
+
+double
+CQChartsSunburstLodObj::
+hierSize() const
+{
+  double size = 0.0;
+
+  for (auto &node : nodes_)
+    size += node->hierSize();
+
+  return size;
+}
+
+QString
+CQChartsSunburstLodObj::
+calcId() const
+{
+  return QString("%1:%2:%3").arg(typeName()).arg(hier_->name()).arg(nodes_.size());
+}
+
+QString
+CQChartsSunburstLodObj::
+calcTipId() const
+{
+  CQChartsTableTip tableTip;
+
+  tableTip.addTableRow("Name" , hier_->hierName());
+  tableTip.addTableRow("Nodes", numNodes());
+  tableTip.addTableRow("Size" , hierSize());
+
+  return tableTip.str();
+}
+
+bool
+CQChartsSunburstLodObj::
+inside(const Point &p) const
+{
+  int n = int(nodes_.size());
+
+  for (int i = 0; i < n; ++i) {
+    if (nodes_[size_t(i)]->pointInside(p, nodes_[size_t(i)]->r(), radii_[size_t(i)]))
+      return true;
+  }
+
+  return false;
+}
+
+void
+CQChartsSunburstLodObj::
+getObjSelectIndices(Indices &inds) const
+{
+  for (const auto &c : plot_->nameColumns())
+    addColumnSelectIndex(inds, c);
+
+  addColumnSelectIndex(inds, plot_->valueColumn());
+}
+
+void
+CQChartsSunburstLodObj::
+draw(PaintDevice *device) const
+{
+  bool updateState = device->isInteractive();
+
+  auto colorInd = calcColorInd();
+
+  device->setColorNames();
+
+  // draw each node as filled arc segment, skipping segments with same pixel mid points
+  using PixelKey = std::tuple<int, int, int, int>;
+
+  std::set<PixelKey> points;
+
+  int n = int(nodes_.size());
+
+  for (int i = 0; i < n; ++i) {
+    auto *node = nodes_[size_t(i)];
+
+    double r1 = node->r();
+    double r2 = radii_[size_t(i)];
+
+    auto a1 = node->a();
+    auto da = node->da();
+
+    auto am = a1 + Angle(da.value()/2.0);
+
+    auto pm1 = plot_->windowToPixel(Angle::circlePoint(Point(0, 0), r1, am));
+    auto pm2 = plot_->windowToPixel(Angle::circlePoint(Point(0, 0), r2, am));
+
+    if (! points.insert(PixelKey(int(pm1.x), int(pm1.y), int(pm2.x), int(pm2.y))).second)
+      continue;
+
+    //---
+
+    auto c = nodeColor(node, colorInd);
+
+    PenBrush penBrush;
+
+    plot_->setPenBrush(penBrush, PenData(true, c, plot_->fillAlpha()), plot_->brushData(c));
+
+    if (updateState)
+      plot_->updateObjPenBrushState(this, penBrush);
+
+    CQChartsDrawUtil::setPenBrush(device, penBrush);
+
+    BBox ibbox(-r1, -r1, r1, r1);
+    BBox obbox(-r2, -r2, r2, r2);
+
+    QPainterPath path;
+
+    if (r1 > 0.0)
+      CQChartsDrawUtil::arcSegmentPath(path, ibbox, obbox, a1, da);
+    else
+      CQChartsDrawUtil::arcPath(path, obbox, a1, da);
+
+    device->drawPath(path);
+  }
+
+  device->resetColorNames();
+}
+
+QColor
+CQChartsSunburstLodObj::
+nodeColor(Node *node, const ColorInd &colorInd) const
+{
+  // use color of first leaf for sub-tree (blending all leaf colors is too slow for large trees)
+  auto *node1 = node;
+
+  auto *hier = dynamic_cast<HierNode *>(node1);
+
+  while (hier) {
+    if      (hier->hasNodes())
+      node1 = hier->getNodes()[0];
+    else if (hier->hasChildren())
+      node1 = hier->getChildren()[0];
+    else
+      break;
+
+    hier = dynamic_cast<HierNode *>(node1);
+  }
+
+  if (! plot_->isFilled())
+    return plot_->interpStrokeColor(colorInd);
+
+  return node1->interpColor(plot_, plot_->fillColor(), colorInd, plot_->numColorIds());
+}
+
+//------
+
 CQChartsSunburstHierNode::
 CQChartsSunburstHierNode(const Plot *plot, HierNode *parent, const QString &name) :
  CQChartsSunburstNode(plot, parent, name)
@@ -1803,45 +2125,43 @@ setPosition(double r, const Angle &a, double dr, const Angle &da)
   placed_ = true;
 }
 
-#if 0
 bool
 CQChartsSunburstNode::
-pointInside(double x, double y)
+pointInside(const Point &p, double r1, double r2) const
 {
-  if (! placed_) return false;
+  Point c(0, 0);
+
+  double r = p.distanceTo(c);
 
-  double r = std::hypoy(x, y);
+  if (r < r1 || r > r2)
+    return false;
 
-  if (r < r_ || r > r_ + dr_) return false;
+  //---
 
-  double a = CMathUtil::normalizeAngle(CMathUtil::Rad2Deg(std::atan2(y, x)));
+  // check angle
+  double a = CMathUtil::Rad2Deg(CQChartsGeom::pointAngle(c, p)); while (a < 0) a += 360.0;
 
-  double a1 = CMathUtil::normalizeAngle(a_.value());
+  double a1 = a_.value();
   double a2 = a1 + da_.value();
 
-  if (a2 > a1) {
-    if (a2 >= 360.0) {
-      double da = a2 - 360.0; a -= da; a1 -= da; a2 = 360.0;
-      a = CMathUtil::normalizeAngle(a);
-    }
+  while (a1 < 0) a1 += 360.0;
+  while (a2 < 0) a2 += 360.0;
 
-    if (a < a1 || a > a2)
-      return false;
+  if (a1 > a2) {
+    // crosses zero
+    if (a >= 0 && a <= a2)
+      return true;
+
+    if (a <= 360 && a >= a1)
+      return true;
   }
   else {
-    if (a2 < 0.0) {
-      double da = -a2; a += da; a1 += da; a2 = 0.0;
-
-      a = CMathUtil::normalizeAngle(a);
-    }
-
-    if (a < a2 || a > a1)
-      return false;
+    if (a >= a1 && a <= a2)
+      return true;
   }
 
-  return true;
+  return false;
 }
-#endif
 
 QColor
 CQChartsSunburstNode::
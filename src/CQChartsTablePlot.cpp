@@ -235,6 +235,16 @@ vscrollSlot(int v)
 {
   scrollData_.vpos = v;
 
+  // reuse row and cell objects for new rows if visible rows have no objects
+  if (isVirtualized()) {
+    int row1, row2;
+
+    calcVirtualRows(0, row1, row2);
+
+    if (row1 < virtualData_.row1 || row2 > virtualData_.row2)
+      recycleObjs();
+  }
+
   drawObjs();
 }
 
@@ -567,6 +577,31 @@ setFollowView(bool b)
 
 //---
 
+void
+CQChartsTablePlot::
+setVirtualized(bool b)
+{
+  CQChartsUtil::testAndSet(virtualData_.enabled, b, [&]() { updateRangeAndObjs(); } );
+}
+
+void
+CQChartsTablePlot::
+setVirtualMargin(int i)
+{
+  CQChartsUtil::testAndSet(virtualData_.margin, std::max(i, 0), [&]() { updateObjs(); } );
+}
+
+void
+CQChartsTablePlot::
+setWidthSamples(int i)
+{
+  CQChartsUtil::testAndSet(virtualData_.samples, std::max(i, 1), [&]() {
+    if (isVirtualized()) updateRangeAndObjs();
+  } );
+}
+
+//---
+
 void
 CQChartsTablePlot::
 addProperties()
@@ -609,6 +644,13 @@ addProperties()
   addProp("options", "rowColumn" , "rowColumn" , "Display row number column");
   addProp("options", "followView", "followView", "Follow view");
 
+  // virtualized
+  addProp("virtualized", "virtualized"  , "enabled", "Only create objects for visible rows");
+  addProp("virtualized", "virtualMargin", "margin" ,
+          "Rows above and below visible rows to create objects for")->setMinValue(0);
+  addProp("virtualized", "widthSamples" , "samples",
+          "Number of sampled rows for column widths")->setMinValue(1);
+
   addStyleProp("options", "indent"    , "indent"    , "Hierarchical row indent")->setMinValue(0.0);
   addStyleProp("options", "cellMargin", "cellMargin", "Cell margin")->setMinValue(0);
 }
@@ -726,10 +768,13 @@ calcTableSize() const
   //---
 
   // update column widths and number of visible rows
+  //
+  // when virtualized only every stride'th row is measured and column widths are
+  // estimated from a histogram of the sampled widths
   class RowVisitor : public ModelVisitor {
    public:
-    RowVisitor(const CQChartsTablePlot *plot, TableData &tableData) :
-     plot_(plot), tableData_(tableData), fm_(tableData_.font) {
+    RowVisitor(const CQChartsTablePlot *plot, TableData &tableData, int stride) :
+     plot_(plot), tableData_(tableData), fm_(tableData_.font), stride_(stride) {
     }
 
     // process hier row
@@ -761,11 +806,34 @@ calcTableSize() const
     }
 
     // process leaf row
-    State visit(const QAbstractItemModel *, const VisitData &data) override {
+    State visit(const QAbstractItemModel *model, const VisitData &data) override {
       if (! expanded_) return State::SKIP;
 
+      if (data.vrow % stride_ != 0) return State::OK;
+
       //---
 
+      measureRow(model, data);
+
+      return State::OK;
+    }
+
+    // process every stride'th row of flat model (no visit of skipped rows)
+    void visitRows(const QAbstractItemModel *model) {
+      for (int r = 0; r < tableData_.nr; r += stride_) {
+        if (plot_->isInterrupt())
+          break;
+
+        VisitData data;
+
+        data.row  = r;
+        data.vrow = r;
+
+        measureRow(model, data);
+      }
+    }
+
+    void measureRow(const QAbstractItemModel *model, const VisitData &data) {
       for (int i = 0; i < tableData_.nc; ++i) {
         const auto &c = plot_->columns().getColumn(i);
 
@@ -773,7 +841,7 @@ calcTableSize() const
 
         bool ok;
 
-        auto str = plot_->modelString(const_cast<QAbstractItemModel *>(model_), ind,
+        auto str = plot_->modelString(const_cast<QAbstractItemModel *>(model), ind,
                                       Qt::DisplayRole, ok);
         if (! ok) continue;
 
@@ -784,32 +852,81 @@ calcTableSize() const
         if (i == 0)
           cw += tableData_.maxDepth*plot_->indent(); // add hierarchical indent
 
-        data.pwidth = std::max(data.pwidth, cw);
+        if (stride_ > 1)
+          ++widthHist_[c][int(cw/binWidth())];
+        else
+          data.pwidth = std::max(data.pwidth, cw);
       }
+    }
 
-      return State::OK;
+    // set sampled column widths to histogram percentile (text is clipped to cell)
+    void updateSampledWidths(double percentile) {
+      for (const auto &pc : widthHist_) {
+        const auto &hist = pc.second;
+
+        int n = 0;
+
+        for (const auto &pb : hist)
+          n += pb.second;
+
+        int n1 = int(std::ceil(percentile*n));
+        int nb = 0;
+
+        for (const auto &pb : hist) {
+          nb += pb.second;
+
+          if (nb >= n1) {
+            auto &data = tableData_.columnDataMap[pc.first];
+
+            data.pwidth = std::max(data.pwidth, (pb.first + 1)*binWidth());
+            break;
+          }
+        }
+      }
     }
 
+    static double binWidth() { return 4.0; }
+
    private:
+    using WidthHist       = std::map<int, int>;
+    using ColumnWidthHist = std::map<Column, WidthHist>;
+
     const CQChartsTablePlot* plot_   { nullptr };
     TableData&               tableData_;
     QFontMetricsF            fm_;
+    int                      stride_   { 1 };
     bool                     expanded_ { true };
     std::vector<int>         expandStack_;
+    ColumnWidthHist          widthHist_;
   };
 
-  RowVisitor visitor(this, th->tableData_);
+  int stride = 1;
+
+  if (isVirtualized())
+    stride = std::max(tableData_.nr/widthSamples(), 1);
+
+  RowVisitor visitor(this, th->tableData_, stride);
 
   visitor.setPlot(this);
 
   //visitor.init();
 
-  if (summaryModel_)
-    CQChartsModelVisit::exec(charts(), summaryModel_, visitor);
-  else
-    CQChartsModelVisit::exec(charts(), model().data(), visitor);
+  if (isDirectRowVisit()) {
+    // visit row is model row so only visit sampled rows
+    visitor.visitRows(summaryModel_ ? summaryModel_ : model().data());
 
-  th->tableData_.nvr = visitor.numProcessedRows();
+    th->tableData_.nvr = tableData_.nr;
+  }
+  else {
+    if (summaryModel_)
+      CQChartsModelVisit::exec(charts(), summaryModel_, visitor);
+    else
+      CQChartsModelVisit::exec(charts(), model().data(), visitor);
+
+    th->tableData_.nvr = visitor.numProcessedRows();
+  }
+
+  visitor.updateSampledWidths(0.99);
 
   //---
 
@@ -1186,6 +1303,10 @@ initDrawData() const
   th->rowObjMap_   .clear();
   th->cellObjMap_  .clear();
 
+  // new objects so no saved selection
+  th->virtualData_.selectedRows .clear();
+  th->virtualData_.selectedCells.clear();
+
   //---
 
   th->tableData_.hrh = pixelToWindowHeight(th->tableData_.phrh);
@@ -1508,10 +1629,23 @@ createTableObjData() const
 
   //---
 
+  auto *th = const_cast<CQChartsTablePlot *>(this);
+
+  // rows to create objects for
+  if (isVirtualized())
+    calcVirtualRows(virtualMargin(), th->virtualData_.row1, th->virtualData_.row2);
+  else {
+    th->virtualData_.row1 = 0;
+    th->virtualData_.row2 = tableData_.nvr - 1;
+  }
+
+  //---
+
   class RowVisitor : public ModelVisitor {
    public:
-    RowVisitor(const CQChartsTablePlot *plot, const TableData &tableData_) :
-     plot_(plot), tableData_(tableData_) {
+    RowVisitor(const CQChartsTablePlot *plot, const QAbstractItemModel *model,
+               const TableData &tableData_, int row1, int row2) :
+     plot_(plot), rowModel_(model), tableData_(tableData_), row1_(row1), row2_(row2) {
       xm_ = plot_->pixelToWindowWidth(tableData_.pmargin);
       xd_ = plot_->pixelToWindowWidth(plot_->indent());
     }
@@ -1530,26 +1664,10 @@ createTableObjData() const
 
       //---
 
-    //const double y = tableData_.yo + (tableData_.nvr - data.vrow)*tableData_.rh - tableData_.hrh;
-      const double y = tableData_.yo + (tableData_.nvr - data.vrow - 1)*tableData_.rh;
-
-      double x = tableData_.xo;
-
-      //---
-
-      // draw line number
-      if (plot_->isRowColumn()) {
-        const auto &cdata = tableData_.rowColumnData;
-
-        drawRowNumber(x, y, data.vrow + 1);
+      if (data.vrow > row2_) return State::TERMINATE;
 
-        x += cdata.drawWidth;
-      }
-
-      //---
-
-      // draw cell values
-      drawCellValues(x, y, data);
+      if (data.vrow >= row1_)
+        drawRow(data);
 
       //---
 
@@ -1589,6 +1707,32 @@ createTableObjData() const
 
       //---
 
+      if (data.vrow > row2_) return State::TERMINATE;
+
+      if (data.vrow >= row1_)
+        drawRow(data);
+
+      //---
+
+      return State::OK;
+    }
+
+    // draw rows of flat model (visit row is model row so start at first row)
+    void visitRows() {
+      if (plot_->isHeaderVisible() && tableData_.nvr > 0)
+        drawHeader();
+
+      for (int r = row1_; r <= row2_; ++r) {
+        VisitData data;
+
+        data.row  = r;
+        data.vrow = r;
+
+        drawRow(data);
+      }
+    }
+
+    void drawRow(const VisitData &data) {
     //const double y = tableData_.yo + (tableData_.nvr - data.vrow)*tableData_.rh - tableData_.hrh;
       const double y = tableData_.yo + (tableData_.nvr - data.vrow - 1)*tableData_.rh;
 
@@ -1609,10 +1753,6 @@ createTableObjData() const
 
       // draw cell values
       drawCellValues(x, y, data);
-
-      //---
-
-      return State::OK;
     }
 
     void drawHeader() {
@@ -1645,7 +1785,7 @@ createTableObjData() const
 
         bool ok;
 
-        auto str = CQChartsModelUtil::modelHHeaderString(model_, c, ok);
+        auto str = CQChartsModelUtil::modelHHeaderString(rowModel_, c, ok);
         if (! ok) continue;
 
         //---
@@ -1706,7 +1846,7 @@ createTableObjData() const
 
       bool ok;
 
-      auto str = plot_->modelString(const_cast<QAbstractItemModel *>(model_), ind,
+      auto str = plot_->modelString(const_cast<QAbstractItemModel *>(rowModel_), ind,
                                     Qt::DisplayRole, ok);
       if (! ok) str.clear();
 
@@ -1747,24 +1887,181 @@ createTableObjData() const
     }
 
    private:
-    const CQChartsTablePlot* plot_     { nullptr };
-    TableData                tableData_;
-    double                   xm_       { 0.0 };
-    double                   xd_       { 0.0 };
-    bool                     expanded_ { true };
-    std::vector<int>         expandStack_;
+    const CQChartsTablePlot*  plot_     { nullptr };
+    const QAbstractItemModel* rowModel_ { nullptr };
+    TableData                 tableData_;
+    int                       row1_     { 0 };
+    int                       row2_     { 0 };
+    double                    xm_       { 0.0 };
+    double                    xd_       { 0.0 };
+    bool                      expanded_ { true };
+    std::vector<int>          expandStack_;
   };
 
-  RowVisitor visitor(this, tableData_);
+  const QAbstractItemModel *model = summaryModel_;
+
+  if (! model)
+    model = this->model().data();
+
+  RowVisitor visitor(this, model, tableData_, virtualData_.row1, virtualData_.row2);
 
   visitor.setPlot(this);
 
   //visitor.init();
 
-  if (summaryModel_)
-    CQChartsModelVisit::exec(charts(), summaryModel_, visitor);
+  if (isDirectRowVisit())
+    visitor.visitRows();
   else
-    CQChartsModelVisit::exec(charts(), model().data(), visitor);
+    CQChartsModelVisit::exec(charts(), model, visitor);
+}
+
+void
+CQChartsTablePlot::
+calcVirtualRows(int margin, int &row1, int &row2) const
+{
+  auto pixelRect = calcTablePixelRect();
+
+  double ph = pixelRect.getHeight();
+  double py = scrollData_.vpos;
+
+  if (isHeaderVisible()) {
+    ph -= tableData_.phrh;
+    py -= tableData_.phrh;
+  }
+
+  double prh = std::max(tableData_.prh, 1.0);
+
+  // visible rows plus margin above and below (same number of rows for all scroll
+  // positions so scrolled rows can reuse all objects)
+  int nr = int(std::ceil(std::max(ph, 0.0)/prh)) + 1 + 2*margin;
+
+  int r1 = int(std::floor(std::max(py, 0.0)/prh)) - margin;
+
+  row1 = std::max(std::min(r1, tableData_.nvr - nr), 0);
+  row2 = std::min(row1 + nr, tableData_.nvr) - 1;
+}
+
+bool
+CQChartsTablePlot::
+isDirectRowVisit() const
+{
+  // hierarchical rows must be visited (visit row depends on expanded state)
+  if (! summaryModel_ && tableData_.maxDepth > 0)
+    return false;
+
+  // filtered rows must be visited (visit row is not model row)
+  return isModelRowsUnfiltered();
+}
+
+void
+CQChartsTablePlot::
+recycleObjs()
+{
+  CQPerfTrace trace("CQChartsTablePlot::recycleObjs");
+
+  //---
+
+  // objects are being (re)created so full update for new rows
+  if (! isReady())
+    return updateObjs();
+
+  //---
+
+  // reuse objects for new rows (full update if not enough objects)
+  if (! recycleObjData())
+    updateObjs();
+}
+
+bool
+CQChartsTablePlot::
+recycleObjData()
+{
+  // stop draw thread while objects are changed (restarted by caller's drawObjs)
+  LockMutex lock(this, "recycleObjData");
+
+  interruptDraw();
+
+  //---
+
+  // get existing row and cell objects and save selection of their rows
+  std::vector<RowObj *>  rowObjs;
+  std::vector<CellObj *> cellObjs;
+
+  auto &selectedRows  = virtualData_.selectedRows;
+  auto &selectedCells = virtualData_.selectedCells;
+
+  for (auto *plotObj : plotObjects()) {
+    auto *rowObj  = dynamic_cast<RowObj  *>(plotObj);
+    auto *cellObj = dynamic_cast<CellObj *>(plotObj);
+
+    if      (rowObj) {
+      rowObjs.push_back(rowObj);
+
+      if (! rowObj->isVisible()) continue;
+
+      int r = rowObj->rowObjData().r;
+
+      if (rowObj->isSelected()) selectedRows.insert(r);
+      else                      selectedRows.erase (r);
+    }
+    else if (cellObj) {
+      cellObjs.push_back(cellObj);
+
+      if (! cellObj->isVisible()) continue;
+
+      auto modelInd = modelIndex(cellObj->cellObjData().ind);
+
+      if (cellObj->isSelected()) selectedCells.insert(modelInd);
+      else                       selectedCells.erase (modelInd);
+    }
+  }
+
+  //---
+
+  // create row and cell data for new rows
+  rowObjMap_ .clear();
+  cellObjMap_.clear();
+
+  createTableObjData();
+
+  // not enough objects so full update
+  if (rowObjMap_.size() > rowObjs.size() || cellObjMap_.size() > cellObjs.size())
+    return false;
+
+  //---
+
+  // move new data (and saved selection) into existing objects and hide unused objects
+  size_t ir = 0;
+
+  for (const auto &pr : rowObjMap_) {
+    bool selected = (selectedRows.find(pr.first) != selectedRows.end());
+
+    rowObjs[ir++]->setRowObjData(pr.second, /*visible*/true, selected);
+  }
+
+  for ( ; ir < rowObjs.size(); ++ir)
+    rowObjs[ir]->setRowObjData(rowObjs[ir]->rowObjData(), /*visible*/false, /*selected*/false);
+
+  size_t ic = 0;
+
+  for (const auto &pc : cellObjMap_) {
+    bool selected = (selectedCells.find(pc.first) != selectedCells.end());
+
+    cellObjs[ic++]->setCellObjData(pc.second, /*visible*/true, selected);
+  }
+
+  for ( ; ic < cellObjs.size(); ++ic)
+    cellObjs[ic]->setCellObjData(cellObjs[ic]->cellObjData(), /*visible*/false,
+                                 /*selected*/false);
+
+  //---
+
+  invalidateObjTree();
+
+  // objects have new rows
+  buildSelectRowIndex();
+
+  return true;
 }
 
 CQChartsTablePlot::HeaderObjData &
@@ -2139,6 +2436,21 @@ CQChartsTableRowObj(const Plot *plot, const Plot::RowObjData &rowObjData) :
 {
 }
 
+void
+CQChartsTableRowObj::
+setRowObjData(const Plot::RowObjData &rowObjData, bool visible, bool selected)
+{
+  rowObjData_ = rowObjData;
+
+  rect_     = rowObjData_.rect;
+  visible_  = visible;
+  inside_   = false;
+  selected_ = selected;
+
+  id_    = OptString();
+  tipId_ = OptString();
+}
+
 QString
 CQChartsTableRowObj::
 calcId() const
@@ -2230,6 +2542,21 @@ CQChartsTableCellObj(const Plot *plot, const Plot::CellObjData &cellObjData) :
 {
 }
 
+void
+CQChartsTableCellObj::
+setCellObjData(const Plot::CellObjData &cellObjData, bool visible, bool selected)
+{
+  cellObjData_ = cellObjData;
+
+  rect_     = cellObjData_.rect;
+  visible_  = visible;
+  inside_   = false;
+  selected_ = selected;
+
+  id_    = OptString();
+  tipId_ = OptString();
+}
+
 QString
 CQChartsTableCellObj::
 calcId() const
@@ -0,0 +1,397 @@
+#include <CQChartsTextCache.h>
+#include <CQChartsDrawUtil.h>
+#include <CQChartsUtil.h>
+
+#include <QFontMetricsF>
+
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+using Clock     = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+}
+
+//---
+
+//! cached values for font (shard with its own lock and stats)
+struct CQChartsTextCache::FontCache {
+  using Widths    = QHash<QString, double>;
+  using Sizes     = QHash<QString, Size>;
+  using LinesList = QHash<QString, QStringList>;
+  using Mutex     = std::shared_timed_mutex;
+
+  //! stats (atomic as hits are added with shared lock)
+  struct StatData {
+    std::atomic<long> hits     { 0 };
+    std::atomic<long> misses   { 0 };
+    std::atomic<long> missTime { 0 }; // ns
+  };
+
+  QFont            font;      //!< font
+  FontData         fontData;  //!< font metrics (set on creation)
+  Widths           widths;    //!< text widths
+  Sizes            htmlSizes; //!< html text sizes (key is margin and text)
+  LinesList        formats;   //!< formatted lines (key is seps, rect size and text)
+  mutable StatData statData[int(StatType::NUM_TYPES)]; //!< stats per value type
+  mutable Mutex    mutex;     //!< values lock
+
+  int numValues() const { return widths.size() + htmlSizes.size() + formats.size(); }
+
+  void clear() { widths.clear(); htmlSizes.clear(); formats.clear(); }
+
+  void addHit(const StatType &type) const {
+    statData[int(type)].hits.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void addMiss(const StatType &type, const TimePoint &t) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t).count();
+
+    auto &statData = this->statData[int(type)];
+
+    statData.misses  .fetch_add(1       , std::memory_order_relaxed);
+    statData.missTime.fetch_add(long(ns), std::memory_order_relaxed);
+  }
+
+  //! find value (shared lock)
+  template<typename HASH, typename T>
+  bool findValue(const StatType &type, const HASH &hash, const QString &key, T &value) const {
+    std::shared_lock<Mutex> lock(mutex);
+
+    auto p = hash.find(key);
+    if (p == hash.end()) return false;
+
+    value = p.value();
+
+    addHit(type);
+
+    return true;
+  }
+
+  //! add measured value (exclusive lock, values cleared if too many)
+  template<typename HASH, typename T>
+  void addValue(const StatType &type, HASH &hash, const QString &key, const T &value,
+                const TimePoint &t, int maxValues) {
+    addMiss(type, t);
+
+    std::unique_lock<Mutex> lock(mutex);
+
+    if (numValues() >= maxValues)
+      clear();
+
+    hash.insert(key, value);
+  }
+};
+
+//---
+
+CQChartsTextCache *
+CQChartsTextCache::
+instance()
+{
+  // used by draw threads so create once (thread safe static init)
+  static auto *instance = new CQChartsTextCache;
+
+  return instance;
+}
+
+CQChartsTextCache::
+CQChartsTextCache()
+{
+}
+
+CQChartsTextCache::
+~CQChartsTextCache()
+{
+}
+
+void
+CQChartsTextCache::
+setEnabled(bool b)
+{
+  enabled_ = b;
+
+  if (! enabled_)
+    clear();
+}
+
+//---
+
+CQChartsTextCache::FontCacheP
+CQChartsTextCache::
+fontCache(const QFont &font)
+{
+  if (! isEnabled())
+    return FontCacheP();
+
+  {
+  std::shared_lock<Mutex> lock(mutex_);
+
+  // const find as shared by reader threads
+  auto pf = fontCaches_.constFind(font);
+
+  if (pf != fontCaches_.constEnd()) {
+    pf.value()->addHit(StatType::FONT);
+
+    return pf.value();
+  }
+  }
+
+  //---
+
+  // measure font outside lock
+  auto t = Clock::now();
+
+  auto fontCache = std::make_shared<FontCache>();
+
+  fontCache->font = font;
+
+  QFontMetricsF fm(font);
+
+  fontCache->fontData.height  = fm.height ();
+  fontCache->fontData.ascent  = fm.ascent ();
+  fontCache->fontData.descent = fm.descent();
+
+  //---
+
+  std::unique_lock<Mutex> lock(mutex_);
+
+  // another thread may have added font
+  auto pf = fontCaches_.find(font);
+
+  if (pf != fontCaches_.end()) {
+    pf.value()->addHit(StatType::FONT);
+
+    return pf.value();
+  }
+
+  fontCache->addMiss(StatType::FONT, t);
+
+  if (fontCaches_.size() >= maxFonts()) {
+    for (const auto &fontCache1 : fontCaches_)
+      addRemovedStats(*fontCache1);
+
+    fontCaches_.clear();
+  }
+
+  fontCaches_.insert(font, fontCache);
+
+  return fontCache;
+}
+
+const CQChartsTextCache::FontData &
+CQChartsTextCache::
+fontData(const FontCacheP &fontCache)
+{
+  return fontCache->fontData;
+}
+
+double
+CQChartsTextCache::
+textWidth(const FontCacheP &fontCache, const QString &text)
+{
+  double w = 0.0;
+
+  if (fontCache->findValue(StatType::WIDTH, fontCache->widths, text, w))
+    return w;
+
+  //---
+
+  auto t = Clock::now();
+
+  QFontMetricsF fm(fontCache->font);
+
+  w = fm.horizontalAdvance(text);
+
+  fontCache->addValue(StatType::WIDTH, fontCache->widths, text, w, t, maxValues());
+
+  return w;
+}
+
+CQChartsGeom::Size
+CQChartsTextCache::
+htmlTextSize(const QString &text, const QFont &font, int margin)
+{
+  auto fontCache = this->fontCache(font);
+
+  if (! fontCache)
+    return CQChartsDrawPrivate::calcHtmlTextSize(text, font, margin);
+
+  auto key = QString::number(margin) + QChar('\0') + text;
+
+  Size size;
+
+  if (fontCache->findValue(StatType::HTML, fontCache->htmlSizes, key, size))
+    return size;
+
+  //---
+
+  auto t = Clock::now();
+
+  size = CQChartsDrawPrivate::calcHtmlTextSize(text, font, margin);
+
+  fontCache->addValue(StatType::HTML, fontCache->htmlSizes, key, size, t, maxValues());
+
+  return size;
+}
+
+QStringList
+CQChartsTextCache::
+formatStringInRect(const QString &text, const QFont &font, const BBox &rect,
+                   const QString &seps)
+{
+  auto formatString = [&]() {
+    QStringList strs;
+
+    CQChartsUtil::formatStringInRect(text, font, rect, strs, CQChartsUtil::FormatData(seps));
+
+    return strs;
+  };
+
+  auto fontCache = this->fontCache(font);
+
+  if (! fontCache)
+    return formatString();
+
+  auto key = seps + QChar('\0') + QString::number(rect.getWidth()) + "," +
+             QString::number(rect.getHeight()) + QChar('\0') + text;
+
+  QStringList strs;
+
+  if (fontCache->findValue(StatType::FORMAT, fontCache->formats, key, strs))
+    return strs;
+
+  //---
+
+  auto t = Clock::now();
+
+  strs = formatString();
+
+  fontCache->addValue(StatType::FORMAT, fontCache->formats, key, strs, t, maxValues());
+
+  return strs;
+}
+
+//---
+
+CQChartsTextCache::Stats
+CQChartsTextCache::
+stats() const
+{
+  std::shared_lock<Mutex> lock(mutex_);
+
+  // sum stats of removed and current fonts
+  StatData statData[int(StatType::NUM_TYPES)];
+
+  for (int i = 0; i < int(StatType::NUM_TYPES); ++i)
+    statData[i] = removedStats_[i];
+
+  Stats stats;
+
+  for (const auto &fontCache : fontCaches_) {
+    for (int i = 0; i < int(StatType::NUM_TYPES); ++i) {
+      const auto &fontStatData = fontCache->statData[i];
+
+      statData[i].hits     += fontStatData.hits;
+      statData[i].misses   += fontStatData.misses;
+      statData[i].missTime += double(fontStatData.missTime)/1E6;
+    }
+
+    std::shared_lock<Mutex> fontLock(fontCache->mutex);
+
+    stats.numValues += fontCache->numValues();
+  }
+
+  stats.numFonts = fontCaches_.size();
+
+  for (const auto &statData1 : statData) {
+    stats.hits     += statData1.hits;
+    stats.misses   += statData1.misses;
+    stats.missTime += statData1.missTime;
+
+    // estimate saved time from average miss time of value type
+    if (statData1.misses > 0)
+      stats.savedTime += statData1.hits*statData1.missTime/double(statData1.misses);
+  }
+
+  return stats;
+}
+
+void
+CQChartsTextCache::
+resetStats()
+{
+  std::unique_lock<Mutex> lock(mutex_);
+
+  for (auto &statData : removedStats_)
+    statData = StatData();
+
+  for (const auto &fontCache : fontCaches_) {
+    for (auto &statData : fontCache->statData) {
+      statData.hits     = 0;
+      statData.misses   = 0;
+      statData.missTime = 0;
+    }
+  }
+}
+
+void
+CQChartsTextCache::
+clear()
+{
+  std::unique_lock<Mutex> lock(mutex_);
+
+  for (const auto &fontCache : fontCaches_)
+    addRemovedStats(*fontCache);
+
+  fontCaches_.clear();
+}
+
+void
+CQChartsTextCache::
+addRemovedStats(const FontCache &fontCache)
+{
+  for (int i = 0; i < int(StatType::NUM_TYPES); ++i) {
+    const auto &fontStatData = fontCache.statData[i];
+
+    removedStats_[i].hits     += fontStatData.hits;
+    removedStats_[i].misses   += fontStatData.misses;
+    removedStats_[i].missTime += double(fontStatData.missTime)/1E6;
+  }
+}
+
+//------
+
+CQChartsFontMetrics::
+CQChartsFontMetrics(const QFont &font) :
+ font_(font)
+{
+  fontCache_ = CQChartsTextCacheInst->fontCache(font_);
+
+  if (fontCache_)
+    fontData_ = TextCache::fontData(fontCache_);
+  else {
+    fm_ = std::make_shared<QFontMetricsF>(font_);
+
+    fontData_.height  = fm_->height ();
+    fontData_.ascent  = fm_->ascent ();
+    fontData_.descent = fm_->descent();
+  }
+}
+
+CQChartsFontMetrics::
+~CQChartsFontMetrics()
+{
+}
+
+double
+CQChartsFontMetrics::
+horizontalAdvance(const QString &text) const
+{
+  if (fontCache_)
+    return CQChartsTextCacheInst->textWidth(fontCache_, text);
+
+  return fm_->horizontalAdvance(text);
+}
@@ -7,6 +7,7 @@
 #include <CQChartsViewPlotPaintDevice.h>
 #include <CQChartsWidgetUtil.h>
 #include <CQChartsHtml.h>
+#include <CQChartsParallel.h>
 
 #include <CQPropertyViewItem.h>
 #include <CQPerfMonitor.h>
@@ -14,6 +15,8 @@
 #include <QMenu>
 #include <QCheckBox>
 
+#include <set>
+
 CQChartsTreeMapPlotType::
 CQChartsTreeMapPlotType()
 {
@@ -257,6 +260,22 @@ setMinArea(const Area &a)
 
 //----
 
+void
+CQChartsTreeMapPlot::
+setLod(bool b)
+{
+  CQChartsUtil::testAndSet(lodData_.enabled, b, [&]() { updateLayout(); } );
+}
+
+void
+CQChartsTreeMapPlot::
+setLodSize(double s)
+{
+  CQChartsUtil::testAndSet(lodData_.size, s, [&]() { updateLayout(); } );
+}
+
+//----
+
 void
 CQChartsTreeMapPlot::
 setColorById(bool b)
@@ -305,6 +324,10 @@ addProperties()
   // filter
   addProp("filter", "minArea", "", "Min box area");
 
+  // level of detail
+  addProp("lod", "lod"    , "enabled", "Aggregate small and out of view nodes");
+  addProp("lod", "lodSize", "size"   , "Min pixel size of node object");
+
   // margins
   addProp("margins", "marginWidth", "box", "Margin size for tree map boxes");
 
@@ -420,7 +443,7 @@ updateCurrentRoot()
 {
   //replaceNodes();
 
-  updateObjs();
+  updateLayout();
 }
 
 CQChartsGeom::Range
@@ -429,6 +452,9 @@ calcRange() const
 {
   CQPerfTrace trace("CQChartsTreeMapPlot::calcRange");
 
+  // range update (data or column change) needs nodes reloaded
+  const_cast<CQChartsTreeMapPlot *>(this)->nodesValid_ = false;
+
   Range dataRange;
 
   double r = 1.0;
@@ -445,11 +471,30 @@ void
 CQChartsTreeMapPlot::
 clearPlotObjects()
 {
-  resetNodes();
+  // keep loaded nodes (and their cached layouts) for layout only update
+  if (! nodesValid_)
+    resetNodes();
 
   CQChartsPlot::clearPlotObjects();
 }
 
+void
+CQChartsTreeMapPlot::
+updateObjs()
+{
+  // general object update (columns, colors, ...) so reload nodes
+  nodesValid_ = false;
+
+  CQChartsHierPlot::updateObjs();
+}
+
+void
+CQChartsTreeMapPlot::
+updateLayout()
+{
+  CQChartsHierPlot::updateObjs();
+}
+
 bool
 CQChartsTreeMapPlot::
 createObjs(PlotObjs &objs) const
@@ -493,6 +538,8 @@ createObjs(PlotObjs &objs) const
   else
     replaceNodes();
 
+  th->nodesValid_ = true;
+
   //---
 
   th->initColorIds();
@@ -504,6 +551,8 @@ createObjs(PlotObjs &objs) const
   ig_ = 0;
   in_ = 0;
 
+  initLod();
+
   if (currentRoot())
     initNodeObjs(currentRoot(), nullptr, 0, objs);
 
@@ -525,6 +574,12 @@ createObjs(PlotObjs &objs) const
 
       nodeObj->setIv(ColorInd(nodeObj->ind(), in_));
     }
+    else {
+      auto *lodObj = dynamic_cast<LodObj *>(obj);
+
+      if (lodObj && lodObj->parent())
+        lodObj->setIg(ColorInd(lodObj->parent()->ind(), ig_));
+    }
   }
 
   //---
@@ -561,8 +616,20 @@ initNodeObjs(HierNode *hier, HierObj *parentObj, int depth, PlotObjs &objs) cons
 
   //---
 
-  for (auto &hierNode : hier->getChildren())
+  // small and out of view sub-trees and nodes are added to single level of detail object
+  Nodes lodNodes;
+
+  for (auto &hierNode : hier->getChildren()) {
+    if (isLodNode(hierNode)) {
+      lodNodes.push_back(hierNode);
+
+      in_ += hierNode->numLeaves();
+
+      continue;
+    }
+
     initNodeObjs(hierNode, hierObj, depth + 1, objs);
+  }
 
   //---
 
@@ -579,6 +646,14 @@ initNodeObjs(HierNode *hier, HierObj *parentObj, int depth, PlotObjs &objs) cons
   for (auto &node : hier->getNodes()) {
     if (! node->placed()) continue;
 
+    if (isLodNode(node)) {
+      lodNodes.push_back(node);
+
+      ++in_;
+
+      continue;
+    }
+
     //---
 
     BBox rect(node->x(), node->y(), node->x() + node->w(), node->y() + node->h());
@@ -600,6 +675,102 @@ initNodeObjs(HierNode *hier, HierObj *parentObj, int depth, PlotObjs &objs) cons
 
     ++in_;
   }
+
+  //---
+
+  if (! lodNodes.empty()) {
+    BBox rect;
+
+    for (auto &node : lodNodes)
+      rect += BBox(node->x(), node->y(), node->x() + node->w(), node->y() + node->h());
+
+    ColorInd is(hier->depth(), maxDepth() + 1);
+
+    auto *obj = createLodObj(hier, hierObj, lodNodes, rect, is);
+
+    connect(obj, SIGNAL(dataChanged()), this, SLOT(updateSlot()));
+
+    objs.push_back(obj);
+
+    for (auto &node : lodNodes)
+      numLodNodes_ += (node->isHier() ? static_cast<HierNode *>(node)->numLeaves() : 1);
+  }
+}
+
+void
+CQChartsTreeMapPlot::
+initLod() const
+{
+  // save scale and view rect (with margin for small pans) used to aggregate nodes
+  numLodNodes_ = 0;
+
+  lodScale_    = 0.0;
+  lodViewRect_ = BBox();
+
+  if (! isLod())
+    return;
+
+  lodScale_ = windowToPixelWidth(1.0);
+
+  auto vbbox = calcPlotViewRect();
+
+  if (vbbox.isValid())
+    lodViewRect_ = vbbox.expanded(-vbbox.getWidth()/2.0, -vbbox.getHeight()/2.0,
+                                   vbbox.getWidth()/2.0,  vbbox.getHeight()/2.0);
+}
+
+bool
+CQChartsTreeMapPlot::
+isLodNode(Node *node) const
+{
+  if (! isLod() || ! node->placed())
+    return false;
+
+  // aggregate if smaller than lod size
+  auto pw = windowToPixelWidth (node->w());
+  auto ph = windowToPixelHeight(node->h());
+
+  if (pw < lodSize() || ph < lodSize())
+    return true;
+
+  // aggregate sub-tree if out of view
+  if (node->isHier() && lodViewRect_.isValid()) {
+    BBox rect(node->x(), node->y(), node->x() + node->w(), node->y() + node->h());
+
+    if (! rect.overlaps(lodViewRect_))
+      return true;
+  }
+
+  return false;
+}
+
+bool
+CQChartsTreeMapPlot::
+isLodUpdate() const
+{
+  if (! isLod() || lodScale_ <= 0.0)
+    return false;
+
+  auto scale = windowToPixelWidth(1.0);
+
+  // zoomed out so more nodes can be aggregated
+  if (scale < lodScale_/4.0)
+    return true;
+
+  if (numLodNodes_ == 0)
+    return false;
+
+  // zoomed in so aggregated nodes may need objects
+  if (scale > 2.0*lodScale_)
+    return true;
+
+  // panned so aggregated (out of view) sub-trees may be visible
+  auto vbbox = calcPlotViewRect();
+
+  if (vbbox.isValid() && lodViewRect_.isValid() && ! lodViewRect_.inside(vbbox))
+    return true;
+
+  return false;
 }
 
 void
@@ -1312,7 +1483,20 @@ postResize()
 
   //replaceNodes();
 
-  updateObjs();
+  updateLayout();
+}
+
+void
+CQChartsTreeMapPlot::
+applyDataRangeAndDraw()
+{
+  CQChartsHierPlot::applyDataRangeAndDraw();
+
+  //---
+
+  // recreate objects if zoom/pan changes level of detail of visible nodes
+  if (isLodUpdate())
+    updateLayout();
 }
 
 //------
@@ -1437,6 +1621,14 @@ createNodeObj(Node *node, HierObj *hierObj, const BBox &rect, const ColorInd &is
   return new NodeObj(this, node, hierObj, rect, is);
 }
 
+CQChartsTreeMapLodObj *
+CQChartsTreeMapPlot::
+createLodObj(HierNode *hier, HierObj *hierObj, const Nodes &nodes,
+             const BBox &rect, const ColorInd &is) const
+{
+  return new LodObj(this, hier, hierObj, nodes, rect, is);
+}
+
 //---
 
 bool
@@ -1721,6 +1913,171 @@ calcPenBrush(PenBrush &penBrush, bool updateState) const
 
 //------
 
+CQChartsTreeMapLodObj::
+CQChartsTreeMapLodObj(const Plot *plot, HierNode *hier, HierObj *hierObj,
+                      const Nodes &nodes, const BBox &rect, const ColorInd &is) :
+ CQChartsPlotObj(const_cast<Plot *>(plot), rect, is, ColorInd(), ColorInd()),
+ plot_(plot), hier_(hier), hierObj_(hierObj), nodes_(nodes)
+{
+  for (auto &node : nodes_) {
+    if (! node->isHier() && node->ind().isValid())
+      addModelInd(node->ind());
+  }
+}
+
+int
+CQChartsTreeMapLodObj::
+numNodes() const
+{
+  int n = 0;
+
+  for (auto &node : nodes_)
+    n += (node->isHier() ? static_cast<HierNode *>(node)->numLeaves() : 1);
+
+  return n;
+}
+
+double
+CQChartsTreeMapLodObj::
+hierSize() const
+{
+  double size = 0.0;
+
+  for (auto &node : nodes_)
+    size += node->hierSize();
+
+  return size;
+}
+
+QString
+CQChartsTreeMapLodObj::
+calcId() const
+{
+  return QString("%1:%2:%3").arg(typeName()).arg(hier_->name()).arg(nodes_.size());
+}
+
+QString
+CQChartsTreeMapLodObj::
+calcTipId() const
+{
+  CQChartsTableTip tableTip;
+
+  tableTip.addTableRow("Name" , hier_->hierName());
+  tableTip.addTableRow("Nodes", numNodes());
+  tableTip.addTableRow("Size" , hierSize());
+
+  return tableTip.str();
+}
+
+bool
+CQChartsTreeMapLodObj::
+inside(const Point &p) const
+{
+  if (! hier_->isHierExpanded())
+    return false;
+
+  if (! rect().inside(p))
+    return false;
+
+  for (auto &node : nodes_) {
+    if (node->contains(p.x, p.y))
+      return true;
+  }
+
+  return false;
+}
+
+void
+CQChartsTreeMapLodObj::
+getObjSelectIndices(Indices &inds) const
+{
+  for (const auto &c : plot_->nameColumns())
+    addColumnSelectIndex(inds, c);
+
+  addColumnSelectIndex(inds, plot_->valueColumn());
+}
+
+void
+CQChartsTreeMapLodObj::
+draw(PaintDevice *device) const
+{
+  if (! hier_->isHierExpanded())
+    return;
+
+  //---
+
+  bool updateState = device->isInteractive();
+
+  auto colorInd = calcColorInd();
+
+  device->setColorNames();
+
+  // draw each node as filled box (or point if too small), skipping repeated pixel points
+  std::set<std::pair<int, int>> points;
+
+  for (auto &node : nodes_) {
+    auto p1 = plot_->windowToPixel(Point(node->x()            , node->y()            ));
+    auto p2 = plot_->windowToPixel(Point(node->x() + node->w(), node->y() + node->h()));
+
+    bool isNodePoint = (std::abs(p2.x - p1.x) <= 1.5 || std::abs(p2.y - p1.y) <= 1.5);
+
+    Point point;
+
+    if (isNodePoint) {
+      point = Point(CMathUtil::avg(p1.x, p2.x), CMathUtil::avg(p1.y, p2.y));
+
+      if (! points.insert(std::make_pair(int(point.x), int(point.y))).second)
+        continue;
+    }
+
+    //---
+
+    auto c = nodeColor(node, colorInd);
+
+    PenBrush penBrush;
+
+    plot_->setPenBrush(penBrush, PenData(true, c, plot_->fillAlpha()), plot_->brushData(c));
+
+    if (updateState)
+      plot_->updateObjPenBrushState(this, penBrush);
+
+    CQChartsDrawUtil::setPenBrush(device, penBrush);
+
+    if (isNodePoint)
+      device->drawPoint(plot_->pixelToWindow(point));
+    else
+      device->drawRect(plot_->pixelToWindow(BBox(p1, p2)));
+  }
+
+  device->resetColorNames();
+}
+
+QColor
+CQChartsTreeMapLodObj::
+nodeColor(Node *node, const ColorInd &colorInd) const
+{
+  // use color of first leaf for sub-tree (blending all leaf colors is too slow for large trees)
+  auto *node1 = node;
+
+  while (node1->isHier()) {
+    auto *hier = static_cast<HierNode *>(node1);
+
+    if      (hier->hasNodes())
+      node1 = hier->getNodes()[0];
+    else if (hier->hasChildren())
+      node1 = hier->getChildren()[0];
+    else
+      break;
+  }
+
+  if (! plot_->isFilled())
+    return plot_->interpStrokeColor(colorInd);
+
+  return node1->interpColor(plot_, plot_->fillColor(), colorInd, plot_->numColorIds());
+}
+
+//------
+
 CQChartsTreeMapNodeObj::
 CQChartsTreeMapNodeObj(const Plot *plot, Node *node, HierObj *hierObj,
                        const BBox &rect, const ColorInd &is) :
@@ -2131,19 +2488,64 @@ isHierExpanded() const
   return true;
 }
 
+void
+CQChartsTreeMapHierNode::
+setSize(double s)
+{
+  CQChartsTreeMapNode::setSize(s);
+
+  invalidateLayout();
+}
+
 double
 CQChartsTreeMapHierNode::
 hierSize() const
 {
-  double s = size();
+  if (! layoutData_.sizeValid) {
+    double s = size();
+    int    n = 0;
 
-  for (auto &child : children_)
-    s += child->hierSize();
+    for (auto &child : children_) {
+      s += child->hierSize();
+      n += child->numLeaves();
+    }
 
-  for (auto &node : nodes_)
-    s += node->hierSize();
+    for (auto &node : nodes_) {
+      s += node->hierSize();
+      ++n;
+    }
+
+    layoutData_.hierSize  = s;
+    layoutData_.numLeaves = n;
+    layoutData_.sizeValid = true;
+  }
 
-  return s;
+  return layoutData_.hierSize;
+}
+
+int
+CQChartsTreeMapHierNode::
+numLeaves() const
+{
+  (void) hierSize();
+
+  return layoutData_.numLeaves;
+}
+
+void
+CQChartsTreeMapHierNode::
+invalidateLayout()
+{
+  // only parents sizes and placements depend on this node's size
+  auto *hier = this;
+
+  while (hier) {
+    hier->layoutData_.sizeValid  = false;
+    hier->layoutData_.sortValid  = false;
+    hier->layoutData_.placeValid = false;
+
+    hier = hier->parent();
+  }
 }
 
 void
@@ -2151,6 +2553,8 @@ CQChartsTreeMapHierNode::
 addChild(HierNode *child)
 {
   children_.push_back(child);
+
+  invalidateLayout();
 }
 
 void
@@ -2175,6 +2579,8 @@ removeChild(HierNode *child)
     children_[i - 1] = children_[i];
 
   children_.pop_back();
+
+  invalidateLayout();
 }
 
 void
@@ -2210,8 +2616,97 @@ packNodes(double x, double y, double w, double h)
   double dh = (showTitle_ ? whh : 0.0);
   double m  = (w > wmw ? wmw : 0.0);
 
-  // make single list of nodes to pack
-  Nodes nodes;
+  // content rect
+  double cx = x + m/2;
+  double cy = y + m/2;
+  double cw = w - m;
+  double ch = h - dh - m;
+
+  //---
+
+  // make single list of nodes to pack sorted by size (largest to smallest)
+  initSortedNodes();
+
+  const auto &nodes = layoutData_.nodes;
+
+  auto n = int(nodes.size());
+  if (n == 0) return;
+
+  //---
+
+  // normalized layout only depends on sizes and content aspect so reuse if unchanged
+  double aspect = (ch > 0.0 ? cw/ch : 1.0);
+
+  if (! layoutData_.placeValid || std::abs(aspect - layoutData_.aspect) > 1E-6*aspect) {
+    layoutData_.rects.clear();
+    layoutData_.rects.resize(size_t(n));
+
+    packSubNodes(0.0, 0.0, aspect, 1.0, 0, n, layoutData_.rects);
+
+    // normalize x to 0-1
+    double ia = (aspect > 0.0 ? 1.0/aspect : 1.0);
+
+    for (auto &rect : layoutData_.rects) {
+      if (rect.isSet())
+        rect = BBox(rect.getXMin()*ia, rect.getYMin(), rect.getXMax()*ia, rect.getYMax());
+    }
+
+    layoutData_.aspect     = aspect;
+    layoutData_.placeValid = true;
+  }
+
+  //---
+
+  // remap normalized rects to content rect
+  auto placeNode = [&](int i) {
+    const auto &rect = layoutData_.rects[size_t(i)];
+    if (! rect.isSet()) return;
+
+    nodes[size_t(i)]->setPosition(cx + rect.getXMin()*cw, cy + rect.getYMin()*ch,
+                                  rect.getWidth()*cw, rect.getHeight()*ch);
+  };
+
+  // place large hierarchies in parallel (only at the top parallel level)
+  static const int minParallelLeaves = 10000;
+
+  static thread_local bool inParallel = false;
+
+  if (! inParallel && children_.size() > 1 && numLeaves() > minParallelLeaves) {
+    std::vector<int> hierInds;
+
+    for (int i = 0; i < n; ++i) {
+      if (nodes[size_t(i)]->isHier())
+        hierInds.push_back(i);
+      else
+        placeNode(i);
+    }
+
+    CQChartsParallel::forEach(int(hierInds.size()), [&](int i) {
+      bool inParallel1 = inParallel;
+
+      inParallel = true;
+
+      placeNode(hierInds[size_t(i)]);
+
+      inParallel = inParallel1;
+    });
+  }
+  else {
+    for (int i = 0; i < n; ++i)
+      placeNode(i);
+  }
+}
+
+void
+CQChartsTreeMapHierNode::
+initSortedNodes() const
+{
+  if (layoutData_.sortValid)
+    return;
+
+  auto &nodes = layoutData_.nodes;
+
+  nodes.clear();
 
   for (const auto &child : children_)
     nodes.push_back(child);
@@ -2226,62 +2721,43 @@ packNodes(double x, double y, double w, double h)
   //for (uint i = 0; i < nodes.size(); ++i)
   //  std::cerr << " " << nodes[i]->name() << ":" << nodes[i]->hierSize() << "\n";
 
-  packSubNodes(x + m/2, y + m/2, w - m, h - dh - m, nodes);
+  // prefix sums (sums[i] = size of nodes [0, i))
+  auto &sums = layoutData_.sums;
+
+  sums.resize(nodes.size() + 1);
+
+  sums[0] = 0.0;
+
+  for (size_t i = 0; i < nodes.size(); ++i)
+    sums[i + 1] = sums[i] + nodes[i]->hierSize();
+
+  layoutData_.sortValid  = true;
+  layoutData_.placeValid = false;
 }
 
 void
 CQChartsTreeMapHierNode::
-packSubNodes(double x, double y, double w, double h, const Nodes &nodes)
+packSubNodes(double x, double y, double w, double h, int i1, int i2, BBoxes &rects) const
 {
-  // place nodes
-  auto n = nodes.size();
-  if (n == 0) return;
+  // place nodes [i1, i2)
+  int n = i2 - i1;
+  if (n <= 0) return;
 
   if (n >= 2) {
-    Nodes  nodes1, nodes2;
-    double size1 = 0.0, size2 = 0.0;
-
-#if 1
-    double size12 = 0.0;
+    const auto &sums = layoutData_.sums;
 
-    for (size_t i = 0; i < n; ++i)
-      size12 += nodes[i]->hierSize();
+    double size12 = sums[size_t(i2)] - sums[size_t(i1)];
 
     double hsize = size12/2;
 
-    size_t i = 0;
-
-    for ( ; i < n - 1; ++i) {
-      if (size1 > hsize)
-        break;
-
-      size1 += nodes[i]->hierSize();
-
-      nodes1.push_back(nodes[i]);
-    }
-
-    for ( ; i < n; ++i) {
-      size2 += nodes[i]->hierSize();
-
-      nodes2.push_back(nodes[i]);
-    }
-#else
-    int n1 = n/2;
-
-    for (int i = 0; i < n1; ++i) {
-      size1 += nodes[i]->hierSize();
+    // split after first node where accumulated size exceeds half (keep at least one
+    // node in second half)
+    auto pe = sums.begin() + i2;
+    auto p  = std::upper_bound(sums.begin() + i1 + 1, pe, sums[size_t(i1)] + hsize);
 
-      nodes1.push_back(nodes[i]);
-    }
-
-    for (int i = n1; i <  n; ++i) {
-      size2 += nodes[i]->hierSize();
+    int is = std::min(int(p - sums.begin()), i2 - 1);
 
-      nodes2.push_back(nodes[i]);
-    }
-
-    double size12 = size1 + size2;
-#endif
+    double size1 = sums[size_t(is)] - sums[size_t(i1)];
 
     // split area = (w*h) if largest direction
     // e.g. split at w1. area1 = w1*h; area2 = (w - w1)*h;
@@ -2292,27 +2768,25 @@ packSubNodes(double x, double y, double w, double h, const Nodes &nodes)
     if (size12 == 0.0)
       return;
 
-    assert(nodes1.size() > 0 && nodes2.size() > 0);
+    assert(is > i1 && is < i2);
 
     double f = size1/size12;
 
     if (w >= h) {
       double w1 = f*w;
 
-      packSubNodes(x     , y,     w1, h, nodes1);
-      packSubNodes(x + w1, y, w - w1, h, nodes2);
+      packSubNodes(x     , y,     w1, h, i1, is, rects);
+      packSubNodes(x + w1, y, w - w1, h, is, i2, rects);
     }
     else {
       double h1 = f*h;
 
-      packSubNodes(x, y     , w, h1    , nodes1);
-      packSubNodes(x, y + h1, w, h - h1, nodes2);
+      packSubNodes(x, y     , w, h1    , i1, is, rects);
+      packSubNodes(x, y + h1, w, h - h1, is, i2, rects);
     }
   }
   else {
-    auto *node = nodes[0];
-
-    node->setPosition(x, y, w, h);
+    rects[size_t(i1)] = BBox(x, y, x + w, y + h);
   }
 }
 
@@ -2330,6 +2804,8 @@ CQChartsTreeMapHierNode::
 addNode(Node *node)
 {
   nodes_.push_back(node);
+
+  invalidateLayout();
 }
 
 void
@@ -2353,6 +2829,8 @@ removeNode(Node *node)
     nodes_[i - 1] = nodes_[i];
 
   nodes_.pop_back();
+
+  invalidateLayout();
 }
 
 QColor
@@ -2384,6 +2862,16 @@ CQChartsTreeMapNode(const Plot *plot, HierNode *parent, const QString &name, dou
 {
 }
 
+void
+CQChartsTreeMapNode::
+setSize(double s)
+{
+  size_ = s;
+
+  if (parent_)
+    parent_->invalidateLayout();
+}
+
 QString
 CQChartsTreeMapNode::
 hierName(QChar sep) const
@@ -9,6 +9,7 @@
 #include <CQChartsTitle.h>
 #include <CQChartsPlotObj.h>
 #include <CQChartsAnnotation.h>
+#include <CQChartsAnnotationTree.h>
 #include <CQChartsModelData.h>
 #include <CQChartsViewGLWidget.h>
 #include <CQCharts.h>
@@ -55,6 +56,7 @@
 #include <QMenu>
 
 #include <fstream>
+#include <algorithm>
 
 //---
 
@@ -119,6 +121,8 @@ init()
 
   displayRange_ = std::make_unique<CQChartsDisplayRange>();
 
+  annotationTree_ = std::make_unique<CQChartsAnnotationTree>();
+
   double vr = viewportRange();
 
   displayRange_->setWindowRange(0, 0, vr, vr);
@@ -1734,6 +1738,8 @@ addAnnotationI(Annotation *annotation)
 {
   annotations_.push_back(annotation);
 
+  annotationTree_->addAnnotation(annotation);
+
   connect(annotation, SIGNAL(idChanged()), this, SLOT(updateAnnotationSlot()));
   connect(annotation, SIGNAL(dataChanged()), this, SLOT(updateAnnotationSlot()));
 
@@ -1787,6 +1793,8 @@ raiseAnnotation(Annotation *annotation)
   if (pos < np - 1)
     std::swap(annotations_[size_t(pos + 1)], annotations_[size_t(pos)]);
 
+  annotationTree_->setOrder(annotations_);
+
   doUpdate();
 
   emit annotationsReordered();
@@ -1805,6 +1813,8 @@ lowerAnnotation(Annotation *annotation)
   if (pos > 0)
     std::swap(annotations_[size_t(pos - 1)], annotations_[size_t(pos)]);
 
+  annotationTree_->setOrder(annotations_);
+
   doUpdate();
 
   emit annotationsReordered();
@@ -1841,6 +1851,11 @@ removeAnnotation(Annotation *annotation)
 
   assert(pos >= 0 && pos < n);
 
+  annotationTree_->removeAnnotation(annotation);
+
+  insideAnnotations_.erase(std::remove(insideAnnotations_.begin(), insideAnnotations_.end(),
+                           annotation), insideAnnotations_.end());
+
   delete annotation;
 
   for (int i = pos + 1; i < n; ++i)
@@ -1861,6 +1876,10 @@ void
 CQChartsView::
 removeAllAnnotations()
 {
+  annotationTree_->clear();
+
+  insideAnnotations_.clear();
+
   for (auto &annotation : annotations_)
     delete annotation;
 
@@ -2726,6 +2745,21 @@ interpColor(const CQChartsColor &c, const ColorInd &ind) const
   return charts()->interpColor(c, ind);
 }
 
+bool
+CQChartsView::
+interpColorValues(const CQChartsColor &c, const std::vector<double> &values,
+                  std::vector<QRgb> &rgbs) const
+{
+  auto c1 = c;
+
+  if (defaultPalette_ != "")
+    c1 = charts()->adjustDefaultPalette(c, defaultPalette_);
+
+  rgbs.resize(values.size());
+
+  return charts()->interpColorValues(c1, values.data(), int(values.size()), rgbs.data());
+}
+
 //------
 
 void
@@ -4764,7 +4798,7 @@ updateSeparators()
 
 void
 CQChartsView::
-paintEvent(QPaintEvent *)
+paintEvent(QPaintEvent *e)
 {
   if (is3D())
     return;
@@ -4778,10 +4812,26 @@ paintEvent(QPaintEvent *)
 
   lockPainter(true);
 
-  paint(ipainter_);
+  // recomposite only the damaged part of the image (e.g. single plot update)
+  auto region = e->region().translated(sizeData_.xpos, sizeData_.ypos);
+
+  // (QRegion::contains(QRect) is true for any overlap so check region covers image)
+  if (QRegion(image_->rect()).subtracted(region).isEmpty())
+    paint(ipainter_);
+  else {
+    ipainter_->save();
+
+    ipainter_->setClipRegion(region);
+
+    paint(ipainter_, nullptr, region);
+
+    ipainter_->restore();
+  }
 
   QPainter painter(this);
 
+  painter.setClipRegion(e->region());
+
   painter.drawImage(-sizeData_.xpos, -sizeData_.ypos, *image_);
 
   lockPainter(false);
@@ -4789,7 +4839,7 @@ paintEvent(QPaintEvent *)
 
 void
 CQChartsView::
-paint(QPainter *painter, Plot *plot)
+paint(QPainter *painter, Plot *plot, const QRegion &region)
 {
   if (isAntiAlias())
     painter->setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
@@ -4809,7 +4859,7 @@ paint(QPainter *painter, Plot *plot)
   }
   // draw all plots
   else {
-    drawPlots(painter);
+    drawPlots(painter, region);
   }
 }
 
@@ -4838,7 +4888,7 @@ drawBackground(PaintDevice *device) const
 
 void
 CQChartsView::
-drawPlots(QPainter *painter)
+drawPlots(QPainter *painter, const QRegion &region)
 {
   bool hasPlots         = ! plots().empty();
   bool hasBgAnnotations = this->hasAnnotations(Layer::Type::BG_ANNOTATION);
@@ -4850,7 +4900,7 @@ drawPlots(QPainter *painter)
   if (! hasPlots && ! hasBgAnnotations && ! hasFgAnnotations && ! isPreview()) {
     showNoData(true);
 
-    auto *painter1 = bgBuffer_->beginPaint(painter, rect());
+    auto *painter1 = bgBuffer_->beginPaint(painter, prect().qrect());
 
     if (painter1) {
       auto *th = const_cast<CQChartsView *>(this);
@@ -4871,7 +4921,7 @@ drawPlots(QPainter *painter)
 
   // draw bg annotations
   if (hasBgAnnotations) {
-    auto *painter1 = bgBuffer_->beginPaint(painter, rect());
+    auto *painter1 = bgBuffer_->beginPaint(painter, prect().qrect());
 
     if (painter1) {
       auto *th = const_cast<CQChartsView *>(this);
@@ -4894,8 +4944,18 @@ drawPlots(QPainter *painter)
     getDrawPlots(drawPlots);
 
     for (const auto &plot : drawPlots) {
-      if (plot->isVisible())
-        plot->draw(painter);
+      if (! plot->isVisible())
+        continue;
+
+      // skip plots outside partial update region
+      if (! region.isEmpty()) {
+        auto prect = plot->calcBufferPixelRect().qrect().toAlignedRect();
+
+        if (! region.intersects(prect))
+          continue;
+      }
+
+      plot->draw(painter);
     }
   }
 
@@ -4903,7 +4963,7 @@ drawPlots(QPainter *painter)
 
   // draw fg annotations and key
   if (hasFgAnnotations || hasPlots) {
-    auto *painter1 = fgBuffer_->beginPaint(painter, rect());
+    auto *painter1 = fgBuffer_->beginPaint(painter, prect().qrect());
 
     if (painter1) {
       auto *th = const_cast<CQChartsView *>(this);
@@ -4935,7 +4995,7 @@ void
 CQChartsView::
 drawOverlay(QPainter *painter)
 {
-  auto *painter1 = overlayBuffer_->beginPaint(painter, rect());
+  auto *painter1 = overlayBuffer_->beginPaint(painter, prect().qrect());
 
   if (painter1) {
     bool hasBgAnnotations = this->hasAnnotations(Layer::Type::BG_ANNOTATION);
@@ -5228,7 +5288,17 @@ drawAnnotations(PaintDevice *device, const CQChartsLayer::Type &layerType)
   // set draw layer
   setDrawLayerType(layerType);
 
-  for (auto &annotation : annotations()) {
+  // cull annotation layers to annotations touching view
+  checkAnnotationTree();
+
+  Annotations annotations1;
+
+  if (layerType == Layer::Type::BG_ANNOTATION || layerType == Layer::Type::FG_ANNOTATION)
+    annotationTree_->annotationsTouchingRect(pixelToWindow(prect_), annotations1);
+  else
+    annotations1 = annotations();
+
+  for (auto &annotation : annotations1) {
     if      (layerType == CQChartsLayer::Type::SELECTION) {
       if (! annotation->isSelected())
         continue;
@@ -5279,6 +5349,27 @@ drawKey(PaintDevice *device, const CQChartsLayer::Type &layerType)
   }
 }
 
+namespace {
+
+// plots draw their layers on their own threads so current draw layer is per thread
+thread_local CQChartsLayer::Type s_drawLayerType = CQChartsLayer::Type::NONE;
+
+}
+
+const CQChartsLayer::Type &
+CQChartsView::
+drawLayerType() const
+{
+  return s_drawLayerType;
+}
+
+void
+CQChartsView::
+setDrawLayerType(const Layer::Type &t)
+{
+  s_drawLayerType = t;
+}
+
 bool
 CQChartsView::
 lockPainter(bool lock)
@@ -5668,6 +5759,18 @@ doUpdate()
   update();
 }
 
+void
+CQChartsView::
+doUpdatePlot(Plot *plot)
+{
+  auto rect = plot->calcBufferPixelRect().qrect().toAlignedRect();
+
+  if (rect.isEmpty())
+    return update();
+
+  update(rect.adjusted(-1, -1, 1, 1).translated(-sizeData_.xpos, -sizeData_.ypos));
+}
+
 //------
 
 void
@@ -5723,18 +5826,35 @@ searchAt(const Point &w)
 
   //---
 
+  // update inside state of annotations at point and previous inside annotations
+  Annotations insideAnnotations;
+
+  annotationsAtPoint(w, insideAnnotations);
+
   bool changed = false;
 
-  for (auto &annotation : annotations()) {
-    bool inside = annotation->contains(w);
+  for (auto &annotation : insideAnnotations_) {
+    if (std::find(insideAnnotations.begin(), insideAnnotations.end(), annotation) !=
+          insideAnnotations.end())
+      continue;
 
-    if (inside != annotation->isInside()) {
-      annotation->setInside(inside);
+    if (annotation->isInside()) {
+      annotation->setInside(false);
 
       changed = true;
     }
   }
 
+  for (auto &annotation : insideAnnotations) {
+    if (! annotation->isInside()) {
+      annotation->setInside(true);
+
+      changed = true;
+    }
+  }
+
+  insideAnnotations_ = insideAnnotations;
+
   if (changed) {
     invalidateOverlay();
 
@@ -5750,7 +5870,15 @@ annotationsAtPoint(const Point &w, Annotations &annotations) const
 {
   annotations.clear();
 
-  for (const auto &annotation : this->annotations()) {
+  // candidates from bbox tree (tolerance for line hit test)
+  checkAnnotationTree();
+
+  Annotations annotations1;
+
+  annotationTree_->annotationsAtPoint(w, pixelToWindowWidth(4), pixelToWindowHeight(4),
+                                      annotations1);
+
+  for (const auto &annotation : annotations1) {
     if (! annotation->contains(w))
       continue;
 
@@ -5758,6 +5886,15 @@ annotationsAtPoint(const Point &w, Annotations &annotations) const
   }
 }
 
+void
+CQChartsView::
+checkAnnotationTree() const
+{
+  // annotations sized or positioned in pixels move when pixel mapping changes
+  // (only these are unindexed, annotations in parent coords stay indexed)
+  annotationTree_->checkMapping(pixelToWindow(BBox(0, 0, 100, 100)));
+}
+
 //------
 
 void
@@ -7019,15 +7156,24 @@ bool
 CQChartsView::
 printPNG(const QString &filename, Plot *plot)
 {
-  int w = width ();
-  int h = height();
+  auto image = renderImage(QSize(width(), height()), plot);
+
+  if (image.isNull())
+    return false;
+
+  return image.save(filename);
+}
 
-  auto image = CQChartsUtil::initImage(QSize(w, h));
+QImage
+CQChartsView::
+renderImage(const QSize &size, Plot *plot)
+{
+  auto image = CQChartsUtil::initImage(size);
 
   QPainter painter;
 
   if (! painter.begin(&image))
-    return false;
+    return QImage();
 
   paint(&painter, plot);
 
@@ -7039,7 +7185,7 @@ printPNG(const QString &filename, Plot *plot)
     image = image.copy(pixelRect.qrecti());
   }
 
-  return image.save(filename);
+  return image;
 }
 
 bool
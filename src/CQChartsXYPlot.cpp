@@ -701,6 +701,8 @@ addProperties()
 
   addSymbolProperties("points/symbol", "", "Points");
 
+  declareObjSymbolStages(""); // point style only drawn by objects
+
   // data labels
   addProp("points", "adjustText", "adjustText", "Adjust text placement");
 
@@ -6,6 +6,7 @@
 #include <CQCharts.h>
 #include <CQChartsWindow.h>
 #include <CQChartsView.h>
+#include <CQChartsBatchPrint.h>
 #include <CQChartsPlot.h>
 #include <CQChartsPlotType.h>
 #include <CQChartsCompositePlot.h>
@@ -29,6 +30,7 @@
 #include <CQChartsSVGUtil.h>
 #include <CQChartsFile.h>
 #include <CQChartsPointPlot.h>
+#include <CQChartsTextCache.h>
 
 #include <CQChartsLoadModelDlg.h>
 #include <CQChartsManageModelsDlg.h>
@@ -127,10 +129,12 @@ addCommands()
     // define charts tcl proc
     addCommand("define_charts_proc", new CQChartsDefineChartsProcCmd(this));
 
-    // correlation, bucket, folded, subset, transpose, summary, collapse, pivot, stats,
-    // data, fractal
+    // correlation, cluster, bucket, folded, subset, transpose, summary, collapse, pivot,
+    // stats, data, fractal
     addCommand("create_charts_correlation_model",
                new CQChartsCreateChartsCorrelationModelCmd(this));
+    addCommand("create_charts_cluster_model"    ,
+               new CQChartsCreateChartsClusterModelCmd    (this));
     addCommand("create_charts_bucket_model"     ,
                new CQChartsCreateChartsBucketModelCmd     (this));
     addCommand("create_charts_folded_model"     ,
@@ -239,8 +243,9 @@ addCommands()
     addCommand("connect_charts_signal", new CQChartsConnectChartsSignalCmd(this));
 
     // print, write
-    addCommand("print_charts_image", new CQChartsPrintChartsImageCmd(this));
-    addCommand("write_charts_data" , new CQChartsWriteChartsDataCmd(this));
+    addCommand("print_charts_image" , new CQChartsPrintChartsImageCmd (this));
+    addCommand("print_charts_images", new CQChartsPrintChartsImagesCmd(this));
+    addCommand("write_charts_data"  , new CQChartsWriteChartsDataCmd  (this));
     addCommand("write_charts_stats", new CQChartsWriteChartsStatsCmd(this));
 
     // measure/encode text
@@ -4815,6 +4820,102 @@ execCmd(CQChartsCmdArgs &argv)
 
 //------
 
+void
+CQChartsCreateChartsClusterModelCmd::
+addCmdArgs(CQChartsCmdArgs &argv)
+{
+  addArg(argv, "-model"      , ArgType::String , "model_id");
+  addArg(argv, "-columns"    , ArgType::String , "columns to cluster");
+  addArg(argv, "-name_column", ArgType::Column , "row name column");
+  addArg(argv, "-linkage"    , ArgType::String , "linkage (ward, average, complete, single)");
+  addArg(argv, "-normalize"  , ArgType::Boolean, "normalize column values");
+  addArg(argv, "-max_memory" , ArgType::Integer, "max distance matrix memory (MB)");
+}
+
+QStringList
+CQChartsCreateChartsClusterModelCmd::
+getArgValues(const QString &arg, const NameValueMap &)
+{
+  if      (arg == "model"  ) return cmds()->modelArgValues();
+  else if (arg == "linkage") return QStringList() << "ward" << "average" << "complete" << "single";
+
+  return QStringList();
+}
+
+bool
+CQChartsCreateChartsClusterModelCmd::
+execCmd(CQChartsCmdArgs &argv)
+{
+  auto errorMsg = [&](const QString &msg) {
+    charts()->errorMsg(msg);
+    return false;
+  };
+
+  //---
+
+  CQPerfTrace trace("CQChartsCreateChartsClusterModelCmd::exec");
+
+  addArgs(argv);
+
+  bool rc;
+
+  if (! argv.parse(rc))
+    return rc;
+
+  //---
+
+  // get model
+  auto modelId = argv.getParseStr("model");
+
+  auto *modelData = cmds()->getModelDataOrCurrent(modelId);
+  if (! modelData) return errorMsg("No model data for '" + modelId + "'");
+
+  auto model = modelData->currentModel();
+
+  //---
+
+  CQChartsLoader::ClusterData clusterData;
+
+  if (argv.hasParseArg("columns")) {
+    auto columnsStr = argv.getParseStr("columns");
+
+    CQChartsCmds::Columns columns;
+
+    if (! cmds()->stringToModelColumns(model, columnsStr, columns))
+      return false;
+
+    clusterData.columns = columns;
+  }
+
+  if (argv.hasParseArg("name_column"))
+    clusterData.nameColumn = argv.getParseColumn("name_column", model.data());
+
+  if (argv.hasParseArg("linkage"))
+    clusterData.linkage = argv.getParseStr("linkage");
+
+  clusterData.normalize = argv.getParseBool("normalize");
+
+  if (argv.hasParseArg("max_memory"))
+    clusterData.maxMemory = argv.getParseInt("max_memory");
+
+  //---
+
+  CQChartsLoader loader(charts());
+
+  auto *clusterModel = loader.createClusterModel(model.data(), clusterData);
+  if (! clusterModel) return false;
+
+  CQChartsCmds::ModelP clusterModelP(clusterModel);
+
+  auto *modelData1 = charts()->initModelData(clusterModelP);
+
+  //---
+
+  return cmdBase_->setCmdRc(modelData1->id());
+}
+
+//------
+
 void
 CQChartsCreateChartsFoldedModelCmd::
 addCmdArgs(CQChartsCmdArgs &argv)
@@ -6235,7 +6336,8 @@ getArgValues(const QString &arg, const NameValueMap &nameValues)
        "model" << "view" << "value" << "map" << "annotations" << "objects" <<
        "selected_objects" << "inds" << "plot_width" << "plot_height" << "pixel_width" <<
        "pixel_height" << "pixel_position" << "properties" << "set_hidden" << "errors" <<
-       "color_filter" << "symbol_type_filter" << "symbol_size_filter";
+       "color_filter" << "symbol_type_filter" << "symbol_size_filter" << "stage_trace" <<
+       "stage_counts" << "property_stages";
       return names;
     }
     else if (hasAnnotation) {
@@ -6247,7 +6349,8 @@ getArgValues(const QString &arg, const NameValueMap &nameValues)
        "models" << "views" << "plot_types" << "plots" << "annotations" << "current_model" <<
        "column_types" << "column_type.names" << "column_type.descs" << "annotation_types" <<
        "symbols" << "procs" << "proc_data" << "role_names" << "path_list" << "view_key" <<
-       "max_symbol_size" << "max_font_size" << "max_line_width" << "pattern_names";
+       "max_symbol_size" << "max_font_size" << "max_line_width" << "pattern_names" <<
+       "text_cache_stats";
       return names;
     }
   }
@@ -7020,6 +7123,47 @@ execCmd(CQChartsCmdArgs &argv)
 
       return cmdBase_->setCmdRc(vars);
     }
+    // property change update stages
+    else if (name == "stage_trace") {
+      QVariantList vars;
+
+      for (const auto &entry : plot->stageTrace()) {
+        QVariantList vars1;
+
+        vars1 << entry.name;
+        vars1 << CQChartsPlotStage::toString(entry.declared);
+        vars1 << CQChartsPlotStage::toString(entry.requested);
+        vars1 << CQChartsPlotStage::toString(entry.applied);
+
+        vars.push_back(vars1);
+      }
+
+      return cmdBase_->setCmdRc(vars);
+    }
+    else if (name == "stage_counts") {
+      QVariantList vars;
+
+      for (int i = 0; i < CQChartsPlotStage::NUM_STAGES; ++i) {
+        auto stage = CQChartsPlotStage::Stage(1U<<i);
+
+        QVariantList vars1;
+
+        vars1 << CQChartsPlotStage::stageName(i);
+        vars1 << plot->stageCount(stage);
+
+        vars.push_back(vars1);
+      }
+
+      return cmdBase_->setCmdRc(vars);
+    }
+    else if (name == "property_stages") {
+      auto data = argv.getParseStr("data");
+
+      if (! data.length())
+        return cmdBase_->setCmdRc(plot->stageGraph().names());
+
+      return cmdBase_->setCmdRc(CQChartsPlotStage::toString(plot->propertyStages(data)));
+    }
     else if (name == "selected_objects") {
       CQChartsPlot::PlotObjs objs;
 
@@ -7354,6 +7498,21 @@ execCmd(CQChartsCmdArgs &argv)
     else if (name == "pattern_names") {
       return cmdBase_->setCmdRc(CQChartsFillPattern().enumNames());
     }
+    else if (name == "text_cache_stats") {
+      auto stats = CQChartsTextCacheInst->stats();
+
+      QVariantList vars;
+
+      vars << "hits"       << qlonglong(stats.hits);
+      vars << "misses"     << qlonglong(stats.misses);
+      vars << "hit_rate"   << stats.hitRate();
+      vars << "miss_time"  << stats.missTime;
+      vars << "saved_time" << stats.savedTime;
+      vars << "fonts"      << stats.numFonts;
+      vars << "values"     << qlonglong(stats.numValues);
+
+      return cmdBase_->setCmdRc(vars);
+    }
     else if (name == "?") {
       NameValueMap nameValues;
 
@@ -7739,11 +7898,32 @@ execCmd(CQChartsCmdArgs &argv)
       if (pointPlot && CQTcl::splitList(value, strs))
         pointPlot->setSymbolSizeFilterNames(strs);
     }
+    // property change update stages
+    else if (name == "stage_trace") {
+      bool ok;
+
+      bool b = CQChartsCmdBaseArgs::stringToBool(value, &ok);
+      if (! ok) return errorMsg("Invalid stage_trace value '" + value + "'");
+
+      plot->setStageTrace(b);
+    }
+    else if (name == "property_stages") {
+      auto data = argv.getParseStr("data");
+      if (! data.length()) return errorMsg("Missing property name");
+
+      bool ok;
+
+      auto stages = CQChartsPlotStage::fromString(value, ok);
+      if (! ok) return errorMsg("Invalid stages '" + value + "' specified");
+
+      plot->declarePropertyStages(data, stages);
+    }
     // plot object property
     else if (name == "?") {
       static auto names = QStringList() << "fit" << "zoom_full" << "updates_enabled" <<
         "set_hidden" << "select" << "model" << "tick_label" <<
-        "color_filter" << "symbol_type_filter" << "symbol_size_filter";
+        "color_filter" << "symbol_type_filter" << "symbol_size_filter" <<
+        "stage_trace" << "property_stages";
       return cmdBase_->setCmdRc(names);
     }
     else
@@ -7823,9 +8003,20 @@ execCmd(CQChartsCmdArgs &argv)
 
       charts->setMaxLineWidth(r);
     }
+    else if (name == "text_cache") {
+      bool ok;
+      bool b = CQChartsUtil::stringToBool(value, &ok);
+
+      CQChartsTextCacheInst->setEnabled(b);
+    }
+    else if (name == "reset_text_cache") {
+      CQChartsTextCacheInst->clear();
+      CQChartsTextCacheInst->resetStats();
+    }
     else if (name == "?") {
       static auto names = QStringList() << "path_list" << "view_key" <<
-        "max_symbol_size" << "max_font_size" << "max_line_width";
+        "max_symbol_size" << "max_font_size" << "max_line_width" << "text_cache" <<
+        "reset_text_cache";
       return cmdBase_->setCmdRc(names);
     }
     else
@@ -11910,6 +12101,125 @@ execCmd(CQChartsCmdArgs &argv)
 
 //------
 
+void
+CQChartsPrintChartsImagesCmd::
+addCmdArgs(CQChartsCmdArgs &argv)
+{
+  addArg(argv, "-jobs", ArgType::String,
+         "list of jobs (name value list of view, plot, file, size and format)").setRequired();
+}
+
+QStringList
+CQChartsPrintChartsImagesCmd::
+getArgValues(const QString &, const NameValueMap &)
+{
+  return QStringList();
+}
+
+bool
+CQChartsPrintChartsImagesCmd::
+execCmd(CQChartsCmdArgs &argv)
+{
+  auto errorMsg = [&](const QString &msg) {
+    charts()->errorMsg(msg);
+    return false;
+  };
+
+  //---
+
+  CQPerfTrace trace("CQChartsPrintChartsImagesCmd::exec");
+
+  addArgs(argv);
+
+  bool rc;
+
+  if (! argv.parse(rc))
+    return rc;
+
+  //---
+
+  CQChartsBatchPrint batchPrint;
+
+  auto jobsStr = argv.getParseStr("jobs");
+
+  QStringList jobStrs;
+
+  if (! CQTcl::splitList(jobsStr, jobStrs))
+    return errorMsg("Invalid jobs '" + jobsStr + "'");
+
+  for (const auto &jobStr : jobStrs) {
+    QStringList nameValueStrs;
+
+    if (! CQTcl::splitList(jobStr, nameValueStrs) || nameValueStrs.length() % 2 != 0)
+      return errorMsg("Invalid job '" + jobStr + "'");
+
+    CQChartsBatchPrint::Job job;
+
+    for (int i = 0; i < nameValueStrs.length(); i += 2) {
+      const auto &name  = nameValueStrs[i];
+      const auto &value = nameValueStrs[i + 1];
+
+      if      (name == "view") {
+        job.view = cmds()->getViewByName(value);
+        if (! job.view) return false;
+      }
+      else if (name == "plot") {
+        job.plot = cmds()->getPlotByName(nullptr, value);
+        if (! job.plot) return false;
+      }
+      else if (name == "file") {
+        job.filename = value;
+      }
+      else if (name == "size") {
+        QStringList sizeStrs;
+
+        bool ok1 = false, ok2 = false;
+
+        if (CQTcl::splitList(value, sizeStrs) && sizeStrs.length() == 2)
+          job.size = QSize(sizeStrs[0].toInt(&ok1), sizeStrs[1].toInt(&ok2));
+
+        if (! ok1 || ! ok2)
+          return errorMsg("Invalid size '" + value + "'");
+      }
+      else if (name == "format") {
+        job.format = value;
+      }
+      else
+        return errorMsg("Invalid job name '" + name + "'");
+    }
+
+    if (! job.view && ! job.plot)
+      return errorMsg("No view or plot for job '" + jobStr + "'");
+
+    if (! job.filename.length())
+      return errorMsg("No file for job '" + jobStr + "'");
+
+    batchPrint.addJob(job);
+  }
+
+  //---
+
+  if (! batchPrint.exec())
+    charts()->errorMsg("Failed to print some images");
+
+  // return stats
+  const auto &stats = batchPrint.stats();
+
+  QVariantList vars;
+
+  vars << "images"            << stats.numImages;
+  vars << "failed"            << stats.numFailed;
+  vars << "layout_time"       << stats.layoutTime;
+  vars << "render_time"       << stats.renderTime;
+  vars << "write_time"        << stats.writeTime;
+  vars << "total_time"        << stats.totalTime;
+  vars << "images_per_second" << stats.imagesPerSecond();
+
+  return cmdBase_->setCmdRc(vars);
+}
+
+//------
+
 void
 CQChartsWriteChartsDataCmd::
 addCmdArgs(CQChartsCmdArgs &argv)
@@ -241,6 +241,7 @@ CQCHARTS_DEF_CMD(DefineChartsProc)
 
 // derived model
 CQCHARTS_DEF_CMD(CreateChartsCorrelationModel)
+CQCHARTS_DEF_CMD(CreateChartsClusterModel)
 CQCHARTS_DEF_CMD(CreateChartsFoldedModel)
 CQCHARTS_DEF_CMD(CreateChartsBucketModel)
 CQCHARTS_DEF_CMD(CreateChartsSubsetModel)
@@ -335,6 +336,7 @@ CQCHARTS_DEF_CMD(ConnectChartsSignal)
 
 // export
 CQCHARTS_DEF_CMD(PrintChartsImage)
+CQCHARTS_DEF_CMD(PrintChartsImages)
 CQCHARTS_DEF_CMD(WriteChartsData)
 CQCHARTS_DEF_CMD(WriteChartsStats)
 